@@ -365,6 +365,7 @@ static void c65_init ( int sid_cycles_per_sec, int sound_mix_freq )
 		XEMUEXIT(1);
 	// Initialize FDC
 	fdc_init(disk_cache);
+	fdc_set_timing_mode(configdb.fdctiming);
 	// Initialize D81 access abstraction for FDC
 	d81access_init();
 	atexit(d81access_close_all);
@@ -898,6 +899,8 @@ static void emulation_loop ( void )
 			int exit_loop = 0;
 			cia_tick(&cia1, 64);
 			cia_tick(&cia2, 64);
+			if (XEMU_UNLIKELY(configdb.fdctiming))
+				fdc_tick(64);
 			cycles -= cpu_cycles_per_scanline;
 			if (XEMU_UNLIKELY(vic3_render_scanline())) {
 				if (XEMU_UNLIKELY(inject_ready_check_status))
@@ -23,7 +23,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 /* Do *NOT* modify these, as other parts of the emulator currently depends on these values ...
    You can try RENDER_SCALE_QUALITY though with values 0, 1, 2 */
 #define SCREEN_FORMAT           SDL_PIXELFORMAT_ARGB8888
-#define USE_LOCKED_TEXTURE	1
+#define USE_LOCKED_TEXTURE	0	// own pixel buffer: only the changed rows are uploaded to the texture, see xemu_update_screen()
 #define RENDER_SCALE_QUALITY	0
 
 #define FAST_CPU_CYCLES_PER_SCANLINE	227
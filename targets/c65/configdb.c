@@ -63,7 +63,8 @@ void configdb_define_emulator_options ( void )
 	XEMUCFG_DEFINE_NUM_OPTIONS(
 		{ "sdlrenderquality", RENDER_SCALE_QUALITY, "Setting SDL hint for scaling method/quality on rendering (0, 1, 2)", &configdb.sdlrenderquality, 0, 2 },
 		{ "dmarev", 2, "Revision of the DMAgic chip (0/1=F018A/B, 2=rom_auto, +512=modulo))", &configdb.dmarev, 0, 1000 },
-		{ "prgmode", 0, "Override auto-detect option for -prg (64 or 65 for C64/C65 modes, 0 = default, auto detect)", &configdb.prgmode, 0, 65 }
+		{ "prgmode", 0, "Override auto-detect option for -prg (64 or 65 for C64/C65 modes, 0 = default, auto detect)", &configdb.prgmode, 0, 65 },
+		{ "fdctiming", 0, "F011 floppy timing (0 = instant, 1 = accurate step/rotational latency, 2 = turbo: accurate, except sequential reads are instant)", &configdb.fdctiming, 0, 2 }
 	);
 	static const void *do_not_save_opts[] = { &configdb.prg, &configdb.go64, &configdb.autoload, NULL };
 	xemucfg_add_flags_to_options(do_not_save_opts, XEMUCFG_FLAG_NO_SAVE);
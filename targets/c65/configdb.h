@@ -32,7 +32,7 @@ struct configdb_st {
 	char	*hostfsdir, *rom, *keymap, *gui, *dumpmem;
 	char	*snapload, *snapsave, *prg;
 	int	d81ro, fullscreen, go64, autoload, syscon;
-	int	sdlrenderquality, dmarev, prgmode;
+	int	sdlrenderquality, dmarev, prgmode, fdctiming;
 };
 
 extern struct configdb_st configdb;
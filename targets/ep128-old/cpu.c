@@ -78,19 +78,19 @@ void set_ep_cpu ( int type )
 		case CPU_Z80:
 			z80ex.nmos = 1;
 #ifdef CONFIG_Z180
-			z80ex.z180 = 0;
+			z80ex_set_z180(0);
 #endif
 			break;
 		case CPU_Z80C:
 			z80ex.nmos = 0;
 #ifdef CONFIG_Z180
-			z80ex.z180 = 0;
+			z80ex_set_z180(0);
 #endif
 			break;
 #ifdef CONFIG_Z180
 		case CPU_Z180:
 			z80ex.nmos = 0;
-			z80ex.z180 = 1;
+			z80ex_set_z180(1);
 			z180_port_start = 0;
 			break;
 #endif
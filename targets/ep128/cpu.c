@@ -45,6 +45,15 @@ Uint8 ports[0x100] VARALIGN;
 const char *memory_segment_map[0x100];
 static Uint8 is_ram_seg[0x100] VARALIGN;
 static int mem_ws_all, mem_ws_m1;
+// Per Z80 page (4*16K) memory access descriptors, rebuilt by ep_update_memory_map() when anything
+// affecting memory decoding changes. The rd/wr pointers are biased by the page base address, so
+// they can be indexed directly by the Z80 address. NULL means that the slow path must be used
+// (VRAM because of Nick clock alignment, SDEXT cartridge area, writes to non-RAM segments).
+static struct {
+	Uint8 *rd, *wr;
+	Uint8 rd_ws[2];	// memory wait states for read, indexed by the M1 state
+	Uint8 wr_ws;	// memory wait states for write
+} pagemap[4] VARALIGN;
 int nmi_pending = 0;
 int CPU_CLOCK = DEFAULT_CPU_CLOCK;
 
@@ -60,7 +69,8 @@ char *mem_desc = NULL;
 
 
 // TODO: this should be written ... it's called when VRAM access, or $80...$8F I/O ports are accessed
-#define nick_clock_align()
+// Currently it only makes Nick to render the already due (deferred) part of the current line.
+#define nick_clock_align() nick_sync()
 
 
 
@@ -68,6 +78,27 @@ void xep_rom_write_support ( int towrite )
 {
 	if (xep_rom_seg > 0) {
 		is_ram_seg[xep_rom_seg] = towrite;
+		ep_update_memory_map();
+	}
+}
+
+
+void ep_update_memory_map ( void )
+{
+	for (int page = 0; page < 4; page++) {
+		const int phys = memsegs[page] + (page << 14);	// physical address of the segment
+		const int ws_all = mem_ws_all ? mem_wait_states : 0;
+		const int ws_m1 = (mem_ws_all || mem_ws_m1) ? mem_wait_states : 0;
+		int slow = (phys >= 0x3F0000);	// VRAM: Nick clock alignment is needed
+#ifdef CONFIG_SDEXT_SUPPORT
+		if ((phys & 0x3F0000) == sdext_cart_enabler)
+			slow = 1;
+#endif
+		pagemap[page].rd = slow ? NULL : memory + memsegs[page];
+		pagemap[page].wr = (slow || !is_ram_seg[phys >> 14]) ? NULL : memory + memsegs[page];
+		pagemap[page].rd_ws[0] = ws_all;
+		pagemap[page].rd_ws[1] = ws_m1;
+		pagemap[page].wr_ws = ws_all;
 	}
 }
 
@@ -81,19 +112,19 @@ void set_ep_cpu ( int type )
 		case CPU_Z80:
 			z80ex.nmos = 1;
 #ifdef CONFIG_Z180
-			z80ex.z180 = 0;
+			z80ex_set_z180(0);
 #endif
 			break;
 		case CPU_Z80C:
 			z80ex.nmos = 0;
 #ifdef CONFIG_Z180
-			z80ex.z180 = 0;
+			z80ex_set_z180(0);
 #endif
 			break;
 #ifdef CONFIG_Z180
 		case CPU_Z180:
 			z80ex.nmos = 0;
-			z80ex.z180 = 1;
+			z80ex_set_z180(1);
 			z180_port_start = 0;
 			break;
 #endif
@@ -232,13 +263,15 @@ int ep_init_ram ( void )
 #ifdef CONFIG_SDEXT_SUPPORT
 	sdext_clear_ram();
 #endif
+	ep_update_memory_map();
 	return sum;
 }
 
 
 
 
-Z80EX_BYTE z80ex_mread_cb(Z80EX_WORD addr, int m1_state) {
+static Z80EX_BYTE mread_slow ( Z80EX_WORD addr, int m1_state )
+{
 	register int phys = memsegs[addr >> 14] + addr;
 	//DEBUG("M1 state at PC=%04Xh Phys=%08Xh seg=%02Xh" NL, addr, phys, ports[0xB0 | (addr >> 14)]);
 	if (phys >= 0x3F0000) { // VRAM access, no "$BF port" wait states ever, BUT TODO: Nick CPU clock strechting ...
@@ -256,6 +289,18 @@ Z80EX_BYTE z80ex_mread_cb(Z80EX_WORD addr, int m1_state) {
 }
 
 
+Z80EX_BYTE z80ex_mread_cb(Z80EX_WORD addr, int m1_state) {
+	const Uint8 *rd = pagemap[addr >> 14].rd;
+	if (XEMU_LIKELY(rd)) {
+		const int ws = pagemap[addr >> 14].rd_ws[m1_state];
+		if (ws)
+			z80ex_w_states(ws);
+		return rd[addr];
+	}
+	return mread_slow(addr, m1_state);
+}
+
+
 Uint8 read_cpu_byte ( Uint16 addr )
 {
 	return memory[memsegs[addr >> 14] + addr];
@@ -276,7 +321,8 @@ void write_cpu_byte_by_segmap ( Uint16 addr, Uint8 *segmap, Uint8 data )
 }
 
 
-void z80ex_mwrite_cb(Z80EX_WORD addr, Z80EX_BYTE value) {
+static void mwrite_slow ( Z80EX_WORD addr, Z80EX_BYTE value )
+{
 	register int phys = memsegs[addr >> 14] + addr;
 	if (phys >= 0x3F0000) { // VRAM access, no "$BF port" wait states ever, BUT TODO: Nick CPU clock strechting ...
 		nick_clock_align();
@@ -299,6 +345,18 @@ void z80ex_mwrite_cb(Z80EX_WORD addr, Z80EX_BYTE value) {
 }
 
 
+void z80ex_mwrite_cb(Z80EX_WORD addr, Z80EX_BYTE value) {
+	Uint8 *wr = pagemap[addr >> 14].wr;
+	if (XEMU_LIKELY(wr)) {
+		if (pagemap[addr >> 14].wr_ws)
+			z80ex_w_states(pagemap[addr >> 14].wr_ws);
+		wr[addr] = value;
+		return;
+	}
+	mwrite_slow(addr, value);
+}
+
+
 
 Z80EX_BYTE z80ex_pread_cb(Z80EX_WORD port16) {
 	Uint8 port;
@@ -497,15 +555,19 @@ void z80ex_pwrite_cb(Z80EX_WORD port16, Z80EX_BYTE value) {
 		/* DAVE registers */
 		case 0xB0:
 			memsegs[0] =  value << 14;
+			ep_update_memory_map();
 			break;
 		case 0xB1:
 			memsegs[1] = (value << 14) - 0x4000;
+			ep_update_memory_map();
 			break;
 		case 0xB2:
 			memsegs[2] = (value << 14) - 0x8000;
+			ep_update_memory_map();
 			break;
 		case 0xB3:
 			memsegs[3] = (value << 14) - 0xC000;
+			ep_update_memory_map();
 			break;
 		case 0xB4:
 			dave_configure_interrupts(value);
@@ -539,7 +601,7 @@ void z80ex_pwrite_cb(Z80EX_WORD port16, Z80EX_BYTE value) {
 				mem_ws_all = 0;
 				mem_ws_m1  = 0;
 			}
-			dave_set_clock();
+			dave_set_clock();	// this also updates the memory map (wait states)
 			DEBUG("DAVE: BF register is written -> W_ALL=%d W_M1=%d CLOCK=%dMHz" NL, mem_ws_all, mem_ws_m1, (value & 2) ? 12 : 8);
 			break;
 		/* NICK registers */
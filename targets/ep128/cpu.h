@@ -28,6 +28,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #define PORT_B6_READ_OTHERS 0xC0
 
 extern void  xep_rom_write_support ( int towrite );
+extern void  ep_update_memory_map ( void );
 extern void  set_ep_cpu ( int type );
 extern int   ep_set_ram_config ( const char *spec );
 extern int   ep_init_ram ( void );
@@ -192,6 +192,8 @@ void dave_set_clock ( void )
 	}
 	//DEBUG("DAVE: CLOCK: assumming %dMHz input, CPU clock divisor is %d, CPU cycles per Dave tick is %d" NL, (ports[0xBF] & 2) ? 12 : 8, CPU_CLOCK / cpu_cycles_per_dave_tick, cpu_cycles_per_dave_tick);
 	mem_wait_states = (CPU_CLOCK > 4000000) ? 2 : 1; // memory wait states (non-VRAM only!) asked by BF port is 1, but 2 for "turbo" Z80 solutions
+	ep_update_memory_map();
+	z80ex_run_break();	// Dave tick timing may be changed, the main loop should reschedule
 }
 
 
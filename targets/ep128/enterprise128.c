@@ -53,8 +53,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 int paused = 0;
 int register_screenshot_request = 0;
 static int cpu_cycles_for_dave_sync = 0;
-static double balancer;
-static double SCALER;
+// Nick slot timing as an integer fraction: one CPU T-state adds 2*NICK_SLOTS_PER_SEC, a Nick slot is due
+// at reaching CPU_CLOCK and takes 2*CPU_CLOCK (the factor of 2 gives the rounding to the nearest slot)
+static int nick_slot_balancer;
 static int sram_ready = 0;
 time_t unix_time;
 static char emulator_speed_title[32] = "";
@@ -90,9 +91,10 @@ void clear_emu_events ( void )
 
 int set_cpu_clock ( int hz )
 {
+	// keep the Nick slot position, which is relative to the CPU clock
+	nick_slot_balancer = (int)((Sint64)nick_slot_balancer * hz / CPU_CLOCK);
 	CPU_CLOCK = hz;
-	SCALER = (double)NICK_SLOTS_PER_SEC / (double)CPU_CLOCK;
-	DEBUG("CPU: clock = %d scaler = %f" NL, CPU_CLOCK, SCALER);
+	DEBUG("CPU: clock = %d, Nick slots per second = %d" NL, CPU_CLOCK, NICK_SLOTS_PER_SEC);
 	dave_set_clock();
 	sprintf(emulator_speed_title, "%.2fMHz", hz / 1000000.0);
 	return hz;
@@ -137,6 +139,16 @@ static void __emu_one_frame(int rasters, int frameskip)
 }
 
 
+// Number of CPU T-states till the next Dave tick or Nick slot is due
+static XEMU_INLINE int cycles_to_next_event ( void )
+{
+	const int dave = cpu_cycles_per_dave_tick - cpu_cycles_for_dave_sync;
+	const int nick = (CPU_CLOCK - nick_slot_balancer + 2 * NICK_SLOTS_PER_SEC - 1) / (2 * NICK_SLOTS_PER_SEC);
+	const int t = dave < nick ? dave : nick;
+	return t > 0 ? t : 1;
+}
+
+
 static void xep128_emulation ( void )
 {
 	//emu_timekeeping_check();
@@ -163,19 +175,21 @@ static void xep128_emulation ( void )
 				DEBUG("CPU: int and accepted = %d" NL, t);
 		} else
 			t = 0;
-		if (XEMU_LIKELY(!t))
-			t = z80ex_step();
+		if (XEMU_LIKELY(!t)) {
+			// Run the CPU till the next Dave/Nick event, or till an interrupt can be accepted
+			z80ex.int_line = dave_int_read & 0xAA;
+			t = z80ex_run(cycles_to_next_event());
+		}
 		cpu_cycles_for_dave_sync += t;
 		//DEBUG("DAVE: SYNC: CPU cycles = %d, Dave sync val = %d, limit = %d" NL, t, cpu_cycles_for_dave_sync, cpu_cycles_per_dave_tick);
 		while (cpu_cycles_for_dave_sync >= cpu_cycles_per_dave_tick) {
 			dave_tick();
 			cpu_cycles_for_dave_sync -= cpu_cycles_per_dave_tick;
 		}
-		balancer += t * SCALER;
-		//DEBUG("%s [balance=%f t=%d]" NL, buffer, balancer, t);
-		while (balancer >= 0.5) {
+		nick_slot_balancer += t * (2 * NICK_SLOTS_PER_SEC);
+		while (nick_slot_balancer >= CPU_CLOCK) {
 			nick_render_slot();
-			balancer -= 1.0;
+			nick_slot_balancer -= 2 * CPU_CLOCK;
 			if (XEMU_UNLIKELY(emu_one_frame_rasters != -1)) {
 				__emu_one_frame(
 					emu_one_frame_rasters,
@@ -185,7 +199,6 @@ static void xep128_emulation ( void )
 				return;
 			}
 		}
-		//DEBUG("[balance=%f t=%d]" NL, balancer, t);
 	}
 }
 
@@ -256,7 +269,7 @@ int main (int argc, char *argv[])
 #ifdef CONFIG_EPNET_SUPPORT
 	epnet_init(NULL);
 #endif
-	balancer = 0;
+	nick_slot_balancer = 0;
 	set_cpu_clock((int)(configdb.clock * 1000000.0));
 	audio_start();
 	xemu_set_full_screen(configdb.fullscreen_requested);
@@ -22,7 +22,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #define SCREEN_WIDTH		736
 #define SCREEN_HEIGHT		288
 #define SCREEN_FORMAT		SDL_PIXELFORMAT_ARGB8888
-#define USE_LOCKED_TEXTURE	1
+#define USE_LOCKED_TEXTURE	0	// own pixel buffer: only the changed rows are uploaded to the texture, see xemu_update_screen()
 #define RENDER_SCALE_QUALITY	0
 
 #define DEFAULT_ROM_FN		"#exos.rom"
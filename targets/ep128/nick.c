@@ -33,6 +33,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
  */
 
 
+#define FIRST_DISPLAY_SLOT	8
+#define LAST_DISPLAY_SLOT	53
+
+
 static Uint16 lpt_a, lpt_set, ld1, ld2;
 static int slot, visible, scanlines, max_scanlines;
 static Uint8 *vram;
@@ -55,6 +59,26 @@ static int chs, msbalt, lsbalt;
 static Uint8 balt_mask, chm, chb, altind;
 Uint32 raster_time = 1;
 
+/*
+ * Rendering of the display slots (8...53) of a line is not done slot by slot, but
+ * deferred: Nick only notes the first not yet rendered slot (span_slot) and the
+ * whole span is rendered with a single call of the line's span renderer, selected
+ * once per LPB according to the video and colour mode. Everything which can change
+ * the output must call nick_sync() first (VRAM access and Nick ports by the CPU,
+ * see nick_clock_align() in cpu.c), so the result is the same as with per-slot
+ * rendering, including mid-line changes.
+ */
+static int span_slot = LAST_DISPLAY_SLOT + 1;
+typedef void (*span_renderer_t)( int slots );
+static span_renderer_t span_renderer;
+static int span_ld1_step, span_ld2_step;
+
+// Colour expansion tables: a byte of the 4 and 16 colour modes is translated into
+// the RGB values of its pixels at once. Tables are rebuilt on demand only, if the
+// used palette entries (by LPB or by BIAS) are changed since the last build.
+static Uint32 col4exp[256][4] VARALIGN, col16exp[256][2] VARALIGN;
+static int col4exp_valid = 0, col16exp_valid = 0;
+
 
 #define RASTER_FIRST_VISIBLE 25
 #define RASTER_LAST_VISIBLE   312
@@ -176,8 +200,12 @@ void nick_set_bias ( Uint8 value )
 	value = (value & 31) << 3;
 	// update the second half of the internal palette ("bias palette") based on the given BIAS value
 	// the first half of the palette is updated by the Nick LPB read process
-	for (a = 0; a < 8; a++)
-		palette_bias[a] = full_palette[value++];
+	for (a = 0; a < 8; a++, value++) {
+		if (palette_bias[a] != full_palette[value]) {
+			palette_bias[a] = full_palette[value];
+			col16exp_valid = 0;
+		}
+	}
 }
 
 
@@ -199,6 +227,7 @@ void nick_set_lpth ( Uint8 value )
 		slot = 0;
 		pixels = pixels_init;
 		scanlines = 0;
+		span_slot = LAST_DISPLAY_SLOT + 1;
 	}
 	lpt_clk = value & 64;
 }
@@ -207,272 +236,360 @@ void nick_set_lpth ( Uint8 value )
 #define NICK_READ(a) (nick_last_byte = vram[a])
 
 
-static inline void FILL( Uint32 colour )
+static void build_col4exp ( void )
 {
-	if (visible) {
-		int a;
-		for(a = 0; a < 16; a++)
-			*(pixels++) = colour;
-	} else
-		pixels += 16;
+	for (int a = 0; a < 256; a++)
+		for (int i = 0; i < 4; i++)
+			col4exp[a][i] = palette[col4trans[a * 4 + i]];
+	col4exp_valid = 1;
 }
 
 
+static void build_col16exp ( void )
+{
+	for (int a = 0; a < 256; a++)
+		for (int i = 0; i < 2; i++)
+			col16exp[a][i] = palette[col16trans[a * 2 + i]];
+	col16exp_valid = 1;
+}
+
 
-static inline void TODO(void) {
-	FILL(full_palette[1]);
-	DEBUG("NO VM = %d CM = %d" NL, vm, cm);
+static inline void set_palette_entry ( int n, Uint8 value )
+{
+	const Uint32 colour = full_palette[value];
+	if (palette[n] != colour) {
+		palette[n] = colour;
+		col16exp_valid = 0;
+		if (n < 4)
+			col4exp_valid = 0;
+	}
 }
 
 
+static inline Uint32 *fill_pixels ( Uint32 *p, Uint32 colour, int num )
+{
+	while (num--)
+		*p++ = colour;
+	return p;
+}
 
-static void _render_border ( void )
+
+static void _span_vsync ( int slots )
 {
-	FILL(border);
+	pixels = fill_pixels(pixels, full_palette[4], slots << 4);
 }
 
 
+static void _span_invalid ( int slots )
+{
+	pixels = fill_pixels(pixels, full_palette[3], slots << 4);
+}
+
 
-static void _render_pixel_2 ( void )
+static void _span_pixel_2 ( int slots )
 {
-	if (!visible) {
-		ld1 += 2;
-		pixels += 16;
-	} else {
-		int j;
-		for (j = 0; j < 2; j ++) {
-			int a, ps;
-			Uint8 data = NICK_READ(ld1++);
-			if (msbalt && (data & 128)) {
-				data &= 127;
-				ps = 2;
-			} else
-				ps = 0;
-			if (lsbalt && (data & 1)) {
-				data &= 254;
-				ps |= 4;
-			}
-			for (a = 128; a; a >>= 1) {
-				*(pixels++) = palette[(data & a ? 1 : 0) | ps];
-			}
+	Uint32 *p = pixels;
+	for (slots <<= 1; slots; slots--) {
+		Uint8 data = NICK_READ(ld1++);
+		int ps = 0;
+		if (msbalt && (data & 128)) {
+			data &= 127;
+			ps = 2;
+		}
+		if (lsbalt && (data & 1)) {
+			data &= 254;
+			ps |= 4;
 		}
+		const Uint32 c0 = palette[ps], c1 = palette[ps | 1];
+		for (int a = 128; a; a >>= 1)
+			*p++ = (data & a) ? c1 : c0;
 	}
+	pixels = p;
 }
 
 
-
-static void _render_lpixel_2 ( void )
+static void _span_lpixel_2 ( int slots )
 {
-	if (!visible) {
-		ld1 += 1;
-		pixels += 16;
-	} else {
-		int a, ps;
+	Uint32 *p = pixels;
+	while (slots--) {
 		Uint8 data = NICK_READ(ld1++);
+		int ps = 0;
 		if (msbalt && (data & 128)) {
 			data &= 127;
 			ps = 2;
-		} else
-			ps = 0;
+		}
 		if (lsbalt && (data & 1)) {
 			data &= 254;
 			ps |= 4;
 		}
-		for (a = 128; a; a >>= 1) {
-			pixels[0] = pixels[1] = palette[(data & a ? 1 : 0) | ps];
-			pixels += 2;
+		const Uint32 c0 = palette[ps], c1 = palette[ps | 1];
+		for (int a = 128; a; a >>= 1) {
+			p[0] = p[1] = (data & a) ? c1 : c0;
+			p += 2;
 		}
 	}
+	pixels = p;
 }
 
 
-static void _render_pixel_256 ( void )
+static void _span_attrib_2 ( int slots )
 {
-	if (!visible) {
-		ld1 += 2;
-		pixels += 16;
-	} else {
-		int a;
-		Uint32 colour = full_palette[NICK_READ(ld1++)];
-		for (a = 0; a < 8; a++)
-			*(pixels++) = colour;
-		colour = full_palette[NICK_READ(ld1++)];
-		for (a = 0; a < 8; a++)
-			*(pixels++) = colour;
+	Uint32 *p = pixels;
+	while (slots--) {
+		const int attr = NICK_READ(ld1++);	// read attribute byte
+		const Uint32 c1 = palette[attr & 0xF];
+		const Uint32 c2 = palette[attr >> 4];
+		const Uint8 data = NICK_READ(ld2++);	// read graphic byte
+		for (int a = 128; a; a >>= 1) {
+			p[0] = p[1] = (data & a) ? c1 : c2;
+			p += 2;
+		}
 	}
+	pixels = p;
 }
-static void _render_lpixel_256 ( void )
+
+
+static const Uint8 _altind_modes[] = {
+	0,	// no altind1, no altind0 (00)	0+0
+	4,	// no altind1, do altind0 (01)	0+4
+	2,	// do altind1, no altind0 (10)	2+0
+	6,	// do altind1, do altind0 (11)
+};
+
+
+static void _span_char_2 ( int slots )
 {
-	if (!visible) {
-		ld1++;
-		pixels += 16;
-	} else {
-		int a;
-		Uint8 colour = full_palette[NICK_READ(ld1++)];
-		for (a = 0; a < 16; a++)
-			*(pixels++) = colour;
+	Uint32 *p = pixels;
+	while (slots--) {
+		const Uint8 code = NICK_READ(ld1++);
+		const int base = _altind_modes[(altind & code) >> 6];
+		const Uint32 c1 = palette[base], c2 = palette[base + 1];
+		const Uint8 data = NICK_READ(ld2 | (code & chm));
+		for (int a = 128; a; a >>= 1) {
+			p[0] = p[1] = (data & a) ? c2 : c1;
+			p += 2;
+		}
 	}
+	pixels = p;
 }
 
 
-
-static void _render_vsync(void)
+static void _span_pixel_4 ( int slots )
 {
-	FILL(full_palette[4]);
+	Uint32 *p = pixels;
+	if (XEMU_UNLIKELY(!col4exp_valid))
+		build_col4exp();
+	for (slots <<= 1; slots; slots--) {
+		const Uint32 *e = col4exp[NICK_READ(ld1++)];
+		p[0] = p[1] = e[0];
+		p[2] = p[3] = e[1];
+		p[4] = p[5] = e[2];
+		p[6] = p[7] = e[3];
+		p += 8;
+	}
+	pixels = p;
 }
 
 
-
-static Uint8 _altind_modes[] = {
-	0,	// no altind1, no altind0 (00)	0+0
-	4,	// no altind1, do altind0 (01)	0+4
-	2,	// do altind1, no altind0 (10)	2+0
-	6,	// do altind1, do altind0 (11)
-};
+static void _span_lpixel_4 ( int slots )
+{
+	Uint32 *p = pixels;
+	if (XEMU_UNLIKELY(!col4exp_valid))
+		build_col4exp();
+	while (slots--) {
+		const Uint32 *e = col4exp[NICK_READ(ld1++)];
+		p[ 0] = p[ 1] = p[ 2] = p[ 3] = e[0];
+		p[ 4] = p[ 5] = p[ 6] = p[ 7] = e[1];
+		p[ 8] = p[ 9] = p[10] = p[11] = e[2];
+		p[12] = p[13] = p[14] = p[15] = e[3];
+		p += 16;
+	}
+	pixels = p;
+}
 
 
-static void _render_char_2 ( void )
+static void _span_char_4 ( int slots )
 {
-	if (!visible) {
-		ld1++;
-	} else {
-		Uint8 data = NICK_READ(ld1++);
-		Uint32 c1 = _altind_modes[(altind & data) >> 6];
-		Uint32 c2 = palette[c1 + 1];
-		c1 = palette[c1];
-		data = NICK_READ(ld2 | (data & chm));
-		pixels[ 0] = pixels[ 1] = (data & 0x80) ? c2 : c1;
-		pixels[ 2] = pixels[ 3] = (data & 0x40) ? c2 : c1;
-		pixels[ 4] = pixels[ 5] = (data & 0x20) ? c2 : c1;
-		pixels[ 6] = pixels[ 7] = (data & 0x10) ? c2 : c1;
-		pixels[ 8] = pixels[ 9] = (data & 0x08) ? c2 : c1;
-		pixels[10] = pixels[11] = (data & 0x04) ? c2 : c1;
-		pixels[12] = pixels[13] = (data & 0x02) ? c2 : c1;
-		pixels[14] = pixels[15] = (data & 0x01) ? c2 : c1;
+	Uint32 *p = pixels;
+	if (XEMU_UNLIKELY(!col4exp_valid))
+		build_col4exp();
+	while (slots--) {
+		const Uint8 code = NICK_READ(ld1++);
+		const int base = _altind_modes[(altind & code) >> 6];
+		const Uint8 data = NICK_READ(ld2 | (code & chm));
+		if (XEMU_LIKELY(!base)) {
+			const Uint32 *e = col4exp[data];
+			p[ 0] = p[ 1] = p[ 2] = p[ 3] = e[0];
+			p[ 4] = p[ 5] = p[ 6] = p[ 7] = e[1];
+			p[ 8] = p[ 9] = p[10] = p[11] = e[2];
+			p[12] = p[13] = p[14] = p[15] = e[3];
+		} else {
+			// ALTIND: the first two colours are taken from an alternative palette position
+			const Uint8 *trans = col4trans + (data << 2);
+			for (int i = 0; i < 4; i++)
+				p[i * 4] = p[i * 4 + 1] = p[i * 4 + 2] = p[i * 4 + 3] = trans[i] < 2 ? palette[base + trans[i]] : palette[trans[i]];
+		}
+		p += 16;
 	}
-	pixels += 16;
+	pixels = p;
 }
 
 
-static void _render_char_4 ( void )
+static void _span_pixel_16 ( int slots )
 {
-	if (!visible) {
-		ld1++;
-	} else {
-		Uint8 data = NICK_READ(ld1++);
-		Uint32 col[2];
-		col[0] = _altind_modes[(altind & data) >> 6];
-		col[1] = palette[col[0] + 1];
-		col[0] = palette[col[0]];
-		data = NICK_READ(ld2 | (data & chm));
-		Uint8 *trans = col4trans + (data << 2);
-		pixels[ 0] = pixels[ 1] = pixels[ 2] = pixels[ 3] = trans[0] < 2 ? col[trans[0]] : palette[trans[0]];
-		pixels[ 4] = pixels[ 5] = pixels[ 6] = pixels[ 7] = trans[1] < 2 ? col[trans[1]] : palette[trans[1]];
-		pixels[ 8] = pixels[ 9] = pixels[10] = pixels[11] = trans[2] < 2 ? col[trans[2]] : palette[trans[2]];
-		pixels[12] = pixels[13] = pixels[14] = pixels[15] = trans[3] < 2 ? col[trans[3]] : palette[trans[3]];
+	Uint32 *p = pixels;
+	if (XEMU_UNLIKELY(!col16exp_valid))
+		build_col16exp();
+	for (slots <<= 1; slots; slots--) {
+		const Uint32 *e = col16exp[NICK_READ(ld1++)];
+		p[0] = p[1] = p[2] = p[3] = e[0];
+		p[4] = p[5] = p[6] = p[7] = e[1];
+		p += 8;
 	}
-	pixels += 16;
+	pixels = p;
 }
 
 
+// 16 colour lpixel and char modes: one byte gives two pixels, each of them is 8 pixels wide on the screen
+static inline Uint32 *put_lpixel_16 ( Uint32 *p, Uint8 data )
+{
+	const Uint32 *e = col16exp[data];
+	p = fill_pixels(p, e[0], 8);
+	return fill_pixels(p, e[1], 8);
+}
+
 
-static void _render_invalid ( void )
+static void _span_lpixel_16 ( int slots )
 {
-	FILL(full_palette[3]);
+	Uint32 *p = pixels;
+	if (XEMU_UNLIKELY(!col16exp_valid))
+		build_col16exp();
+	while (slots--)
+		p = put_lpixel_16(p, NICK_READ(ld1++));
+	pixels = p;
 }
 
 
-static void _render_attrib_2 ( void )
+static void _span_char_16 ( int slots )
 {
-	if (!visible) {
-		ld1++;
-		ld2++;
-	} else {
-		int data = NICK_READ(ld1++); // read attribute byte
-		Uint32 c1 = palette[data & 0xF];
-		Uint32 c2 = palette[data >> 4];
-		data = NICK_READ(ld2++); // read graphic byte
-		pixels[ 0] = pixels[ 1] = (data & 0x80) ? c1 : c2;
-		pixels[ 2] = pixels[ 3] = (data & 0x40) ? c1 : c2;
-		pixels[ 4] = pixels[ 5] = (data & 0x20) ? c1 : c2;
-		pixels[ 6] = pixels[ 7] = (data & 0x10) ? c1 : c2;
-		pixels[ 8] = pixels[ 9] = (data & 0x08) ? c1 : c2;
-		pixels[10] = pixels[11] = (data & 0x04) ? c1 : c2;
-		pixels[12] = pixels[13] = (data & 0x02) ? c1 : c2;
-		pixels[14] = pixels[15] = (data & 0x01) ? c1 : c2;
+	Uint32 *p = pixels;
+	if (XEMU_UNLIKELY(!col16exp_valid))
+		build_col16exp();
+	while (slots--) {
+		const Uint8 code = NICK_READ(ld1++);
+		p = put_lpixel_16(p, NICK_READ(ld2 | (code & chm)));
 	}
-	pixels += 16;
+	pixels = p;
 }
 
 
-static void _render_pixel_4 ( void )
+static void _span_pixel_256 ( int slots )
 {
-	if (!visible) {
-		ld1 += 2;
-	} else {
-		Uint8 *trans = col4trans + (NICK_READ(ld1++) << 2);
-		pixels[ 0] = pixels[ 1] = palette[trans[0]];
-		pixels[ 2] = pixels[ 3] = palette[trans[1]];
-		pixels[ 4] = pixels[ 5] = palette[trans[2]];
-		pixels[ 6] = pixels[ 7] = palette[trans[3]];
-		trans = col4trans + (NICK_READ(ld1++) << 2);
-		pixels[ 8] = pixels[ 9] = palette[trans[0]];
-		pixels[10] = pixels[11] = palette[trans[1]];
-		pixels[12] = pixels[13] = palette[trans[2]];
-		pixels[14] = pixels[15] = palette[trans[3]];
-	}
-	pixels += 16;
+	Uint32 *p = pixels;
+	for (slots <<= 1; slots; slots--)
+		p = fill_pixels(p, full_palette[NICK_READ(ld1++)], 8);
+	pixels = p;
 }
 
-static void _render_lpixel_4 ( void )
+
+static void _span_lpixel_256 ( int slots )
 {
-	if (!visible) {
-		ld1 += 1;
-	} else {
-		Uint8 *trans = col4trans + (NICK_READ(ld1++) << 2);
-		pixels[ 0] = pixels[ 1] = pixels[ 2] = pixels[ 3] = palette[trans[0]];
-		pixels[ 4] = pixels[ 5] = pixels[ 6] = pixels[ 7] = palette[trans[1]];
-		pixels[ 8] = pixels[ 9] = pixels[10] = pixels[11] = palette[trans[2]];
-		pixels[12] = pixels[13] = pixels[14] = pixels[15] = palette[trans[3]];
-	}
-	pixels += 16;
+	Uint32 *p = pixels;
+	while (slots--)
+		p = fill_pixels(p, full_palette[NICK_READ(ld1++)], 16);
+	pixels = p;
 }
 
 
-static void _render_pixel_16 ( void ) // TODO
+static void _span_char_256 ( int slots )
 {
-	if (!visible) {
-		ld1 += 2;
-	} else {
-		Uint8 *trans = col16trans + (NICK_READ(ld1++) << 1);
-		pixels[ 0] = pixels[ 1] = pixels[ 2] = pixels[ 3] = palette[trans[0]];
-		pixels[ 4] = pixels[ 5] = pixels[ 6] = pixels[ 7] = palette[trans[1]];
-		trans = col16trans + (NICK_READ(ld1++) << 1);
-		pixels[ 8] = pixels[ 9] = pixels[10] = pixels[11] = palette[trans[0]];
-		pixels[12] = pixels[13] = pixels[14] = pixels[15] = palette[trans[1]];
+	Uint32 *p = pixels;
+	while (slots--) {
+		const Uint8 code = NICK_READ(ld1++);
+		p = fill_pixels(p, full_palette[NICK_READ(ld2 | (code & chm))], 16);
 	}
-	pixels += 16;
+	pixels = p;
 }
 
-static void _render_lpixel_16 ( void ) // TODO
+
+// indexed by (colour mode << 3) | video mode
+// Attribute mode has the same renderer in all colour modes: the two colours of a byte are given by the two nibbles
+// of the attribute byte as 16 colour palette indices, so there is nothing for the colour mode to select. Nick
+// displays the graphic byte as eight (lpixel wide) pixels with these colours, whatever the colour mode is.
+static const span_renderer_t span_renderers[4 * 8] = {
+	_span_vsync,		// col-2 vsync
+	_span_pixel_2,		// col-2 pixel
+	_span_attrib_2,		// col-2 attrib
+	_span_char_2,		// col-2 ch256
+	_span_char_2,		// col-2 ch128
+	_span_char_2,		// col-2 ch64
+	_span_invalid,		// col-2 invalid
+	_span_lpixel_2,		// col-2 lpixel
+	_span_vsync,		// col-4 vsync
+	_span_pixel_4,		// col-4 pixel
+	_span_attrib_2,		// col-4 attrib
+	_span_char_4,		// col-4 ch256
+	_span_char_4,		// col-4 ch128
+	_span_char_4,		// col-4 ch64
+	_span_invalid,		// col-4 invalid
+	_span_lpixel_4,		// col-4 lpixel
+	_span_vsync,		// col-16 vsync
+	_span_pixel_16,		// col-16 pixel
+	_span_attrib_2,		// col-16 attrib
+	_span_char_16,		// col-16 ch256
+	_span_char_16,		// col-16 ch128
+	_span_char_16,		// col-16 ch64
+	_span_invalid,		// col-16 invalid
+	_span_lpixel_16,	// col-16 lpixel
+	_span_vsync,		// col-256 vsync
+	_span_pixel_256,	// col-256 pixel
+	_span_attrib_2,		// col-256 attrib
+	_span_char_256,		// col-256 ch256
+	_span_char_256,		// col-256 ch128
+	_span_char_256,		// col-256 ch64
+	_span_invalid,		// col-256 invalid
+	_span_lpixel_256,	// col-256 lpixel
+};
+// LD1/LD2 bytes used per slot by the video modes, used to step the pointers for non-visible lines
+static const Uint8 ld1_step_for_modes[] = { 0, 2, 1, 1, 1, 1, 0, 1 };
+static const Uint8 ld2_step_for_modes[] = { 0, 0, 1, 0, 0, 0, 0, 0 };
+
+
+// Renders slots from "from" to "to" (not including) of the current line, border and display area as well
+static void render_span ( int from, int to )
 {
-	if (!visible) {
-		ld1 += 1;
-	} else {
-		Uint8 *trans = col16trans + (NICK_READ(ld1++) << 1);
-		pixels[ 0] = pixels[ 1] = pixels[ 2] = pixels[ 3] =
-		pixels[ 4] = pixels[ 5] = pixels[ 6] = pixels[ 7] = palette[trans[0]];
-		pixels[ 8] = pixels[ 9] = pixels[10] = pixels[11] =
-		pixels[12] = pixels[13] = pixels[14] = pixels[15] = palette[trans[1]];
+	int d0 = from > lm ? from : lm;
+	int d1 = to < rm ? to : rm;
+	if (d1 <= d0)
+		d0 = d1 = to;	// no display area within this span, everything is border
+	if (XEMU_UNLIKELY(!visible)) {
+		pixels += (to - from) << 4;
+		ld1 += (d1 - d0) * span_ld1_step;
+		ld2 += (d1 - d0) * span_ld2_step;
+		return;
 	}
-	pixels += 16;
+	// TODO: real nick does not use complicated comparsion just disables border and enables again while hitting lm and rm ...
+	const Uint32 bcol = vsync ? full_palette[4] : border;
+	if (d0 > from)
+		pixels = fill_pixels(pixels, bcol, (d0 - from) << 4);
+	if (d1 > d0)
+		span_renderer(d1 - d0);
+	if (to > d1)
+		pixels = fill_pixels(pixels, bcol, (to - d1) << 4);
 }
 
-static void _render_char_16 ( void ) { TODO(); }
-static void _render_char_256 ( void ) { TODO(); }
+
+// Renders the pending, already due display slots of the current line
+void nick_sync ( void )
+{
+	const int end = slot <= LAST_DISPLAY_SLOT ? slot : LAST_DISPLAY_SLOT + 1;
+	if (span_slot < end) {
+		render_span(span_slot, end);
+		span_slot = end;
+	}
+}
 
 
-static int _render_selection;
 //static const int chs_for_modes[] = { 0, 0, 0, 256, 128, 64, 0, 0 };
 static const int chb_for_modes[] = { 0, 0, 0,   8,   7,  6, 0, 0 };
 
@@ -587,9 +704,10 @@ void nick_render_slot ( void )
 			if (pixels >= pixels_limit_vsync_long_force)
 				_update();
 			visible = (pixels >= pixels_limit_up && pixels < pixels_limit_bottom && (!frameskip));
-			_render_selection = vm | ((a >> 2) & 0x18);
-			if (XEMU_UNLIKELY(_render_selection >= 8 * 4))
-				FATAL("NICK: render funcarray bound check failure!");
+			span_renderer = span_renderers[vm | (cm << 3)];
+			span_ld1_step = ld1_step_for_modes[vm];
+			span_ld2_step = ld2_step_for_modes[vm];
+			span_slot = FIRST_DISPLAY_SLOT;
 			break;
 		case 1:
 			a = NICK_READ(lpt_a++);
@@ -629,22 +747,24 @@ void nick_render_slot ( void )
 		// these slots are used to read the palette related info from LPB
 		// note: the high 8 colours of the palette is set by BIAS register, not by the LPB!
 		case 4:
-			palette[0] = full_palette[NICK_READ(lpt_a++)];
-			palette[1] = full_palette[NICK_READ(lpt_a++)];
+			set_palette_entry(0, NICK_READ(lpt_a++));
+			set_palette_entry(1, NICK_READ(lpt_a++));
 			break;
 		case 5:
-			palette[2] = full_palette[NICK_READ(lpt_a++)];
-			palette[3] = full_palette[NICK_READ(lpt_a++)];
+			set_palette_entry(2, NICK_READ(lpt_a++));
+			set_palette_entry(3, NICK_READ(lpt_a++));
 			break;
 		case 6:
-			palette[4] = full_palette[NICK_READ(lpt_a++)];
-			palette[5] = full_palette[NICK_READ(lpt_a++)];
+			set_palette_entry(4, NICK_READ(lpt_a++));
+			set_palette_entry(5, NICK_READ(lpt_a++));
 			break;
 		case 7:
-			palette[6] = full_palette[NICK_READ(lpt_a++)];
-			palette[7] = full_palette[NICK_READ(lpt_a++)];
+			set_palette_entry(6, NICK_READ(lpt_a++));
+			set_palette_entry(7, NICK_READ(lpt_a++));
 			break;
 		case 54:
+			nick_sync();	// the end of the display area: render the rest of the line
+			break;
 		case 55:
 		case 56:
 			// Nick does VRAM refresh here, and generates HSYNC, not so much needed in an emulator, though :)
@@ -652,49 +772,7 @@ void nick_render_slot ( void )
 		case  8: case  9: case 10: case 11: case 12: case 13: case 14: case 15: case 16: case 17: case 18: case 19: case 20: case 21: case 22: case 23: case 24: case 25: case 26: case 27: case 28:
 		case 29: case 30: case 31: case 32: case 33: case 34: case 35: case 36: case 37: case 38: case 39: case 40: case 41: case 42: case 43: case 44: case 45: case 46: case 47: case 48: case 49:
 		case 50: case 51: case 52: case 53:
-			// TODO: real nick does not use complicated comparsion just disables border and enables again while hitting lm and rm ...
-			if (slot < lm || slot >= rm) {
-				if (vsync)
-					_render_vsync();
-				else
-					_render_border();
-			} else {
-				switch (_render_selection) {
-					case  0: _render_vsync();	break;	// col-2 vsync
-					case  1: _render_pixel_2();	break;	// col-2 pixel
-					case  2: _render_attrib_2();	break;	// col-2 attrib
-					case  3: _render_char_2();	break;	// col-2 ch256
-					case  4: _render_char_2();	break;	// col-2 ch128
-					case  5: _render_char_2();	break;	// col-2 ch64
-					case  6: _render_invalid();	break;	// col-2 invalid
-					case  7: _render_lpixel_2();	break;	// col-2 lpixel
-					case  8: _render_vsync();	break;	// col-4 vsync
-					case  9: _render_pixel_4();	break;	// col-4 pixel
-					case 10: _render_attrib_2();	break;	// col-4 attrib	  TODO
-					case 11: _render_char_4();	break;	// col-4 ch256
-					case 12: _render_char_4();	break;	// col-4 ch128
-					case 13: _render_char_4();	break;	// col-4 ch64
-					case 14: _render_invalid();	break;	// col-4 invalid
-					case 15: _render_lpixel_4();	break;	// col-4 lpixel
-					case 16: _render_vsync();	break;	// col-16 vsync
-					case 17: _render_pixel_16();	break;	// col-16 pixel
-					case 18: _render_attrib_2();	break;	// col-16 attrib  TODO
-					case 19: _render_char_16();	break;	// col-16 ch256
-					case 20: _render_char_16();	break;	// col-16 ch128
-					case 21: _render_char_16();	break;	// col-16 ch64
-					case 22: _render_invalid();	break;	// col-16 invalid
-					case 23: _render_lpixel_16();	break;	// col-16 lpixel
-					case 24: _render_vsync();	break;	// col-256 vsync
-					case 25: _render_pixel_256();	break;	// col-256 pixel
-					case 26: _render_attrib_2();	break;	// col-256 attrib TODO
-					case 27: _render_char_256();	break;	// col-256 ch256
-					case 28: _render_char_256();	break;	// col-256 ch128
-					case 29: _render_char_256();	break;	// col-256 ch64
-					case 30: _render_invalid();	break;	// col-256 invalid
-					case 31: _render_lpixel_256();	break;	// col-256 lpixel
-					default: XEMU_UNREACHABLE();
-				}
-			}
+			// display slots: rendering is deferred, see nick_sync()
 			break;
 		default:
 			FATAL("NICK: FATAL ERROR: invalid slot number for rendering: %d", slot);
@@ -34,6 +34,7 @@ extern void  nick_set_lpth ( Uint8 value );
 extern void  nick_set_frameskip ( int val );
 extern char  *nick_dump_lpt ( const char *newline_seq );
 extern void  nick_render_slot ( void );
+extern void  nick_sync ( void );
 extern void  screenshot ( void );
 
 #endif
@@ -387,6 +387,7 @@ int sdext_init ( const char *img_fn )
 	memcpy(sd_rom_ext, memory + 7 * 0x4000, 0x4000);
 	sdext_clear_ram();
 	sdext_cart_enabler = SDEXT_CART_ENABLER_ON;	// turn emulation on
+	ep_update_memory_map();
 	rom_page_ofs = 0;
 	is_hs_read = 0;
 	cmd_index = 0;
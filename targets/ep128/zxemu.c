@@ -45,6 +45,7 @@ void zxemu_switch ( Uint8 data )
 static int zxemu_nmi ( void )
 {
 	nmi_pending = zxemu_on;
+	z80ex_run_break();	// let the main loop handle the NMI after the current opcode
 	return nmi_pending;
 }
 
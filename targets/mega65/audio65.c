@@ -16,12 +16,11 @@ You should have received a copy of the GNU General Public License
 along with this program; if not, write to the Free Software
 Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 
-#define SID_USES_LOCK
-#define OPL_USES_LOCK
 #define NEED_SID_H
 //#define CORRUPTION_DEBUG
 
 #include "xemu/emutools.h"
+#include "xemu/emutools_files.h"
 #include "xemu/opl3.h"
 #include "audio65.h"
 // For D7XX (audio DMA):
@@ -29,6 +28,8 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 // For accessing memory (audio DMA):
 #include "memory_mapper.h"
 #include "configdb.h"
+// For the length of a scanline (time source of the SID/OPL3 register write queue):
+#include "vic4.h"
 
 
 struct SidEmulation sid[NUMBER_OF_SIDS];
@@ -36,6 +37,10 @@ struct SidEmulation sid[NUMBER_OF_SIDS];
 static opl3_chip opl3;
 
 static SDL_AudioDeviceID audio = 0;		// SDL audio device
+static bool offline_render = false;		// no SDL audio device (headless mode, or capture), the emulator pulls audio rendering by emulated time
+static int capture_fd = -1;			// audio capture file (-audiocapture option), always used with offline rendering
+static bool capture_is_wav;
+static Uint32 capture_bytes;			// number of bytes of audio data written into the capture file
 static int system_sound_mix_freq;		// playback sample rate (in Hz) of the emulator itself
 static int system_sid_cycles_per_sec;
 static double dma_audio_mixing_value;
@@ -52,59 +57,123 @@ static bool mono_downmix;
 #	error "Currently NUMBER_OF_SIDS macro must be set to 4!"
 #endif
 
-// --- choose one only, normally you want the last (no debug), especially in RELEASEs. Debugging is spammy and expensive in CPU time! ---
-//#define DEBUG_AUDIO_LOCKS(...) DEBUGPRINT(__VA_ARGS__)
-//#define DEBUG_AUDIO_LOCKS(...) DEBUG(__VA_ARGS__)
-#define DEBUG_AUDIO_LOCKS(...)
+/* SID and OPL3 register writes are not done directly by the emulation thread (which would need locking
+   against the audio thread rendering a whole buffer meanwhile) but pushed into a lock-free single-producer
+   (emulation) / single-consumer (audio callback) queue. Every write is time-stamped in the emulated sample
+   time (advanced by audio65_scanline_tick() every scanline) so the consumer can apply it at the right sample
+   position within the buffer being rendered. The renderer side lags behind the emulation by about a buffer
+   of samples, which is re-synchronized, if the difference becomes insane (eg: paused or sleepless emulation). */
+
+#define WRITE_QUEUE_SIZE	8192		// must be power of two!
+#define WRITE_TARGET_OPL3	NUMBER_OF_SIDS	// target IDs 0...NUMBER_OF_SIDS-1 are the SIDs themselves
+#define WRITE_TARGET_SID_FRAME	(NUMBER_OF_SIDS + 1)
+
+struct audio_write_st {
+	Uint32	stamp;		// emulated sample time of the write
+	Uint16	reg;
+	Uint8	data;
+	Uint8	target;
+};
+static struct audio_write_st write_queue[WRITE_QUEUE_SIZE];
+static SDL_atomic_t write_queue_head;		// written only by the producer (emulation)
+static SDL_atomic_t write_queue_tail;		// written only by the consumer (audio callback)
+static SDL_atomic_t emu_sample_time;		// integer part of emu_sample_time_fp, for the consumer
+static Uint64 emu_sample_time_fp;		// emulated sample time, 32.32 fixed point, producer side only
+static Uint32 render_sample_time;		// sample time of the next sample to be rendered, consumer side only
+static bool consumer_is_running = false;	// audio callback is called by SDL's audio thread (not in offline mode)
+#ifdef XEMU_SNAPSHOT_SUPPORT
+static Uint8 sid_shadow_regs[NUMBER_OF_SIDS][0x20];	// last written SID/OPL3 register values, producer side only
+static Uint8 opl3_shadow_regs[0x100];
+#endif
 
 
-#ifdef OPL_USES_LOCK
-static SDL_SpinLock opl3_lock;
-static XEMU_INLINE void LOCK_OPL ( const char *m )
+static void apply_write ( const struct audio_write_st *w )
 {
-	DEBUG_AUDIO_LOCKS("%s: Waiting for OPL3 lock (%d)" NL, m, opl3_lock);
-	SDL_AtomicLock(&opl3_lock);
-	DEBUG_AUDIO_LOCKS("%s: Got OPL3 lock (%d)" NL, m, opl3_lock);
+	if (w->target == WRITE_TARGET_OPL3) {
+		//OPL3_WriteReg(&opl3, w->reg, w->data);
+		OPL3_WriteRegBuffered(&opl3, w->reg, w->data);
+	} else if (w->target == WRITE_TARGET_SID_FRAME) {
+		for (int i = 0; i < NUMBER_OF_SIDS; i++)
+			sid[i].sFrameCount++;
+	} else
+		sid_write_reg(&sid[w->target], w->reg, w->data);
 }
-static XEMU_INLINE void UNLOCK_OPL ( const char *m )
+
+
+// Consumer side: returns with the next queued write, or NULL if the queue is empty. Use pop_write() after applying it.
+static XEMU_INLINE const struct audio_write_st *peek_write ( void )
 {
-	SDL_AtomicUnlock(&opl3_lock);
-	DEBUG_AUDIO_LOCKS("%s: Released OPL3 lock (%d)" NL, m, opl3_lock);
+	const int tail = SDL_AtomicGet(&write_queue_tail);
+	if (tail == SDL_AtomicGet(&write_queue_head))
+		return NULL;
+	SDL_MemoryBarrierAcquire();
+	return &write_queue[tail];
 }
-#else
-#	define LOCK_OPL(m)
-#	define UNLOCK_OPL(m)
-#	warning "Disabled LOCK for OPL3, you may experience Xemu crashes and/or sound anomalies!"
-#endif
 
 
-#ifdef SID_USES_LOCK
-static XEMU_INLINE void LOCK_SID ( const char *m, const int i )
+static XEMU_INLINE void pop_write ( void )
 {
-	DEBUG_AUDIO_LOCKS("%s: Waiting for SID#%d lock (%d)" NL, m, i, sid[i].spinlock);
-	SDL_AtomicLock(&sid[i].spinlock);
-	DEBUG_AUDIO_LOCKS("%s: Got SID#%d lock (%d)" NL, m, i, sid[i].spinlock);
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&write_queue_tail, (SDL_AtomicGet(&write_queue_tail) + 1) & (WRITE_QUEUE_SIZE - 1));
 }
-static XEMU_INLINE void UNLOCK_SID ( const char *m, const int i )
+
+
+// Applies all the queued writes at once. Must be called only if the consumer cannot run meanwhile!
+static void drain_writes ( void )
 {
-	SDL_AtomicUnlock(&sid[i].spinlock);
-	DEBUG_AUDIO_LOCKS("%s: Released SID#%d lock (%d)" NL, m, i, sid[i].spinlock);
+	const struct audio_write_st *w;
+	while ((w = peek_write())) {
+		apply_write(w);
+		pop_write();
+	}
+}
+
+
+static void queue_write ( const int target, const int reg, const Uint8 data )
+{
+	const int head = SDL_AtomicGet(&write_queue_head);
+	const int next = (head + 1) & (WRITE_QUEUE_SIZE - 1);
+	if (XEMU_UNLIKELY(next == SDL_AtomicGet(&write_queue_tail))) {
+		// Queue is full. If the consumer does not run on its own (offline mode, or audio is not started yet) it's
+		// safe to apply the writes here. Otherwise, lock the audio device, so the audio callback cannot run while
+		// we apply the pending writes in its place. Their timing is lost this way, but no write is lost, and the
+		// emulation never waits for the audio thread. The queue is empty after this, so the current write can go
+		// there with its proper time stamp.
+		if (!consumer_is_running) {
+			drain_writes();
+		} else {
+			SDL_LockAudioDevice(audio);
+			drain_writes();
+			SDL_UnlockAudioDevice(audio);
+		}
+	}
+	struct audio_write_st *w = &write_queue[head];
+	w->stamp = (Uint32)(emu_sample_time_fp >> 32);
+	w->reg = reg;
+	w->data = data;
+	w->target = target;
+	SDL_MemoryBarrierRelease();
+	SDL_AtomicSet(&write_queue_head, next);
+}
+
+
+// Must be called at every emulated scanline, this is the time source for the time-stamped register writes
+void audio65_scanline_tick ( void )
+{
+	// videostd_1mhz_cycles_per_scanline is the length of a scanline in microseconds
+	emu_sample_time_fp += (Uint64)((double)videostd_1mhz_cycles_per_scanline * (double)system_sound_mix_freq * (4294967296.0 / 1000000.0));
+	SDL_AtomicSet(&emu_sample_time, (int)(Uint32)(emu_sample_time_fp >> 32));
 }
-#else
-#	define LOCK_SID(m,i)
-#	define UNLOCK_SID(m,i)
-#	warning "Disabled LOCK for SID, you may experience Xemu crashes and/or sound anomalies!"
-#endif
 
 
 void audio65_sid_write ( const int addr, const Uint8 data )
 {
 	// SIDs are separated by $20 bytes from each others, 4 SIDs (0-3), instance number
 	// figured out from address
-	const int instance = (addr >> 5) & 3;
-	LOCK_SID("WRITER", instance);
-	sid_write_reg(&sid[instance], addr & 0x1F, data);
-	UNLOCK_SID("WRITER", instance);
+#ifdef XEMU_SNAPSHOT_SUPPORT
+	sid_shadow_regs[(addr >> 5) & 3][addr & 0x1F] = data;
+#endif
+	queue_write((addr >> 5) & 3, addr & 0x1F, data);
 }
 
 
@@ -112,20 +181,16 @@ void audio65_opl3_write ( Uint8 reg, Uint8 data )
 {
 	if (XEMU_UNLIKELY(configdb.noopl3))
 		return;
-	LOCK_OPL("WRITER");
-	//OPL3_WriteReg(&opl3, reg, data);
-	OPL3_WriteRegBuffered(&opl3, reg, data);
-	UNLOCK_OPL("WRITER");
+#ifdef XEMU_SNAPSHOT_SUPPORT
+	opl3_shadow_regs[reg] = data;
+#endif
+	queue_write(WRITE_TARGET_OPL3, reg, data);
 }
 
 
 void audio65_sid_inc_framecount ( void )
 {
-	for (int i = 0; i < NUMBER_OF_SIDS; i++) {
-		LOCK_SID("INCER", i);
-		sid[i].sFrameCount++;
-		UNLOCK_SID("INCER", i);
-	}
+	queue_write(WRITE_TARGET_SID_FRAME, 0, 0);
 }
 
 
@@ -239,6 +304,46 @@ static float scalers_left[MIXED_CHANNELS];
 static float scalers_right[MIXED_CHANNELS];
 
 
+// Renders SIDs and OPL3, applying the queued register writes at their sample position within the buffer
+static void render_sid_opl3 ( Sint16 *streams, const int len )
+{
+	// Re-sync, if the renderer is ahead of the emulation, or lags behind too much (more than a buffer and 100msec)
+	const int lag = (int)((Uint32)SDL_AtomicGet(&emu_sample_time) - render_sample_time);
+	if (XEMU_UNLIKELY(lag < 0 || lag > len + system_sound_mix_freq / 10))
+		render_sample_time = (Uint32)SDL_AtomicGet(&emu_sample_time) - len;
+	for (int pos = 0; pos < len;) {
+		int until = len;
+		const struct audio_write_st *w = peek_write();
+		if (w) {
+			const int at = (int)(w->stamp - render_sample_time);
+			if (at <= pos) {	// write is due (or even late): apply it before rendering further
+				apply_write(w);
+				pop_write();
+				continue;
+			}
+			if (at < len)
+				until = at;
+		}
+		// Render samples from the four SIDs
+		for (int i = 0; i < NUMBER_OF_SIDS; i++) {
+			if (XEMU_UNLIKELY(!(configdb.sidmask & (1 << i))))
+				memset(STREAMS(4 + i) + pos, 0, (until - pos) * sizeof(Sint16));
+			else
+				sid_render(&sid[i], STREAMS(4 + i) + pos, until - pos, 1);
+		}
+		// Render samples for the OPL3 emulation
+		if (XEMU_LIKELY(!configdb.noopl3)) {
+			OPL3_GenerateStream(&opl3, STREAMS(8) + pos, STREAMS(9) + pos, until - pos, 1, 1);
+		} else {
+			memset(STREAMS(8) + pos, 0, (until - pos) * sizeof(Sint16));
+			memset(STREAMS(9) + pos, 0, (until - pos) * sizeof(Sint16));
+		}
+		pos = until;
+	}
+	render_sample_time += len;
+}
+
+
 static void audio_callback ( void *userdata, Uint8 *stereo_out_stream, int len )
 {
 	static Sint16 streams[STREAMS_SIZE_ALL];
@@ -251,6 +356,9 @@ static void audio_callback ( void *userdata, Uint8 *stereo_out_stream, int len )
 		// Render silence ...
 		// Here we use "len" as-is, since it's before the shift operation below, and means BYTES, what SDL is asking from us
 		memset(stereo_out_stream, 0, len);
+		// Register writes must be still applied, so SIDs/OPL3 have the right state if sound is enabled again
+		drain_writes();
+		render_sample_time = (Uint32)SDL_AtomicGet(&emu_sample_time);
 		return;
 	}
 	//DEBUGPRINT("AUDIO: audio callback, wants %d bytes to be rendered" NL, len);
@@ -263,25 +371,7 @@ static void audio_callback ( void *userdata, Uint8 *stereo_out_stream, int len )
 	// Render samples from the four audio DMA units
 	for (int i = 0; i < 4; i++)
 		render_dma_audio(i, STREAMS(i), len);
-	// Render samples from the four SIDs
-	for (int i = 0; i < NUMBER_OF_SIDS; i++) {
-		if (XEMU_UNLIKELY(!(configdb.sidmask & (1 << i)))) {
-			memset(STREAMS(4 + i), 0, len * sizeof(Sint16));
-			continue;
-		}
-		LOCK_SID("RENDER", i);
-		sid_render(&sid[i], STREAMS(4 + i), len, 1);
-		UNLOCK_SID("RENDER", i);
-	}
-	// Render samples for the OPL3 emulation
-	if (XEMU_LIKELY(!configdb.noopl3)) {
-		LOCK_OPL("RENDER");
-		OPL3_GenerateStream(&opl3, STREAMS(8), STREAMS(9), len, 1, 1);
-		UNLOCK_OPL("RENDER");
-	} else {
-		memset(STREAMS(8), 0, len * sizeof(Sint16));
-		memset(STREAMS(9), 0, len * sizeof(Sint16));
-	}
+	render_sid_opl3(streams, len);
 	// Now mix the result ...
 	for (int i = 0, j = 0; i < len; i++) {
 		// do the mixing stuff. NOTE: it seems on modern CPUs, using float/doubles can be even faster than integer math where I also need a division ...
@@ -311,6 +401,89 @@ static void audio_callback ( void *userdata, Uint8 *stereo_out_stream, int len )
 	}
 #endif
 }
+
+
+static void write_wav_header ( void )
+{
+	// 16 bit signed stereo PCM (stored as little-endian: it's the byte order of the render buffer on all supported hosts)
+	const Uint32 rate = system_sound_mix_freq;
+	Uint8 h[44];
+	memcpy(h +  0, "RIFF", 4);
+	h[ 4] = (capture_bytes + 36) & 0xFF; h[5] = ((capture_bytes + 36) >> 8) & 0xFF; h[6] = ((capture_bytes + 36) >> 16) & 0xFF; h[7] = (capture_bytes + 36) >> 24;
+	memcpy(h +  8, "WAVEfmt ", 8);
+	h[16] = 16; h[17] = 0; h[18] = 0; h[19] = 0;	// size of the "fmt " chunk
+	h[20] = 1;  h[21] = 0;				// format: PCM
+	h[22] = 2;  h[23] = 0;				// channels: stereo
+	h[24] = rate & 0xFF; h[25] = (rate >> 8) & 0xFF; h[26] = (rate >> 16) & 0xFF; h[27] = rate >> 24;
+	h[28] = (rate * 4) & 0xFF; h[29] = ((rate * 4) >> 8) & 0xFF; h[30] = ((rate * 4) >> 16) & 0xFF; h[31] = (rate * 4) >> 24;	// bytes per sec
+	h[32] = 4;  h[33] = 0;				// block align: bytes per "frame" (both channels)
+	h[34] = 16; h[35] = 0;				// bits per sample
+	memcpy(h + 36, "data", 4);
+	h[40] = capture_bytes & 0xFF; h[41] = (capture_bytes >> 8) & 0xFF; h[42] = (capture_bytes >> 16) & 0xFF; h[43] = capture_bytes >> 24;
+	if (lseek(capture_fd, 0, SEEK_SET) != 0 || xemu_safe_write(capture_fd, h, sizeof h) != sizeof h)
+		DEBUGPRINT("AUDIO: capture: cannot write WAV header" NL);
+}
+
+
+static void capture_open ( const char *fn )
+{
+	capture_fd = xemu_open_file(fn, O_CREAT | O_TRUNC | O_WRONLY, NULL, NULL);
+	if (capture_fd < 0) {
+		ERROR_WINDOW("Cannot create audio capture file:\n%s", fn);
+		return;
+	}
+	const char *ext = strrchr(fn, '.');
+	capture_is_wav = ext && !strcasecmp(ext, ".wav");
+	capture_bytes = 0;
+	if (capture_is_wav)
+		write_wav_header();	// with zero sizes for now, we will update it on closing the capture
+	DEBUGPRINT("AUDIO: capturing %s audio, rendered by emulated time, into file: %s" NL, capture_is_wav ? "WAV" : "raw (16 bit stereo)", fn);
+}
+
+
+void audio65_shutdown ( void )
+{
+	if (capture_fd < 0)
+		return;
+	if (capture_is_wav)
+		write_wav_header();
+	xemu_safe_close(capture_fd);
+	capture_fd = -1;
+	DEBUGPRINT("AUDIO: capture has been closed, %u bytes of audio data" NL, capture_bytes);
+}
+
+
+// Without an SDL audio device (headless mode, or audio capture) nobody would call audio_callback(), though audio DMA
+// (including its address registers, readable by programs), SID and OPL3 state is advanced by rendering.
+// So in this case the emulator pulls rendering itself, driven by the emulated time (see audio65_scanline_tick()),
+// rendering all the samples up to the current emulated time. The result is written into the capture file (if any).
+void audio65_offline_pull ( void )
+{
+	static Sint16 stereo_buffer[AUDIO_BUFFER_SAMPLES_MAX * 2];
+	if (XEMU_LIKELY(!offline_render))
+		return;
+	int samples = (int)((Uint32)SDL_AtomicGet(&emu_sample_time) - render_sample_time);
+	while (samples > 0) {
+		const int len = samples > AUDIO_BUFFER_SAMPLES_MAX ? AUDIO_BUFFER_SAMPLES_MAX : samples;
+		audio_callback(NULL, (Uint8*)stereo_buffer, len << 2);	// len << 2: callback wants the size in bytes (stereo, 16 bit samples)
+		samples -= len;
+		if (capture_fd >= 0) {
+			if (xemu_safe_write(capture_fd, stereo_buffer, len << 2) == len << 2) {
+				capture_bytes += len << 2;
+			} else {
+				ERROR_WINDOW("Cannot write audio capture file, stopping capture");
+				audio65_shutdown();
+			}
+		}
+	}
+}
+#else
+void audio65_offline_pull ( void )
+{
+}
+void audio65_shutdown ( void )
+{
+}
 #endif
 
 
@@ -359,14 +532,15 @@ void audio65_reset ( void )
 {
 	// We always initialize SIDs/OPL, even if no audio emulation is compiled in
 	// Since there can be problem to write SID registers otherwise?
-	for (int i = 0; i < NUMBER_OF_SIDS; i++) {
-		LOCK_SID("RESET", i);
+	// The audio thread must not render meanwhile. Pending register writes are dropped, as the chips are reset anyway.
+	if (audio)
+		SDL_LockAudioDevice(audio);
+	SDL_AtomicSet(&write_queue_tail, SDL_AtomicGet(&write_queue_head));
+	for (int i = 0; i < NUMBER_OF_SIDS; i++)
 		sid_init(&sid[i], system_sid_cycles_per_sec, system_sound_mix_freq);
-		UNLOCK_SID("RESET", i);
-	}
-	LOCK_OPL("RESET");
 	OPL3_Reset(&opl3, system_sound_mix_freq);
-	UNLOCK_OPL("RESET");
+	if (audio)
+		SDL_UnlockAudioDevice(audio);
 	DEBUGPRINT("AUDIO: reset for %d SIDs (%d cycles per sec) and 1 OPL3 chip for %dHz sampling rate." NL, NUMBER_OF_SIDS, system_sid_cycles_per_sec, system_sound_mix_freq);
 	audio65_clear_regs();
 }
@@ -383,6 +557,7 @@ void audio65_start ( void )
 	if (!audio)
 		return;
 	DEBUGPRINT("AUDIO: start mixing." NL);
+	consumer_is_running = true;
 	SDL_PauseAudioDevice(audio, 0);
 }
 
@@ -546,9 +721,6 @@ void audio65_init ( int sid_cycles_per_sec, int sound_mix_freq, int volume, unsi
 	mono_downmix = false;
 	set_volume(volume);
 	audio65_reset_mixer();
-	for (int i = 0; i < NUMBER_OF_SIDS; i++)
-		UNLOCK_SID("INIT", i);
-	UNLOCK_OPL("INIT");
 	system_sound_mix_freq = sound_mix_freq;
 	system_sid_cycles_per_sec = sid_cycles_per_sec;
 	audio65_reset();
@@ -564,6 +736,13 @@ void audio65_init ( int sid_cycles_per_sec, int sound_mix_freq, int volume, unsi
 	audio_want.userdata = NULL;		// Not used, "userdata" parameter passed to the callback by SDL
 	if (audio)
 		ERROR_WINDOW("audio was not zero before calling SDL_OpenAudioDevice!");
+	if (configdb.audiocapture && *configdb.audiocapture)
+		capture_open(configdb.audiocapture);
+	if (emu_is_headless || capture_fd >= 0) {
+		offline_render = true;
+		DEBUGPRINT("AUDIO: %s, no audio device, offline rendering is pulled by the emulation, %d Hz." NL, capture_fd >= 0 ? "capture mode" : "headless mode", sound_mix_freq);
+		return;
+	}
 	audio = SDL_OpenAudioDevice(NULL, 0, &audio_want, &audio_got, 0);
 	if (audio) {
 		for (int i = 0; i < SDL_GetNumAudioDevices(0); i++)
@@ -584,3 +763,51 @@ void audio65_init ( int sid_cycles_per_sec, int sound_mix_freq, int volume, unsi
 	DEBUGPRINT("AUDIO: has been disabled at compilation time." NL);
 #endif
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+// The internal state of the SID and OPL3 emulators is not stored (it's owned by the audio thread),
+// instead the last written register values are stored and replayed through the write queue on load.
+
+#define SNAPSHOT_AUDIO_BLOCK_VERSION	0
+#define SNAPSHOT_AUDIO_BLOCK_SIZE	0x400
+
+
+int audio65_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[SNAPSHOT_AUDIO_BLOCK_SIZE];
+	if (block->block_version != SNAPSHOT_AUDIO_BLOCK_VERSION || block->sub_counter || block->sub_size != sizeof buffer)
+		RETURN_XSNAPERR_USER("Bad audio block syntax");
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	for (int i = 0; i < NUMBER_OF_SIDS * 0x20; i++)
+		audio65_sid_write(i, buffer[i]);
+	for (int i = 0; i < 0x100; i++)
+		audio65_opl3_write(i, buffer[0x100 + i]);
+	for (int i = 0; i < 0x100; i++)
+		write_mixer_register(i, buffer[0x200 + i]);
+	mixer_register = buffer[0x300];
+	recalulate_scalers();
+	return 0;
+}
+
+
+int audio65_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_AUDIO_BLOCK_SIZE];
+	const int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_AUDIO_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	memcpy(buffer, sid_shadow_regs, sizeof sid_shadow_regs);
+	memcpy(buffer + 0x100, opl3_shadow_regs, sizeof opl3_shadow_regs);
+	memcpy(buffer + 0x200, mixer_bytes, sizeof mixer_bytes);
+	buffer[0x300] = mixer_register;
+	return xemusnap_write_sub_block(buffer, sizeof buffer);
+}
+
+#endif
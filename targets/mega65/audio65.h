@@ -45,6 +45,9 @@ extern void audio65_start ( void );
 extern void audio65_opl3_write ( Uint8 reg, Uint8 data );
 extern void audio65_sid_write ( const int addr, const Uint8 data );
 extern void audio65_sid_inc_framecount ( void );
+extern void audio65_offline_pull ( void );
+extern void audio65_scanline_tick ( void );
+extern void audio65_shutdown ( void );
 extern void audio_set_stereo_parameters ( int vol, int sep );
 
 extern Uint8 audio65_read_mixer_register  ( void );
@@ -58,4 +61,10 @@ extern void  audio65_set_output ( const int val );
 extern int   audio65_get_output ( void );
 extern size_t audio65_get_description ( char *buffer, const size_t buffer_size );
 
+#ifdef XEMU_SNAPSHOT_SUPPORT
+#include "xemu/emutools_snapshot.h"
+extern int   audio65_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+extern int   audio65_snapshot_save_state ( const struct xemu_snapshot_definition_st *def );
+#endif
+
 #endif
@@ -57,6 +57,13 @@ static const struct xemutools_configdef_str_st str_options[] = {
 	{ "sdimg",	SDCARD_NAME, "Override path of SD-image to be used (also see the -virtsd option!)", &configdb.sdimg },
 	{ "dumpmem",	NULL, "Save memory content on exit", &configdb.dumpmem },
 	{ "dumpscreen",	NULL, "Save screen content (ASCII) on exit", &configdb.dumpscreen },
+	{ "profilecsv",	NULL, "Enable the main loop profiler and write per-frame statistics into a CSV file", &configdb.profilecsv },
+	{ "guestprof",	NULL, "Enable the guest code (CPU) profiler from the start, and write its report into the given file on exit", &configdb.guestprof },
+#ifdef XEMU_SNAPSHOT_SUPPORT
+	{ "snapload",	NULL, "Load a snapshot from the given file", &configdb.snapload },
+	{ "snapsave",	NULL, "Save a snapshot into the given file before Xemu would exit", &configdb.snapsave },
+#endif
+	{ "audiocapture", NULL, "Render audio by emulated time (no audio device) into a WAV (.wav extension) or raw file", &configdb.audiocapture },
 #ifdef XEMU_FILES_SCREENSHOT_SUPPORT
 	{ "screenshot",	NULL, "Save screenshot (PNG) on exit and vice-versa (for testing!)", &configdb.screenshot_and_exit },
 #endif
@@ -85,6 +92,9 @@ static const struct xemutools_configdef_str_st str_options[] = {
 
 static const struct xemutools_configdef_switch_st switch_options[] = {
 	{ "cpusinglestep", "Force CPU emulation to do single step emulation (slower!)", &configdb.cpusinglestep },
+#ifdef CPU65_PREDECODE_SUPPORT
+	{ "cpupredecode", "EXPERIMENTAL: cache decoded opcodes of the main RAM and dispatch them directly (computed goto)", &configdb.cpupredecode },
+#endif
 	{ "hdosvirt", "Virtualize HDOS file access functions, but via only traps", &configdb.hdosvirt },
 	{ "driveled", "Render drive LED at the top right corner of the screen", &configdb.show_drive_led },
 	{ "allowmousegrab", "Allow auto mouse grab with left-click", &allow_mouse_grab },
@@ -99,6 +109,15 @@ static const struct xemutools_configdef_switch_st switch_options[] = {
 	{ "romfromsd", "Force ROM to be used from SD-card", &configdb.romfromsd },
 	{ "defd81fromsd", "Force default D81 to be used from SD-card", &configdb.defd81fromsd },
 	{ "testing", "Turn on features allows program to do privileged things", &configdb.testing },
+#ifdef SD_IMAGE_MMAP_SUPPORT
+	{ "sdnommap", "Do not use memory mapped access of the SD-card image, but file I/O for each block", &configdb.sdnommap },
+#endif
+#ifdef SD_ASYNC_IO_SUPPORT
+	{ "sdasyncio", "Do SD-card block I/O on a separate thread, the emulation does not wait for the host storage", &configdb.sdasyncio },
+#endif
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+	{ "sdrleprefetch", "Decompress the next page of a compressed SD-card image in advance, on a separate thread", &configdb.sdrleprefetch },
+#endif
 #ifdef VIRTUAL_DISK_IMAGE_SUPPORT
 	{ "virtsd", "Interpret -sdimg option as a DIRECTORY to be fed onto the FAT32FS and use virtual-in-memory disk storage.", &configdb.virtsd },
 #endif
@@ -107,11 +126,18 @@ static const struct xemutools_configdef_switch_st switch_options[] = {
 	{ "syscon", "Keep system console open (Windows-specific effect only)", &configdb.syscon },
 	{ "skipunhandledmem", "Do not even ask on unhandled memory access (hides problems!!)", &configdb.skip_unhandled_mem },
 	{ "fullborders", "Show non-clipped display borders", &configdb.fullborders },
+#ifdef XEMU_SNAPSHOT_SUPPORT
+	{ "snapdelta", "Save snapshots only with the memory pages changed since the snapshot loaded by -snapload", &configdb.snapdelta },
+#endif
+	{ "profiler", "Enable the main loop profiler (see UART monitor ~profile command, matrix mode prof command)", &configdb.profiler },
 	{ "nosound", "Disables audio output generation", &configdb.nosound },
 	{ "noopl3", "Disables OPL3 emulation", &configdb.noopl3 },
 	{ "lockvideostd", "Lock video standard (programs cannot change it)", &configdb.lock_videostd },
 	{ "curskeyjoy", "Cursor keys as joystick [makes your emulator unsable to move cursor in BASIC/etc!]", &hid_joy_on_cursor_keys },
 	{ "showscanlines", "Show scanlines in V200 modes", &configdb.show_scanlines },
+#ifdef VIC4_RENDER_THREAD_SUPPORT
+	{ "victhread", "EXPERIMENTAL: render VIC-IV scanlines on a separate thread (pipelined by one scanline)", &configdb.victhread },
+#endif
 	{ "allowscanlines", "Allow user programs to control scanline visibility", &configdb.allow_scanlines },
 	{ "fastboot", "Try to use sleepless emulation mode during booting", &configdb.fastboot },
 	{ "matrixstart", "Start with matrix-mode activated", &configdb.matrixstart },
@@ -142,6 +168,16 @@ static const struct xemutools_configdef_num_st num_options[] = {
 	{ "audiobuffersize", AUDIO_BUFFER_SAMPLES_DEFAULT, "Audio buffer size in BYTES", &configdb.audiobuffersize, AUDIO_BUFFER_SAMPLES_MIN, AUDIO_BUFFER_SAMPLES_MAX },
 	{ "coloureffect", 0, "Colour effect to be applied to the SDL output (0=none, 1=grayscale, 2=green-monitor, ...)", &configdb.colour_effect, 0, 255 },
 	{ "joyport", 2, "Default joystick port to emulate (1 or 2)", &configdb.joyport, 1, 2 },
+	{ "fdctiming", 0, "F011 floppy timing (0 = instant, 1 = accurate step/rotational latency, 2 = turbo: accurate, except sequential reads are instant)", &configdb.fdctiming, 0, 2 },
+#ifdef SD_ASYNC_IO_SUPPORT
+	{ "sdlatency", 0, "Emulated latency of SD-card block operations in usecs, the controller is BUSY meanwhile (0 = no latency)", &configdb.sdlatency, 0, 100000 },
+#endif
+#ifdef RLE_COMPRESSED_DISK_IMAGE_SUPPORT
+	{ "sdrlecache", 16, "Number of 64K pages to cache (LRU) of the decompressed data of a compressed SD-card image", &configdb.sdrlecache, 1, 1024 },
+#endif
+#ifdef VIRTUAL_DISK_IMAGE_SUPPORT
+	{ "virtsdmaxmem", 0, "Memory limit of the -virtsd in-memory disk data in Mbytes, over that a temporary file is used (0 = no limit). The block index (max 32Mbytes) is always in memory", &configdb.virtsdmaxmem, 0, 0x100000 },
+#endif
 	{ "resethotkeytype", RESET_MEGA65_HARD, "Default reset type for reset hotkey, if enabled", &configdb.resethotkeytype, 1, RESET_MEGA65_LAST_ID },
 	{ NULL }
 };
@@ -162,9 +198,12 @@ static const void *do_not_save_opts[] = {
 	&configdb.prg, &configdb.prgmode, &configdb.autoload, &configdb.go64, &configdb.hyperserialfile, &configdb.importbas,
 	&configdb.testing,
 	&configdb.matrixstart,
-	&configdb.dumpmem, &configdb.dumpscreen,
+	&configdb.dumpmem, &configdb.dumpscreen, &configdb.audiocapture, &configdb.profilecsv, &configdb.profiler, &configdb.guestprof,
 #ifdef	XEMU_FILES_SCREENSHOT_SUPPORT
 	&configdb.screenshot_and_exit,
+#endif
+#ifdef	XEMU_SNAPSHOT_SUPPORT
+	&configdb.snapload, &configdb.snapsave, &configdb.snapdelta,
 #endif
 	&configdb.testing, &configdb.hyperdebug, &configdb.hyperdebugfreezer, &configdb.usestubrom, &configdb.useinitrom, &configdb.useutilmenu,
 	&configdb.cart, &configdb.winpos, &configdb.ramcheckread, &configdb.init_attic,
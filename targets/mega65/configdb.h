@@ -55,6 +55,14 @@ struct configdb_st {
 	char	*sdimg;
 	char	*dumpmem;
 	char	*dumpscreen;
+	char	*audiocapture;
+	char	*profilecsv;
+	char	*guestprof;
+#ifdef XEMU_SNAPSHOT_SUPPORT
+	char	*snapload;
+	char	*snapsave;
+	int	snapdelta;
+#endif
 #ifdef XEMU_FILES_SCREENSHOT_SUPPORT
 	char	*screenshot_and_exit;
 #endif
@@ -76,6 +84,13 @@ struct configdb_st {
 	int	show_scanlines;
 	int	allow_scanlines;
 	int	fullborders;
+	int	profiler;
+#ifdef VIC4_RENDER_THREAD_SUPPORT
+	int	victhread;
+#endif
+#ifdef CPU65_PREDECODE_SUPPORT
+	int	cpupredecode;
+#endif
 	int	hdosvirt;
 	int	show_drive_led;
 	int	allowfreezer;
@@ -86,8 +101,23 @@ struct configdb_st {
 	int	usestubrom;
 	int	useinitrom;
 	int	useutilmenu;
+#ifdef SD_IMAGE_MMAP_SUPPORT
+	int	sdnommap;
+#endif
+#ifdef RLE_COMPRESSED_DISK_IMAGE_SUPPORT
+	int	sdrlecache;
+#endif
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+	int	sdrleprefetch;
+#endif
+#ifdef SD_ASYNC_IO_SUPPORT
+	int	sdasyncio;
+	int	sdlatency;
+#endif
+	int	fdctiming;
 #ifdef VIRTUAL_DISK_IMAGE_SUPPORT
 	int	virtsd;
+	int	virtsdmaxmem;
 #endif
 	int	go64;
 	int	autoload;
@@ -66,6 +66,7 @@ static int   with_io;			// legacy MEGA65 stuff, should be removed? 0x80 or 0
 static unsigned int list_entry_pos = 0;
 static bool  mb_cross_global = false;	// allow to cross megabyte boundary
 static bool  mb_cross;			// (same as above, for the current session though)
+static bool  bulk_op;			// current COPY/FILL operation is "simple" enough to be done in bulk (see dma_bulk_chunk())
 
 // On C65, DMA cannot cross 64K boundaries, so the right mask is 0xFFFF
 // On MEGA65 it seems to be 1Mbyte, thus the mask should be 0xFFFFF
@@ -637,6 +638,11 @@ int dma_update ( void )
 			length = 0x10000;			// I *think* length of zero means 64K. Probably it's not true!!
 		if (in_hypervisor)
 			mb_cross = false;			// Megabyte-crossing is disabled in hypervisor mode!
+		// The very common case of linear COPY/FILL (step 1, no modulo, no I/O, no LDM, no transparency
+		// for COPY) can be done with memmove()/memset(), if it's plain RAM (that is checked run-time)
+		bulk_op = (dma_op == COPY_OP || dma_op == FILL_OP) && !modulo.used &&
+			target.step == 0x100 && !target.also_io && !(target.ldm.slope_type & 0x80) &&
+			(dma_op == FILL_OP || (source.step == 0x100 && !source.also_io && !(source.ldm.slope_type & 0x80) && transparency > 0xFFU));
 		return cycles;
 	}
 	// We have valid command to be executed, or continue to execute
@@ -712,10 +718,64 @@ int dma_update ( void )
 }
 
 
+// Executes at most "max_bytes" bytes of the current bulk COPY/FILL operation, using direct memory access on
+// plain RAM. The last byte of the operation is never done here, so dma_update() will handle the end of the
+// operation (chained list, etc) as usual. Returns the number of bytes done, which can be zero, if the current
+// source or target page is not plain RAM: then dma_update() must be used for the next byte.
+static int dma_bulk_chunk ( int max_bytes )
+{
+	if (max_bytes > length - 1)
+		max_bytes = length - 1;
+	int done = 0;
+	while (done < max_bytes) {
+		const int t_addr = DMA_ADDRESSING(target);
+		Uint8 *t = memory_dma_target_direct_wr(t_addr);
+		if (!t)
+			break;
+		int n = 0x100 - (t_addr & 0xFF);	// direct pointers are valid only till the end of the given page
+		if (n > max_bytes - done)
+			n = max_bytes - done;
+		if (dma_op == COPY_OP) {
+			const int s_addr = DMA_ADDRESSING(source);
+			const Uint8 *s = memory_dma_source_direct_rd(s_addr);
+			if (!s)
+				break;
+			if (n > 0x100 - (s_addr & 0xFF))
+				n = 0x100 - (s_addr & 0xFF);
+			if (XEMU_UNLIKELY(t > s && t < s + n)) {
+				// overlapping with target ahead: must be done forward byte-by-byte, as DMA would do (replicating the pattern)
+				for (int i = 0; i < n; i++)
+					t[i] = s[i];
+			} else
+				memmove(t, s, n);
+			source.addr += (n - 1) * 0x100;
+			address_stepping(&source);	// do the last step normally, as it can cross megabyte boundary
+		} else if ((unsigned int)filler_byte != transparency) {
+			memset(t, filler_byte, n);
+		}
+		target.addr += (n - 1) * 0x100;
+		address_stepping(&target);
+		length -= n;
+		done += n;
+	}
+	return done;
+}
+
+
 int dma_update_multi_steps ( const int do_for_cycles )
 {
 	int cycles = 0;
 	while (cycles <= do_for_cycles && in_dma) {
+		if (bulk_op && command != -1 && length > 1) {
+			// Same per-byte cycle count as dma_update() uses for COPY/FILL. The number of bytes is also
+			// the same as the byte-by-byte loop would do, that is, the cycle accounting does not change.
+			const int cycles_per_byte = dma_op == COPY_OP ? 2 : 1;
+			const int done = dma_bulk_chunk((do_for_cycles - cycles) / cycles_per_byte + 1);
+			if (done) {
+				cycles += done * cycles_per_byte;
+				continue;
+			}
+		}
 		cycles += dma_update();
 	}
 	return cycles;
@@ -751,6 +811,7 @@ void dma_reset ( void )
 {
 	command = -1;	// no command is fetched yet
 	in_dma = 0;
+	bulk_op = false;
 	source.base = 0;
 	target.base = 0;
 	list_addr = 0;
@@ -803,3 +864,136 @@ void dma_set_list_addr_from_bytes ( const Uint8 *p )
 	list_addr = p[0] + (p[1] << 8) + (p[2] << 16) + ((p[3] & 0x0F) << 24);
 	DEBUGDMA("DMA: list address is set 'externally' to $%X" NL, list_addr);
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+// Unlike the C65 emulator, the full state of the DMA engine is stored, thus a snapshot
+// can be taken (and restored) even in the middle of an on-going DMA session.
+
+#include <string.h>
+
+#define SNAPSHOT_DMA_BLOCK_VERSION	0
+#define SNAPSHOT_DMA_BLOCK_SIZE		0x100
+
+
+static void channel_to_snapshot ( Uint8 *p, const struct dma_channel_st *channel )
+{
+	U32_AS_BE(p +  0, channel->addr);
+	U32_AS_BE(p +  4, channel->base);
+	U32_AS_BE(p +  8, channel->step);
+	U32_AS_BE(p + 12, channel->is_modulo);
+	U32_AS_BE(p + 16, channel->also_io);
+	U32_AS_BE(p + 20, channel->ldm.x_col);
+	U32_AS_BE(p + 24, channel->ldm.y_col);
+	U32_AS_BE(p + 28, channel->ldm.slope);
+	U32_AS_BE(p + 32, channel->ldm.slope_accu);
+	p[36] = channel->addr_fract;
+	p[37] = channel->step_fract;
+	p[38] = channel->step_int;
+	p[39] = channel->mbyte;
+	p[40] = channel->ldm.slope_type;
+}
+
+
+static void channel_from_snapshot ( const Uint8 *p, struct dma_channel_st *channel )
+{
+	channel->addr		= (int)P_AS_BE32(p +  0);
+	channel->base		= (int)P_AS_BE32(p +  4);
+	channel->step		= (int)P_AS_BE32(p +  8);
+	channel->is_modulo	= (int)P_AS_BE32(p + 12);
+	channel->also_io	= (int)P_AS_BE32(p + 16);
+	channel->ldm.x_col	= P_AS_BE32(p + 20);
+	channel->ldm.y_col	= P_AS_BE32(p + 24);
+	channel->ldm.slope	= P_AS_BE32(p + 28);
+	channel->ldm.slope_accu	= P_AS_BE32(p + 32);
+	channel->addr_fract	= p[36];
+	channel->step_fract	= p[37];
+	channel->step_int	= p[38];
+	channel->mbyte		= p[39];
+	channel->ldm.slope_type	= p[40];
+}
+
+
+int dma_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[SNAPSHOT_DMA_BLOCK_SIZE];
+	if (block->block_version != SNAPSHOT_DMA_BLOCK_VERSION || block->sub_counter || block->sub_size != sizeof buffer)
+		RETURN_XSNAPERR_USER("Bad DMA block syntax");
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	in_dma			= buffer[0];
+	dma_op			= (enum dma_op_types)(buffer[1] & 3);
+	memcpy(minterms, buffer + 2, sizeof minterms);
+	filler_byte		= buffer[6];
+	length_byte3		= buffer[7];
+	mb_cross_global		= !!buffer[8];
+	mb_cross		= !!buffer[9];
+	bulk_op			= !!buffer[10];
+	transparency		= P_AS_BE32(buffer + 0x10);
+	default_revision	= (int)P_AS_BE32(buffer + 0x14);
+	session_revision	= (int)P_AS_BE32(buffer + 0x18);
+	length			= (int)P_AS_BE32(buffer + 0x1C);
+	command			= (int)P_AS_BE32(buffer + 0x20);
+	chained			= (int)P_AS_BE32(buffer + 0x24);
+	list_addr		= (int)P_AS_BE32(buffer + 0x28);
+	list_addr_policy	= (int)P_AS_BE32(buffer + 0x2C);
+	enhanced_mode		= (int)P_AS_BE32(buffer + 0x30);
+	with_io			= (int)P_AS_BE32(buffer + 0x34);
+	list_entry_pos		= P_AS_BE32(buffer + 0x38);
+	// modulo.enabled is not part of the state, it's a feature selection of the emulator
+	modulo.used		= (int)P_AS_BE32(buffer + 0x40);
+	modulo.col_counter	= (int)P_AS_BE32(buffer + 0x44);
+	modulo.col_limit	= (int)P_AS_BE32(buffer + 0x48);
+	modulo.row_counter	= (int)P_AS_BE32(buffer + 0x4C);
+	modulo.row_limit	= (int)P_AS_BE32(buffer + 0x50);
+	modulo.value		= (int)P_AS_BE32(buffer + 0x54);
+	channel_from_snapshot(buffer + 0x80, &source);
+	channel_from_snapshot(buffer + 0xC0, &target);
+	if (in_dma)
+		cpu65.multi_step_stop_trigger = 1;
+	return 0;
+}
+
+
+int dma_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_DMA_BLOCK_SIZE];
+	const int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_DMA_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	buffer[0] = in_dma;
+	buffer[1] = dma_op;
+	memcpy(buffer + 2, minterms, sizeof minterms);
+	buffer[6] = filler_byte;
+	buffer[7] = length_byte3;
+	buffer[8] = mb_cross_global ? 1 : 0;
+	buffer[9] = mb_cross ? 1 : 0;
+	buffer[10] = bulk_op ? 1 : 0;
+	U32_AS_BE(buffer + 0x10, transparency);
+	U32_AS_BE(buffer + 0x14, default_revision);
+	U32_AS_BE(buffer + 0x18, session_revision);
+	U32_AS_BE(buffer + 0x1C, length);
+	U32_AS_BE(buffer + 0x20, command);
+	U32_AS_BE(buffer + 0x24, chained);
+	U32_AS_BE(buffer + 0x28, list_addr);
+	U32_AS_BE(buffer + 0x2C, list_addr_policy);
+	U32_AS_BE(buffer + 0x30, enhanced_mode);
+	U32_AS_BE(buffer + 0x34, with_io);
+	U32_AS_BE(buffer + 0x38, list_entry_pos);
+	U32_AS_BE(buffer + 0x40, modulo.used);
+	U32_AS_BE(buffer + 0x44, modulo.col_counter);
+	U32_AS_BE(buffer + 0x48, modulo.col_limit);
+	U32_AS_BE(buffer + 0x4C, modulo.row_counter);
+	U32_AS_BE(buffer + 0x50, modulo.row_limit);
+	U32_AS_BE(buffer + 0x54, modulo.value);
+	channel_to_snapshot(buffer + 0x80, &source);
+	channel_to_snapshot(buffer + 0xC0, &target);
+	return xemusnap_write_sub_block(buffer, sizeof buffer);
+}
+
+#endif
@@ -70,6 +70,7 @@ static struct {
 	//int (*reader)(Uint32 block, void *data);
 	//int (*writer)(Uint32 block, void *data);
 	mfat_io_callback_func_t reader, writer;
+	mfat_io_multi_callback_func_t multi_reader, multi_writer;	// optional, can be NULL
 	Uint32	blocks;
 	int	part;	// selected partition number
 } disk;
@@ -94,6 +95,32 @@ static int mfat_write_DEVICE_blk ( Uint32 block, void *buf )
 	}
 	return disk.writer(block, buf);
 }
+static int mfat_read_DEVICE_blks ( Uint32 block, void *buf, Uint32 count )
+{
+	if (block >= disk.blocks || count > disk.blocks - block) {
+		FATDEBUGPRINT("FATFS: WARNING: Host FS: reading outside of the device" NL);
+		return -1;
+	}
+	if (disk.multi_reader)
+		return disk.multi_reader(block, buf, count);
+	for (; count; count--, block++, buf = (Uint8*)buf + 512)
+		if (disk.reader(block, buf))
+			return -1;
+	return 0;
+}
+static int mfat_write_DEVICE_blks ( Uint32 block, void *buf, Uint32 count )
+{
+	if (block >= disk.blocks || count > disk.blocks - block) {
+		FATDEBUGPRINT("FATFS: WARNING: Host FS: writing outside of the device" NL);
+		return -1;
+	}
+	if (disk.multi_writer)
+		return disk.multi_writer(block, buf, count);
+	for (; count; count--, block++, buf = (Uint8*)buf + 512)
+		if (disk.writer(block, buf))
+			return -1;
+	return 0;
+}
 
 static int mfat_read_part_blk ( Uint32 block, void *buf )
 {
@@ -119,6 +146,30 @@ static int mfat_write_part_blk ( Uint32 block, void *buf )
 	}
 	return mfat_write_DEVICE_blk(block + mfat_partitions[disk.part].first_block, buf);
 }
+static int mfat_read_part_blks ( Uint32 block, void *buf, Uint32 count )
+{
+	if (disk.part < 0) {
+		FATDEBUGPRINT("FATFS: WARNING: read partition block: invalid partition is selected" NL);
+		return -1;
+	}
+	if (block >= mfat_partitions[disk.part].blocks || count > mfat_partitions[disk.part].blocks - block) {
+		FATDEBUGPRINT("FATFS: WARNING: read partition block: trying to read block outside of partition!" NL);
+		return -1;
+	}
+	return mfat_read_DEVICE_blks(block + mfat_partitions[disk.part].first_block, buf, count);
+}
+static int mfat_write_part_blks ( Uint32 block, void *buf, Uint32 count )
+{
+	if (disk.part < 0) {
+		FATDEBUGPRINT("FATFS: WARNING: write partition block: invalid partition is selected" NL);
+		return -1;
+	}
+	if (block >= mfat_partitions[disk.part].blocks || count > mfat_partitions[disk.part].blocks - block) {
+		FATDEBUGPRINT("FATFS: WARNING: write partition block: trying to write block outside of partition!" NL);
+		return -1;
+	}
+	return mfat_write_DEVICE_blks(block + mfat_partitions[disk.part].first_block, buf, count);
+}
 
 static int mfat_read_cluster ( Uint32 cluster, Uint32 block_in_cluster, void *buf )
 {
@@ -151,32 +202,56 @@ static int mfat_write_cluster ( Uint32 cluster, Uint32 block_in_cluster, void *b
 #define AS_DWORD(p,o)	(p[o] + (p[o+1] << 8) + (p[o+2] << 16) + (p[o+3] << 24))
 
 
+#define FAT_CACHE_BLOCKS	16	// number of consecutive FAT blocks kept in the cache (must be <= 32, see "dirty")
+
+
 static struct {
-	Uint8  buf[512];
-	Uint32 block;
-	int    dirty;
-	int    ofs;
+	Uint8  buf[512 * FAT_CACHE_BLOCKS];
+	Uint32 block;		// first FAT block in the cache
+	int    blocks;		// number of blocks in the cache
+	Uint32 dirty;		// bitmask of the modified blocks in the cache
+	int    ofs;		// byte offset of the last accessed FAT entry within buf
 } fat_cache;
 
+static Uint32 fat_generation = 0;	// incremented on each FAT modification, extent caches of streams with older generation are invalid
 
 
 static int mfat_flush_fat_cache ( void )
 {
-	if (fat_cache.dirty) {
-		if (mfat_write_part_blk(fat_cache.block, fat_cache.buf))
+	// Also, we need to write the "backup" copy of FAT.
+	// We assume max of two FATs are used, but currenty, other parts of this source assumes ALWAYS two copies.
+	// To be careful, let's check it here though.
+	const int fat2_offset = fat_cache.dirty ? mfat_partitions[disk.part].fat2_start - mfat_partitions[disk.part].fat1_start : 0;
+	// Write out runs of modified blocks with one multi-block write for each
+	for (int a = 0; a < fat_cache.blocks && fat_cache.dirty; ) {
+		if (!(fat_cache.dirty & (1U << a))) {
+			a++;
+			continue;
+		}
+		int n = 1;
+		while (a + n < fat_cache.blocks && (fat_cache.dirty & (1U << (a + n))))
+			n++;
+		if (mfat_write_part_blks(fat_cache.block + a, fat_cache.buf + (a << 9), n))
 			return -1;
-		// Also, we need to write the "backup" copy of FAT.
-		// We assume max of two FATs are used, but currenty, other parts of this source assumes ALWAYS two copies.
-		// To be careful, let's check it here though.
-		int fat2_offset = mfat_partitions[disk.part].fat2_start - mfat_partitions[disk.part].fat1_start;
 		if (fat2_offset > 0)
-			mfat_write_part_blk(fat_cache.block + fat2_offset, fat_cache.buf);	// FIXME: should we error check this? if "main" FAT was OK to be written but not the "backup" one??
-		fat_cache.dirty = 0;
+			mfat_write_part_blks(fat_cache.block + a + fat2_offset, fat_cache.buf + (a << 9), n);	// FIXME: should we error check this? if "main" FAT was OK to be written but not the "backup" one??
+		for (int b = a; b < a + n; b++)
+			fat_cache.dirty &= ~(1U << b);
+		a += n;
 	}
 	return 0;
 }
 
 
+static void mfat_invalidate_fat_cache ( void )
+{
+	fat_cache.block = -1;
+	fat_cache.blocks = 0;
+	fat_cache.dirty = 0;
+	fat_generation++;
+}
+
+
 static int cluster_was_free;
 
 // Return value:
@@ -193,15 +268,22 @@ static Uint32 mfat_read_fat_chain ( Uint32 cluster )
 	}
 	Uint32 cluster_in = cluster;
 	block = mfat_partitions[disk.part].fat1_start + (cluster >> 7);
-	fat_cache.ofs   = (cluster & 127) << 2;
-	if (block != fat_cache.block) {
+	if (block < fat_cache.block || block >= fat_cache.block + fat_cache.blocks) {
 		mfat_flush_fat_cache();
-		if (mfat_read_part_blk(block, fat_cache.buf))
+		// Read as many FAT blocks at once as we can cache, but do not read over the end of FAT1
+		int blocks = mfat_partitions[disk.part].fat2_start - block;
+		if (blocks > FAT_CACHE_BLOCKS || blocks <= 0)
+			blocks = FAT_CACHE_BLOCKS;
+		if (mfat_read_part_blks(block, fat_cache.buf, blocks)) {
+			fat_cache.blocks = 0;
 			return 1;
+		}
 		fat_cache.block = block;
-		FATDEBUG("FATFS: UNCACHED block: %d" NL, block);
+		fat_cache.blocks = blocks;
+		FATDEBUG("FATFS: UNCACHED block: %d (%d blocks are read)" NL, block, blocks);
 	} else
 		FATDEBUG("FATFS: COOL, fat block is cached for %d" NL, block);
+	fat_cache.ofs = ((block - fat_cache.block) << 9) + ((cluster & 127) << 2);
 	cluster = AS_DWORD(fat_cache.buf, fat_cache.ofs) & 0x0FFFFFFFU;
 	FATDEBUG("FATFS: DEBUG: mfat_read_chain: got cluster: $%08X" NL, AS_DWORD(fat_cache.buf, fat_cache.ofs));
 	// In theory there is some "official" end-of-chain marker, but in reality it seems anything which is outside of normal
@@ -244,7 +326,8 @@ static int mfat_write_fat_chain ( Uint32 cluster, Uint32 next )
 	for (int a = fat_cache.ofs; a < fat_cache.ofs + 4; a++, next >>= 8) {
 		if (fat_cache.buf[a] != (Uint8)next) {
 			fat_cache.buf[a] = (Uint8)next;
-			fat_cache.dirty = 1;	// now we make the cache dirty, oh-oh
+			fat_cache.dirty |= 1U << (fat_cache.ofs >> 9);	// now we make the cache dirty, oh-oh
+			fat_generation++;
 		}
 	}
 	return 0;
@@ -326,8 +409,17 @@ void mfat_init ( mfat_io_callback_func_t reader, mfat_io_callback_func_t writer,
 	disk.writer = writer;
 	disk.blocks = device_size;
 	disk.part = -1;
-	fat_cache.block = -1;
-	fat_cache.dirty = 0;
+	disk.multi_reader = NULL;
+	disk.multi_writer = NULL;
+	mfat_invalidate_fat_cache();
+}
+
+
+// Optional: can be called after mfat_init() to give functions for multi-block transfers, otherwise reader/writer is called block by block
+void mfat_set_multi_block_io ( mfat_io_multi_callback_func_t reader, mfat_io_multi_callback_func_t writer )
+{
+	disk.multi_reader = reader;
+	disk.multi_writer = writer;
 }
 
 
@@ -342,8 +434,7 @@ int mfat_init_mbr ( void )
 	Uint8 cache[512], *p;
 	// DANGER WILL ROBINSON! Previous partition could be in use!! Flush cache!
 	mfat_flush_fat_cache();
-	fat_cache.block = -1;
-	fat_cache.dirty =  0;
+	mfat_invalidate_fat_cache();
 	// end of the danger zone
 	if (mfat_read_DEVICE_blk(0, cache))	// read MBR
 		return -1;
@@ -408,8 +499,7 @@ int mfat_use_part ( int part )
 	int previous_part = disk.part;
 	// DANGER WILL ROBINSON! Previous partition may be was in use! Flush cache!
 	mfat_flush_fat_cache();
-	fat_cache.block = -1;
-	fat_cache.dirty =  0;
+	mfat_invalidate_fat_cache();
 	// end of the danger zone
 	disk.part = part;
 	if (part < 0 || part > 3 || !mfat_partitions[part].valid)
@@ -536,6 +626,8 @@ void mfat_open_stream ( mfat_stream_t *p, Uint32 cluster )
 	p->file_pos = 0;
 	p->partition = &mfat_partitions[disk.part];
 	p->start_cluster = cluster;	// for rewind() like function?
+	p->extent_first = 0;		// no extent is known yet (cluster 0 cannot be part of a chain)
+	p->extent_last = 0;
 }
 
 
@@ -575,6 +667,45 @@ Uint32 mfat_get_real_size ( mfat_stream_t *p, int *fragmented )
 	return clusters * p->partition->cluster_size_in_blocks * 512;
 }
 
+#define MAX_EXTENT_SCAN	4096	// maximum number of clusters to scan ahead in FAT to discover a contiguous run
+
+
+// Makes sure that the extent cache of the stream covers the current cluster of the stream. Returns with non-zero on error.
+static int mfat_stream_find_extent ( mfat_stream_t *p )
+{
+	const Uint32 cluster = p->cluster & 0x0FFFFFFFU;
+	if (p->extent_generation == fat_generation && cluster >= p->extent_first && cluster <= p->extent_last)
+		return 0;
+	Uint32 last = cluster;
+	Uint32 next = mfat_read_fat_chain(last);
+	while (next == last + 1 && last - cluster < MAX_EXTENT_SCAN) {
+		last = next;
+		next = mfat_read_fat_chain(last);
+	}
+	if (next == 1) {		// error
+		if (last == cluster)
+			return -1;
+		next = last--;		// the error is reported when the stream arrives to that cluster
+	}
+	p->extent_first = cluster;
+	p->extent_last = last;
+	p->extent_next = next;
+	p->extent_generation = fat_generation;
+	FATDEBUG("FATFS: extent of stream: clusters %u-%u, then %u" NL, cluster, last, next);
+	return 0;
+}
+
+
+// Like mfat_read_fat_chain() for the current cluster of the stream, but using the extent cache of the stream
+static Uint32 mfat_stream_next_cluster ( mfat_stream_t *p )
+{
+	if (mfat_stream_find_extent(p))
+		return 1;
+	const Uint32 cluster = p->cluster & 0x0FFFFFFFU;
+	return cluster < p->extent_last ? cluster + 1 : p->extent_next;
+}
+
+
 // Warning: uses own cache! That is, it's not possible to deal with more than ONE stream at the same time!!
 static struct {
 	Uint8	buf[512];
@@ -602,6 +733,32 @@ int mfat_read_stream ( mfat_stream_t *p, void *buf, int size )
 	if (p->size_constraint >= 0 && p->file_pos + size > p->size_constraint)
 		size = p->size_constraint - p->file_pos;
 	while (size > 0) {
+		if (p->in_block_pos == 0 && size >= 1024) {
+			// At least two whole blocks are needed from a block boundary: read as many blocks as we can directly
+			// into the caller's buffer at once, within the contiguous run of clusters we're at.
+			if (mfat_stream_find_extent(p))
+				goto error;
+			const Uint32 cluster_size = p->partition->cluster_size_in_blocks;
+			Uint32 blocks = (p->extent_last - p->cluster + 1) * cluster_size - p->in_cluster_block;
+			if (blocks > size >> 9)
+				blocks = size >> 9;
+			if (mfat_read_part_blks(p->cluster * cluster_size + p->partition->data_area_fake_ofs + p->in_cluster_block, buf, blocks))
+				goto error;
+			const int piece = blocks << 9;
+			ret += piece;
+			p->file_pos += piece;
+			size -= piece;
+			buf = (Uint8*)buf + piece;
+			blocks += p->in_cluster_block;
+			p->cluster += blocks / cluster_size;
+			p->in_cluster_block = blocks % cluster_size;
+			if (p->cluster > p->extent_last) {	// we've consumed the whole extent, continue with the next cluster in the chain
+				p->cluster = p->extent_next;
+				if (p->cluster == 0)
+					goto eof;
+			}
+			continue;
+		}
 		if (p->cluster != stream_cache.cluster || p->in_cluster_block != stream_cache.cluster_block || disk.part != stream_cache.part) {
 			if (mfat_read_cluster(p->cluster, p->in_cluster_block, stream_cache.buf))
 				goto error;
@@ -625,7 +782,7 @@ int mfat_read_stream ( mfat_stream_t *p, void *buf, int size )
 			p->in_block_pos = 0;
 			p->in_cluster_block++;
 			if (p->in_cluster_block == p->partition->cluster_size_in_blocks) {
-				p->cluster = mfat_read_fat_chain(p->cluster);
+				p->cluster = mfat_stream_next_cluster(p);
 				if (p->cluster == 1)
 					goto error;
 				if (p->cluster == 0)
@@ -28,6 +28,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #define IS_MFAT_FILE(p)	(((p)&0x18)==0)
 
 typedef int(*mfat_io_callback_func_t)(Uint32 block, Uint8 *data);
+typedef int(*mfat_io_multi_callback_func_t)(Uint32 block, Uint8 *data, Uint32 count);
 
 struct mfat_part_st {
 	Uint32	first_block;
@@ -55,6 +56,9 @@ typedef struct {
 	int	file_pos;
 	struct mfat_part_st *partition;
 	Uint32	start_cluster;
+	// Extent cache: the cluster chain is known to be contiguous from extent_first to extent_last, then it continues with extent_next (0 = end of chain)
+	Uint32	extent_first, extent_last, extent_next;
+	Uint32	extent_generation;
 } mfat_stream_t;
 
 typedef struct {
@@ -68,6 +72,7 @@ typedef struct {
 } mfat_dirent_t;
 
 extern void   mfat_init     ( mfat_io_callback_func_t reader, mfat_io_callback_func_t writer, Uint32 device_size );
+extern void   mfat_set_multi_block_io ( mfat_io_multi_callback_func_t reader, mfat_io_multi_callback_func_t writer );
 extern int    mfat_init_mbr ( void     );
 extern int    mfat_use_part ( int part );
 
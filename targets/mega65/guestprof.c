@@ -0,0 +1,367 @@
+/* A work-in-progess MEGA65 (Commodore 65 clone origins) emulator
+   Part of the Xemu project, please visit: https://github.com/lgblgblgb/xemu
+   Copyright (C)2016-2025 LGB (Gábor Lénárt) <lgblgblgb@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+/* Guest code profiler: accumulates the CPU cycles spent per linear (thus MAP/banking resolved)
+   opcode address, and also tracks JSR/RTS (and interrupts/RTI) with a "shadow stack" to build a
+   call graph with self and inclusive cycles per subroutine. The CPU emulation calls us only if
+   cpu65_profiler_enabled is set, so the cost is a single flag check per opcode otherwise.
+
+   Returns are matched by the stack pointer value, not by counting: a return pops every frame
+   which was entered with a lower stack pointer than the one after the return. This way software
+   playing tricks with the stack (dropping return addresses, "RTS jumps", etc) causes less damage. */
+
+#include "xemu/emutools.h"
+#include "xemu/emutools_files.h"
+#include "xemu/cpu65.h"
+#include "guestprof.h"
+#include "memory_mapper.h"
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+
+#define NO_KEY		0xFFFFFFFFU
+#define ROOT_KEY	0xFFFFFFFEU	// pseudo-function for code executed outside of any tracked subroutine
+#define MAX_DEPTH	256
+
+#define PCS_SIZE_BITS	17
+#define FUNCS_SIZE_BITS	14
+#define EDGES_SIZE_BITS	15
+
+bool cpu65_profiler_enabled = false;
+
+struct entry_st {
+	Uint32	key, key2;	// key2 is used only by call graph edges (caller -> callee), zero otherwise
+	Uint64	count;		// executions (PCs), or number of calls (functions/edges)
+	Uint64	cycles;		// PCs: cycles, functions: self cycles
+	Uint64	incl;		// functions/edges: inclusive cycles
+};
+
+// Open addressing hash table. Entries are never moved, so pointers to them remain valid until reset.
+struct table_st {
+	struct entry_st	*e;
+	unsigned int	mask, used, limit;
+	struct entry_st	overflow;	// used when the table is full, so callers always get a valid entry
+};
+
+static struct table_st pcs, funcs, edges;
+
+static struct {
+	Uint32		func;
+	Uint16		sp;
+	Uint64		start;
+	struct entry_st	*func_e, *edge_e;
+} stack[MAX_DEPTH];
+static int depth;
+static struct entry_st *current_func_e;	// cached self-cycle entry of the current function
+static Uint64 total_cycles;
+static Uint64 lost_frames;
+
+
+static void table_init ( struct table_st *t, const int bits )
+{
+	const unsigned int size = 1U << bits;
+	if (!t->e)
+		t->e = xemu_malloc(size * sizeof(struct entry_st));
+	for (unsigned int i = 0; i < size; i++)
+		t->e[i].key = NO_KEY;
+	t->mask = size - 1;
+	t->used = 0;
+	t->limit = size - (size >> 2);	// do not allow more than 75% fill ratio
+	memset(&t->overflow, 0, sizeof t->overflow);
+}
+
+
+static struct entry_st *table_lookup ( struct table_st *t, const Uint32 key, const Uint32 key2 )
+{
+	unsigned int i = ((key * 0x9E3779B1U) ^ (key2 * 0x85EBCA77U)) >> 7;
+	for (;;) {
+		struct entry_st *e = t->e + (i & t->mask);
+		if (XEMU_LIKELY(e->key == key && e->key2 == key2))
+			return e;
+		if (e->key == NO_KEY) {
+			if (XEMU_UNLIKELY(t->used >= t->limit))
+				return &t->overflow;
+			e->key = key;
+			e->key2 = key2;
+			e->count = 0;
+			e->cycles = 0;
+			e->incl = 0;
+			t->used++;
+			return e;
+		}
+		i++;
+	}
+}
+
+
+void guestprof_reset ( void )
+{
+	table_init(&pcs,   PCS_SIZE_BITS);
+	table_init(&funcs, FUNCS_SIZE_BITS);
+	table_init(&edges, EDGES_SIZE_BITS);
+	depth = 0;
+	total_cycles = 0;
+	lost_frames = 0;
+	current_func_e = table_lookup(&funcs, ROOT_KEY, 0);
+}
+
+
+void guestprof_enable ( const bool enable )
+{
+	if (enable == cpu65_profiler_enabled)
+		return;
+	if (enable)
+		guestprof_reset();
+	cpu65_profiler_enabled = enable;
+	DEBUGPRINT("GUESTPROF: guest code profiler is %s" NL, enable ? "enabled" : "disabled");
+}
+
+
+static XEMU_INLINE Uint16 get_sp ( void )
+{
+	return cpu65.sphi | cpu65.s;
+}
+
+
+static XEMU_INLINE Uint32 current_func ( void )
+{
+	return depth ? stack[depth - 1].func : ROOT_KEY;
+}
+
+
+static void enter ( const Uint32 func )
+{
+	if (XEMU_UNLIKELY(depth >= MAX_DEPTH)) {
+		// Too deep (or the software never returns properly): forget the outermost frame
+		memmove(stack, stack + 1, sizeof(stack[0]) * (MAX_DEPTH - 1));
+		depth--;
+		lost_frames++;
+	}
+	struct entry_st *func_e = table_lookup(&funcs, func, 0);
+	struct entry_st *edge_e = table_lookup(&edges, current_func(), func);
+	func_e->count++;
+	edge_e->count++;
+	stack[depth].func = func;
+	stack[depth].sp = get_sp();
+	stack[depth].start = total_cycles;
+	stack[depth].func_e = func_e;
+	stack[depth].edge_e = edge_e;
+	depth++;
+	current_func_e = func_e;
+}
+
+
+static void leave ( void )
+{
+	const Uint16 sp = get_sp();
+	while (depth && stack[depth - 1].sp < sp) {
+		depth--;
+		const Uint64 incl = total_cycles - stack[depth].start;
+		stack[depth].func_e->incl += incl;
+		stack[depth].edge_e->incl += incl;
+	}
+	current_func_e = depth ? stack[depth - 1].func_e : table_lookup(&funcs, ROOT_KEY, 0);
+}
+
+
+// Called by the CPU emulation after executing an opcode (at CPU65.old_pc)
+void cpu65_profiler_opcode_callback ( void )
+{
+	const unsigned int cycles = cpu65.op_cycles;
+	struct entry_st *e = table_lookup(&pcs, memory_cpu_addr_to_linear(cpu65.old_pc, NULL), 0);
+	e->count++;
+	e->cycles += cycles;
+	current_func_e->cycles += cycles;
+	total_cycles += cycles;
+	switch (cpu65.op) {
+		case 0x00:	// BRK: handled as an interrupt
+		case 0x20:	// JSR abs
+		case 0x22:	// JSR (abs)
+		case 0x23:	// JSR (abs,X)
+			enter(memory_cpu_addr_to_linear(cpu65.pc, NULL));
+			break;
+		case 0x40:	// RTI
+		case 0x60:	// RTS
+		case 0x62:	// RTS #imm
+			leave();
+			break;
+	}
+}
+
+
+// Called by the CPU emulation after an interrupt is accepted, and PC is set to the handler already
+void cpu65_profiler_interrupt_callback ( void )
+{
+	enter(memory_cpu_addr_to_linear(cpu65.pc, NULL));
+	current_func_e->cycles += 7;
+	total_cycles += 7;
+}
+
+
+static int cmp_cycles ( const void *a, const void *b )
+{
+	const Uint64 va = (*(struct entry_st *const*)a)->cycles, vb = (*(struct entry_st *const*)b)->cycles;
+	return va < vb ? 1 : va > vb ? -1 : 0;
+}
+
+
+static int cmp_incl ( const void *a, const void *b )
+{
+	const Uint64 va = (*(struct entry_st *const*)a)->incl, vb = (*(struct entry_st *const*)b)->incl;
+	return va < vb ? 1 : va > vb ? -1 : 0;
+}
+
+
+// Collects the used entries of a table into a newly allocated array, sorted by descending "cycles" or "incl"
+static struct entry_st **table_sorted ( const struct table_st *t, const bool by_incl, unsigned int *n_p )
+{
+	struct entry_st **list = xemu_malloc((t->used + 1) * sizeof(struct entry_st*));
+	unsigned int n = 0;
+	for (unsigned int i = 0; i <= t->mask; i++)
+		if (t->e[i].key != NO_KEY)
+			list[n++] = t->e + i;
+	qsort(list, n, sizeof(struct entry_st*), by_incl ? cmp_incl : cmp_cycles);
+	*n_p = n;
+	return list;
+}
+
+
+// Report output goes either into a memory buffer or into a file
+static struct {
+	char	*buf;
+	size_t	size, len;
+	int	fd;
+	bool	error;
+} out;
+
+
+static void out_printf ( const char *format, ... )
+{
+	char line[256];
+	va_list args;
+	va_start(args, format);
+	const int len = vsnprintf(line, sizeof line, format, args);
+	va_end(args);
+	if (len <= 0 || out.error)
+		return;
+	if (out.fd >= 0) {
+		if (xemu_safe_write(out.fd, line, strlen(line)) != (ssize_t)strlen(line))
+			out.error = true;
+	} else if (out.len < out.size) {
+		out.len += snprintf(out.buf + out.len, out.size - out.len, "%s", line);
+		if (out.len >= out.size)
+			out.error = true;
+	}
+}
+
+
+static const char *key_str ( const Uint32 key, char *buf )
+{
+	if (key == ROOT_KEY)
+		return "<root>";
+	sprintf(buf, "$%07X", key);
+	return buf;
+}
+
+
+static XEMU_INLINE double percent ( const Uint64 v )
+{
+	return total_cycles ? 100.0 * (double)v / (double)total_cycles : 0.0;
+}
+
+
+static void report ( const unsigned int top_pcs, const unsigned int top_funcs, const bool with_edges )
+{
+	char k1[16], k2[16];
+	unsigned int n;
+	out_printf("Guest profile: %llu cycles, %u PCs, %u functions, call depth %d%s\n",
+		(unsigned long long int)total_cycles, pcs.used, funcs.used, depth,
+		(pcs.overflow.count || funcs.overflow.count || edges.overflow.count) ? " (TABLE OVERFLOW, incomplete!)" : ""
+	);
+	if (lost_frames)
+		out_printf("Lost %llu frames because of too deep calls\n", (unsigned long long int)lost_frames);
+	// Flat profile by PC
+	struct entry_st **list = table_sorted(&pcs, false, &n);
+	out_printf("\nFlat profile by PC:\n      PC      cycles      %%        count\n");
+	for (unsigned int i = 0; i < n && i < top_pcs; i++)
+		out_printf("%8s %11llu %6.2f%% %12llu\n", key_str(list[i]->key, k1),
+			(unsigned long long int)list[i]->cycles, percent(list[i]->cycles), (unsigned long long int)list[i]->count);
+	free(list);
+	// Functions (subroutines or interrupt handlers)
+	list = table_sorted(&funcs, false, &n);
+	out_printf("\nFunctions by self cycles (inclusive cycles do not contain still running calls):\n"
+		"   ENTRY        self      %%    inclusive      %%       calls\n");
+	for (unsigned int i = 0; i < n && i < top_funcs; i++)
+		out_printf("%8s %11llu %6.2f%% %12llu %6.2f%% %11llu\n", key_str(list[i]->key, k1),
+			(unsigned long long int)list[i]->cycles, percent(list[i]->cycles),
+			(unsigned long long int)list[i]->incl, percent(list[i]->incl), (unsigned long long int)list[i]->count);
+	free(list);
+	if (!with_edges)
+		return;
+	// Call graph edges
+	list = table_sorted(&edges, true, &n);
+	out_printf("\nCall graph (caller -> callee) by inclusive cycles:\n"
+		"  CALLER ->   CALLEE    inclusive      %%       calls\n");
+	for (unsigned int i = 0; i < n; i++)
+		out_printf("%8s -> %8s %12llu %6.2f%% %11llu\n", key_str(list[i]->key, k1), key_str(list[i]->key2, k2),
+			(unsigned long long int)list[i]->incl, percent(list[i]->incl), (unsigned long long int)list[i]->count);
+	free(list);
+}
+
+
+void guestprof_get_report ( char *buf, const size_t size, const int top )
+{
+	if (!pcs.e) {
+		snprintf(buf, size, "Guest profiler has never been enabled");
+		return;
+	}
+	*buf = '\0';
+	out.buf = buf;
+	out.size = size;
+	out.len = 0;
+	out.fd = -1;
+	out.error = false;
+	report(top, top / 2, false);
+	if (out.len && buf[out.len - 1] == '\n')
+		buf[out.len - 1] = '\0';
+}
+
+
+int guestprof_dump ( const char *fn )
+{
+	if (!pcs.e) {
+		ERROR_WINDOW("Guest profiler has never been enabled, nothing to dump");
+		return 1;
+	}
+	out.fd = xemu_open_file(fn, O_CREAT | O_TRUNC | O_WRONLY, NULL, NULL);
+	if (out.fd < 0) {
+		ERROR_WINDOW("Cannot create guest profiler dump file:\n%s", fn);
+		return 1;
+	}
+	out.error = false;
+	report(pcs.used, funcs.used, true);
+	xemu_safe_close(out.fd);
+	out.fd = -1;
+	if (out.error) {
+		ERROR_WINDOW("Cannot write guest profiler dump file:\n%s", fn);
+		return 1;
+	}
+	DEBUGPRINT("GUESTPROF: profile has been written into file: %s" NL, fn);
+	return 0;
+}
@@ -33,6 +33,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #include <sys/types.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <time.h>
 
 // This source is meant to virtualize Hyppo's DOS functions to be able to access
 // the host OS (what runs Xemu) filesystem via the normal HDOS calls (ie what
@@ -66,11 +67,30 @@ static int hdos_init_is_done = 0;
 static const char hdos_fake_external_name_str[] = "XEMUFAKEDEXTERNALMOUNTMAGIC";
 
 #define HDOS_DESCRIPTORS	4
+#define DIR_CACHE_SIZE		8
+
+// Listing of a host directory (entry names only, in the order as the host OS gives them)
+struct dir_listing_st {
+	int refs;		// number of users: the directory cache and the directory descriptors
+	int num;
+	char **names;		// malloc'ed array of malloc'ed strings
+};
+
+// Listings of the recently scanned directories, so directory searches (try_open) and readdir don't need
+// to walk through host directories again and again, unless the directory has been modified since.
+static struct {
+	char *path;		// malloc'ed string, NULL if this entry is not used
+	time_t mtime;		// modification time of the directory at the time of the scan
+	time_t scanned;		// time of the scan
+	unsigned int last_used;
+	struct dir_listing_st *listing;
+} dir_cache[DIR_CACHE_SIZE];
+static unsigned int dir_cache_clock = 0;
 
 static struct desc_table_st {
 	union {
 		int fd;
-		DIR *dirp;
+		struct dir_listing_st *listing;
 	};
 	enum hdos_desc_status_t { HDOS_DESC_CLOSED, HDOS_DESC_FILE, HDOS_DESC_DIR, HDOS_DESC_NOTCLOSED } status;	// HDOS_DESC_NOTCLOSED should NOT be put into desc_table[].status ever!
 	char *basedirpath;	// pointer to malloc'ed string (when in use). ALWAYS ends with directory separator of your host OS!
@@ -320,6 +340,99 @@ static const char *hdos_get_func_name ( const int func_no )
 }
 
 
+static void release_dir_listing ( struct dir_listing_st *listing )
+{
+	if (--listing->refs > 0)
+		return;
+	for (int a = 0; a < listing->num; a++)
+		free(listing->names[a]);
+	free(listing->names);
+	free(listing);
+}
+
+
+static void flush_dir_cache ( void )
+{
+	for (int a = 0; a < DIR_CACHE_SIZE; a++)
+		if (dir_cache[a].path) {
+			free(dir_cache[a].path);
+			dir_cache[a].path = NULL;
+			release_dir_listing(dir_cache[a].listing);
+		}
+}
+
+
+static struct dir_listing_st *scan_dir ( const char *path )
+{
+	DIR *dirp = opendir(path);
+	if (!dirp)
+		return NULL;
+	struct dir_listing_st *listing = xemu_malloc(sizeof(struct dir_listing_st));
+	listing->refs = 1;
+	listing->num = 0;
+	listing->names = NULL;
+	int allocated = 0;
+	char fn_found[FILENAME_MAX];
+	while (!xemu_readdir(dirp, fn_found, sizeof fn_found)) {
+		if (listing->num == allocated) {
+			allocated = allocated ? allocated * 2 : 64;
+			listing->names = xemu_realloc(listing->names, allocated * sizeof(char*));
+		}
+		listing->names[listing->num++] = xemu_strdup(fn_found);
+	}
+	closedir(dirp);
+	return listing;
+}
+
+
+// Returns with the listing of the given directory (path must end with directory separator), or NULL on error.
+// The result is owned by the cache, callers must increment "refs" if they want to keep it after another call of this function.
+static struct dir_listing_st *get_dir_listing ( const char *path )
+{
+	char stat_path[strlen(path) + 1];
+	strcpy(stat_path, path);
+	const int len = strlen(stat_path);
+	if (len > 1 && stat_path[len - 1] == DIRSEP_CHR && stat_path[len - 2] != ':')
+		stat_path[len - 1] = '\0';	// stat() on Windows does not like the trailing separator (but keep it for root directories)
+	struct stat st;
+	if (stat(stat_path, &st) || (st.st_mode & S_IFMT) != S_IFDIR)
+		return NULL;
+	int e = -1;
+	for (int a = 0; a < DIR_CACHE_SIZE; a++)
+		if (dir_cache[a].path && !strcmp(dir_cache[a].path, path)) {
+			e = a;
+			break;
+		}
+	// Modification within the same second as the scan cannot be detected by the mtime, so such a listing is never trusted
+	if (e >= 0 && dir_cache[e].mtime == st.st_mtime && st.st_mtime < dir_cache[e].scanned) {
+		dir_cache[e].last_used = ++dir_cache_clock;
+		return dir_cache[e].listing;
+	}
+	const time_t now = time(NULL);
+	struct dir_listing_st *listing = scan_dir(path);
+	if (!listing)
+		return NULL;
+	if (e < 0) {
+		e = 0;
+		for (int a = 1; a < DIR_CACHE_SIZE && dir_cache[e].path; a++)
+			if (!dir_cache[a].path || dir_cache[a].last_used < dir_cache[e].last_used)
+				e = a;
+		if (dir_cache[e].path) {
+			free(dir_cache[e].path);
+			release_dir_listing(dir_cache[e].listing);
+		}
+		dir_cache[e].path = xemu_strdup(path);
+	} else
+		release_dir_listing(dir_cache[e].listing);
+	dir_cache[e].listing = listing;
+	dir_cache[e].mtime = st.st_mtime;
+	dir_cache[e].scanned = now;
+	dir_cache[e].last_used = ++dir_cache_clock;
+	DEBUGHDOS("HDOS: VIRT: directory has been scanned (%d entries): %s" NL, listing->num, path);
+	return listing;
+}
+
+
 static int allocate_descriptor ( void )
 {
 	for (int a = 0; a < HDOS_DESCRIPTORS; a++)
@@ -364,11 +477,9 @@ static int close_descriptor ( const unsigned int entry )
 			return -1;	// error value??
 		return 0;
 	} else if (desc_table[entry].status == HDOS_DESC_DIR) {
-		const int ret = closedir(desc_table[entry].dirp);
+		release_dir_listing(desc_table[entry].listing);
 		desc_table[entry].status = HDOS_DESC_CLOSED;
-		DEBUGHDOS("HDOS: closing directory descriptor #$%02X: %d" NL, entry, ret);
-		if (ret)
-			return -1;	// error value??
+		DEBUGHDOS("HDOS: closing directory descriptor #$%02X" NL, entry);
 		return 0;
 	} else if (desc_table[entry].status ==  HDOS_DESC_CLOSED) {
 		return -1;	// already closed?
@@ -412,24 +523,22 @@ static int _open_impl ( const char *basedirfn, const char *needfn, const int ope
 // * we must deal with FS case insensivity madness (also on Host-OS side, lame Windows thing ...)
 // * opening by "short file name"
 // So at the end we need a directory scan unfortunately to be really sure we found the thing we want ...
+// (at least, the directory listing is cached, see get_dir_listing())
 static int try_open ( const char *basedirfn, const char *needfn, const int open_mode, struct stat *st, char *fullpathout, void *result )
 {
 	*fullpathout = '\0';	// make sure we pass something back, even before it would be "normally" filled up
 	if (strchr(needfn, '/') || strchr(needfn, '\\') || !*needfn)	// needfn could not contain directory component(s) and also cannot be empty
 		return HDOSERR_FILE_NOT_FOUND;
-	DIR *dirp = opendir(basedirfn);
-	if (!dirp)
+	const struct dir_listing_st *listing = get_dir_listing(basedirfn);
+	if (!listing)
 		return HDOSERR_FILE_NOT_FOUND;
-	char fn_found[FILENAME_MAX];
-	while (!xemu_readdir(dirp, fn_found, sizeof fn_found)) {
+	for (int a = 0; a < listing->num; a++) {
+		const char *fn_found = listing->names[a];
 		// TODO: add check for "." and ".." not done in root of emulated HDOS FS
 		// TODO: is there a hyppo policy to try by short name as well? nothing similar in Xemu yet ...
-		if (!strcasecmp(fn_found, needfn) && strlen(fn_found) <= 63) {
-			closedir(dirp);
+		if (!strcasecmp(fn_found, needfn) && strlen(fn_found) <= 63)
 			return _open_impl(basedirfn, fn_found, open_mode, st, fullpathout, result);
-		}
 	}
-	closedir(dirp);
 	return HDOSERR_FILE_NOT_FOUND;
 }
 
@@ -507,18 +616,35 @@ static void hdos_virt_loadfile ( const Uint32 addr_base )
 		return;
 	}
 	int loaded = 0;
-	for (;;) {
-		Uint8 buffer[1024];
-		ret = xemu_safe_read(fd, buffer, sizeof buffer);
-		if (ret <= 0)
-			break;
-		loaded += ret;
-		if (loaded > st.st_size) {	// should not happen, but nice to check, anyway
-			ret = -1;
+	ret = 0;
+	while (loaded < st.st_size) {
+		const Uint32 addr32 = addr_base + (addr_ofs & 0xFFFFFF);
+		int limit = st.st_size - loaded;
+		if (limit > 0x1000000 - (int)(addr_ofs & 0xFFFFFF))
+			limit = 0x1000000 - (addr_ofs & 0xFFFFFF);	// do not read over the wrapping point of the offset
+		int size = 0x100 - (addr32 & 0xFF);	// till the end of the current page
+		Uint8 *p = debug_write_linear_direct(addr32);
+		if (p) {
+			// Plain RAM: read directly into the memory of the emulated machine, for as many pages as they're contiguous in our memory too
+			while (size < limit && debug_write_linear_direct(addr32 + size) == p + size)
+				size += 0x100;
+			if (size > limit)
+				size = limit;
+			ret = xemu_safe_read(fd, p, size);
+		} else {
+			Uint8 buffer[0x100];
+			if (size > limit)
+				size = limit;
+			ret = xemu_safe_read(fd, buffer, size);
+			for (int a = 0; a < ret; a++)
+				debug_write_linear_byte(addr32 + a, buffer[a]);
+		}
+		if (ret != size) {
+			ret = -1;	// read error, or file has been shrunk meanwhile
 			break;
 		}
-		for (const Uint8 *b = buffer; ret > 0; ret--, b++, addr_ofs++)
-			debug_write_linear_byte(addr_base + (addr_ofs & 0xFFFFFF), *b);
+		loaded += size;
+		addr_ofs += size;
 	}
 	close(fd);
 	if (ret < 0 || loaded != st.st_size) {
@@ -539,15 +665,16 @@ static void hdos_virt_opendir ( void )
 		hdos.virt_out_a = HDOSERR_TOO_MANY_OPEN;
 		return;
 	}
-	DIR *dirp = opendir(hdos.cwd);
-	if (!dirp) {
+	struct dir_listing_st *listing = get_dir_listing(hdos.cwd);
+	if (!listing) {
 		hdos.virt_out_a = HDOSERR_CANNOT_OPEN_DIR;	// some error code; directory cannot be open (this SHOULD not happen though!)
 		return;
 	}
+	listing->refs++;	// the descriptor keeps the listing, even if the cache drops or re-scans it meanwhile
 	desc_table[e] = (struct desc_table_st){
 		.basedirpath	= xemu_strdup(hdos.cwd),
 		.status		= HDOS_DESC_DIR,
-		.dirp		= dirp,
+		.listing	= listing,
 		.dir_entry_no	= 0,
 	};
 	hdos.virt_out_a = e;		// return the file descriptor
@@ -644,7 +771,6 @@ static void hdos_virt_readdir ( void )
 		return;
 	}
 	Uint8 mem[87];
-	char fn_found[FILENAME_MAX];
 	// FIXME: remove this? it seems, Hyppo never returns with the volume label anyway
 #if 0
 	if (in_emu_root && desc_table[hdos.in_x].dir_entry_no == 0) {
@@ -664,14 +790,12 @@ static void hdos_virt_readdir ( void )
 	}
 #endif
 readdir_again:
-	if (xemu_readdir(desc_table[hdos.in_x].dirp, fn_found, sizeof fn_found)) {
-		// FIXME: there should be error checking here, but we assume for now, that NULL means end of directory
-		// But anyway, what should we do in case of an error during readdir? Not so much ...
+	if (desc_table[hdos.in_x].dir_entry_no >= desc_table[hdos.in_x].listing->num) {
 		DEBUGHDOS("HDOS: VIRT: %s(): end-of-directory" NL, __func__);
 		hdos.virt_out_a = HDOSERR_END_DIR;
 		return;
 	}
-	desc_table[hdos.in_x].dir_entry_no++;
+	const char *fn_found = desc_table[hdos.in_x].listing->names[desc_table[hdos.in_x].dir_entry_no++];
 	memset(mem, 0, sizeof mem);	// pre-fill with zero for our whole buffer
 	memset(mem + 65, 0x20, 8 + 3);	// pre-fill with spaces for the short name!
 	if (fn_found[0] == '.') {
@@ -688,7 +812,8 @@ readdir_again:
 			goto readdir_again;	// entry names starting with '.' (other than '.' and '..' handled above!) can be problematic, let's ignore them!
 	} else {
 		// Copy, check (length and chars) and convert filename
-		for (Uint8 *s = (Uint8*)fn_found, *t = mem, *sn = mem + 65; *s; s++, t++, mem[64]++) {
+		Uint8 *t = mem, *sn = mem + 65;
+		for (const Uint8 *s = (const Uint8*)fn_found; *s; s++, t++, mem[64]++) {
 			if (mem[64] >= 63)
 				goto readdir_again;	// skip file: too long name
 			Uint8 c = *s;
@@ -1160,6 +1285,7 @@ static void hdos_reset ( void )
 	hdos.transfer_area_addr = 0;
 	hdos.last_func_call_was_virtualized = false;
 	hypervisor_hdos_close_descriptors();
+	flush_dir_cache();
 	for (int i = 0; i < MAX_REAL_PATH_DB_ENTRIES; i++)
 		if (hdos.ext_real_path_db[i]) {
 			free(hdos.ext_real_path_db[i]);
@@ -287,6 +287,7 @@ static inline void first_leave ( void )
 	// Workarounds: ROM override
 	// returns with new PC for reset vector _OR_ negative value if no ROM override was needed
 	int new_pc = rom_do_override(main_ram + 0x20000);
+	memory_code_cache_invalidate(0x20000, 0x20000);
 	if (new_pc >= 0) {
 		// if ROM was forced here, PC hypervisor would return is invalid (valid for the _original_ ROM which was overriden here!), thus we must set it now!
 		DEBUGPRINT("ROM: force ROM re-apply policy, PC change: $%04X -> $%04X" NL, cpu65.pc, new_pc);
@@ -725,3 +726,49 @@ void hypervisor_debug ( void )
 		);
 	}
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+// Note: the in_hypervisor flag itself is part of the memory mapper's snapshot block, as it's
+// restored together with the memory configuration. HDOS host-side file descriptors are not stored.
+
+#define SNAPSHOT_HYPERVISOR_BLOCK_VERSION	0
+#define SNAPSHOT_HYPERVISOR_BLOCK_SIZE		0x20
+
+
+int hypervisor_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[SNAPSHOT_HYPERVISOR_BLOCK_SIZE];
+	if (block->block_version != SNAPSHOT_HYPERVISOR_BLOCK_VERSION || block->sub_counter || block->sub_size != sizeof buffer)
+		RETURN_XSNAPERR_USER("Bad hypervisor block syntax");
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	hypervisor_is_first_call	= (int)P_AS_BE32(buffer + 0);
+	execution_range_check_gate	= (int)P_AS_BE32(buffer + 4);
+	trap_current			= (int)P_AS_BE32(buffer + 8);
+	hypervisor_queued_trap		= (int)P_AS_BE32(buffer + 12);
+	current_hdos_func		= (int)P_AS_BE32(buffer + 16);
+	return 0;
+}
+
+
+int hypervisor_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_HYPERVISOR_BLOCK_SIZE];
+	const int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_HYPERVISOR_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	U32_AS_BE(buffer +  0, hypervisor_is_first_call);
+	U32_AS_BE(buffer +  4, execution_range_check_gate);
+	U32_AS_BE(buffer +  8, trap_current);
+	U32_AS_BE(buffer + 12, hypervisor_queued_trap);
+	U32_AS_BE(buffer + 16, current_hdos_func);
+	return xemusnap_write_sub_block(buffer, sizeof buffer);
+}
+
+#endif
@@ -48,4 +48,10 @@ extern int  hypervisor_hdos_virtualization_status ( const int set, const char **
 extern void hypervisor_hdos_close_descriptors ( void );						// prototype is here, but it's implemented in hdos.c not in hypervisor.c
 extern char*hypervisor_hdos_get_sysfile_path ( const char *fn );				// prototype is here, but it's implemented in hdos.c not in hypervisor.c
 
+#ifdef XEMU_SNAPSHOT_SUPPORT
+#include "xemu/emutools_snapshot.h"
+extern int  hypervisor_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+extern int  hypervisor_snapshot_save_state ( const struct xemu_snapshot_definition_st *def );
+#endif
+
 #endif
@@ -190,6 +190,7 @@ static void prg_inject_callback ( void *unused )
 	DEBUGPRINT("INJECT: hit 'READY.' trigger, about to inject %d bytes from $%04X." NL, prg.size, prg.load_addr);
 	fdc_allow_disk_access(FDC_ALLOW_DISK_ACCESS);
 	memcpy(main_ram + prg.load_addr, prg.stream, prg.size);
+	memory_code_cache_invalidate(prg.load_addr, prg.size);
 	clear_emu_events();	// clear keyboard & co state, ie for C64 mode, probably had MEGA key pressed still
 	CBM_SCREEN_PRINTF(under_ready_p - vic4_query_screen_width() + 7, "<$%04X-$%04X,%d bytes>", prg.load_addr, prg.load_addr + prg.size - 1, prg.size);
 	if (prg.run_it) {
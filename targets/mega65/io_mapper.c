@@ -103,7 +103,9 @@ static inline void vdc_write_register ( const Uint8 reg, const Uint8 data )
 	if (reg == 0x1F) {	// writing the data register which means writing a byte through VDC
 		Uint16 vdc_mem_addr = (vdc_regs[0x12] << 8) + vdc_regs[0x13];
 		VDC_DEBUG("VDC: writing VRAM at VDC address $%04X with data $%02X" NL, vdc_mem_addr, data);
-		*vdc2vicptr(vdc_mem_addr++) = data;
+		Uint8 *p = vdc2vicptr(vdc_mem_addr++);
+		*p = data;
+		memory_code_cache_invalidate(p - main_ram, 1);
 		vdc_regs[0x12] = vdc_mem_addr >> 8;
 		vdc_regs[0x13] = vdc_mem_addr & 0xFF;
 		return;
@@ -126,6 +128,7 @@ static inline void vdc_write_register ( const Uint8 reg, const Uint8 data )
 			while (vdc_word_count-- > 0)
 				*vdc2vicptr(vdc_mem_addr++) = vdc_regs[0x2A];			// normally attrib control, but on block write, this is the data to be written
 		}
+		memory_code_cache_invalidate(0x40000U, 0x10000U);	// the whole area vdc2vicptr() can point to
 		vdc_regs[0x12] = vdc_mem_addr >> 8;
 		vdc_regs[0x13] = vdc_mem_addr & 0xFF;
 		return;
@@ -719,3 +722,54 @@ void io_write ( unsigned int addr, Uint8 data )
 			FATAL("Xemu internal error: undecoded I/O area writing for address $(%X)%03X and data $%02X", addr >> 8, addr & 0xFFF, data);
 	}
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+#include <string.h>
+
+#define SNAPSHOT_IO_BLOCK_VERSION	0
+#define SNAPSHOT_IO_BLOCK_SIZE		0x300
+
+
+int io_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[SNAPSHOT_IO_BLOCK_SIZE];
+	if (block->block_version != SNAPSHOT_IO_BLOCK_VERSION || block->sub_counter || block->sub_size != sizeof buffer)
+		RETURN_XSNAPERR_USER("Bad I/O block syntax");
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	memcpy(D6XX_registers, buffer + 0x000, sizeof D6XX_registers);
+	memcpy(D7XX,           buffer + 0x100, sizeof D7XX);
+	memcpy(vdc_regs,       buffer + 0x200, sizeof vdc_regs);
+	vdc_reg_sel = buffer[0x240];
+	cpu_mega65_opcodes = buffer[0x241];
+	port_d607 = buffer[0x242];
+	bigmult_valid_result = 0;	// force re-calculation on the next read
+	hw_errata_level = 0xFF;		// force change, see reset_hw_errata_level()
+	set_hw_errata_level(buffer[0x243], "snapshot");
+	return 0;
+}
+
+
+int io_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_IO_BLOCK_SIZE];
+	const int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_IO_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	memcpy(buffer + 0x000, D6XX_registers, sizeof D6XX_registers);
+	memcpy(buffer + 0x100, D7XX,           sizeof D7XX);
+	memcpy(buffer + 0x200, vdc_regs,       sizeof vdc_regs);
+	buffer[0x240] = vdc_reg_sel;
+	buffer[0x241] = cpu_mega65_opcodes;
+	buffer[0x242] = port_d607;
+	buffer[0x243] = hw_errata_level;
+	return xemusnap_write_sub_block(buffer, sizeof buffer);
+}
+
+#endif
@@ -39,4 +39,10 @@ extern struct Cia6526 cia1, cia2;		// CIA emulation structures for the two CIAs
 extern int    port_d607;			// ugly hack for C65 extended keys ...
 extern int    core_age_in_days;
 
+#ifdef XEMU_SNAPSHOT_SUPPORT
+#include "xemu/emutools_snapshot.h"
+extern int io_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+extern int io_snapshot_save_state ( const struct xemu_snapshot_definition_st *def );
+#endif
+
 #endif
@@ -0,0 +1,269 @@
+/* A work-in-progess MEGA65 (Commodore 65 clone origins) emulator
+   Part of the Xemu project, please visit: https://github.com/lgblgblgb/xemu
+   Copyright (C)2016-2025 LGB (Gábor Lénárt) <lgblgblgb@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#include "xemu/emutools.h"
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+#include "xemu/emutools_snapshot.h"
+#include "xemu/cpu65.h"
+#include "xemu/cia6526.h"
+#include "xemu/f011_core.h"
+#include "m65_snapshot.h"
+#include "memory_mapper.h"
+#include "io_mapper.h"
+#include "hypervisor.h"
+#include "vic4.h"
+#include "dma65.h"
+#include "audio65.h"
+#include "sdcard.h"
+#include "configdb.h"
+#include <string.h>
+
+/* Incremental ("delta") snapshots: a snapshot can refer to a base snapshot, then its memory block only
+   contains the 4K pages which are different from the memory content of the base snapshot. Loading
+   such a snapshot loads the base first (recursively, if the base itself is a delta one), then the
+   snapshot itself over it. For the reference, the snapshot loaded with -snapload (or the last full
+   snapshot saved) is used as the base when the -snapdelta option is given.
+
+   To know the base before touching the emulator state, the snapshot is "probed" first: the "Base"
+   block is always the first one after the ident, and in probing mode its loader aborts the loading
+   after recording the name of the base snapshot. */
+
+#define M65_BASE_BLOCK_VERSION		0
+#define M65_MEMORY_BLOCK_VERSION	0
+#define M65_MEMORY_PAGE_SIZE		0x1000
+#define M65_MEMORY_HEADER_SIZE		0x10
+#define M65_MEMORY_FLAG_DELTA		1
+#define M65_SNAPSHOT_MAX_DEPTH		8
+
+static const struct {
+	Uint8	*p;
+	Uint32	size;
+	Uint8	fill;	// not stored pages in a full snapshot have this content
+} mem_regions[] = {
+	{ main_ram,		sizeof main_ram,	0x00 },
+	{ colour_ram,		sizeof colour_ram,	0x00 },
+	{ char_ram,		sizeof char_ram,	0x00 },
+	{ hypervisor_ram,	sizeof hypervisor_ram,	0x00 },
+	{ attic_ram,		sizeof attic_ram,	0xFF },
+	{ i2c_regs,		sizeof i2c_regs,	0x00 }
+};
+#define MEM_REGIONS	((int)(sizeof(mem_regions) / sizeof(mem_regions[0])))
+
+static Uint8 *base_mem = NULL;		// copy of the memory of the base snapshot, all the regions after each other
+static char  *base_name = NULL;		// file name of the base snapshot (which base_mem is from)
+static char   probed_base_name[PATH_MAX];
+static bool   probing = false;
+static bool   probe_done;
+static bool   saving_delta;
+
+
+static int snapcallback_base_loader ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	if (block->block_version != M65_BASE_BLOCK_VERSION || block->sub_counter || block->sub_size == 0 || block->sub_size >= sizeof probed_base_name)
+		RETURN_XSNAPERR_USER("Bad base block syntax");
+	if (!probing)
+		return xemusnap_skip_file_bytes(block->sub_size);	// the base has been already loaded by m65_snapshot_load()
+	const int ret = xemusnap_read_file(probed_base_name, block->sub_size);
+	if (ret)
+		return ret;
+	probed_base_name[block->sub_size] = '\0';
+	probe_done = true;
+	RETURN_XSNAPERR_USER("probing");	// abort loading, no other block should be applied while probing
+}
+
+
+static int snapcallback_base_saver ( const struct xemu_snapshot_definition_st *def )
+{
+	const int ret = xemusnap_write_block_header(def->idstr, M65_BASE_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	const char *name = saving_delta ? base_name : "";
+	return xemusnap_write_sub_block((const Uint8*)name, strlen(name) + 1);	// with the NUL byte, zero sized sub-block would mean end of block
+}
+
+
+static int snapcallback_memory_loader ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[M65_MEMORY_HEADER_SIZE];
+	if (block->block_version != M65_MEMORY_BLOCK_VERSION)
+		RETURN_XSNAPERR_USER("Bad memory block version");
+	if (!block->sub_counter) {
+		if (block->sub_size != M65_MEMORY_HEADER_SIZE)
+			RETURN_XSNAPERR_USER("Bad memory block header");
+		const int ret = xemusnap_read_file(buffer, sizeof buffer);
+		if (ret)
+			return ret;
+		if (P_AS_BE32(buffer + 4) != MEM_REGIONS)
+			RETURN_XSNAPERR_USER("Memory layout mismatch");
+		if (!(P_AS_BE32(buffer) & M65_MEMORY_FLAG_DELTA))
+			for (int r = 0; r < MEM_REGIONS; r++)
+				memset(mem_regions[r].p, mem_regions[r].fill, mem_regions[r].size);
+		memory_code_cache_invalidate(0, sizeof main_ram);	// memory is loaded directly, not through the memory decoder
+		return 0;
+	}
+	if (block->sub_size < 8)
+		RETURN_XSNAPERR_USER("Bad memory page sub-block");
+	const int ret = xemusnap_read_file(buffer, 8);
+	if (ret)
+		return ret;
+	const Uint32 r = P_AS_BE32(buffer), ofs = P_AS_BE32(buffer + 4), size = block->sub_size - 8;
+	if (r >= MEM_REGIONS || ofs >= mem_regions[r].size || size > mem_regions[r].size - ofs || size > M65_MEMORY_PAGE_SIZE)
+		RETURN_XSNAPERR_USER("Bad memory page region=%u offset=$%X size=$%X", r, ofs, size);
+	return xemusnap_read_file(mem_regions[r].p + ofs, size);
+}
+
+
+static int is_page_filled ( const Uint8 *p, const Uint32 size, const Uint8 fill )
+{
+	for (Uint32 a = 0; a < size; a++)
+		if (p[a] != fill)
+			return 0;
+	return 1;
+}
+
+
+static int snapcallback_memory_saver ( const struct xemu_snapshot_definition_st *def )
+{
+	static Uint8 buffer[8 + M65_MEMORY_PAGE_SIZE];
+	int ret = xemusnap_write_block_header(def->idstr, M65_MEMORY_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0, M65_MEMORY_HEADER_SIZE);
+	U32_AS_BE(buffer,     saving_delta ? M65_MEMORY_FLAG_DELTA : 0);
+	U32_AS_BE(buffer + 4, MEM_REGIONS);
+	ret = xemusnap_write_sub_block(buffer, M65_MEMORY_HEADER_SIZE);
+	if (ret)
+		return ret;
+	const Uint8 *base = base_mem;
+	int pages = 0;
+	for (int r = 0; r < MEM_REGIONS; r++) {
+		for (Uint32 ofs = 0; ofs < mem_regions[r].size; ofs += M65_MEMORY_PAGE_SIZE) {
+			const Uint8 *p = mem_regions[r].p + ofs;
+			const Uint32 size = mem_regions[r].size - ofs < M65_MEMORY_PAGE_SIZE ? mem_regions[r].size - ofs : M65_MEMORY_PAGE_SIZE;
+			if (saving_delta ? !memcmp(p, base + ofs, size) : is_page_filled(p, size, mem_regions[r].fill))
+				continue;
+			U32_AS_BE(buffer,     r);
+			U32_AS_BE(buffer + 4, ofs);
+			memcpy(buffer + 8, p, size);
+			ret = xemusnap_write_sub_block(buffer, size + 8);
+			if (ret)
+				return ret;
+			pages++;
+		}
+		base += mem_regions[r].size;
+	}
+	DEBUGPRINT("SNAP: %s memory block with %d pages of 4K" NL, saving_delta ? "delta" : "full", pages);
+	return 0;
+}
+
+
+// Takes the current memory content as the base of delta snapshots to be saved later
+static void set_base ( const char *filename )
+{
+	if (!base_mem) {
+		Uint32 size = 0;
+		for (int r = 0; r < MEM_REGIONS; r++)
+			size += mem_regions[r].size;
+		base_mem = xemu_malloc(size);
+	}
+	Uint8 *p = base_mem;
+	for (int r = 0; r < MEM_REGIONS; r++) {
+		memcpy(p, mem_regions[r].p, mem_regions[r].size);
+		p += mem_regions[r].size;
+	}
+	xemu_restrdup(&base_name, filename);
+	DEBUGPRINT("SNAP: base of delta snapshots is now \"%s\"" NL, filename);
+}
+
+
+static int load_with_bases ( const char *filename, const int depth )
+{
+	if (depth >= M65_SNAPSHOT_MAX_DEPTH) {
+		snprintf(xemusnap_error_buffer, XEMUSNAP_ERROR_BUFFER_SIZE, "Too deep chain of delta snapshots at \"%s\"", filename);
+		return 1;
+	}
+	probing = true;
+	probe_done = false;
+	const int ret = xemusnap_load(filename);
+	probing = false;
+	if (!probe_done)
+		return ret ? ret : 1;	// real error (or no base block at all, which is an error as well)
+	if (*probed_base_name) {
+		char base[PATH_MAX];
+		strcpy(base, probed_base_name);
+		DEBUGPRINT("SNAP: \"%s\" is a delta snapshot, loading its base \"%s\" first" NL, filename, base);
+		if (load_with_bases(base, depth + 1))
+			return 1;
+	}
+	DEBUGPRINT("SNAP: loading \"%s\"" NL, filename);
+	return xemusnap_load(filename);
+}
+
+
+int m65_snapshot_load ( const char *filename )
+{
+	if (load_with_bases(filename, 0))
+		return 1;
+	if (configdb.snapdelta)
+		set_base(filename);
+	return 0;
+}
+
+
+int m65_snapshot_save ( const char *filename )
+{
+	saving_delta = configdb.snapdelta && base_mem;
+	if (configdb.snapdelta && !base_mem)
+		DEBUGPRINT("SNAP: no base snapshot for delta save, saving a full snapshot instead" NL);
+	if (xemusnap_save(filename))
+		return 1;
+	if (configdb.snapdelta && !saving_delta)
+		set_base(filename);
+	return 0;
+}
+
+
+/* See the comment at the definition table in the C65 emulator for the details on the format of this table.
+   The "Base" block must be the very first one, as it's used for probing, see above. */
+static const struct xemu_snapshot_definition_st m65_snapshot_definition[] = {
+	{ "Base",		NULL,	snapcallback_base_loader,	snapcallback_base_saver },
+	{ "CPU",		NULL,	cpu65_snapshot_load_state,	cpu65_snapshot_save_state },
+	{ "CIA#1",		&cia1,	cia_snapshot_load_state,	cia_snapshot_save_state },
+	{ "CIA#2",		&cia2,	cia_snapshot_load_state,	cia_snapshot_save_state },
+	{ "Memory",		NULL,	snapcallback_memory_loader,	snapcallback_memory_saver },
+	{ "Memory mapper",	NULL,	memory_snapshot_load_state,	memory_snapshot_save_state },
+	{ "I/O",		NULL,	io_snapshot_load_state,		io_snapshot_save_state },
+	{ "Hypervisor",		NULL,	hypervisor_snapshot_load_state,	hypervisor_snapshot_save_state },
+	{ "VIC-4",		NULL,	vic4_snapshot_load_state,	vic4_snapshot_save_state },
+	{ "DMA",		NULL,	dma_snapshot_load_state,	dma_snapshot_save_state },
+	{ "Audio",		NULL,	audio65_snapshot_load_state,	audio65_snapshot_save_state },
+	{ "FDC-F011",		NULL,	fdc_snapshot_load_state,	fdc_snapshot_save_state },
+	{ "SD-card",		NULL,	sdcard_snapshot_load_state,	sdcard_snapshot_save_state },
+	{ "M65",		NULL,	m65emu_snapshot_load_state,	m65emu_snapshot_save_state },
+	{ NULL,			NULL,	m65emu_snapshot_loading_finalize, NULL }
+};
+
+
+void m65_snapshot_init ( void )
+{
+	xemusnap_init(m65_snapshot_definition);
+}
+
+#endif
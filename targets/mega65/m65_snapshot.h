@@ -0,0 +1,36 @@
+/* A work-in-progess MEGA65 (Commodore 65 clone origins) emulator
+   Part of the Xemu project, please visit: https://github.com/lgblgblgb/xemu
+   Copyright (C)2016-2025 LGB (Gábor Lénárt) <lgblgblgb@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#ifndef XEMU_MEGA65_M65_SNAPSHOT_H_INCLUDED
+#define XEMU_MEGA65_M65_SNAPSHOT_H_INCLUDED
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+#include "xemu/emutools_snapshot.h"
+
+// From other modules ...
+extern int  m65emu_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+extern int  m65emu_snapshot_save_state ( const struct xemu_snapshot_definition_st *def );
+extern int  m65emu_snapshot_loading_finalize ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+
+// From our .c file
+extern void m65_snapshot_init ( void );
+extern int  m65_snapshot_load ( const char *filename );
+extern int  m65_snapshot_save ( const char *filename );
+
+#endif
+#endif
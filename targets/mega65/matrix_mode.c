@@ -29,6 +29,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #include "io_mapper.h"
 #include "memory_mapper.h"
 #include "audio65.h"
+#include "profiler.h"
 
 #include <ctype.h>
 #include <string.h>
@@ -592,6 +593,26 @@ static void cmd_audio ( char *p )
 }
 
 
+static void cmd_prof ( char *p )
+{
+	if (!strcmp(p, "on"))
+		profiler_enable(true);
+	else if (!strcmp(p, "off")) {
+		profiler_csv_close();
+		profiler_enable(false);
+	} else if (!strncmp(p, "csv ", 4)) {
+		if (profiler_csv_open(p + 4))
+			MATRIX("ERROR: Cannot open CSV file");
+	} else if (*p) {
+		MATRIX("?BAD PARAMETER, use: on, off, csv FILE, or no parameter for the report");
+		return;
+	}
+	char buffer[1024];
+	profiler_get_report(buffer, sizeof buffer);
+	MATRIX("%s", buffer);
+}
+
+
 static void cmd_vic ( char *p )
 {
 	const Uint32 v_addr = (Uint32)(vic4_query_screen_address() - main_ram);
@@ -680,6 +701,7 @@ static const struct command_tab_st {
 	{ "shade",	cmd_shade,	NULL	},
 	{ "audio",	cmd_audio,	NULL	},
 	{ "vic",	cmd_vic,	NULL	},
+	{ "prof",	cmd_prof,	NULL	},
 #	ifdef XEMU_HAS_SOCKET_API
 	{ "serialtcp",	cmd_serialtcp,	NULL	},
 #	endif
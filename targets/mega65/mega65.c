@@ -25,6 +25,7 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #include "xemu/emutools_hid.h"
 #include "vic4.h"
 #include "sdcard.h"
+#include "xemu/f011_core.h"
 #include "uart_monitor.h"
 #include "hypervisor.h"
 #include "xemu/c64_kbd_mapping.h"
@@ -45,6 +46,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #include "matrix_mode.h"
 #include "xemu/emutools_osk.h"
 #include "serialtcp.h"
+#include "profiler.h"
+#include "guestprof.h"
+#include "m65_snapshot.h"
 
 // "Typical" size in default settings (video standard is PAL, default border settings).
 // See also vic4.h
@@ -484,9 +488,14 @@ static void shutdown_callback ( void )
 		vic4_freerun_until_frame_close();
 	}
 #endif
+	vic4_shutdown();
 	hypervisor_serial_monitor_close_file(configdb.hyperserialfile);
+	profiler_csv_close();
+	if (configdb.guestprof && *configdb.guestprof)
+		guestprof_dump(configdb.guestprof);
 	i2c_save_storage(0);
 	eth65_shutdown();
+	audio65_shutdown();
 	for (int a = 0; a < 0x40; a++)
 		DEBUG("VIC-3 register $%02X is %02X" NL, a, vic_registers[a]);
 	cia_dump_state(&cia1);
@@ -511,6 +520,19 @@ static void shutdown_callback ( void )
 }
 
 
+#ifdef XEMU_SNAPSHOT_SUPPORT
+static void m65_snapshot_saver_on_exit_callback ( void )
+{
+	if (!configdb.snapsave)
+		return;
+	if (m65_snapshot_save(configdb.snapsave))
+		ERROR_WINDOW("Could not save snapshot \"%s\": %s", configdb.snapsave, xemusnap_error_buffer);
+	else
+		DEBUGPRINT("SNAP: snapshot has been saved to \"%s\"" NL, configdb.snapsave);
+}
+#endif
+
+
 static void reset_mega65_hard ( void )
 {
 	reset_hw_errata_level();
@@ -614,10 +636,15 @@ static void update_emulated_time_sources ( void )
 
 static void update_emulator ( void )
 {
+	Uint64 prof_t = profiler_start();
 	vic4_close_frame_access();
+	prof_t = profiler_lap(PROF_SCREEN, prof_t);
 	// XXX: some things has been moved here from the main loop, however update_emulator is called from other places as well, FIXME check if it causes problems or not!
 	inject_ready_check_do();
 	audio65_sid_inc_framecount();
+	prof_t = profiler_lap(PROF_UPDATE, prof_t);
+	audio65_offline_pull();
+	prof_t = profiler_lap(PROF_AUDIO, prof_t);
 	hid_handle_all_sdl_events();
 	xemugui_iteration();
 	nmi_set(IS_RESTORE_PRESSED(), 2);	// Custom handling of the restore key ...
@@ -635,9 +662,12 @@ static void update_emulator ( void )
 #endif
 	// Screen updating, final phase
 	//vic4_close_frame_access();
+	prof_t = profiler_lap(PROF_UPDATE, prof_t);
 	// Let's sleep ...
 	xemu_timekeeping_delay(videostd_frametime);
 	update_emulated_time_sources();
+	profiler_lap(PROF_SLEEP, prof_t);
+	profiler_frame_end();
 }
 
 
@@ -725,16 +755,33 @@ static void emulation_loop ( void )
 			}
 		}
 #endif
-		cycles += XEMU_UNLIKELY(in_dma) ? dma_update_multi_steps(cpu_cycles_per_scanline) : cpu65_step(
+		const Uint8 step_is_dma = in_dma;
+		Uint64 prof_t = profiler_start();
+		const int step_cycles = XEMU_UNLIKELY(step_is_dma) ? dma_update_multi_steps(cpu_cycles_per_scanline) : cpu65_step(
 #ifdef CPU_STEP_MULTI_OPS
 			cpu_cycles_per_step
 #endif
 		);	// FIXME: this is maybe not correct, that DMA's speed depends on the fast/slow clock as well?
+		cycles += step_cycles;
+		if (XEMU_UNLIKELY(profiler_enabled)) {
+			prof_t = profiler_lap(step_is_dma ? PROF_DMA : PROF_CPU, prof_t);
+			profiler_cycles += step_cycles;
+		}
 		if (cycles >= cpu_cycles_per_scanline) {
 			cycles -= cpu_cycles_per_scanline;
 			cia_tick(&cia1, 32);	// FIXME: why 32?????? why fixed????? what should be the CIA "tick" frequency for real? Is it dependent on NTSC/PAL?
 			cia_tick(&cia2, 32);
-			if (XEMU_UNLIKELY(vic4_render_scanline()))
+			prof_t = profiler_lap(PROF_CIA, prof_t);
+			audio65_scanline_tick();
+#ifdef			SD_ASYNC_IO_SUPPORT
+			if (XEMU_UNLIKELY(sd_io_pending))
+				sdcard_io_scanline_tick();
+#endif
+			if (XEMU_UNLIKELY(configdb.fdctiming))
+				fdc_tick(videostd_1mhz_cycles_per_scanline);
+			const bool end_of_frame = vic4_render_scanline();
+			profiler_lap(PROF_VIC, prof_t);
+			if (XEMU_UNLIKELY(end_of_frame))
 				break;	// break the (main, "for") loop, if frame is over!
 		}
 	}
@@ -823,11 +870,26 @@ int main ( int argc, char **argv )
 	rom_initrom_requested = configdb.useinitrom;
 	rom_from_prefdir_allowed = !configdb.romfromsd;
 	rom_load_custom(configdb.rom);
+	// *** Snapshot loading must be the last step of the initialization, to override the state set up so far
+#ifdef XEMU_SNAPSHOT_SUPPORT
+	m65_snapshot_init();
+	if (configdb.snapload) {
+		if (m65_snapshot_load(configdb.snapload))
+			FATAL("Couldn't load snapshot \"%s\": %s", configdb.snapload, xemusnap_error_buffer);
+	}
+	atexit(m65_snapshot_saver_on_exit_callback);
+#endif
 	audio65_start();
 	xemu_set_full_screen(configdb.fullscreen_requested);
 	if (!configdb.syscon)
 		sysconsole_close(NULL);
 	hypervisor_serial_monitor_open_file(configdb.hyperserialfile);
+	if (configdb.profilecsv && *configdb.profilecsv)
+		profiler_csv_open(configdb.profilecsv);
+	else if (configdb.profiler)
+		profiler_enable(true);
+	if (configdb.guestprof && *configdb.guestprof)
+		guestprof_enable(true);
 #ifdef XEMU_HAS_SOCKET_API
 	serialtcp_init(configdb.serialtcp);
 #endif
@@ -840,3 +902,50 @@ int main ( int argc, char **argv )
 	XEMU_MAIN_LOOP(emulation_loop, 25, 1);
 	return 0;
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+#define SNAPSHOT_M65_BLOCK_VERSION	0
+#define SNAPSHOT_M65_BLOCK_SIZE		0x100
+
+
+int m65emu_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[SNAPSHOT_M65_BLOCK_SIZE];
+	if (block->block_version != SNAPSHOT_M65_BLOCK_VERSION || block->sub_counter || block->sub_size != sizeof buffer)
+		RETURN_XSNAPERR_USER("Bad M65 block syntax");
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	nmi_level = (int)P_AS_BE32(buffer + 0);
+	last_dd00_bits = buffer[4];
+	return 0;
+}
+
+
+int m65emu_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_M65_BLOCK_SIZE];
+	const int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_M65_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	U32_AS_BE(buffer + 0, nmi_level);
+	buffer[4] = last_dd00_bits;
+	return xemusnap_write_sub_block(buffer, sizeof buffer);
+}
+
+
+int m65emu_snapshot_loading_finalize ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	// CPU speed depends on the state of multiple modules, so it's calculated again only at this point
+	speed_current = -1;
+	machine_set_speed(1);
+	DEBUGPRINT("SNAP: loaded (finalize-callback!)." NL);
+	return 0;
+}
+
+#endif
@@ -121,6 +121,14 @@ static void  memwatch_writer  ( const Uint32 addr32, const Uint8 data );
 static Uint8 mem_slot_watcher[MEM_SLOTS_TOTAL];
 #endif
 
+#ifdef CPU65_PREDECODE_SUPPORT
+#ifndef MEM_USE_DATA_POINTERS
+#error "CPU65_PREDECODE_SUPPORT needs MEM_USE_DATA_POINTERS"
+#endif
+static void  code_cache_writer ( const Uint32 addr32, const Uint8 data );
+static void  code_cache_assign_slot ( const Uint32 slot );
+#endif
+
 typedef enum {
 	MEM_SLOT_TYPE_UNRESOLVED,	// invalidated slots
 	MEM_SLOT_TYPE_IMPOSSIBLE,	// should not happen ever! software bug ...
@@ -421,6 +429,9 @@ static XEMU_INLINE void slot_assignment_postprocessing ( const Uint32 slot )
 		}
 	}
 #endif
+#ifdef	CPU65_PREDECODE_SUPPORT
+	code_cache_assign_slot(slot);
+#endif
 }
 
 
@@ -665,6 +676,9 @@ static inline void invalidate_slot ( const unsigned int slot )
 	if (slot < 0x100U) {
 		mem_slot_rd_func[slot] = mem_slot_rd_func_real[slot] = lazy_cpu_read_resolver;
 		mem_slot_wr_func[slot] = mem_slot_wr_func_real[slot] = lazy_cpu_write_resolver;
+#ifdef		CPU65_PREDECODE_SUPPORT
+		cpu65_predecode_blocks[slot] = NULL;
+#endif
 	}
 }
 
@@ -676,6 +690,97 @@ static inline void invalidate_slot_range ( unsigned int first_slot, const unsign
 }
 
 
+#ifdef CPU65_PREDECODE_SUPPORT
+// Predecoded opcode cache of the CPU emulator (see cpu65.h), with blocks allocated on demand for 256 byte pages of the main RAM.
+// The 2K shared with the colour RAM is not cached, as it can be written through the colour RAM as well.
+// While a block has decoded opcodes, all slots able to write its page have no write data pointer, but code_cache_writer()
+// instead, thus any write there invalidates the block (and gives the fast path back to those slots). The previous writer
+// of the slot (eg: memwatch_writer) is kept and called by code_cache_writer(), so it's not bypassed.
+#define CODE_CACHE_PAGES	(sizeof(main_ram) >> 8)
+static struct cpu65_predecode_block_st *code_cache_blocks[CODE_CACHE_PAGES];
+static mem_slot_wr_func_t code_cache_chained_writers[MEM_SLOTS_TOTAL];
+static bool code_cache_enabled = false;
+
+
+static XEMU_INLINE bool code_cache_is_cacheable ( const Uint32 addr32 )
+{
+	return addr32 < sizeof(main_ram) && (addr32 < 0x1F800U || addr32 >= 0x20000U);
+}
+
+
+static void code_cache_invalidate_page ( const Uint32 page )
+{
+	struct cpu65_predecode_block_st *blk = code_cache_blocks[page];
+	if (!blk || !blk->decoded)
+		return;
+	cpu65_predecode_invalidate_block(blk);
+	for (unsigned int slot = 0; slot < MEM_SLOTS_TOTAL; slot++)
+		if (mem_slot_wr_addr32[slot] == blk->addr && mem_slot_wr_func[slot] == code_cache_writer)
+			invalidate_slot(slot);	// nothing to protect there anymore, the slot will be resolved again with its data pointer
+}
+
+
+static void code_cache_writer ( const Uint32 addr32, const Uint8 data )
+{
+	code_cache_chained_writers[ref_slot](addr32, data);	// write first, the invalidation below can invalidate the slot itself as well
+	code_cache_invalidate_page(addr32 >> 8);
+}
+
+
+static void code_cache_protect_slot ( const Uint32 slot )
+{
+	const Uint32 addr32 = mem_slot_wr_addr32[slot];
+	if (code_cache_is_cacheable(addr32) && code_cache_blocks[addr32 >> 8] && code_cache_blocks[addr32 >> 8]->decoded &&
+		mem_slot_wr_func[slot] != dummy_writer && mem_slot_wr_func[slot] != code_cache_writer
+	) {
+		code_cache_chained_writers[slot] = mem_slot_wr_func[slot];
+		mem_slot_wr_data[slot] = NULL;
+		mem_slot_wr_func[slot] = code_cache_writer;
+	}
+}
+
+
+// Called by slot_assignment_postprocessing() for all newly resolved slots
+static void code_cache_assign_slot ( const Uint32 slot )
+{
+	if (!code_cache_enabled)
+		return;
+	if (slot < 0x100U) {
+		const Uint32 addr32 = mem_slot_rd_addr32[slot];
+		if (code_cache_is_cacheable(addr32) && mem_slot_rd_data[slot] == main_ram + addr32) {
+			struct cpu65_predecode_block_st **blk = &code_cache_blocks[addr32 >> 8];
+			if (XEMU_UNLIKELY(!*blk)) {
+				*blk = xemu_malloc(sizeof(struct cpu65_predecode_block_st));
+				memset(*blk, 0, sizeof(struct cpu65_predecode_block_st));
+				(*blk)->addr = addr32;
+			}
+			cpu65_predecode_blocks[slot] = *blk;
+		} else
+			cpu65_predecode_blocks[slot] = NULL;
+	}
+	code_cache_protect_slot(slot);
+}
+
+
+void cpu65_predecode_block_activated ( struct cpu65_predecode_block_st *blk )
+{
+	for (unsigned int slot = 0; slot < MEM_SLOTS_TOTAL; slot++)
+		if (mem_slot_wr_addr32[slot] == blk->addr)
+			code_cache_protect_slot(slot);
+}
+
+
+// Must be called if main RAM is written directly, not through the slots (bulk loads, etc)
+void memory_code_cache_invalidate ( const Uint32 addr32, const Uint32 size )
+{
+	if (!code_cache_enabled || !size)
+		return;
+	for (Uint32 page = addr32 >> 8; page <= (addr32 + size - 1) >> 8 && page < CODE_CACHE_PAGES; page++)
+		code_cache_invalidate_page(page);
+}
+#endif
+
+
 static void apply_cpu_memory_policy ( Uint8 i )
 {
 	for (; i < 0x10U; i++) {
@@ -967,6 +1072,9 @@ void memory_init (void )
 	rom_protect = false;
 	D6XX_registers[0x7D] &= ~4;
 	in_hypervisor = false;
+#ifdef	CPU65_PREDECODE_SUPPORT
+	code_cache_enabled = configdb.cpupredecode;
+#endif
 #ifdef	MEM_USE_HINTS
 	for (unsigned int i = 0; i < MEM_HINT_SLOTS; i++)
 		mem_map_hints[i] = mem_map;
@@ -1010,6 +1118,33 @@ void memory_reset_unwritten_debug_stat ( void )
 }
 
 
+// Reads/writes a byte through the given slot: if the slot has a data pointer (plain RAM-like content) it's a simple
+// indexed access, only the other ones (I/O, watched, special handling needed, etc) fall back to the slot callbacks.
+// Warning: the caller must set ref_slot before, as the callbacks may depend on it!
+static XEMU_INLINE Uint8 slot_read_byte ( const Uint32 slot, const Uint32 addr32 )
+{
+#ifdef	MEM_USE_DATA_POINTERS
+	register const Uint8 *p = mem_slot_rd_data[slot];
+	if (MEM_DATA_POINTER_HINTING_STRENGTH(p))
+		return p[addr32 & 0xFFU];
+#endif
+	return mem_slot_rd_func[slot](addr32);
+}
+
+
+static XEMU_INLINE void slot_write_byte ( const Uint32 slot, const Uint32 addr32, const Uint8 data )
+{
+#ifdef	MEM_USE_DATA_POINTERS
+	register Uint8 *p = mem_slot_wr_data[slot];
+	if (MEM_DATA_POINTER_HINTING_STRENGTH(p)) {
+		p[addr32 & 0xFFU] = data;
+		return;
+	}
+#endif
+	mem_slot_wr_func[slot](addr32, data);
+}
+
+
 // Warning: this overwrites ref_slot!
 static XEMU_INLINE Uint32 cpu_get_flat_addressing_mode_address ( const Uint8 index )
 {
@@ -1020,10 +1155,10 @@ static XEMU_INLINE Uint32 cpu_get_flat_addressing_mode_address ( const Uint8 ind
 		resolve_cpu_slot(ref_slot);
 	const Uint32 rd_base_addr = mem_slot_rd_addr32[ref_slot];
 	return index +
-		(mem_slot_rd_func[ref_slot](rd_base_addr +   bp_addr              )      ) +
-		(mem_slot_rd_func[ref_slot](rd_base_addr + ((bp_addr + 1) & 0xFFU)) <<  8) +
-		(mem_slot_rd_func[ref_slot](rd_base_addr + ((bp_addr + 2) & 0xFFU)) << 16) +
-		(mem_slot_rd_func[ref_slot](rd_base_addr + ((bp_addr + 3) & 0xFFU)) << 24) ;
+		(slot_read_byte(ref_slot, rd_base_addr +   bp_addr              )      ) +
+		(slot_read_byte(ref_slot, rd_base_addr + ((bp_addr + 1) & 0xFFU)) <<  8) +
+		(slot_read_byte(ref_slot, rd_base_addr + ((bp_addr + 2) & 0xFFU)) << 16) +
+		(slot_read_byte(ref_slot, rd_base_addr + ((bp_addr + 3) & 0xFFU)) << 24) ;
 }
 
 
@@ -1051,7 +1186,7 @@ Uint8 cpu65_read_linear_opcode_callback ( void )
 	//DEBUGPRINT("cpu65_read_linear_opcode_callback: about to call read for addr = $%02X at PC=$%04X" NL, addr32, cpu65.old_pc);	// REMOVE
 	resolve_special_rd_slot_on_demand(MEM_SLOT_CPU_LINEAR, addr32);
 	ref_slot = MEM_SLOT_CPU_LINEAR;
-	return mem_slot_rd_func[MEM_SLOT_CPU_LINEAR](addr32);
+	return slot_read_byte(MEM_SLOT_CPU_LINEAR, addr32);
 }
 
 
@@ -1060,7 +1195,7 @@ void cpu65_write_linear_opcode_callback ( const Uint8 data )
 	register const Uint32 addr32 = cpu_get_flat_addressing_mode_address(cpu65.z) & 0xFFFFFFFU;
 	resolve_special_wr_slot_on_demand(MEM_SLOT_CPU_LINEAR, addr32);
 	ref_slot = MEM_SLOT_CPU_LINEAR;
-	mem_slot_wr_func[MEM_SLOT_CPU_LINEAR](addr32, data);
+	slot_write_byte(MEM_SLOT_CPU_LINEAR, addr32, data);
 }
 
 
@@ -1069,13 +1204,13 @@ Uint32 cpu65_read_linear_long_opcode_callback ( const Uint8 index )
 	Uint32 addr32 = cpu_get_flat_addressing_mode_address(index);
 	ref_slot = MEM_SLOT_CPU_LINEAR;
 	resolve_special_rd_slot_on_demand(MEM_SLOT_CPU_LINEAR,   addr32);
-	Uint32 data =   mem_slot_rd_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU) ;
+	Uint32 data =   slot_read_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU) ;
 	resolve_special_rd_slot_on_demand(MEM_SLOT_CPU_LINEAR, ++addr32);
-	data += (Uint32)mem_slot_rd_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU) <<  8;
+	data += (Uint32)slot_read_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU) <<  8;
 	resolve_special_rd_slot_on_demand(MEM_SLOT_CPU_LINEAR, ++addr32);
-	data += (Uint32)mem_slot_rd_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU) << 16;
+	data += (Uint32)slot_read_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU) << 16;
 	resolve_special_rd_slot_on_demand(MEM_SLOT_CPU_LINEAR, ++addr32);
-	data += (Uint32)mem_slot_rd_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU) << 24;
+	data += (Uint32)slot_read_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU) << 24;
 	return data;
 
 }
@@ -1086,13 +1221,13 @@ void cpu65_write_linear_long_opcode_callback ( const Uint8 index, const Uint32 d
 	Uint32 addr32 = cpu_get_flat_addressing_mode_address(index);
 	ref_slot = MEM_SLOT_CPU_LINEAR;
 	resolve_special_wr_slot_on_demand(MEM_SLOT_CPU_LINEAR,   addr32);
-	mem_slot_wr_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU,  data        & 0xFFU);
+	slot_write_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU,  data        & 0xFFU);
 	resolve_special_wr_slot_on_demand(MEM_SLOT_CPU_LINEAR, ++addr32);
-	mem_slot_wr_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU, (data >>  8) & 0xFFU);
+	slot_write_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU, (data >>  8) & 0xFFU);
 	resolve_special_wr_slot_on_demand(MEM_SLOT_CPU_LINEAR, ++addr32);
-	mem_slot_wr_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU, (data >> 16) & 0xFFU);
+	slot_write_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU, (data >> 16) & 0xFFU);
 	resolve_special_wr_slot_on_demand(MEM_SLOT_CPU_LINEAR, ++addr32);
-	mem_slot_wr_func[MEM_SLOT_CPU_LINEAR](addr32 & 0xFFFFFFFU, (data >> 24) & 0xFFU);
+	slot_write_byte(MEM_SLOT_CPU_LINEAR, addr32 & 0xFFFFFFFU, (data >> 24) & 0xFFU);
 }
 
 
@@ -1100,14 +1235,14 @@ void cpu65_write_linear_long_opcode_callback ( const Uint8 index, const Uint32 d
 	Uint8 name ( const Uint32 addr32 ) { \
 		resolve_special_rd_slot_on_demand(slot, addr32); \
 		ref_slot = slot; \
-		return mem_slot_rd_func[slot](addr32 & 0xFFFFFFFU); \
+		return slot_read_byte(slot, addr32 & 0xFFFFFFFU); \
 	}
 
 #define CREATE_LINEAR_WRITER(name,slot) \
 	void name ( const Uint32 addr32, const Uint8 data ) { \
 		resolve_special_wr_slot_on_demand(slot, addr32); \
 		ref_slot = slot; \
-		mem_slot_wr_func[slot](addr32 & 0xFFFFFFFU, data); \
+		slot_write_byte(slot, addr32 & 0xFFFFFFFU, data); \
 	}
 
 CREATE_LINEAR_READER(memory_dma_list_reader,    MEM_SLOT_DMA_LIST)
@@ -1121,6 +1256,47 @@ CREATE_LINEAR_READER(sdebug_read_linear_byte,   MEM_SLOT_SDEBUG)
 CREATE_LINEAR_WRITER(sdebug_write_linear_byte,  MEM_SLOT_SDEBUG)
 
 
+// For DMA bulk operations: returns with a direct pointer to the given linear address, which is valid
+// till the end of its 256 byte page, if the page can be accessed without any side effects (plain RAM,
+// no memory watch, no shared colour RAM, etc). Otherwise NULL is returned, the caller must fall back
+// to the byte-by-byte reader/writer functions then.
+Uint8 *memory_dma_source_direct_rd ( const Uint32 addr32 )
+{
+#ifdef	MEM_USE_DATA_POINTERS
+	resolve_special_rd_slot_on_demand(MEM_SLOT_DMA_SOURCE, addr32);
+	Uint8 *p = mem_slot_rd_data[MEM_SLOT_DMA_SOURCE];
+	return p ? p + (addr32 & 0xFFU) : NULL;
+#else
+	return NULL;
+#endif
+}
+
+
+Uint8 *memory_dma_target_direct_wr ( const Uint32 addr32 )
+{
+#ifdef	MEM_USE_DATA_POINTERS
+	resolve_special_wr_slot_on_demand(MEM_SLOT_DMA_TARGET, addr32);
+	Uint8 *p = mem_slot_wr_data[MEM_SLOT_DMA_TARGET];
+	return p ? p + (addr32 & 0xFFU) : NULL;
+#else
+	return NULL;
+#endif
+}
+
+
+// The same as memory_dma_target_direct_wr() but for non-CPU/DMA bulk writes (eg: HDOS virtualization loading host files)
+Uint8 *debug_write_linear_direct ( const Uint32 addr32 )
+{
+#ifdef	MEM_USE_DATA_POINTERS
+	resolve_special_wr_slot_on_demand(MEM_SLOT_DEBUG, addr32);
+	Uint8 *p = mem_slot_wr_data[MEM_SLOT_DEBUG];
+	return p ? p + (addr32 & 0xFFU) : NULL;
+#else
+	return NULL;
+#endif
+}
+
+
 Uint8 debug_read_cpu_byte  ( const Uint16 addr16 )
 {
 	ref_slot = addr16 >> 8;
@@ -1130,7 +1306,14 @@ Uint8 debug_read_cpu_byte  ( const Uint16 addr16 )
 void  debug_write_cpu_byte ( const Uint16 addr16, const Uint8 data )
 {
 	ref_slot = addr16 >> 8;
+#ifdef	CPU65_PREDECODE_SUPPORT
+	const Uint32 addr32 = mem_slot_wr_addr32[ref_slot] + (addr16 & 0xFFU);
+	const mem_slot_wr_func_t writer = mem_slot_wr_func_real[ref_slot];
+	memory_code_cache_invalidate(addr32, 1);
+	writer(addr32, data);
+#else
 	mem_slot_wr_func_real[ref_slot](mem_slot_wr_addr32[ref_slot] + (addr16 & 0xFFU), data);
+#endif
 }
 
 
@@ -1241,3 +1424,65 @@ void memory_watch_notify_change ( const struct mem_watch_list_st *rd_list, const
 		}
 }
 #endif
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+// Note: this block only stores the state of the memory decoder. The memory content itself
+// is handled by the "Memory" block, see m65_snapshot.c
+
+#define SNAPSHOT_MEMORY_MAPPER_BLOCK_VERSION	0
+#define SNAPSHOT_MEMORY_MAPPER_BLOCK_SIZE	0x100
+
+
+int memory_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	Uint8 buffer[SNAPSHOT_MEMORY_MAPPER_BLOCK_SIZE];
+	if (block->block_version != SNAPSHOT_MEMORY_MAPPER_BLOCK_VERSION || block->sub_counter || block->sub_size != sizeof buffer)
+		RETURN_XSNAPERR_USER("Bad memory mapper block syntax");
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	// Forget all resolved slots, the new configuration is applied from scratch
+	invalidate_slot_range(0, MEM_SLOTS_TOTAL - 1);
+	for (unsigned int i = 0; i < 0x10; i++)
+		policy4k[i] = BANK_POLICY_INVALID;
+	cpu_rmw_old_data = -1;
+	memory_reconfigure(
+		buffer[0],			// $D030 ROM banking
+		buffer[1] & 3,			// I/O mode
+		buffer[2], buffer[3],		// CPU I/O port 0, 1
+		P_AS_BE32(buffer + 8),  P_AS_BE32(buffer + 12),	// MAP MB LO, OFS LO
+		P_AS_BE32(buffer + 16), P_AS_BE32(buffer + 20),	// MAP MB HI, OFS HI
+		buffer[4],			// MAP mask
+		!!buffer[5]			// hypervisor
+	);
+	memory_set_rom_protection(!!buffer[6]);
+	return 0;
+}
+
+
+int memory_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_MEMORY_MAPPER_BLOCK_SIZE];
+	const int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_MEMORY_MAPPER_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	buffer[0] = vic_registers[0x30];
+	buffer[1] = io_mode;
+	buffer[2] = cpu_io_port[0];
+	buffer[3] = cpu_io_port[1];
+	buffer[4] = map_mask;
+	buffer[5] = in_hypervisor ? 1 : 0;
+	buffer[6] = rom_protect ? 1 : 0;
+	U32_AS_BE(buffer +  8, map_megabyte_low);
+	U32_AS_BE(buffer + 12, map_offset_low);
+	U32_AS_BE(buffer + 16, map_megabyte_high);
+	U32_AS_BE(buffer + 20, map_offset_high);
+	return xemusnap_write_sub_block(buffer, sizeof buffer);
+}
+
+#endif
@@ -41,6 +41,7 @@ extern Uint8 debug_read_linear_byte   ( const Uint32 addr32 );
 extern Uint8 sdebug_read_linear_byte  ( const Uint32 addr32 );
 extern void  debug_write_linear_byte  ( const Uint32 addr32, const Uint8 data );
 extern void  sdebug_write_linear_byte ( const Uint32 addr32, const Uint8 data );
+extern Uint8 *debug_write_linear_direct ( const Uint32 addr32 );
 // debug read/write CPU address functions: other than hardware emulation, these must be used for debug purposes (monitor/debugger, etc)
 extern Uint8 debug_read_cpu_byte  ( const Uint16 addr16 );
 extern void  debug_write_cpu_byte ( const Uint16 addr16, const Uint8 data );
@@ -51,6 +52,15 @@ extern void  memory_dma_source_mwriter ( const Uint32 addr32, const Uint8 data )
 extern Uint8 memory_dma_target_mreader ( const Uint32 addr32 );
 extern void  memory_dma_target_mwriter ( const Uint32 addr32, const Uint8 data );
 extern Uint8 memory_dma_list_reader    ( const Uint32 addr32 );
+extern Uint8 *memory_dma_source_direct_rd ( const Uint32 addr32 );
+extern Uint8 *memory_dma_target_direct_wr ( const Uint32 addr32 );
+
+// Must be called after writing main RAM directly, not through the functions above, see CPU65_PREDECODE_SUPPORT
+#ifdef CPU65_PREDECODE_SUPPORT
+extern void memory_code_cache_invalidate ( const Uint32 addr32, const Uint32 size );
+#else
+#define memory_code_cache_invalidate(addr32,size)
+#endif
 
 // MAP related variables, do not change these values directly!
 extern Uint32 map_offset_low, map_offset_high, map_megabyte_low, map_megabyte_high;
@@ -74,4 +84,10 @@ extern Uint8 i2c_regs[0x1000];
 extern int skip_unhandled_mem;
 extern int cpu_rmw_old_data;
 
+#ifdef XEMU_SNAPSHOT_SUPPORT
+#include "xemu/emutools_snapshot.h"
+extern int memory_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+extern int memory_snapshot_save_state ( const struct xemu_snapshot_definition_st *def );
+#endif
+
 #endif
@@ -0,0 +1,178 @@
+/* A work-in-progess MEGA65 (Commodore 65 clone origins) emulator
+   Part of the Xemu project, please visit: https://github.com/lgblgblgb/xemu
+   Copyright (C)2016-2025 LGB (Gábor Lénárt) <lgblgblgb@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+/* Simple host time profiler for the main emulation loop: accumulates the time spent in the major
+   parts of the emulation (CPU, DMA, VIC rendering, etc) per emulated frame. The results can be queried
+   as averages over a window of frames (UART monitor, matrix mode) or written into a CSV file, one line
+   per frame. When not enabled, the cost is a single flag check at the instrumented points. */
+
+#include "xemu/emutools.h"
+#include "xemu/emutools_files.h"
+#include "profiler.h"
+
+#include <string.h>
+
+#define WINDOW_FRAMES	50
+
+bool   profiler_enabled = false;
+Uint64 profiler_acc[PROF_SECTIONS];
+Uint64 profiler_cycles;
+
+static const char *section_names[PROF_SECTIONS] = {
+	"cpu", "dma", "cia", "vic", "screen", "audio", "update", "sleep"
+};
+
+static Uint64 frame_start = 0;		// host time at the end of the previous frame
+static Uint64 frame_counter;
+static int    csv_fd = -1;
+// The current (being collected) and the last completed window of frames
+static struct {
+	Uint64	acc[PROF_SECTIONS];
+	Uint64	total;
+	Uint64	cycles;
+	int	frames;
+} window, last_window;
+
+
+static void reset_counters ( void )
+{
+	memset(profiler_acc, 0, sizeof profiler_acc);
+	profiler_cycles = 0;
+	memset(&window, 0, sizeof window);
+	memset(&last_window, 0, sizeof last_window);
+	frame_start = 0;
+	frame_counter = 0;
+}
+
+
+void profiler_enable ( const bool enable )
+{
+	if (enable == profiler_enabled)
+		return;
+	reset_counters();
+	profiler_enabled = enable;
+	DEBUGPRINT("PROFILER: %s" NL, enable ? "enabled" : "disabled");
+}
+
+
+int profiler_csv_open ( const char *fn )
+{
+	profiler_csv_close();
+	csv_fd = xemu_open_file(fn, O_CREAT | O_TRUNC | O_WRONLY, NULL, NULL);
+	if (csv_fd < 0) {
+		ERROR_WINDOW("Cannot create profiler CSV file:\n%s", fn);
+		return 1;
+	}
+	char buf[256];
+	int len = snprintf(buf, sizeof buf, "frame,total_us");
+	for (int i = 0; i < PROF_SECTIONS; i++)
+		len += snprintf(buf + len, sizeof(buf) - len, ",%s_us", section_names[i]);
+	len += snprintf(buf + len, sizeof(buf) - len, ",other_us,cycles\n");
+	if (xemu_safe_write(csv_fd, buf, len) != len) {
+		profiler_csv_close();
+		return 1;
+	}
+	DEBUGPRINT("PROFILER: writing per-frame CSV into file: %s" NL, fn);
+	profiler_enable(true);
+	return 0;
+}
+
+
+void profiler_csv_close ( void )
+{
+	if (csv_fd >= 0) {
+		xemu_safe_close(csv_fd);
+		csv_fd = -1;
+		DEBUGPRINT("PROFILER: CSV file has been closed" NL);
+	}
+}
+
+
+static XEMU_INLINE unsigned int to_usec ( const Uint64 t )
+{
+	return (unsigned int)(t * 1000000U / SDL_GetPerformanceFrequency());
+}
+
+
+// Must be called at the end of every emulated frame
+void profiler_frame_end ( void )
+{
+	if (XEMU_LIKELY(!profiler_enabled))
+		return;
+	const Uint64 now = SDL_GetPerformanceCounter();
+	if (XEMU_UNLIKELY(!frame_start)) {
+		// First frame after enabling: we don't know when it started, thus drop it
+		frame_start = now;
+		memset(profiler_acc, 0, sizeof profiler_acc);
+		profiler_cycles = 0;
+		return;
+	}
+	const Uint64 total = now - frame_start;
+	frame_start = now;
+	frame_counter++;
+	Uint64 sum = 0;
+	for (int i = 0; i < PROF_SECTIONS; i++) {
+		window.acc[i] += profiler_acc[i];
+		sum += profiler_acc[i];
+	}
+	window.total += total;
+	window.cycles += profiler_cycles;
+	if (csv_fd >= 0) {
+		char buf[256];
+		int len = snprintf(buf, sizeof buf, "%llu,%u", (unsigned long long int)frame_counter, to_usec(total));
+		for (int i = 0; i < PROF_SECTIONS; i++)
+			len += snprintf(buf + len, sizeof(buf) - len, ",%u", to_usec(profiler_acc[i]));
+		len += snprintf(buf + len, sizeof(buf) - len, ",%u,%llu\n", total > sum ? to_usec(total - sum) : 0, (unsigned long long int)profiler_cycles);
+		if (xemu_safe_write(csv_fd, buf, len) != len) {
+			ERROR_WINDOW("Cannot write profiler CSV file, closing it");
+			profiler_csv_close();
+		}
+	}
+	memset(profiler_acc, 0, sizeof profiler_acc);
+	profiler_cycles = 0;
+	if (++window.frames >= WINDOW_FRAMES) {
+		last_window = window;
+		memset(&window, 0, sizeof window);
+	}
+}
+
+
+void profiler_get_report ( char *buf, const size_t size )
+{
+	if (!profiler_enabled) {
+		snprintf(buf, size, "Profiler is not enabled");
+		return;
+	}
+	if (!last_window.frames || !last_window.total) {
+		snprintf(buf, size, "Profiler: no complete window of %d frames yet", WINDOW_FRAMES);
+		return;
+	}
+	const double frames = last_window.frames;
+	size_t len = snprintf(buf, size, "Profiler, average of %d frames: %.0f usec/frame, %.0f cycles/frame\n",
+		last_window.frames, to_usec(last_window.total) / frames, last_window.cycles / frames);
+	Uint64 sum = 0;
+	for (int i = 0; i < PROF_SECTIONS && len < size; i++) {
+		len += snprintf(buf + len, size - len, "%-6s %7.0f usec %5.1f%%\n", section_names[i],
+			to_usec(last_window.acc[i]) / frames, 100.0 * (double)last_window.acc[i] / (double)last_window.total);
+		sum += last_window.acc[i];
+	}
+	if (len < size) {
+		const Uint64 other = last_window.total > sum ? last_window.total - sum : 0;
+		snprintf(buf + len, size - len, "%-6s %7.0f usec %5.1f%%", "other", to_usec(other) / frames, 100.0 * (double)other / (double)last_window.total);
+	}
+}
@@ -0,0 +1,56 @@
+/* A work-in-progess MEGA65 (Commodore 65 clone origins) emulator
+   Part of the Xemu project, please visit: https://github.com/lgblgblgb/xemu
+   Copyright (C)2016-2025 LGB (Gábor Lénárt) <lgblgblgb@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#ifndef XEMU_MEGA65_PROFILER_H_INCLUDED
+#define XEMU_MEGA65_PROFILER_H_INCLUDED
+
+// Sections of the main emulation loop, host time is accumulated separately for these
+enum profiler_section_en {
+	PROF_CPU, PROF_DMA, PROF_CIA, PROF_VIC, PROF_SCREEN, PROF_AUDIO, PROF_UPDATE, PROF_SLEEP,
+	PROF_SECTIONS
+};
+
+extern bool   profiler_enabled;
+extern Uint64 profiler_acc[PROF_SECTIONS];
+extern Uint64 profiler_cycles;
+
+// Returns the current host time for a following profiler_lap(), or zero if profiler is not enabled
+static XEMU_INLINE Uint64 profiler_start ( void )
+{
+	return XEMU_UNLIKELY(profiler_enabled) ? SDL_GetPerformanceCounter() : 0;
+}
+
+// Accounts the time elapsed since "start" to the given section. Returns with the current host time, so it
+// can be used as the "start" of the next section, without the need of another profiler_start()
+static XEMU_INLINE Uint64 profiler_lap ( const int section, const Uint64 start )
+{
+	if (XEMU_LIKELY(!profiler_enabled))
+		return 0;
+	const Uint64 now = SDL_GetPerformanceCounter();
+	if (XEMU_LIKELY(start))
+		profiler_acc[section] += now - start;
+	return now;
+}
+
+extern void profiler_frame_end  ( void );
+extern void profiler_enable     ( const bool enable );
+extern int  profiler_csv_open   ( const char *fn );
+extern void profiler_csv_close  ( void );
+extern void profiler_get_report ( char *buf, const size_t size );
+
+#endif
@@ -38,6 +38,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <math.h>
+#ifdef SD_IMAGE_MMAP_SUPPORT
+#include <sys/mman.h>
+#endif
 
 #define USE_KEEP_BUSY
 
@@ -71,6 +75,35 @@ static int	sd_is_read_only;
 #ifdef USE_KEEP_BUSY
 static int	keep_busy = 0;
 #endif
+#ifdef SD_IMAGE_MMAP_SUPPORT
+// If not NULL, the SD-card image is mapped into memory, and block I/O is done via that, instead of file I/O.
+// Since it's a shared mapping, it's coherent with the file I/O the d81access layer does on the same image
+// (on-SD D81 mounts), but the written data must be flushed (msync) to be sure it reaches the storage.
+static Uint8	*sd_mmap = NULL;
+static size_t	sd_mmap_size;
+static int	sd_mmap_dirty = 0;
+#endif
+#ifdef SD_ASYNC_IO_SUPPORT
+// Block I/O with emulated latency: the BUSY flags are cleared only after the given amount of emulated time
+// (counted in scanlines). Optionally, the host I/O itself is done by a worker thread, so the emulation thread
+// does not wait for the host storage. Only one request can be in progress, just like with the real controller.
+enum { SD_IO_IDLE, SD_IO_HOST, SD_IO_LATENCY };
+static struct {
+	int		state;		// SD_IO_HOST: the host I/O is not yet done, SD_IO_LATENCY: done, waiting for the emulated latency
+	int		latency_usec;
+	int		latency_ticks;	// remaining emulated latency in scanlines
+	Uint32		block;
+	int		is_write;
+	int		ret;		// result of the host I/O
+	Uint8		buffer[512];
+	SDL_Thread	*thread;
+	SDL_sem		*job_sem;
+	SDL_sem		*done_sem;
+	volatile bool	thread_quit;
+} sd_io;
+int		sd_io_pending = 0;	// checked by the main emulation loop, to call sdcard_io_scanline_tick() only if needed
+static void	sd_io_init ( const int latency_usec, const int use_thread );
+#endif
 // 4K buffer space: Actually the SD buffer _IS_ inside this, also the F011 buffer should be (FIXME: that is not implemented yet right now!!)
 Uint8		disk_buffers[0x1000];
 static Uint8	sd_fill_buffer[512];	// Only used by the sd fill mode write command
@@ -135,151 +168,257 @@ static struct {
 // Simulate a 4Gbyte card for virtual disk (the number is: number of blocks). Does not matter since only the actual written blocks stored in memory from it
 #define VIRTUAL_DISK_SIZE_IN_BLOCKS	8388608U
 
-#define RANGE_MAP_SIZE 256
+// Block number -> storage lookup is done by a two level radix index (root table + lazily allocated leaf tables)
+// so it's O(1) regardless of the number of blocks stored. A leaf entry is zero if the block is not stored (reads
+// as all zero bytes), otherwise it's the slot number in the in-memory chunks plus one, or if VDISK_SPILLED bit is
+// set, the rest of the bits is the block number within the spill file (used when the memory limit is reached).
+#define VDISK_LEAF_BITS		12
+#define VDISK_LEAF_SIZE		(1U << VDISK_LEAF_BITS)
+#define VDISK_ROOT_SIZE		((VIRTUAL_DISK_SIZE_IN_BLOCKS + VDISK_LEAF_SIZE - 1) >> VDISK_LEAF_BITS)
+#define VDISK_SPILLED		0x80000000U
+// About the memory limit: the allocated index leaves count in, but the limit can only stop allocating data chunks.
+// The index must be in memory to find the spilled blocks as well, so leaves are still allocated over the limit (one
+// leaf of 16Kbytes per 2Mbytes area of the disk written at all), thus the limit can be exceeded by 32Mbytes at most.
 
-struct virtdisk_chunk_st {
-	struct	virtdisk_chunk_st *next;	// pointer to the next chunk, or NULL, if it was the last (in that case vdisk.tail should point to this chunk)
-	int	used_blocks;			// number of used blocks in this chunk (up to vidsk.blocks_per_chunk)
-	Uint32	block_no_min;			// optimization: lowest numbered block inside _this_ chunk of blocks
-	Uint32	block_no_max;			// optimization: highest numbered block inside _this_ chunk of blocks
-	Uint8	*base;				// base pointer of the data area on this chunk, 512 bytes per block then
-	Uint32	list[];				// block number list for this chunk (see: used_blocks) [C99/C11 flexible array members syntax]
-};
 struct virtdisk_st {
-	struct	virtdisk_chunk_st *head, *tail;	// pointers to the head and tail of the linked list of chunks, or NULL for both, if there is nothing yet
+	Uint8	**chunks;			// data areas of the chunks, 512 bytes per block, blocks_per_chunk blocks in each
+	int	chunks_allocated;		// number of allocated entries in the "chunks" pointer array
 	int	blocks_per_chunk;		// number of blocks handled by a chunk
-	int	allocation_size;		// pre-calculated to have number of bytes allocated for a chunk, including the data area + struct itself
-	int	base_offset;			// pre-calculated to have the offset to the data area inside a chunk
 	int	all_chunks;			// number of all currently allocated chunks
 	int	all_blocks;			// number of all currently USED blocks within all chunks
-	Uint8	range_map[RANGE_MAP_SIZE];	// optimization: store here if a given range is stored in memory, eliminating the need to search all chunks over, if not
-	Uint32	range_map_divisor;		// optimization: for the above, to form range number from block number
+	int	spilled_blocks;			// number of blocks stored in the spill file
+	int	all_leaves;			// number of allocated leaf tables of the index
+	Uint32	*index[VDISK_ROOT_SIZE];	// root table of the index, pointers to leaf tables (or NULL)
+	size_t	mem_used;			// memory allocated for the virtual disk (chunks + index leaves) in bytes
+	size_t	mem_limit;			// above this amount of memory, new blocks are stored in the spill file, 0 = no limit (see below)
+	FILE	*spill_file;			// temporary file for the blocks over the memory limit, opened on demand
+	int	spill_fd;
 	int	mode;				// what mode is used, 0=no virtual disk
 };
 
-static struct virtdisk_st vdisk = { .head = NULL };
+static struct virtdisk_st vdisk = { .chunks = NULL, .spill_fd = -1 };
 
 static void virtdisk_destroy ( void )
 {
-	if (vdisk.head) {
-		struct virtdisk_chunk_st *v = vdisk.head;
-		int ranges = 0;
-		for (unsigned int a = 0; a < RANGE_MAP_SIZE; a++)
-			for (Uint8 m = 0x80; m; m >>= 1)
-				if ((vdisk.range_map[a] & m))
-					ranges++;
-		DEBUGPRINT("SDCARD: VDISK: destroying %d chunks (active data: %d blocks, %dKbytes, %d%%, ranges: %d/%d) of storage." NL,
+	if (vdisk.all_chunks || vdisk.all_leaves) {
+		DEBUGPRINT("SDCARD: VDISK: destroying %d chunks (active data: %d blocks, %dKbytes, %d%%), %d index leaves, %uKbytes of memory, %d spilled blocks." NL,
 			vdisk.all_chunks, vdisk.all_blocks, vdisk.all_blocks >> 1,
-			100 * vdisk.all_blocks / (vdisk.all_chunks * vdisk.blocks_per_chunk),
-			ranges, RANGE_MAP_SIZE * 8
+			vdisk.all_chunks ? 100 * vdisk.all_blocks / (vdisk.all_chunks * vdisk.blocks_per_chunk) : 0,
+			vdisk.all_leaves, (unsigned int)(vdisk.mem_used >> 10), vdisk.spilled_blocks
 		);
-		while (v) {
-			struct virtdisk_chunk_st *next = v->next;
-			free(v);
-			v = next;
-		}
 	}
-	vdisk.head = NULL;
-	vdisk.tail = NULL;
+	for (int a = 0; a < vdisk.all_chunks; a++)
+		free(vdisk.chunks[a]);
+	free(vdisk.chunks);
+	vdisk.chunks = NULL;
+	vdisk.chunks_allocated = 0;
+	for (unsigned int a = 0; a < VDISK_ROOT_SIZE; a++) {
+		free(vdisk.index[a]);
+		vdisk.index[a] = NULL;
+	}
+	if (vdisk.spill_file) {
+		fclose(vdisk.spill_file);	// it's a tmpfile(), so it's deleted on close
+		vdisk.spill_file = NULL;
+		vdisk.spill_fd = -1;
+	}
 	vdisk.all_chunks = 0;
 	vdisk.all_blocks = 0;
-	memset(vdisk.range_map, 0, RANGE_MAP_SIZE);
+	vdisk.spilled_blocks = 0;
+	vdisk.all_leaves = 0;
+	vdisk.mem_used = 0;
 }
 
 
-static void virtdisk_init ( int blocks_per_chunk, Uint32 total_number_of_blocks )
+static void virtdisk_init ( int blocks_per_chunk, int mem_limit_mbytes )
 {
 	virtdisk_destroy();
 	vdisk.blocks_per_chunk = blocks_per_chunk;
-	vdisk.base_offset = sizeof(struct virtdisk_chunk_st) + (sizeof(Uint32) * blocks_per_chunk);
-	vdisk.allocation_size = (blocks_per_chunk << 9) + vdisk.base_offset;
-	vdisk.range_map_divisor = (total_number_of_blocks / (RANGE_MAP_SIZE * 8)) + 1;
-	DEBUGPRINT("SDCARD: VDISK: %d blocks (%dKbytes) per chunk, range-divisor is %u" NL, blocks_per_chunk, blocks_per_chunk >> 1, vdisk.range_map_divisor);
-}
-
-
-// Note: you must take care to call this function with "block" not outside of the desired capacity or some logic (range_map) will cause crash.
-// That's not a problem, as this function is intended to use as storage backend, thus boundary checking should be done BEFORE you call this!
-static Uint8 *virtdisk_search_block ( Uint32 block, int do_allocate )
-{
-	struct virtdisk_chunk_st *v;
-	Uint32 range_index = block / vdisk.range_map_divisor;
-	Uint8  range_mask  = 1U << (range_index & 7U);
-	range_index >>= 3U;
-	if (XEMU_LIKELY(vdisk.head && (vdisk.range_map[range_index] & range_mask))) {
-		v = vdisk.head;
-		do {
-			if (block >= v->block_no_min && block <= v->block_no_max)
-				for (unsigned int a = 0; a < v->used_blocks; a++)
-					if (v->list[a] == block)
-						return v->base + (a << 9);
-			v = v->next;
-		} while (v);
+	vdisk.mem_limit = (size_t)mem_limit_mbytes << 20;
+	DEBUGPRINT("SDCARD: VDISK: %d blocks (%dKbytes) per chunk, memory limit: %dMbytes (0 = unlimited)" NL, blocks_per_chunk, blocks_per_chunk >> 1, mem_limit_mbytes);
+}
+
+
+// Returns with the pointer of the index entry of the given block. If the leaf table does not exist, it's allocated if
+// "do_allocate" is true, otherwise NULL is returned. The caller must check "block" being in the capacity of the disk.
+static XEMU_INLINE Uint32 *virtdisk_index_entry ( const Uint32 block, const int do_allocate )
+{
+	Uint32 **leaf = &vdisk.index[block >> VDISK_LEAF_BITS];
+	if (XEMU_UNLIKELY(!*leaf)) {
+		if (!do_allocate)
+			return NULL;
+		*leaf = xemu_malloc(VDISK_LEAF_SIZE * sizeof(Uint32));
+		memset(*leaf, 0, VDISK_LEAF_SIZE * sizeof(Uint32));
+		vdisk.all_leaves++;
+		vdisk.mem_used += VDISK_LEAF_SIZE * sizeof(Uint32);
 	}
-	// if we can't found the block, and do_allocate is false, we return with zero
-	// otherwise we continue to allocate a block
-	if (!do_allocate)
-		return NULL;
-	//DEBUGPRINT("RANGE-INDEX=%d RANGE-MASK=%d" NL, range_index, range_mask);
-	// We're instructed to allocate block if cannot be found already elsewhere
-	// This condition checks if we have room in "tail" or there is any chunk already at all (tail is not NULL)
-	if (vdisk.tail && (vdisk.tail->used_blocks < vdisk.blocks_per_chunk)) {
-		v = vdisk.tail;
-		// OK, we had room in the tail, so put the block there
-		vdisk.all_blocks++;
-		if (block < v->block_no_min)
-			v->block_no_min = block;
-		if (block > v->block_no_max)
-			v->block_no_max = block;
-		vdisk.range_map[range_index] |= range_mask;
-		v->list[v->used_blocks] = block;
-		return v->base + ((v->used_blocks++) << 9);
+	return *leaf + (block & (VDISK_LEAF_SIZE - 1));
+}
+
+
+static XEMU_INLINE Uint8 *virtdisk_slot_pointer ( const Uint32 entry )
+{
+	const Uint32 slot = entry - 1;
+	return vdisk.chunks[slot / vdisk.blocks_per_chunk] + ((slot % vdisk.blocks_per_chunk) << 9);
+}
+
+
+static void virtdisk_spill_io ( const Uint32 entry, Uint8 *buffer, const int is_write )
+{
+	const off_t offset = (off_t)(entry & ~VDISK_SPILLED) << 9;
+	if (lseek(vdisk.spill_fd, offset, SEEK_SET) != offset)
+		FATAL("SDCARD: VDISK: spill file seek failure: %s", strerror(errno));
+	if ((is_write ? xemu_safe_write(vdisk.spill_fd, buffer, 512) : xemu_safe_read(vdisk.spill_fd, buffer, 512)) != 512)
+		FATAL("SDCARD: VDISK: spill file %s failure: %s", is_write ? "write" : "read", strerror(errno));
+}
+
+
+// Allocates storage for a new block, returns with the index entry value of it
+static Uint32 virtdisk_allocate_block ( void )
+{
+	if (vdisk.all_blocks < vdisk.all_chunks * vdisk.blocks_per_chunk)
+		return ++vdisk.all_blocks;	// there is room in the last chunk
+	const size_t chunk_size = (size_t)vdisk.blocks_per_chunk << 9;
+	if (vdisk.mem_limit && vdisk.mem_used + chunk_size > vdisk.mem_limit) {
+		// Over the memory limit, use the spill file instead
+		if (!vdisk.spill_file) {
+			vdisk.spill_file = tmpfile();
+			if (!vdisk.spill_file)
+				FATAL("SDCARD: VDISK: cannot create spill file (memory limit is reached): %s", strerror(errno));
+			vdisk.spill_fd = fileno(vdisk.spill_file);
+			DEBUGPRINT("SDCARD: VDISK: memory limit is reached, using spill file from now" NL);
+		}
+		return VDISK_SPILLED | (Uint32)(vdisk.spilled_blocks++);
 	}
-	// we don't have room in the tail, or not any chunk yet AT ALL!
-	// Let's allocate a new chunk, and use the first block from it!
-	v = xemu_malloc(vdisk.allocation_size);	// xemu_malloc() is safe, it malloc()s space or abort the whole program if it cannot ...
-	v->next = NULL;
-	v->base = (Uint8*)v + vdisk.base_offset;
-	vdisk.all_chunks++;
-	if (vdisk.tail)
-		vdisk.tail->next = v;
-	vdisk.tail = v;
-	if (!vdisk.head)
-		vdisk.head = v;
-	v->list[0] = block;
-	v->used_blocks = 1;
-	v->block_no_min = block;
-	v->block_no_max = block;
-	vdisk.range_map[range_index] |= range_mask;
-	vdisk.all_blocks++;
-	return v->base;	// no need to add block offset in storage, always the first block is served in a new chunk!
+	if (vdisk.all_chunks >= vdisk.chunks_allocated) {
+		vdisk.chunks_allocated = vdisk.chunks_allocated ? vdisk.chunks_allocated * 2 : 64;
+		vdisk.chunks = xemu_realloc(vdisk.chunks, vdisk.chunks_allocated * sizeof(Uint8*));
+	}
+	vdisk.chunks[vdisk.all_chunks++] = xemu_malloc(chunk_size);	// xemu_malloc() is safe, it malloc()s space or abort the whole program if it cannot ...
+	vdisk.mem_used += chunk_size;
+	return ++vdisk.all_blocks;
 }
 
 
 static inline void virtdisk_write_block ( Uint32 block, Uint8 *buffer )
 {
-	// Check if the block is all zero. If yes, we can omit write if the block is not cached
-	Uint8 *vbuf = virtdisk_search_block(block, has_block_nonzero_byte(buffer));
-	if (vbuf)
-		memcpy(vbuf, buffer, 512);
+	// Check if the block is all zero. If yes, we can omit write if the block is not stored
+	const int nonzero = has_block_nonzero_byte(buffer);
+	Uint32 *entry = virtdisk_index_entry(block, nonzero);
+	if (!entry)
+		return;
+	if (!*entry) {
+		if (!nonzero)
+			return;
+		*entry = virtdisk_allocate_block();
+	}
+	if (XEMU_UNLIKELY(*entry & VDISK_SPILLED))
+		virtdisk_spill_io(*entry, buffer, 1);
+	else
+		memcpy(virtdisk_slot_pointer(*entry), buffer, 512);
 	// TODO: Like with the next function, this whole strategy needs to be changed when mixed operation is used!!!!!
 }
 
 
 static inline void virtdisk_read_block ( Uint32 block, Uint8 *buffer )
 {
-	Uint8 *vbuf = virtdisk_search_block(block, 0);
-	if (vbuf)
-		memcpy(buffer, vbuf, 512);
-	else
+	const Uint32 *entry = virtdisk_index_entry(block, 0);
+	if (!entry || !*entry)
 		memset(buffer, 0, 512);	// if not found, we fake an "all zero" answer (TODO: later in mixed operation, image+vdisk, this must be modified!)
+	else if (XEMU_UNLIKELY(*entry & VDISK_SPILLED))
+		virtdisk_spill_io(*entry, buffer, 0);
+	else
+		memcpy(buffer, virtdisk_slot_pointer(*entry), 512);
+}
+#endif
+
+
+#ifdef SD_IMAGE_MMAP_SUPPORT
+static void sdimage_map ( void )
+{
+	if (configdb.sdnommap)
+		return;
+#ifdef RLE_COMPRESSED_DISK_IMAGE_SUPPORT
+	if (sd_compressed)
+		return;
+#endif
+	if (((Uint64)sdcard_size_in_blocks << 9) > (Uint64)SIZE_MAX) {
+		DEBUGPRINT("SDCARD: image is too large to be mapped into the address space, using file I/O" NL);
+		return;
+	}
+	sd_mmap_size = (size_t)sdcard_size_in_blocks << 9;
+	void *p = mmap(NULL, sd_mmap_size, sd_is_read_only ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, sdfd, 0);
+	if (p == MAP_FAILED) {
+		DEBUGPRINT("SDCARD: cannot map image into memory, using file I/O: %s" NL, strerror(errno));
+		return;
+	}
+	sd_mmap = p;
+	sd_mmap_dirty = 0;
+	DEBUGPRINT("SDCARD: image is mapped into memory (%s)" NL, sd_is_read_only ? "R/O" : "R/W");
+}
+
+
+// Writes back the modified pages of the mapped SD-card image (if any) to the storage
+static void sdimage_flush ( const int is_sync )
+{
+	if (!sd_mmap || !sd_mmap_dirty)
+		return;
+	if (msync(sd_mmap, sd_mmap_size, is_sync ? MS_SYNC : MS_ASYNC))
+		DEBUGPRINT("SDCARD: msync() failed on the image: %s" NL, strerror(errno));
+	sd_mmap_dirty = 0;
+}
+
+
+static void sdimage_unmap ( void )
+{
+	if (!sd_mmap)
+		return;
+	sdimage_flush(1);
+	munmap(sd_mmap, sd_mmap_size);
+	sd_mmap = NULL;
+}
+#endif
+
+
+#ifdef SD_ASYNC_IO_SUPPORT
+// Waits for the host I/O of the worker thread, if it's still in progress. It must be used before anything
+// would use the SD-card backend (or the d81access layer) from the emulation thread. It does not affect the
+// emulated latency, the request is still seen as in-progress by the emulated machine.
+static void sd_io_wait_host ( void )
+{
+	if (XEMU_UNLIKELY(sd_io.state == SD_IO_HOST)) {
+		SDL_SemWait(sd_io.done_sem);
+		sd_io.state = SD_IO_LATENCY;
+	}
+}
+
+
+static void sd_io_stop_thread ( void )
+{
+	sd_io_wait_host();
+	if (sd_io.thread) {
+		sd_io.thread_quit = true;
+		SDL_SemPost(sd_io.job_sem);
+		SDL_WaitThread(sd_io.thread, NULL);
+		sd_io.thread = NULL;
+		DEBUGPRINT("SDCARD: I/O thread has been stopped" NL);
+	}
 }
 #endif
 
 
 static void sdcard_shutdown ( void )
 {
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_stop_thread();
+#endif
 	d81access_close_all();
+#ifdef SD_IMAGE_MMAP_SUPPORT
+	sdimage_unmap();
+#endif
+#ifdef RLE_COMPRESSED_DISK_IMAGE_SUPPORT
+	if (sd_compressed)
+		compressed_diskimage_free(&sd_compressed_info);	// also stops the prefetch thread, if there is any
+#endif
 	if (sdfd >= 0) {
 		close(sdfd);
 		sdfd = -1;
@@ -342,7 +481,7 @@ int sdcard_init ( const char *fn, const int virtsd_flag )
 	char fnbuf[PATH_MAX + 1];
 #ifdef VIRTUAL_DISK_IMAGE_SUPPORT
 	if (virtsd_flag) {
-		virtdisk_init(VIRTUAL_DISK_BLOCKS_PER_CHUNK, VIRTUAL_DISK_SIZE_IN_BLOCKS);
+		virtdisk_init(VIRTUAL_DISK_BLOCKS_PER_CHUNK, configdb.virtsdmaxmem);
 		vdisk.mode = 1;
 	} else {
 		vdisk.mode = 0;
@@ -350,7 +489,11 @@ int sdcard_init ( const char *fn, const int virtsd_flag )
 #endif
 	d81access_init();
 	atexit(sdcard_shutdown);
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_init(configdb.sdlatency, configdb.sdasyncio);
+#endif
 	fdc_init(disk_buffers + FD_BUFFER_POS);	// initialize F011 emulation
+	fdc_set_timing_mode(configdb.fdctiming);
 	KEEP_BUSY(0);
 	sd_status = 0;
 	memset(sd_fill_buffer, sd_fill_value, 512);
@@ -423,6 +566,11 @@ retry:
 		} else if (sd_compressed > 0) {
 			sd_is_read_only = 1;	// compressed disk image is always read-only!
 			sdcard_size_in_blocks = sd_compressed_info.size_in_blocks;
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+			compressed_diskimage_setup_cache(&sd_compressed_info, configdb.sdrlecache, configdb.sdrleprefetch);
+#else
+			compressed_diskimage_setup_cache(&sd_compressed_info, configdb.sdrlecache, false);
+#endif
 			size_in_bytes = (off_t)sdcard_size_in_blocks << 9;
 		} else {
 			DEBUGPRINT("SDCARD: image is not compressed" NL);
@@ -449,6 +597,9 @@ retry:
 		}
 	}
 	if (sdfd >= 0) {
+#ifdef SD_IMAGE_MMAP_SUPPORT
+		sdimage_map();
+#endif
 		card_init_done();
 		//sdcontent_handle(sdcard_size_in_blocks, NULL, SDCONTENT_ASK_FDISK | SDCONTENT_ASK_FILES);
 		if (just_created_image_file) {
@@ -529,7 +680,7 @@ static XEMU_INLINE Uint8 *get_buffer_memory ( const int is_write )
 }
 
 
-int sdcard_read_block ( const Uint32 block, Uint8 *buffer )
+static int host_read_block ( const Uint32 block, Uint8 *buffer )
 {
 	if (block >= sdcard_size_in_blocks) {
 		DEBUGPRINT("SDCARD: SEEK: invalid block was requested to READ: block=%u (max_block=%u) @ PC=$%04X" NL, block, sdcard_size_in_blocks, cpu65.pc);
@@ -551,6 +702,12 @@ int sdcard_read_block ( const Uint32 block, Uint8 *buffer )
 		virtdisk_read_block(block, buffer);
 		return 0;
 	}
+#endif
+#ifdef SD_IMAGE_MMAP_SUPPORT
+	if (XEMU_LIKELY(sd_mmap)) {
+		memcpy(buffer, sd_mmap + ((size_t)block << 9), 512);
+		return 0;
+	}
 #endif
 	if (host_seek(block))
 		return -1;
@@ -561,7 +718,7 @@ int sdcard_read_block ( const Uint32 block, Uint8 *buffer )
 }
 
 
-int sdcard_write_block ( const Uint32 block, Uint8 *buffer )
+static int host_write_block ( const Uint32 block, Uint8 *buffer )
 {
 	if (block >= sdcard_size_in_blocks) {
 		DEBUGPRINT("SDCARD: SEEK: invalid block was requested to WRITE: block=%u (max_block=%u) @ PC=$%04X" NL, block, sdcard_size_in_blocks, cpu65.pc);
@@ -579,11 +736,22 @@ int sdcard_write_block ( const Uint32 block, Uint8 *buffer )
 	if (XEMU_UNLIKELY(sd_compressed))	// This shouldn't ever happen, since then sd_is_read_only must be true, and the condition above handles that
 		FATAL("Hitting %s() with compressed image. Should never happen!", __func__);
 #endif
+	// Writing the area of an on-SD mounted disk image behind d81access: its sector cache must be dropped
+	for (int unit = 0; unit < 2; unit++)
+		if (XEMU_UNLIKELY(mount_info[unit].type == MOUNT_TYPE_INTERNAL && block >= mount_info[unit].sector && block < mount_info[unit].sector + acm_sectors[mount_info[unit].acm]))
+			d81access_cache_invalidate(unit);
 #ifdef VIRTUAL_DISK_IMAGE_SUPPORT
 	if (vdisk.mode) {
 		virtdisk_write_block(block, buffer);
 		return 0;
 	}
+#endif
+#ifdef SD_IMAGE_MMAP_SUPPORT
+	if (XEMU_LIKELY(sd_mmap)) {
+		memcpy(sd_mmap + ((size_t)block << 9), buffer, 512);
+		sd_mmap_dirty = 1;
+		return 0;
+	}
 #endif
 	if (host_seek(block))
 		return -1;
@@ -594,9 +762,194 @@ int sdcard_write_block ( const Uint32 block, Uint8 *buffer )
 }
 
 
+int sdcard_read_block ( const Uint32 block, Uint8 *buffer )
+{
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
+	return host_read_block(block, buffer);
+}
+
+
+int sdcard_write_block ( const Uint32 block, Uint8 *buffer )
+{
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
+	return host_write_block(block, buffer);
+}
+
+
+// Multi-block variants of sdcard_read_block() and sdcard_write_block(), mainly for the SD-card content updater (through fat32.c)
+// They're done as a single host I/O operation if possible, otherwise block by block with the functions above.
+static int host_blocks_can_be_bulk ( const Uint32 block, const Uint32 count )
+{
+	const Uint32 last = block + count - 1;
+	if (!count || block >= sdcard_size_in_blocks || count > sdcard_size_in_blocks - block)
+		return 0;
+	if (block <= sd_external_mount_area_end && last >= sd_external_mount_area_start)
+		return 0;
+#ifdef RLE_COMPRESSED_DISK_IMAGE_SUPPORT
+	if (sd_compressed)
+		return 0;
+#endif
+#ifdef VIRTUAL_DISK_IMAGE_SUPPORT
+	if (vdisk.mode)
+		return 0;
+#endif
+	return 1;
+}
+
+
+int sdcard_read_blocks ( Uint32 block, Uint8 *buffer, Uint32 count )
+{
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
+	if (host_blocks_can_be_bulk(block, count)) {
+#ifdef SD_IMAGE_MMAP_SUPPORT
+		if (XEMU_LIKELY(sd_mmap)) {
+			memcpy(buffer, sd_mmap + ((size_t)block << 9), (size_t)count << 9);
+			return 0;
+		}
+#endif
+		if (host_seek(block))
+			return -1;
+		return xemu_safe_read(sdfd, buffer, (size_t)count << 9) == (ssize_t)count << 9 ? 0 : -1;
+	}
+	for (; count; count--, block++, buffer += 512)
+		if (host_read_block(block, buffer))
+			return -1;
+	return 0;
+}
+
+
+int sdcard_write_blocks ( Uint32 block, Uint8 *buffer, Uint32 count )
+{
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
+	if (!sd_is_read_only && host_blocks_can_be_bulk(block, count)) {
+		for (int unit = 0; unit < 2; unit++)
+			if (XEMU_UNLIKELY(mount_info[unit].type == MOUNT_TYPE_INTERNAL && block < mount_info[unit].sector + acm_sectors[mount_info[unit].acm] && block + count > mount_info[unit].sector))
+				d81access_cache_invalidate(unit);
+#ifdef SD_IMAGE_MMAP_SUPPORT
+		if (XEMU_LIKELY(sd_mmap)) {
+			memcpy(sd_mmap + ((size_t)block << 9), buffer, (size_t)count << 9);
+			sd_mmap_dirty = 1;
+			return 0;
+		}
+#endif
+		if (host_seek(block))
+			return -1;
+		return xemu_safe_write(sdfd, buffer, (size_t)count << 9) == (ssize_t)count << 9 ? 0 : -1;
+	}
+	for (; count; count--, block++, buffer += 512)
+		if (host_write_block(block, buffer))
+			return -1;
+	return 0;
+}
+
+
+static void block_io_result ( const int ret )
+{
+	if (ret || !sdhc_mode) {
+		sd_status |= SD_ST_ERROR | SD_ST_FSM_ERROR; // | SD_ST_BUSY1 | SD_ST_BUSY0;
+			sd_status |= SD_ST_BUSY1 | SD_ST_BUSY0;
+			//KEEP_BUSY(1);
+		return;
+	}
+	sd_status &= ~(SD_ST_ERROR | SD_ST_FSM_ERROR);
+}
+
+
+#ifdef SD_ASYNC_IO_SUPPORT
+static int sd_io_thread ( void *unused )
+{
+	for (;;) {
+		SDL_SemWait(sd_io.job_sem);
+		if (XEMU_UNLIKELY(sd_io.thread_quit))
+			return 0;
+		sd_io.ret = sd_io.is_write ? host_write_block(sd_io.block, sd_io.buffer) : host_read_block(sd_io.block, sd_io.buffer);
+		SDL_SemPost(sd_io.done_sem);
+	}
+}
+
+
+static void sd_io_init ( const int latency_usec, const int use_thread )
+{
+	sd_io.state = SD_IO_IDLE;
+	sd_io.latency_usec = latency_usec;
+	if (!use_thread)
+		return;
+	sd_io.job_sem  = SDL_CreateSemaphore(0);
+	sd_io.done_sem = SDL_CreateSemaphore(0);
+	if (sd_io.job_sem && sd_io.done_sem)
+		sd_io.thread = SDL_CreateThread(sd_io_thread, "Xemu-SD-IO", NULL);
+	if (sd_io.thread)
+		DEBUGPRINT("SDCARD: block I/O on a separate thread, emulated latency is %d usecs" NL, latency_usec);
+	else
+		ERROR_WINDOW("Cannot create SD-card I/O thread, falling back to I/O on the main thread:\n%s", SDL_GetError());
+}
+
+
+static void sd_io_submit ( const Uint32 block, const int is_write, const Uint8 *buffer )
+{
+	sd_io.block = block;
+	sd_io.is_write = is_write;
+	if (is_write)
+		memcpy(sd_io.buffer, buffer, 512);
+	// 1MHz cycles are microseconds, so it's simple to tell the emulated latency in scanlines
+	sd_io.latency_ticks = (int)ceilf((float)sd_io.latency_usec / videostd_1mhz_cycles_per_scanline);
+	sd_status |= SD_ST_BUSY1 | SD_ST_BUSY0;
+	KEEP_BUSY(1);
+	sd_io_pending = 1;
+	if (sd_io.thread) {
+		sd_io.state = SD_IO_HOST;
+		SDL_SemPost(sd_io.job_sem);
+	} else {
+		sd_io.ret = is_write ? host_write_block(block, sd_io.buffer) : host_read_block(block, sd_io.buffer);
+		sd_io.state = SD_IO_LATENCY;
+	}
+}
+
+
+// Finishes the request as seen by the emulated machine: the read data goes into the SD-buffer and the status is updated
+static void sd_io_complete ( void )
+{
+	sd_io_wait_host();
+	sd_io.state = SD_IO_IDLE;
+	sd_io_pending = 0;
+	sd_status &= ~(SD_ST_BUSY1 | SD_ST_BUSY0);
+	KEEP_BUSY(0);
+	if (!sd_io.is_write && !sd_io.ret)
+		memcpy(get_buffer_memory(0), sd_io.buffer, 512);
+	block_io_result(sd_io.ret);
+}
+
+
+// Called by the main emulation loop in each scanline while sd_io_pending is set. It never blocks:
+// if the host I/O is still not ready when the emulated latency is over, the request just stays BUSY.
+void sdcard_io_scanline_tick ( void )
+{
+	if (sd_io.latency_ticks > 0) {
+		sd_io.latency_ticks--;
+		return;
+	}
+	if (sd_io.state == SD_IO_HOST) {
+		if (SDL_SemTryWait(sd_io.done_sem))
+			return;
+		sd_io.state = SD_IO_LATENCY;
+	}
+	sd_io_complete();
+}
+#endif
+
+
 /* Lots of TODO's here:
  * + study M65's quite complex error handling behaviour to really match ...
  * + In general: SD emulation is "too fast" done in zero emulated CPU time, which can affect the emulation badly if an I/O-rich task is running on Xemu/M65
+ *   (with SD_ASYNC_IO_SUPPORT, -sdlatency can be used to have some emulated latency though)
  * */
 static void sdcard_block_io ( const Uint32 block, const int is_write )
 {
@@ -611,16 +964,19 @@ static void sdcard_block_io ( const Uint32 block, const int is_write )
 	if (XEMU_UNLIKELY(is_write &&  block == 0                                        && sdfd >= 0 && protect_important_blocks)) {
 #endif
 		if (protect_important_blocks == 2) {
-			goto error;
+			block_io_result(-1);
+			return;
 		} else {
 			char msg[128];
 			sprintf(msg, "Program tries to overwrite SD sector #%d!\nUnless you fdisk/format your card, it's not something you want.", block);
 			switch (QUESTION_WINDOW("Reject this|Reject all|Allow this|Allow all", msg)) {
 				case 0:
-					goto error;
+					block_io_result(-1);
+					return;
 				case 1:
 					protect_important_blocks = 2;
-					goto error;
+					block_io_result(-1);
+					return;
 				case 2:
 					break;
 				case 3:
@@ -637,15 +993,13 @@ static void sdcard_block_io ( const Uint32 block, const int is_write )
 		return;
 	}
 	Uint8 *buffer = get_buffer_memory(is_write);
-	int ret = is_write ? sdcard_write_block(block, buffer) : sdcard_read_block(block, buffer);
-	if (ret || !sdhc_mode) {
-	error:
-		sd_status |= SD_ST_ERROR | SD_ST_FSM_ERROR; // | SD_ST_BUSY1 | SD_ST_BUSY0;
-			sd_status |= SD_ST_BUSY1 | SD_ST_BUSY0;
-			//KEEP_BUSY(1);
+#ifdef SD_ASYNC_IO_SUPPORT
+	if (sd_io.latency_usec || sd_io.thread) {
+		sd_io_submit(block, is_write, buffer);
 		return;
 	}
-	sd_status &= ~(SD_ST_ERROR | SD_ST_FSM_ERROR);
+#endif
+	block_io_result(is_write ? host_write_block(block, buffer) : host_read_block(block, buffer));
 }
 
 
@@ -755,6 +1109,9 @@ static void sdcard_command ( const Uint8 cmd )
 // Here we implement F011 core's callbacks using d81access (and yes, F011 uses 512 bytes long sectors for real)
 int fdc_cb_rd_sec ( const int which, Uint8 *buffer, const Uint8 side, const Uint8 track, const Uint8 sector )
 {
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();	// the worker thread may use the same d81access layer or file descriptor
+#endif
 	const int ret = d81access_read_sect(which, buffer, side, track, sector, 512);
 	DEBUG("SDCARD: FDC: reading sector at (side,track,sector)=(%u,%u,%u), return value=%d" NL, side, track, sector, ret);
 	return ret;
@@ -763,6 +1120,9 @@ int fdc_cb_rd_sec ( const int which, Uint8 *buffer, const Uint8 side, const Uint
 
 int fdc_cb_wr_sec ( const int which, Uint8 *buffer, const Uint8 side, const Uint8 track, const Uint8 sector )
 {
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
 	const int ret = d81access_write_sect(which, buffer, side, track, sector , 512);
 	DEBUG("SDCARD: FDC: writing sector at (side,track,sector)=(%u,%u,%u), return value=%d" NL, side, track, sector, ret);
 	return ret;
@@ -875,6 +1235,9 @@ static int do_external_mount ( const int unit, const char *fn, int read_only )
 {
 	const int old_type = mount_info[unit].type;
 	DEBUGPRINT("SDCARD: MOUNT: external mount #%d from file %s (%s)" NL, unit, fn, read_only ? "R/O" : "R/W");
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
 	if (old_type == MOUNT_TYPE_EXTERNAL && !strcmp(fn, mount_info[unit].desc) && !!mount_info[unit].read_only == !!read_only) {
 		DEBUGPRINT("SDCARD: MOUNT: (external mount) already mounted, no change" NL);
 		return 0;	// no change, report success though
@@ -931,6 +1294,9 @@ static int do_internal_mount ( const int unit, const Uint32 sector, const int ac
 		goto invalid_internal;
 	}
 	read_only = (sd_is_read_only || read_only) ? D81ACCESS_RO : 0;
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
 	char desc[16];
 	snprintf(desc, sizeof desc, "<%s@%u>", acm_names[acm], sector);
 	xemu_restrdup(&mount_info[unit].desc, desc);
@@ -947,7 +1313,10 @@ invalid_internal:
 
 
 static int is_hyppo_reset = -1;
+static int is_first_hyppo_reset = 1;
 #define MOUNT_REG_BACKUP_LEN (0x13 - 0x0A + 1)
+static Uint8 mount_reg_backup[MOUNT_REG_BACKUP_LEN];
+static int has_mount_reg_backup = 0;
 
 
 static void clear_mount_registers ( void )
@@ -958,18 +1327,16 @@ static void clear_mount_registers ( void )
 
 static void backup_or_restore_mount_registers ( const int is_backup )
 {
-	static Uint8 backup[MOUNT_REG_BACKUP_LEN];
-	static int has_backup = 0;
 	if (is_backup) {
-		if (!has_backup) {
-			memcpy(backup, sd_regs + 0x0A, sizeof backup);
-			has_backup = 1;
+		if (!has_mount_reg_backup) {
+			memcpy(mount_reg_backup, sd_regs + 0x0A, sizeof mount_reg_backup);
+			has_mount_reg_backup = 1;
 		}
 	} else {
-		if (!has_backup)
+		if (!has_mount_reg_backup)
 			FATAL("%s(): restore without prior backup!", __func__);
-		memcpy(sd_regs + 0x0A, backup, sizeof backup);
-		has_backup = 0;
+		memcpy(sd_regs + 0x0A, mount_reg_backup, sizeof mount_reg_backup);
+		has_mount_reg_backup = 0;
 	}
 }
 
@@ -1012,9 +1379,8 @@ void sdcard_notify_hyppo_leave ( void )
 			}
 		}
 		backup_or_restore_mount_registers(0);
-		static int is_first_reset = 1;
-		if (is_first_reset) {
-			is_first_reset = 0;
+		if (is_first_hyppo_reset) {
+			is_first_hyppo_reset = 0;
 			clear_mount_registers();
 		        if (configdb.disk8) {
 				if (sdcard_external_mount(0, configdb.disk8, "Mount failure on CLI/CFG requested drive-8"))
@@ -1145,17 +1511,28 @@ void sdcard_unmount ( const int unit )
 {
 	if (mount_info[unit].type == MOUNT_TYPE_EMPTY)
 		return;
+#ifdef SD_ASYNC_IO_SUPPORT
+	sd_io_wait_host();
+#endif
 	DEBUGPRINT("SDCARD: MOUNT: unmounting #%d" NL, unit);
 	mount_info[unit].type = MOUNT_TYPE_EMPTY;
 	free(mount_info[unit].desc);
 	mount_info[unit].desc = NULL;
 	d81access_close(unit);
+#ifdef SD_IMAGE_MMAP_SUPPORT
+	sdimage_flush(0);
+#endif
 }
 
 
 void sdcard_write_register ( const int reg, const Uint8 data )
 {
 	const Uint8 prev_data = sd_regs[reg];
+#ifdef SD_ASYNC_IO_SUPPORT
+	// Writing registers other than the sector number ones finishes the pending request (if any) immediately
+	if (XEMU_UNLIKELY(sd_io_pending) && (reg < 0x01 || reg > 0x04))
+		sd_io_complete();
+#endif
 	if (!in_hypervisor && reg >= 0x0A && reg <= 0x13) {
 		// TODO/FIXME: this is probably wrong if MEGA65 allows FDC-mount operations outside of hypervisor as well
 		// However this is much safer/more simple this way as we can use the fact of hypervisor leave gate to "evaluate" the resulf of
@@ -1270,3 +1647,146 @@ Uint8 sdcard_read_register ( const int reg )
 	}
 	return data;
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+// The content of the SD-card image itself is NOT part of the snapshot (it's assumed that the same
+// image is used on load), only the controller state and the mounts are. External mounts are stored
+// by their host-side file name and re-mounted on load.
+
+#define SNAPSHOT_SDCARD_BLOCK_VERSION	0
+#define SNAPSHOT_SDCARD_BLOCK_SIZE	0x100
+
+
+static int sdcard_snapshot_load_registers ( void )
+{
+	Uint8 buffer[SNAPSHOT_SDCARD_BLOCK_SIZE];
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	memcpy(sd_regs, buffer, sizeof sd_regs);
+	sd_status		= buffer[0x30];
+	sd_fill_mode		= buffer[0x31];
+	sd_fill_value		= buffer[0x32];
+#ifdef USE_KEEP_BUSY
+	keep_busy		= buffer[0x33];
+#endif
+	is_hyppo_reset		= (int)(Sint8)buffer[0x34];
+	is_first_hyppo_reset	= buffer[0x35];
+	has_mount_reg_backup	= buffer[0x36];
+	memcpy(mount_reg_backup, buffer + 0x38, sizeof mount_reg_backup);
+	memset(sd_fill_buffer, sd_fill_value, 512);
+	set_disk_buffer_cpu_view();
+	for (int unit = 0; unit < 2; unit++) {
+		const Uint8 *p = buffer + 0x80 + unit * 0x20;
+		mount_info[unit].type		= p[0];
+		mount_info[unit].acm		= p[1] & 3;
+		mount_info[unit].read_only	= p[2];
+		mount_info[unit].acm_initial	= p[3] & 3;
+		mount_info[unit].sector		= P_AS_BE32(p + 4);
+		mount_info[unit].sector_initial	= P_AS_BE32(p + 8);
+		mount_info[unit].sector_fake	= P_AS_BE32(p + 12);
+	}
+	return 0;
+}
+
+
+// Mount what the snapshot says. External mounts are done when the file names are read, see below.
+static void sdcard_snapshot_remount ( const int unit, const char *fn )
+{
+	const int type = mount_info[unit].type;
+	const int ro = mount_info[unit].read_only;
+	mount_info[unit].type = MOUNT_TYPE_EMPTY;	// to avoid the "no change" optimization of the mount functions
+	d81access_close(unit);
+	if (type == MOUNT_TYPE_EXTERNAL) {
+		if (!*fn || do_external_mount(unit, fn, ro)) {
+			DEBUGPRINT("SDCARD: SNAPSHOT: could not re-mount external image \"%s\" on unit #%d" NL, fn, unit);
+			sdcard_unmount(unit);
+		}
+	} else if (type == MOUNT_TYPE_INTERNAL) {
+		if (do_internal_mount(unit, mount_info[unit].sector, mount_info[unit].acm, ro))
+			sdcard_unmount(unit);
+	} else {
+		free(mount_info[unit].desc);
+		mount_info[unit].desc = NULL;
+	}
+}
+
+
+int sdcard_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	if (block->block_version != SNAPSHOT_SDCARD_BLOCK_VERSION)
+		RETURN_XSNAPERR_USER("Bad SD-card block version");
+#ifdef SD_ASYNC_IO_SUPPORT
+	if (sd_io_pending)
+		sd_io_complete();	// the status and the SD-buffer will be overwritten by the snapshot anyway
+#endif
+	if (block->sub_counter == 0 && block->sub_size == SNAPSHOT_SDCARD_BLOCK_SIZE)
+		return sdcard_snapshot_load_registers();
+	if (block->sub_counter == 1 && block->sub_size == sizeof disk_buffers)
+		return xemusnap_read_file(disk_buffers, sizeof disk_buffers);
+	if ((block->sub_counter == 2 || block->sub_counter == 3) && block->sub_size > 0 && block->sub_size <= PATH_MAX) {
+		char fn[PATH_MAX + 1];
+		const int ret = xemusnap_read_file(fn, block->sub_size);
+		if (ret)
+			return ret;
+		fn[block->sub_size] = '\0';
+		sdcard_snapshot_remount(block->sub_counter - 2, fn);
+		return 0;
+	}
+	RETURN_XSNAPERR_USER("Bad SD-card block syntax");
+}
+
+
+int sdcard_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_SDCARD_BLOCK_SIZE];
+#ifdef SD_ASYNC_IO_SUPPORT
+	if (sd_io_pending)
+		sd_io_complete();	// the snapshot does not store in-progress requests, finish it now
+#endif
+	int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_SDCARD_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	memset(buffer, 0xFF, sizeof buffer);
+	memcpy(buffer, sd_regs, sizeof sd_regs);
+	buffer[0x30] = sd_status;
+	buffer[0x31] = sd_fill_mode;
+	buffer[0x32] = sd_fill_value;
+#ifdef USE_KEEP_BUSY
+	buffer[0x33] = keep_busy;
+#endif
+	buffer[0x34] = (Uint8)is_hyppo_reset;
+	buffer[0x35] = is_first_hyppo_reset;
+	buffer[0x36] = has_mount_reg_backup;
+	memcpy(buffer + 0x38, mount_reg_backup, sizeof mount_reg_backup);
+	for (int unit = 0; unit < 2; unit++) {
+		Uint8 *p = buffer + 0x80 + unit * 0x20;
+		p[0] = mount_info[unit].type;
+		p[1] = mount_info[unit].acm;
+		p[2] = mount_info[unit].read_only;
+		p[3] = mount_info[unit].acm_initial;
+		U32_AS_BE(p +  4, mount_info[unit].sector);
+		U32_AS_BE(p +  8, mount_info[unit].sector_initial);
+		U32_AS_BE(p + 12, mount_info[unit].sector_fake);
+	}
+	ret = xemusnap_write_sub_block(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	ret = xemusnap_write_sub_block(disk_buffers, sizeof disk_buffers);
+	if (ret)
+		return ret;
+	// Sub-block size zero would mean end of block, thus the terminating NUL byte is always stored
+	for (int unit = 0; unit < 2; unit++) {
+		const char *fn = (mount_info[unit].type == MOUNT_TYPE_EXTERNAL && mount_info[unit].desc) ? mount_info[unit].desc : "";
+		ret = xemusnap_write_sub_block((const Uint8*)fn, strlen(fn) + 1);
+		if (ret)
+			return ret;
+	}
+	return 0;
+}
+
+#endif
@@ -37,6 +37,8 @@ extern void   sdcard_set_external_mount_pool ( Uint32 sector );
 
 extern int    sdcard_read_block     ( const Uint32 block, Uint8 *buffer );
 extern int    sdcard_write_block    ( const Uint32 block, Uint8 *buffer );
+extern int    sdcard_read_blocks    ( Uint32 block, Uint8 *buffer, Uint32 count );
+extern int    sdcard_write_blocks   ( Uint32 block, Uint8 *buffer, Uint32 count );
 
 extern int    sdcard_external_mount ( const int unit, const char *filename, const char *cry );
 extern int    sdcard_external_mount_with_image_creation ( const int unit, const char *filename, const int do_overwrite, const char *cry );
@@ -49,6 +51,17 @@ extern const char *sdcard_get_external_mount_name ( const int unit );
 extern void   sdcard_notify_hyppo_enter ( const int _is_hyppo_reset );
 extern void   sdcard_notify_hyppo_leave ( void );
 
+#ifdef SD_ASYNC_IO_SUPPORT
+extern int    sd_io_pending;
+extern void   sdcard_io_scanline_tick ( void );
+#endif
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+#include "xemu/emutools_snapshot.h"
+extern int    sdcard_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block );
+extern int    sdcard_snapshot_save_state ( const struct xemu_snapshot_definition_st *def );
+#endif
+
 // disk buffer for SD (can be mapped to I/O space too), F011, and some "3.5K scratch space"
 extern Uint8  disk_buffers[0x1000];
 extern Uint8  *disk_buffer_cpu_view;
@@ -396,7 +396,7 @@ static int update_sdcard_file ( const char *on_card_name, int options, const cha
 	Uint32 block = mfat_overwrite_file_with_direct_linear_device_block_write(&sd_rootdirent, on_card_name, size_to_install);
 	if (block == 0)
 		goto error_on_maybe_sys_file;
-	// Copy file block by block
+	// Copy file in chunks of multiple blocks
 	if ((options & SDCONTENT_HDOS_DIR_TOO)) {
 		free(hdos_name);
 		hdos_name = hypervisor_hdos_get_sysfile_path(on_card_name);
@@ -408,10 +408,11 @@ static int update_sdcard_file ( const char *on_card_name, int options, const cha
 		}
 	}
 	while (size_to_install) {
-		Uint8 buffer[512];
-		int need = (size_to_install < sizeof buffer) ? size_to_install : sizeof buffer;
-		if (need < sizeof(buffer))
-			memset(buffer + need, 0, sizeof(buffer) - need);
+		static Uint8 buffer[0x8000];
+		const int need = (size_to_install < sizeof buffer) ? size_to_install : sizeof buffer;
+		const int blocks = (need + 511) >> 9;
+		if (need < (blocks << 9))
+			memset(buffer + need, 0, (blocks << 9) - need);
 		if (fd >= 0) {
 			// Read from external file
 			int got = xemu_safe_read(fd, buffer, need);
@@ -427,7 +428,8 @@ static int update_sdcard_file ( const char *on_card_name, int options, const cha
 			fn_or_data += need;
 		}
 		// And now WRITE!!!!!
-		sdcard_write_block(block++, buffer);	// FIXME: error handling!!!
+		sdcard_write_blocks(block, buffer, blocks);	// FIXME: error handling!!!
+		block += blocks;
 		// Also write to the hdos/... entry, if fdw is already open!
 		if (fdw >= 0) {
 			if (write(fdw, buffer, need) != need) {
@@ -617,6 +619,7 @@ int sdcontent_handle ( Uint32 size_in_blocks, const char *update_dir_path, int o
 	if (!init_done) {
 		//snprintf(system_files_directory, sizeof system_files_directory, "%s%s", sdl_pref_dir, "system-files");
 		mfat_init(sdcard_read_block, sdcard_write_block, size_in_blocks);
+		mfat_set_multi_block_io(sdcard_read_blocks, sdcard_write_blocks);
 		init_done = 1;
 	}
 	//system_files_directory_check(system_files_directory, (options & SDCONTENT_UPDATE_SYSDIR));
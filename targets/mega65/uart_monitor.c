@@ -26,6 +26,9 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #include "xemu/cpu65.h"
 #include "memory_mapper.h"
 #include "sdcard.h"
+#include "profiler.h"
+#include "guestprof.h"
+#include "m65_snapshot.h"
 #include "xemu/emutools_socketapi.h"
 #include <string.h>
 
@@ -398,6 +401,64 @@ static void execute_command ( char *cmd )
 						OSD(-1, -1, "Unmounted (%d)", unit);
 					}
 				}
+			} else if (!strncmp(cmd, "gprof", 5)) {
+				// Guest code profiler:
+				//	~gprof			- show the top of the flat profile (by PC and by function)
+				//	~gprofon		- enable the profiler (and reset the collected data)
+				//	~gprofoff		- disable the profiler (collected data is kept to be reported)
+				//	~gprofreset		- reset the collected data
+				//	~gprofdumpfile.txt	- write the full profile (with call graph) into "file.txt"
+				cmd += 5;
+				if (!strcmp(cmd, "on")) {
+					guestprof_enable(true);
+				} else if (!strcmp(cmd, "off")) {
+					guestprof_enable(false);
+				} else if (!strcmp(cmd, "reset")) {
+					guestprof_reset();
+				} else if (!strncmp(cmd, "dump", 4) && cmd[4]) {
+					if (guestprof_dump(cmd + 4))
+						umon_printf(UMON_SYNTAX_ERROR "cannot write file: %s", cmd + 4);
+				} else if (!*cmd) {
+					char report[4096];
+					guestprof_get_report(report, sizeof report, 20);
+					umon_printf("%s", report);
+				} else
+					umon_printf(UMON_SYNTAX_ERROR "unknown guest profiler command: %s", cmd);
+			} else if (!strncmp(cmd, "profile", 7)) {
+				// Also quite crude syntax:
+				//	~profile		- show the profiler report (average of the last window of frames)
+				//	~profileon		- enable the profiler
+				//	~profileoff		- disable the profiler (and stop CSV writing, if any)
+				//	~profilecsvfile.csv	- enable the profiler, writing per-frame statistics into "file.csv"
+				cmd += 7;
+				if (!strcmp(cmd, "on")) {
+					profiler_enable(true);
+				} else if (!strcmp(cmd, "off")) {
+					profiler_csv_close();
+					profiler_enable(false);
+				} else if (!strncmp(cmd, "csv", 3) && cmd[3]) {
+					if (profiler_csv_open(cmd + 3))
+						umon_printf(UMON_SYNTAX_ERROR "cannot open CSV file: %s", cmd + 3);
+				} else if (!*cmd) {
+					char report[1024];
+					profiler_get_report(report, sizeof report);
+					umon_printf("%s", report);
+				} else
+					umon_printf(UMON_SYNTAX_ERROR "unknown profiler command: %s", cmd);
+#ifdef XEMU_SNAPSHOT_SUPPORT
+			} else if (!strncmp(cmd, "snapsave", 8) && cmd[8]) {
+				//	~snapsavefile.snap	- save the machine state into "file.snap" (delta snapshot, if -snapdelta is used)
+				if (m65_snapshot_save(cmd + 8))
+					umon_printf(UMON_SYNTAX_ERROR "%s", xemusnap_error_buffer);
+				else
+					umon_printf("Snapshot has been saved to \"%s\"", cmd + 8);
+			} else if (!strncmp(cmd, "snapload", 8) && cmd[8]) {
+				//	~snaploadfile.snap	- load the machine state from "file.snap"
+				if (m65_snapshot_load(cmd + 8))
+					umon_printf(UMON_SYNTAX_ERROR "%s", xemusnap_error_buffer);
+				else
+					umon_printf("Snapshot has been loaded from \"%s\"", cmd + 8);
+#endif
 			} else if (!strncmp(cmd, "mapping", 7)) {
 				char desc[10];
 				for (unsigned int i = 0; i < 16; i++) {
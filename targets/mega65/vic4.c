@@ -91,6 +91,10 @@ static Uint8 sprite_is_being_rendered[8];
 static Uint8 bug_compat_vic_iii_d016_delta = 2;
 static bool  bug_compat_char_attr = true;
 static bool  chary16 = false;
+static void  vic4_render_sync ( void );
+#ifdef VIC4_RENDER_THREAD_SUPPORT
+static void  vic4_start_render_thread ( void );
+#endif
 
 // --- these things are altered by vic4_open_frame_access() ONLY at every fame ONLY based on PAL or NTSC selection
 Uint8 videostd_id = 0xFF;			// 0=PAL, 1=NTSC [give some insane value by default to force the change at the fist frame after starting Xemu]
@@ -170,6 +174,7 @@ static inline void vic4_reset_display_counters ( void )
 
 void vic_reset ( void )
 {
+	vic4_render_sync();	// the renderer must be idle before resetting (also its) state
 	vic_frame_counter = 0;
 	vic_frame_counter_since_boot = 0;
 	memory_set_io_mode(VIC2_IOMODE);
@@ -218,6 +223,10 @@ void vic_init ( void )
 	c128_d030_reg = 0;	// make sure to set it to zero, FIXME: should we move this into vic_reset() which is also called from vic_init() but then would function only calling reset as well?!
 	machine_set_speed(0);
 	vic4_reset_display_counters();
+#ifdef	VIC4_RENDER_THREAD_SUPPORT
+	if (configdb.victhread)
+		vic4_start_render_thread();
+#endif
 	DEBUG("VIC4: has been initialized." NL);
 }
 
@@ -227,6 +236,7 @@ void vic_init ( void )
 void vic4_close_frame_access ( void )
 {
 	DEBUG("FRAME CLOSED" NL);
+	vic4_render_sync();	// make sure the frame is complete, in case of the render thread
 #ifdef	SPRITE_COORD_LATCHING
 	// To avoid the problem when sprite rendering is not finished (at the very bottom of the screen, does not "fit"),
 	// thus the "end" condition in active rendering is never reached: that would be remain latched for the next frame then!
@@ -448,6 +458,7 @@ static void vic4_interpret_legacy_mode_registers ( void )
 // Do NOT call this function from vic4.c! It must be used by the emulator's main loop!
 void vic4_open_frame_access ( void )
 {
+	vic4_render_sync();
 	int tail_sdl;
 	current_pixel = pixel_start = xemu_start_pixel_buffer_access(&tail_sdl);
 	if (XEMU_UNLIKELY(tail_sdl))
@@ -1047,6 +1058,45 @@ Uint8 vic_read_reg ( int unsigned addr )
 #undef CASE_VIC_3_4
 
 
+/* --- SCANLINE RENDERER ---
+   The renderer does not use the "live" VIC state but a per-scanline snapshot of it (registers and the derived
+   values it needs) taken by vic4_render_scanline() right before rendering a scanline. This allows to render
+   on a separate thread (-victhread option), while the CPU emulation already executes the next scanline which
+   may alter the live state. Pixels, counters (xcounter, char_row, display_row ...), is_fg[] etc are owned by
+   the renderer, the CPU side touches those only if the renderer is idle (see vic4_render_sync()).
+   Note: the memory itself (screen, colour, char RAM, palette) is not part of the snapshot. Thus with the
+   render thread, such a change within the next scanline may be already visible in the current one.
+   The macros below redirect the names used by the renderer (including the REG_* macros) to the snapshot. */
+static struct {
+	Uint8	regs[0x80];
+	int	ycounter;
+	int	border_x_left, border_x_right;
+	float	char_x_step;
+	int	effective_v400;
+	Uint8	color_register_mask;
+	Uint8	*bitplane_bank_p;
+	Uint32	*palette, *altpalette, *spritepalette;
+	int	blink_phase;
+	int	sprite_y_adjust_xemu_bug;
+	bool	show_scanlines;
+	bool	sprites_rendered;	// result: sprites were rendered, so collision status should be updated
+} render_snap;
+
+#define vic_registers			render_snap.regs
+#define ycounter			render_snap.ycounter
+#define border_x_left			render_snap.border_x_left
+#define border_x_right			render_snap.border_x_right
+#define char_x_step			render_snap.char_x_step
+#define EFFECTIVE_V400			render_snap.effective_v400
+#define vic_color_register_mask		render_snap.color_register_mask
+#define bitplane_bank_p			render_snap.bitplane_bank_p
+#define palette				render_snap.palette
+#define altpalette			render_snap.altpalette
+#define spritepalette			render_snap.spritepalette
+#define blink_phase			render_snap.blink_phase
+#define sprite_y_adjust_xemu_bug	render_snap.sprite_y_adjust_xemu_bug
+
+
 // A very interesting thing happening here. If I want to check only if is_sprite[pos] is zero,
 // I found, that the sprite can collide with itself ... Looks like it sees it's "own data"
 // somehow which should be impossible as "is_sprite" is zeroed after each scanline. No idea,
@@ -1268,6 +1318,28 @@ static XEMU_INLINE void vic4_do_sprites ( void )
 }
 
 
+#include "xemu/opt-code/expand32.h"
+
+// Pixel doubling factor for the row renderers' fast paths: 1 (char_x_step is 1.0, 1:1 scale), 2 (char_x_step
+// is 0.5: every pixel is doubled, ie normal H320 modes), or 0 (odd horizontal scale, generic rendering is needed).
+// It is set by vic4_render_scanline_pixels() since char_x_step cannot change within a scanline.
+static int render_pixel_rep;
+// Fast path can be used if the scale allows it and the whole glyph fits before the right border
+#define FAST_ROW_OK(width)	(XEMU_LIKELY(render_pixel_rep) && xcounter + (width) * render_pixel_rep <= border_x_right)
+
+
+// Emits "n" source pixels (with doubling, if needed) prepared by a row renderer's fast path
+static XEMU_INLINE void vic4_emit_row ( const Uint32 *col, const Uint8 *attr, const Uint8 *opaque, const int n, const bool keep )
+{
+	if (render_pixel_rep == 1)
+		expand32_store(current_pixel, is_fg + xcounter, col, attr, opaque, n, keep, 1);
+	else
+		expand32_store(current_pixel, is_fg + xcounter, col, attr, opaque, n, keep, 2);
+	current_pixel += n * render_pixel_rep;
+	xcounter += n * render_pixel_rep;
+}
+
+
 // Render a monochrome character cell row
 // flip = 00 Dont flip, 01 = flip vertical, 10 = flip horizontal, 11 = flip both
 static XEMU_INLINE void vic4_render_mono_char_row ( Uint8 char_byte, const int glyph_width, const Uint8 bg_color, Uint8 fg_color, Uint8 vic3attr )
@@ -1289,6 +1361,16 @@ static XEMU_INLINE void vic4_render_mono_char_row ( Uint8 char_byte, const int g
 	}
 	char_byte &= draw_mask;
 	const Uint32 sdl_fg_color = palette_now[fg_color];
+	if (XEMU_LIKELY(glyph_width == 8 && FAST_ROW_OK(8))) {
+		const Uint32 sdl_bg_color = enable_bg_paint ? palette_now[bg_color] : 0;
+		if (render_pixel_rep == 1)
+			expand32_mono8(current_pixel, is_fg + xcounter, char_byte, sdl_fg_color, sdl_bg_color, !enable_bg_paint, 1);
+		else
+			expand32_mono8(current_pixel, is_fg + xcounter, char_byte, sdl_fg_color, sdl_bg_color, !enable_bg_paint, 2);
+		current_pixel += 8 * render_pixel_rep;
+		xcounter += 8 * render_pixel_rep;
+		return;
+	}
 	if (XEMU_LIKELY(enable_bg_paint)) {
 		const Uint32 sdl_bg_color = palette_now[bg_color];
 		for (float cx = 0; cx < glyph_width && xcounter < border_x_right; cx += char_x_step) {
@@ -1311,6 +1393,17 @@ static XEMU_INLINE void vic4_render_mono_char_row ( Uint8 char_byte, const int g
 static XEMU_INLINE void vic4_render_multicolor_char_row ( Uint8 char_byte, const int glyph_width, const Uint8 color_source[4] )
 {
 	char_byte &= draw_mask;
+	if (XEMU_LIKELY(FAST_ROW_OK(glyph_width))) {
+		Uint32 col[8];
+		Uint8 pair[8], attr[8];
+		for (int a = 0; a < glyph_width; a++) {
+			pair[a] = (char_byte >> (6 - (a & 6))) & 3;
+			col[a] = used_palette[color_source[pair[a]]];
+			attr[a] = pair[a] & 2;
+		}
+		vic4_emit_row(col, attr, pair, glyph_width, !enable_bg_paint);
+		return;
+	}
 	for (float cx = 0; cx < glyph_width && xcounter < border_x_right; cx += char_x_step) {
 		const Uint8 bitsel = 2 * (int)(cx / 2);
 		const Uint8 bit_pair = (char_byte & (0x80 >> bitsel)) >> (6-bitsel) | (char_byte & (0x40 >> bitsel)) >> (6-bitsel);
@@ -1325,6 +1418,17 @@ static XEMU_INLINE void vic4_render_multicolor_char_row ( Uint8 char_byte, const
 // 8-bytes per row
 static XEMU_INLINE void vic4_render_fullcolor_char_row ( const Uint8* char_row, const int glyph_width, const Uint32 bg_sdl_color, const Uint32 fg_sdl_color, const int hflip, const Uint32 *palette_now )
 {
+	if (XEMU_LIKELY(FAST_ROW_OK(glyph_width))) {
+		Uint32 col[8];
+		Uint8 data[8];
+		for (int a = 0; a < glyph_width; a++) {
+			const Uint8 char_data = draw_mask & char_row[XEMU_LIKELY(!hflip) ? a : glyph_width - 1 - a];
+			data[a] = char_data;
+			col[a] = char_data == 0xFF ? fg_sdl_color : (char_data ? palette_now[char_data] : bg_sdl_color);
+		}
+		vic4_emit_row(col, data, data, glyph_width, !enable_bg_paint);
+		return;
+	}
 	for (float cx = 0; cx < glyph_width && xcounter < border_x_right; cx += char_x_step) {
 		const Uint8 char_data = draw_mask & char_row[XEMU_LIKELY(!hflip) ? (int)cx : glyph_width - 1 - (int)cx];
 		if (char_data == 0xFF)
@@ -1344,6 +1448,16 @@ static XEMU_INLINE void vic4_render_fullcolor_char_row ( const Uint8* char_row,
 
 static XEMU_INLINE void vic4_render_fullcolor_char_row_with_alpha ( const Uint8* char_row_ptr, const int glyph_width, const Uint32 bg_sdl_color, const Uint32 fg_sdl_color, const int hflip )
 {
+	if (XEMU_LIKELY(FAST_ROW_OK(glyph_width))) {
+		Uint32 col[8];
+		Uint8 data[8];
+		for (int a = 0; a < glyph_width; a++) {
+			data[a] = draw_mask & char_row_ptr[XEMU_LIKELY(!hflip) ? a : glyph_width - 1 - a];
+			col[a] = blend32(fg_sdl_color, bg_sdl_color, data[a]);
+		}
+		vic4_emit_row(col, data, data, glyph_width, false);
+		return;
+	}
 	for (float cx = 0; cx < glyph_width && xcounter < border_x_right; cx += char_x_step) {
 		const Uint8 char_data = draw_mask & char_row_ptr[XEMU_LIKELY(!hflip) ? (int)cx : glyph_width - 1 - (int)cx];
 		*current_pixel++ = blend32(fg_sdl_color, bg_sdl_color, char_data);
@@ -1355,6 +1469,25 @@ static XEMU_INLINE void vic4_render_fullcolor_char_row_with_alpha ( const Uint8*
 // 16-color (Nybl) mode (4-bit per pixel / 16 pixel wide characters)
 static XEMU_INLINE void vic4_render_16color_char_row ( const Uint8* char_row, const int glyph_width, const Uint32 bg_sdl_color, const Uint32 fg_sdl_color, const Uint32 *palette16, const int hflip )
 {
+	if (XEMU_LIKELY(FAST_ROW_OK(glyph_width))) {
+		Uint32 col[16];
+		Uint8 data[16];
+		for (int a = 0; a < glyph_width; a++) {
+			Uint8 char_data;
+			if (XEMU_LIKELY(!hflip)) {
+				char_data = char_row[a / 2];
+				char_data = (a & 1) ? char_data >> 4 : char_data & 0xF;
+			} else {
+				char_data = char_row[glyph_width / 2 - 1 - (a / 2)];
+				char_data = (a & 1) ? char_data & 0xF : char_data >> 4;
+			}
+			char_data &= draw_mask;
+			data[a] = char_data;
+			col[a] = char_data ? ((char_data != 15) ? palette16[char_data] : fg_sdl_color) : bg_sdl_color;
+		}
+		vic4_emit_row(col, data, data, glyph_width, !enable_bg_paint);
+		return;
+	}
 	for (float cx = 0; cx < glyph_width && xcounter < border_x_right; cx += char_x_step) {
 		Uint8 char_data;
 		if (XEMU_LIKELY(!hflip)) {
@@ -1412,6 +1545,22 @@ static XEMU_INLINE void set_bitplane_pointers ( void )
 // Render a bitplane-mode character cell row
 static XEMU_INLINE void vic4_render_bitplane_char_row ( const Uint32 offset, const int glyph_width )
 {
+	if (XEMU_LIKELY(FAST_ROW_OK(glyph_width))) {
+		Uint8 planes[8], attr[8];
+		Uint32 col[8];
+		for (int p = 0; p < 8; p++)
+			planes[p] = *(bitplane_p[p] + offset);
+		for (int a = 0; a < glyph_width; a++) {
+			const int shift = 7 - a;
+			Uint8 index = 0;
+			for (int p = 0; p < 8; p++)
+				index |= ((planes[p] >> shift) & 1) << p;
+			col[a] = palette[(index & vic_registers[0x32]) ^ vic_registers[0x3B]];
+			attr[a] = planes[2] & (0x80 >> a);
+		}
+		vic4_emit_row(col, attr, NULL, glyph_width, false);
+		return;
+	}
 	for (float cx = 0; cx < glyph_width && xcounter < border_x_right; cx += char_x_step) {
 		const Uint8 bitsel = 0x80 >> ((int)cx);
 		*(current_pixel++) = palette[((			// Do not try this at home ...
@@ -1691,10 +1840,13 @@ static XEMU_INLINE void vic4_render_border_raster ( const bool do_increment_row_
 }
 
 
-bool vic4_render_scanline ( void )
+// Renders the scanline described by render_snap, it may run on the render thread!
+static void vic4_render_scanline_pixels ( void )
 {
 	// Work this first. DO NOT OPTIMIZE EARLY.
 
+	xcounter = 0;
+	render_pixel_rep = char_x_step == 1.0f ? 1 : (char_x_step == 0.5f ? 2 : 0);
 	used_palette = palette;	// may be overriden later by GOTOX token!
 	current_pixel = pixel_start + ycounter * TEXTURE_WIDTH;
 	pixel_raster_start = current_pixel;
@@ -1707,7 +1859,7 @@ bool vic4_render_scanline ( void )
 	// FIXME: is this really correct? ie even sprites cannot be set to Y pos finer than V200 or ...
 	// ... having resolution finer than V200 with some "VIC4 magic"?
 	if (!EFFECTIVE_V400 && (ycounter & 1) && !chary16) {
-		if (XEMU_UNLIKELY(configdb.show_scanlines)) {
+		if (XEMU_UNLIKELY(render_snap.show_scanlines)) {
 			for (int i = 0; i < TEXTURE_WIDTH; i++, current_pixel++)
 				*current_pixel = ((*(current_pixel - TEXTURE_WIDTH) >> 1) & 0x7F7F7F7FU) | black_colour;	// "| black_colour" is used to correct the messed-up alpha channel to $FF
 		} else {
@@ -1746,8 +1898,63 @@ bool vic4_render_scanline ( void )
 	// Sprites can be displayed on V200/V400 independently of char generator, so
 	// this must be outside of the main loop to avoid being affected by double-scan
 
-	if (XEMU_LIKELY(REG_DISPLAYENABLE) && (ycounter >= BORDER_Y_TOP && ycounter < BORDER_Y_BOTTOM)) {
+	render_snap.sprites_rendered = XEMU_LIKELY(REG_DISPLAYENABLE) && (ycounter >= BORDER_Y_TOP && ycounter < BORDER_Y_BOTTOM);
+	if (render_snap.sprites_rendered)
 		vic4_do_sprites();
+}
+
+#undef vic_registers
+#undef ycounter
+#undef border_x_left
+#undef border_x_right
+#undef char_x_step
+#undef EFFECTIVE_V400
+#undef vic_color_register_mask
+#undef bitplane_bank_p
+#undef palette
+#undef altpalette
+#undef spritepalette
+#undef blink_phase
+#undef sprite_y_adjust_xemu_bug
+/* --- END OF THE SCANLINE RENDERER --- */
+
+
+#ifdef VIC4_RENDER_THREAD_SUPPORT
+static SDL_Thread *render_thread = NULL;
+static SDL_sem *render_job_sem, *render_done_sem;
+static volatile bool render_thread_quit = false;
+#endif
+static bool render_job_pending = false;
+
+
+static void vic4_render_snapshot ( void )
+{
+	memcpy(render_snap.regs, vic_registers, sizeof render_snap.regs);
+	// Collision registers: the renderer only sets bits here, which are merged into the live registers then
+	render_snap.regs[0x1E] = 0;
+	render_snap.regs[0x1F] = 0;
+	render_snap.ycounter = ycounter;
+	render_snap.border_x_left = border_x_left;
+	render_snap.border_x_right = border_x_right;
+	render_snap.char_x_step = char_x_step;
+	render_snap.effective_v400 = EFFECTIVE_V400;
+	render_snap.color_register_mask = vic_color_register_mask;
+	render_snap.bitplane_bank_p = bitplane_bank_p;
+	render_snap.palette = palette;
+	render_snap.altpalette = altpalette;
+	render_snap.spritepalette = spritepalette;
+	render_snap.blink_phase = blink_phase;
+	render_snap.sprite_y_adjust_xemu_bug = sprite_y_adjust_xemu_bug;
+	render_snap.show_scanlines = configdb.show_scanlines;
+}
+
+
+// Applies the "non-pixel" results of the rendered scanline to the live state: always runs on the CPU (main) side
+static void vic4_render_merge ( void )
+{
+	if (render_snap.sprites_rendered) {
+		vic_registers[0x1E] |= render_snap.regs[0x1E];
+		vic_registers[0x1F] |= render_snap.regs[0x1F];
 		if (vic_registers[0x1E])		// sprite-sprite collision
 			interrupt_status |= 4;
 		else
@@ -1757,8 +1964,7 @@ bool vic4_render_scanline ( void )
 		else
 			interrupt_status &= 255 - 2;
 	}
-
-	if (XEMU_UNLIKELY(ycounter == debug_y && debug_x_real < TEXTURE_WIDTH)) {
+	if (XEMU_UNLIKELY(render_snap.ycounter == debug_y && debug_x_real < TEXTURE_WIDTH)) {
 		const Uint32 pix = pixel_raster_start[debug_x_real];
 		vic_pixel_readback_result[1] = (pix >> sdl_pix_fmt->Rshift) & 0xFF;	// red channel
 		vic_pixel_readback_result[2] = (pix >> sdl_pix_fmt->Gshift) & 0xFF;	// green channel
@@ -1766,11 +1972,85 @@ bool vic4_render_scanline ( void )
 		debug_x_crosshair = debug_x_real;
 		debug_y_crosshair = debug_y;
 	}
+}
+
+
+// Waits for the render thread to finish the scanline given to it (if any), and merges its results.
+// After this, it's safe to touch the renderer's state or the pixel buffer.
+static void vic4_render_sync ( void )
+{
+	if (render_job_pending) {
+#ifdef		VIC4_RENDER_THREAD_SUPPORT
+		SDL_SemWait(render_done_sem);
+#endif
+		render_job_pending = false;
+		vic4_render_merge();
+	}
+}
+
+
+#ifdef VIC4_RENDER_THREAD_SUPPORT
+static int vic4_render_thread ( void *unused )
+{
+	for (;;) {
+		SDL_SemWait(render_job_sem);
+		if (XEMU_UNLIKELY(render_thread_quit))
+			return 0;
+		vic4_render_scanline_pixels();
+		SDL_SemPost(render_done_sem);
+	}
+}
+
+
+static void vic4_start_render_thread ( void )
+{
+	render_job_sem  = SDL_CreateSemaphore(0);
+	render_done_sem = SDL_CreateSemaphore(0);
+	if (render_job_sem && render_done_sem)
+		render_thread = SDL_CreateThread(vic4_render_thread, "Xemu-VIC4-Render", NULL);
+	if (render_thread)
+		DEBUGPRINT("VIC4: scanline rendering on a separate thread (pipelined by one scanline)" NL);
+	else
+		ERROR_WINDOW("Cannot create VIC-IV render thread, falling back to rendering on the main thread:\n%s", SDL_GetError());
+}
+#endif
+
+
+void vic4_shutdown ( void )
+{
+	vic4_render_sync();
+#ifdef	VIC4_RENDER_THREAD_SUPPORT
+	if (render_thread) {
+		render_thread_quit = true;
+		SDL_SemPost(render_job_sem);
+		SDL_WaitThread(render_thread, NULL);
+		render_thread = NULL;
+		DEBUGPRINT("VIC4: render thread has been stopped" NL);
+	}
+#endif
+}
+
+
+bool vic4_render_scanline ( void )
+{
+	vic4_render_sync();	// previous scanline must be finished by the render thread (if it's used at all)
+	vic4_render_snapshot();
+#ifdef	VIC4_RENDER_THREAD_SUPPORT
+	if (render_thread) {
+		render_job_pending = true;
+		SDL_SemPost(render_job_sem);
+	} else
+#endif
+	{
+		vic4_render_scanline_pixels();
+		vic4_render_merge();
+	}
 
 	ycounter++;
 	// End of frame?
 	bool end_of_frame = false;
 	if (XEMU_UNLIKELY(ycounter == max_rasters)) {
+		vic4_render_sync();		// the frame must be complete for the caller, also the renderer's counters are reset below
 		vic4_reset_display_counters();	// this will also set logical_raster and xcounter to zero
 		static int blink_frame_counter = 0;
 		blink_frame_counter++;
@@ -1779,10 +2059,8 @@ bool vic4_render_scanline ( void )
 			blink_phase = !blink_phase;
 		}
 		end_of_frame = true;
-	} else {
+	} else
 		logical_raster = ycounter >> 1;
-		xcounter = 0;
-	}
 	SET_PHYSICAL_RASTER(ycounter);
 	// VIC2 raster source: shall we check FNRST?
 	// This check was at the beginning of this function. The reason of the modification, that Xemu uses
@@ -1858,3 +2136,105 @@ void vic4_set_emulation_colour_effect ( int val )
 		vic4_revalidate_all_palette();
 	}
 }
+
+
+/* --- SNAPSHOT RELATED --- */
+
+#ifdef XEMU_SNAPSHOT_SUPPORT
+
+// Snapshots are meant to be taken/restored between frames, thus the raster counters are not stored,
+// they're simply reset. The state derived from the registers is re-calculated on load instead of storing it.
+
+#define SNAPSHOT_VIC4_BLOCK_VERSION	0
+#define SNAPSHOT_VIC4_BLOCK_SIZE	0x100
+#define SNAPSHOT_VIC4_PALETTE_SIZE	(3 * NO_OF_PALETTE_REGS)
+
+
+static int vic4_snapshot_load_registers ( void )
+{
+	Uint8 buffer[SNAPSHOT_VIC4_BLOCK_SIZE];
+	const int ret = xemusnap_read_file(buffer, sizeof buffer);
+	if (ret)
+		return ret;
+	memcpy(vic_registers, buffer, sizeof vic_registers);
+	compare_raster			= P_AS_BE16(buffer + 0x80);
+	interrupt_status		= buffer[0x82];
+	c128_d030_reg			= buffer[0x83];
+	reg_d018_screen_addr		= buffer[0x84];
+	vic_color_register_mask		= buffer[0x85];
+	chary16				= !!buffer[0x86];
+	blink_phase			= buffer[0x87];
+	// Re-calculate derived state, see vic_write_reg() for the source of these
+	vic_hotreg_touched = 0;
+	vic4_sideborder_touched = 0;
+	debug_x = vic_registers[0x7D] | ((vic_registers[0x7F] & 0x0F) << 8);
+	debug_x_real = debug_x - DEBUG_X_OFFSET;
+	debug_y = vic_registers[0x7E] | ((vic_registers[0x7F] & 0xF0) << 4);
+	debug_x_crosshair = TEXTURE_WIDTH;
+	if ((vic_registers[0x7C] & 7) <= 2)
+		bitplane_bank_p = main_ram + ((vic_registers[0x7C] & 7) << 17);
+	altpalette	= ((vic_registers[0x70] & 0x03) << 8) + vic_palettes;
+	spritepalette	= ((vic_registers[0x70] & 0x0C) << 6) + vic_palettes;
+	palette		= ((vic_registers[0x70] & 0x30) << 4) + vic_palettes;
+	palregaccofs	= ((vic_registers[0x70] & 0xC0) << 2);
+	check_if_rom_palette(!(vic_registers[0x30] & 4));
+	vicii_first_raster		= buffer[0x88];
+	calculate_char_x_step();
+	vic4_update_sideborder_dimensions();	// but NOT the vertical ones: those are registers, already restored
+	vic4_reset_display_counters();
+	// Force to apply the video standard (and the timing based on it) at the next frame, if it's different
+	if (!!(vic_registers[0x6F] & 0x80) != videostd_id)
+		videostd_id = 0xFF;
+	return 0;
+}
+
+
+int vic4_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, struct xemu_snapshot_block_st *block )
+{
+	if (block->block_version != SNAPSHOT_VIC4_BLOCK_VERSION)
+		RETURN_XSNAPERR_USER("Bad VIC-4 block version");
+	vic4_render_sync();	// the renderer must be idle before altering its state
+	if (block->sub_counter == 0 && block->sub_size == SNAPSHOT_VIC4_BLOCK_SIZE)
+		return vic4_snapshot_load_registers();
+	if (block->sub_counter == 1 && block->sub_size == SNAPSHOT_VIC4_PALETTE_SIZE) {
+		Uint8 buffer[SNAPSHOT_VIC4_PALETTE_SIZE];
+		const int ret = xemusnap_read_file(buffer, sizeof buffer);
+		if (ret)
+			return ret;
+		memcpy(vic_palette_bytes_red,   buffer,                          NO_OF_PALETTE_REGS);
+		memcpy(vic_palette_bytes_green, buffer +     NO_OF_PALETTE_REGS, NO_OF_PALETTE_REGS);
+		memcpy(vic_palette_bytes_blue,  buffer + 2 * NO_OF_PALETTE_REGS, NO_OF_PALETTE_REGS);
+		vic4_revalidate_all_palette();
+		return 0;
+	}
+	RETURN_XSNAPERR_USER("Bad VIC-4 block syntax");
+}
+
+
+int vic4_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
+{
+	Uint8 buffer[SNAPSHOT_VIC4_PALETTE_SIZE];
+	int ret = xemusnap_write_block_header(def->idstr, SNAPSHOT_VIC4_BLOCK_VERSION);
+	if (ret)
+		return ret;
+	vic4_render_sync();
+	memset(buffer, 0xFF, SNAPSHOT_VIC4_BLOCK_SIZE);
+	memcpy(buffer, vic_registers, sizeof vic_registers);
+	U16_AS_BE(buffer + 0x80, compare_raster);
+	buffer[0x82] = interrupt_status;
+	buffer[0x83] = c128_d030_reg;
+	buffer[0x84] = reg_d018_screen_addr;
+	buffer[0x85] = vic_color_register_mask;
+	buffer[0x86] = chary16 ? 1 : 0;
+	buffer[0x87] = blink_phase;
+	buffer[0x88] = vicii_first_raster;
+	ret = xemusnap_write_sub_block(buffer, SNAPSHOT_VIC4_BLOCK_SIZE);
+	if (ret)
+		return ret;
+	memcpy(buffer,                          vic_palette_bytes_red,   NO_OF_PALETTE_REGS);
+	memcpy(buffer +     NO_OF_PALETTE_REGS, vic_palette_bytes_green, NO_OF_PALETTE_REGS);
+	memcpy(buffer + 2 * NO_OF_PALETTE_REGS, vic_palette_bytes_blue,  NO_OF_PALETTE_REGS);
+	return xemusnap_write_sub_block(buffer, SNAPSHOT_VIC4_PALETTE_SIZE);
+}
+
+#endif
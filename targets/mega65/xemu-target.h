@@ -25,6 +25,12 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 //#define DEBUG_CPU
 #define CPU_CUSTOM_MEMORY_FUNCTIONS_H "cpu_custom_functions.h"
 #define CPU65 cpu65
+// Guest code profiler (see guestprof.c) hooks in the CPU emulation
+#define CPU65_PROFILER_SUPPORT
+// Allows (optionally, -cpupredecode) to cache decoded opcodes, needs computed goto, see cpu65.h
+#ifdef __GNUC__
+#define CPU65_PREDECODE_SUPPORT
+#endif
 //#define CPU65_DISCRETE_PF_NZ
 
 // Forces xemu/emutools.c to have a callback on window title update: used in MEGA65 emu
@@ -47,6 +53,12 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #define VIRTUAL_DISK_IMAGE_SUPPORT
 //#define CBM_BASIC_TEXT_SUPPORT
 #define SD_CONTENT_SUPPORT
+// Allows (optionally, -victhread) to render VIC-IV scanlines on a separate thread
+#define VIC4_RENDER_THREAD_SUPPORT
+// Allows (optionally, -sdrleprefetch) to decompress the next page of a compressed SD-card image on a separate thread
+#define RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+// Allows (optionally, -sdlatency and -sdasyncio) emulated latency and host I/O on a separate thread for SD-card block operations
+#define SD_ASYNC_IO_SUPPORT
 #endif
 
 //#define TRACE_NEXT_SUPPORT
@@ -96,6 +108,14 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 
 #define RLE_COMPRESSED_DISK_IMAGE_SUPPORT
 
+// Access SD-card image through mmap() instead of doing read/write syscalls for each block (see sdcard.c)
+#if !defined(XEMU_ARCH_WIN) && !defined(XEMU_ARCH_HTML)
+#define SD_IMAGE_MMAP_SUPPORT
+#endif
+
+// Save-state support (see m65_snapshot.c), string is the ident of the snapshot format
+#define XEMU_SNAPSHOT_SUPPORT "MEGA65"
+
 // Workaround for hang causes by trying fast-seriel-IEC by ROM
 // These defines are used by xemu/cia6526.c
 //#define CIA_IN_SDR_SETS_ICR_BIT3
@@ -592,14 +592,12 @@ static void emulation_loop ( void )
 			// time. NOTE: debugger support/etc, should use notification system as well!
 			if (emu_loop_notification & EMU_LOOP_NMI_NOTIFY) {	// Notification for triggering NMI
 				// check if Z80ex accepted NMI. Though a real Z80 should always do this (NMI is not maskable),
-				// Z80ex is constructed in a way, that it actually *returns* after z80ex_step() even if it was
-				// a prefix byte, like FD,DD,CB,ED ... Surely, Z80 would not allow this, that's why z80ex_nmi()
-				// may report zero, that is NMI *now* cannot be accepted. Then we simply try again on the next
-				// run. Note: the construction of this z80ex_step() function actually GOOD because of more fine
-				// grained timing, so it's not only "a problem"! Actually it's IMPOSSIBLE to write an accurate
-				// Z80 emulation without this behaviour! Since, a real Z80 would react for a loong opocde
-				// sequence of FD/DD bytes to block even NMIs till its end, which would block the execution
-				// of the emulator updates etc as well, probably.
+				// z80ex_step() does a whole (even prefixed) instruction, except for a redundant FD/DD prefix
+				// followed by another FD/DD/ED one: then it returns in the "middle" of the instruction, so it
+				// cannot hang on an endless chain of prefixes. In this case z80ex_nmi() reports zero, that is
+				// NMI *now* cannot be accepted. Then we simply try again on the next run, after the instruction
+				// is done. A real Z80 would block even NMIs till the end of a loong sequence of FD/DD bytes, which
+				// would block the execution of the emulator updates etc as well, probably.
 				op_cycles = z80ex_nmi();
 				if (op_cycles) {
 					DEBUG("NMI accepted" NL);
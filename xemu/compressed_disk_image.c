@@ -36,18 +36,215 @@ static int unpack_buffer_allocated = 0;
 static const char default_image_debug_name[] = "COMPRESSED-DISK-IMAGE";
 static const char compressed_marker[] = "XemuBlockCompressedImage001";	// Do not change this, this is used to identify the compressed format!
 
+#define MAX_CACHE_PAGES	1024
+
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+enum { PREFETCH_IDLE, PREFETCH_REQUESTED, PREFETCH_UNPACKING, PREFETCH_DONE, PREFETCH_QUIT };
+#endif
+
+
+// Reads the compressed data of a 64K page into "packed", its size is stored into "pck_siz".
+// Returns NULL on success, or the description of the problem. It must not call any
+// Xemu UI functions (ie FATAL), since it can be called from the prefetch thread as well.
+// With prefetching, the file descriptor is shared: it must be called with prefetch_mutex held.
+static const char *read_packed_page ( struct compressed_diskimage_st *info, const unsigned int page_no, Uint8 *packed, unsigned int *pck_siz )
+{
+	const unsigned int img_ofs = info->pagedir[page_no];
+	*pck_siz = info->pagedir[page_no + 1] - img_ofs;
+	if (XEMU_UNLIKELY(*pck_siz > info->unpack_buffer_size))
+		return "too large unpack request";
+	if (!*pck_siz)
+		return NULL;
+	if (lseek(info->fd, img_ofs, SEEK_SET) != (off_t)img_ofs)
+		return "SEEK: compressed image seek host-OS failure";
+	if (xemu_safe_read(info->fd, packed, *pck_siz) != *pck_siz)
+		return "READ: compressed image read host-OS failure";
+	return NULL;
+}
+
+
+// Unpacks a 64K page into "page" from the compressed data read by read_packed_page() before. No file access.
+static void unpack_packed_page ( Uint8 *page, const Uint8 *packed, const unsigned int pck_siz )
+{
+	if (!pck_siz) {
+		memset(page, 0, 0x10000);
+		return;
+	}
+	memset(page, packed[0], 0x10000);
+	for (unsigned int i = 1, o = 0; i < pck_siz;) {
+		const Uint8 c = packed[i++];
+		if (c == packed[0]) {
+			const Uint8 v = packed[i++];
+			unsigned int n = packed[i++];
+			if (!n) {
+				n = packed[i] + (packed[i + 1] << 8);
+				i += 2;
+			}
+			if (v != c)
+				memset(page + o, v, n);
+			o += n;
+		} else
+			page[o++] = c;
+	}
+}
+
+
+// Unpacks a 64K page into "page" using "packed" as the buffer for the compressed data.
+// Returns NULL on success, or the description of the problem.
+static const char *unpack_page ( struct compressed_diskimage_st *info, const unsigned int page_no, Uint8 *page, Uint8 *packed )
+{
+	unsigned int pck_siz;
+	const char *error = read_packed_page(info, page_no, packed, &pck_siz);
+	if (!error)
+		unpack_packed_page(page, packed, pck_siz);
+	return error;
+}
+
+
+static int is_page_cached ( const struct compressed_diskimage_st *info, const unsigned int page_no )
+{
+	for (int i = 0; i < info->cache_pages; i++)
+		if (info->cache[i].page_no == page_no)
+			return 1;
+	return 0;
+}
+
+
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+static int prefetch_thread ( void *user_data )
+{
+	struct compressed_diskimage_st *info = user_data;
+	SDL_LockMutex(info->prefetch_mutex);
+	for (;;) {
+		while (info->prefetch_state != PREFETCH_REQUESTED && info->prefetch_state != PREFETCH_QUIT)
+			SDL_CondWait(info->prefetch_cond, info->prefetch_mutex);
+		if (info->prefetch_state == PREFETCH_QUIT)
+			break;
+		// The mutex is held only while reading the file (the file descriptor is shared with the main thread), not while unpacking.
+		// The main thread does not touch prefetch_data in the PREFETCH_UNPACKING state, and it can request another page meanwhile.
+		const unsigned int page_no = info->prefetch_page;
+		unsigned int pck_siz;
+		if (read_packed_page(info, page_no, info->prefetch_unpack_buffer, &pck_siz)) {
+			info->prefetch_state = PREFETCH_IDLE;
+		} else {
+			info->prefetch_state = PREFETCH_UNPACKING;
+			SDL_UnlockMutex(info->prefetch_mutex);
+			unpack_packed_page(info->prefetch_data, info->prefetch_unpack_buffer, pck_siz);
+			SDL_LockMutex(info->prefetch_mutex);
+			if (info->prefetch_state == PREFETCH_UNPACKING)
+				info->prefetch_state = info->prefetch_page == page_no ? PREFETCH_DONE : PREFETCH_REQUESTED;
+		}
+		SDL_CondBroadcast(info->prefetch_cond);	// the main thread may wait for this page
+	}
+	SDL_UnlockMutex(info->prefetch_mutex);
+	return 0;
+}
+
+
+static void stop_prefetch ( struct compressed_diskimage_st *info )
+{
+	if (info->prefetch_thread) {
+		SDL_LockMutex(info->prefetch_mutex);
+		info->prefetch_state = PREFETCH_QUIT;
+		SDL_CondBroadcast(info->prefetch_cond);
+		SDL_UnlockMutex(info->prefetch_mutex);
+		SDL_WaitThread(info->prefetch_thread, NULL);
+		info->prefetch_thread = NULL;
+		DEBUGPRINT("%s: prefetch thread has been stopped" NL, info->name);
+	}
+	if (info->prefetch_cond) {
+		SDL_DestroyCond(info->prefetch_cond);
+		info->prefetch_cond = NULL;
+	}
+	if (info->prefetch_mutex) {
+		SDL_DestroyMutex(info->prefetch_mutex);
+		info->prefetch_mutex = NULL;
+	}
+	free(info->prefetch_data);
+	info->prefetch_data = NULL;
+	free(info->prefetch_unpack_buffer);
+	info->prefetch_unpack_buffer = NULL;
+}
+
+
+static void start_prefetch ( struct compressed_diskimage_st *info )
+{
+	info->prefetch_state = PREFETCH_IDLE;
+	info->prefetch_page = UINT_MAX;
+	info->prefetch_data = xemu_malloc(0x10000);
+	info->prefetch_unpack_buffer = xemu_malloc(info->unpack_buffer_size);	// the static "unpack_buffer" is for the main thread only
+	info->prefetch_mutex = SDL_CreateMutex();
+	info->prefetch_cond = SDL_CreateCond();
+	if (info->prefetch_mutex && info->prefetch_cond)
+		info->prefetch_thread = SDL_CreateThread(prefetch_thread, "Xemu-RLE-Prefetch", info);
+	if (info->prefetch_thread) {
+		DEBUGPRINT("%s: next page prefetching on a separate thread" NL, info->name);
+	} else {
+		DEBUGPRINT("%s: cannot create prefetch thread, no prefetching: %s" NL, info->name, SDL_GetError());
+		stop_prefetch(info);
+	}
+}
+#endif
+
+
+static void free_cache ( struct compressed_diskimage_st *info )
+{
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+	stop_prefetch(info);
+#endif
+	for (int i = 0; i < info->cache_pages; i++)
+		free(info->cache[i].data);
+	free(info->cache);
+	info->cache = NULL;
+	info->cache_pages = 0;
+	info->last_slot = 0;
+}
+
+
+static void alloc_cache ( struct compressed_diskimage_st *info, const int pages )
+{
+	free_cache(info);
+	info->cache = xemu_malloc(sizeof(struct compressed_diskimage_cache_st) * pages);
+	for (int i = 0; i < pages; i++) {
+		info->cache[i].page_no = UINT_MAX;
+		info->cache[i].last_used = 0;
+		info->cache[i].data = xemu_malloc(0x10000);
+	}
+	info->cache_pages = pages;
+	info->last_slot = 0;
+	info->lru_clock = 0;
+}
+
+
+void compressed_diskimage_setup_cache ( struct compressed_diskimage_st *info, int pages, const bool prefetch )
+{
+	if (!info || !info->pagedir)
+		return;
+	const int image_pages = info->size_in_blocks >> 7;
+	if (pages > image_pages)
+		pages = image_pages;	// no point to have more cache than the image itself
+	if (pages > MAX_CACHE_PAGES)
+		pages = MAX_CACHE_PAGES;
+	if (pages < 1)
+		pages = 1;
+	alloc_cache(info, pages);
+	DEBUGPRINT("%s: using %d page(s) of LRU cache (%d Kbytes)" NL, info->name, pages, pages * 64);
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+	if (prefetch && image_pages > 1)
+		start_prefetch(info);
+#endif
+}
+
 
 void compressed_diskimage_free ( struct compressed_diskimage_st *info )
 {
 	if (!info)
 		return;
+	free_cache(info);
 	free(info->pagedir);
 	info->pagedir = NULL;
-	free(info->page_cache);
-	info->page_cache = NULL;
 	free(info->name);
 	info->name = NULL;
-	info->cached_page = UINT_MAX;
 	info->size_in_blocks = 0;
 	info->fd = -1;
 }
@@ -57,11 +254,8 @@ int compressed_diskimage_detect ( struct compressed_diskimage_st *info, const in
 {
 	if (!name)
 		name = default_image_debug_name;
-	info->pagedir = NULL;
-	info->page_cache = NULL;
-	info->cached_page = UINT_MAX;
+	memset(info, 0, sizeof(struct compressed_diskimage_st));
 	info->fd = -1;
-	info->name = NULL;
 	Uint8 hdr[sizeof(compressed_marker) + 64];
 	if (lseek(fd, 0, SEEK_SET) != (off_t)0 || xemu_safe_read(fd, hdr, sizeof(hdr)) != sizeof(hdr))
 		return -1;
@@ -110,7 +304,6 @@ int compressed_diskimage_detect ( struct compressed_diskimage_st *info, const in
 	}
 	free(buf);
 	info->pagedir[pages]  = data_offset;	// we need pages+1 elements in the array, see read_compressed_block() later
-	info->page_cache = xemu_malloc(0x10000);
 	info->fd = fd;
 	info->name = xemu_strdup(name);
 	DEBUGPRINT("%s: compressed image with %u 64K-pages, max packed page size is %u bytes, compressed page directory is %u entries long" NL, name, pages, info->unpack_buffer_size, pagedir_length / 3);
@@ -119,6 +312,7 @@ int compressed_diskimage_detect ( struct compressed_diskimage_st *info, const in
 		unpack_buffer = xemu_realloc(unpack_buffer, info->unpack_buffer_size);
 		unpack_buffer_allocated = info->unpack_buffer_size;
 	}
+	alloc_cache(info, 1);	// the default is a single page, use compressed_diskimage_setup_cache() to change it
 	return 1;
 unpack_error:
 	free(buf);
@@ -128,56 +322,82 @@ unpack_error:
 }
 
 
+// Unpacks the given page into a cache slot, it's either the result of the prefetch (if it's the wanted page)
+// or done here. Also, it asks the prefetch thread (if there is) to unpack the next page in the background.
+static void fill_cache_slot ( struct compressed_diskimage_st *info, struct compressed_diskimage_cache_st *slot, const unsigned int page_no )
+{
+	const char *error;
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+	if (info->prefetch_thread) {
+		unsigned int pck_siz = 0;
+		bool hit = false;
+		SDL_LockMutex(info->prefetch_mutex);	// blocks only while the thread reads the file, not while it unpacks
+		// If the wanted page is being unpacked right now, waiting for it is still faster than doing it again here
+		while (info->prefetch_state == PREFETCH_UNPACKING && info->prefetch_page == page_no)
+			SDL_CondWait(info->prefetch_cond, info->prefetch_mutex);
+		if (info->prefetch_state == PREFETCH_DONE && info->prefetch_page == page_no) {
+			// Prefetch hit: swap the buffers, no need to copy
+			Uint8 *p = slot->data;
+			slot->data = info->prefetch_data;
+			info->prefetch_data = p;
+			info->prefetch_state = PREFETCH_IDLE;
+			error = NULL;
+			hit = true;
+			//DEBUGPRINT("%s: CACHE: prefetch-hit" NL, info->name);
+		} else
+			error = read_packed_page(info, page_no, unpack_buffer, &pck_siz);
+		const unsigned int next_page = page_no + 1;
+		if (!error && next_page < (info->size_in_blocks >> 7) && !is_page_cached(info, next_page)) {
+			info->prefetch_page = next_page;
+			// While unpacking, the thread notices the new request itself when it's done
+			if (info->prefetch_state != PREFETCH_UNPACKING) {
+				info->prefetch_state = PREFETCH_REQUESTED;
+				SDL_CondBroadcast(info->prefetch_cond);
+			}
+		}
+		SDL_UnlockMutex(info->prefetch_mutex);
+		if (!error && !hit)
+			unpack_packed_page(slot->data, unpack_buffer, pck_siz);
+	} else
+#endif
+		error = unpack_page(info, page_no, slot->data, unpack_buffer);
+	if (XEMU_UNLIKELY(error))
+		FATAL("%s: compressed disk image unpack fatal error on page $%X: %s (%s)", info->name, page_no, error, strerror(errno));
+	slot->page_no = page_no;
+}
+
+
 int compressed_diskimage_read_block ( struct compressed_diskimage_st *info, const Uint32 block, Uint8 *buffer )
 {
-	if (XEMU_UNLIKELY(!info || !info->pagedir || !info->page_cache || info->fd < 0))
+	if (XEMU_UNLIKELY(!info || !info->pagedir || !info->cache || info->fd < 0))
 		FATAL("%s(): invalid \"info\" structure", __func__);
 	if (XEMU_UNLIKELY(block >= info->size_in_blocks))
 		return -1;
 	const unsigned int page_no = block >> 7;	// "block" is 512 byte based, so to get 64K based page, we need 7 more shifts
-	if (info->cached_page != page_no) {
-		const unsigned int img_ofs = info->pagedir[page_no];
-		const unsigned int pck_siz = info->pagedir[page_no + 1] - img_ofs;
-		if (XEMU_UNLIKELY(pck_siz > info->unpack_buffer_size))
-			FATAL("%s: Compressed disk image unpack fatal error: too large unpack request", info->name);
-		if (!pck_siz) {
-			memset(info->page_cache, 0, 0x10000);
-			//DEBUGPRINT("%s: CACHE: miss-zeroed" NL, info->name);
-		} else {
-			//DEBUGPRINT("%s: CACHE: miss" NL, info->name);
-			if (lseek(info->fd, img_ofs, SEEK_SET) != (off_t)img_ofs)
-				goto seek_error;
-			if (xemu_safe_read(info->fd, unpack_buffer, pck_siz) != pck_siz)
-				goto read_error;
-			memset(info->page_cache, unpack_buffer[0], 0x10000);
-			for (unsigned int i = 1, o = 0; i < pck_siz;) {
-				const Uint8 c = unpack_buffer[i++];
-				if (c == unpack_buffer[0]) {
-					const Uint8 v = unpack_buffer[i++];
-					unsigned int n = unpack_buffer[i++];
-					if (!n) {
-						n = unpack_buffer[i] + (unpack_buffer[i + 1] << 8);
-						i += 2;
-					}
-					if (v != c)
-						memset(info->page_cache + o, v, n);
-					o += n;
-				} else
-					info->page_cache[o++] = c;
+	struct compressed_diskimage_cache_st *slot = &info->cache[info->last_slot];
+	if (XEMU_UNLIKELY(slot->page_no != page_no)) {
+		// Not the last used page: look up the cache, also find the least recently used slot in case of a miss
+		int lru = 0;
+		slot = NULL;
+		for (int i = 0; i < info->cache_pages; i++) {
+			if (info->cache[i].page_no == page_no) {
+				slot = &info->cache[i];
+				info->last_slot = i;
+				break;
 			}
+			if (info->cache[i].last_used < info->cache[lru].last_used)
+				lru = i;
 		}
-		info->cached_page = page_no;
-	} else {
-		//DEBUGPRINT("%s: CACHE: hit!" NL, info->name);
+		if (!slot) {
+			//DEBUGPRINT("%s: CACHE: miss" NL, info->name);
+			slot = &info->cache[lru];
+			info->last_slot = lru;
+			fill_cache_slot(info, slot, page_no);
+		}
+		slot->last_used = ++info->lru_clock;
 	}
-	memcpy(buffer, info->page_cache + ((block & 127) << 9), 512);
+	memcpy(buffer, slot->data + ((block & 127) << 9), 512);
 	return 0;
-seek_error:
-	FATAL("%s: SEEK: compressed image seek host-OS failure: %s", info->name, strerror(errno));
-	return -1;
-read_error:
-	FATAL("%s: READ: compressed image read host-OS failure: %s", info->name, strerror(errno));
-	return -1;
 }
 
 #endif
@@ -19,19 +19,37 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #ifndef XEMU_COMMON_COMPRESSED_DISK_IMAGE_H_INCLUDED
 #define XEMU_COMMON_COMPRESSED_DISK_IMAGE_H_INCLUDED
 
+struct compressed_diskimage_cache_st {
+	unsigned int	page_no;	// UINT_MAX: slot is not used yet
+	Uint32		last_used;	// LRU "timestamp"
+	Uint8		*data;		// 64K of unpacked data
+};
+
 struct compressed_diskimage_st {
 	int		fd;
 	char		*name;
 	int		unpack_buffer_size;
 	Uint32		*pagedir;
 	Uint32		size_in_blocks;
-	unsigned int	cached_page;
-	Uint8		*page_cache;
+	int		cache_pages;
+	int		last_slot;
+	Uint32		lru_clock;
+	struct compressed_diskimage_cache_st *cache;
+#ifdef RLE_COMPRESSED_DISK_IMAGE_PREFETCH
+	SDL_Thread	*prefetch_thread;
+	SDL_mutex	*prefetch_mutex;
+	SDL_cond	*prefetch_cond;
+	int		prefetch_state;
+	unsigned int	prefetch_page;
+	Uint8		*prefetch_data;
+	Uint8		*prefetch_unpack_buffer;
+#endif
 };
 
-extern int  compressed_diskimage_detect     ( struct compressed_diskimage_st *info, const int fd, const char *name );
-extern int  compressed_diskimage_read_block ( struct compressed_diskimage_st *info, const Uint32 block, Uint8 *buffer );
-extern void compressed_diskimage_free       ( struct compressed_diskimage_st *info );
+extern int  compressed_diskimage_detect      ( struct compressed_diskimage_st *info, const int fd, const char *name );
+extern void compressed_diskimage_setup_cache ( struct compressed_diskimage_st *info, int pages, const bool prefetch );
+extern int  compressed_diskimage_read_block  ( struct compressed_diskimage_st *info, const Uint32 block, Uint8 *buffer );
+extern void compressed_diskimage_free        ( struct compressed_diskimage_st *info );
 
 #endif
 #endif
@@ -113,6 +113,17 @@ static XEMU_INLINE Uint32 AXYZ_SET ( const Uint32 val ) {
 #	endif
 #endif
 
+#ifdef CPU65_PREDECODE_SUPPORT
+#ifndef __GNUC__
+#error "CPU65_PREDECODE_SUPPORT needs computed goto (labels as values) which is a GCC/clang extension."
+#endif
+#include <string.h>
+// With predecoding, every opcode in cpu65_step() has a label as well, so it can jump there directly (see opcode_labels)
+#define OPCODE(n)	case n: opcode_##n
+#else
+#define OPCODE(n)	case n
+#endif
+
 #define TIMINGS_65CE02_	{7,5,2,2,4,3,4,4,3,2,1,1,5,4,5,4,2,5,5,3,4,3,4,4,1,4,1,1,5,4,5,4,5,5,7,7,3,3,4,4,3,2,1,1,4,4,5,4,2,5,5,3,3,3,4,4,1,4,1,1,4,4,5,4,5,5,2,2,4,3,4,4,3,2,1,1,3,4,5,4,2,5,5,3,4,3,4,4,2,4,3,1,4,4,5,4,4,5,7,5,3,3,4,4,3,2,1,1,5,4,5,4,2,5,5,3,3,3,4,4,2,4,3,1,5,4,5,4,2,5,6,3,3,3,3,4,1,2,1,4,4,4,4,4,2,5,5,3,3,3,3,4,1,4,1,4,4,4,4,4,2,5,2,2,3,3,3,4,1,2,1,4,4,4,4,4,2,5,5,3,3,3,3,4,1,4,1,4,4,4,4,4,2,5,2,6,3,3,4,4,1,2,1,7,4,4,5,4,2,5,5,3,3,3,4,4,1,4,3,3,4,4,5,4,2,5,6,6,3,3,4,4,1,2,1,7,4,4,5,4,2,5,5,3,5,3,4,4,1,4,3,3,7,4,5,4} // 65CE02 timing (my findings)
 #define TIMINGS_65CE02	{7,5,2,2,4,3,4,4,3,2,1,1,5,4,5,4,2,5,5,3,4,3,4,4,1,4,1,1,5,4,5,4,2,5,7,7,4,3,4,4,3,2,1,1,5,4,4,4,2,5,5,3,4,3,4,4,1,4,1,1,5,4,5,4,5,5,2,2,4,3,4,4,3,2,1,1,3,4,5,4,2,5,5,3,4,3,4,4,1,4,3,3,4,4,5,4,4,5,7,5,3,3,4,4,3,2,1,1,5,4,5,4,2,5,5,3,3,3,4,4,2,4,3,1,5,4,5,4,2,5,6,3,3,3,3,4,1,2,1,4,4,4,4,4,2,5,5,3,3,3,3,4,1,4,1,4,4,4,4,4,2,5,2,2,3,3,3,4,1,2,1,4,4,4,4,4,2,5,5,3,3,3,3,4,1,4,1,4,4,4,4,4,2,5,2,6,3,3,4,4,1,2,1,7,4,4,5,4,2,5,5,3,3,3,4,4,1,4,3,3,4,4,5,4,2,5,6,6,3,3,4,4,1,2,1,6,4,4,5,4,2,5,5,3,5,3,4,4,1,4,3,3,7,4,5,4} // 65CE02 timing (from gs4510.vhdl)
 #define TIMINGS_6502C65	{7,6,2,8,3,3,5,5,3,2,2,2,4,4,6,6,2,5,5,8,4,4,6,6,2,4,2,7,4,4,7,7,6,6,7,8,3,3,5,5,4,2,2,2,4,4,6,6,2,5,5,8,4,4,6,6,2,4,2,7,4,4,7,7,6,6,2,8,3,3,5,5,3,2,2,2,3,4,6,6,2,5,5,8,4,4,6,6,2,4,2,7,4,4,7,7,6,6,7,8,3,3,5,5,4,2,2,2,5,4,6,6,2,5,5,8,4,4,6,6,2,4,2,7,4,4,7,7,2,6,2,6,3,3,3,3,2,2,2,2,4,4,4,4,2,6,5,6,4,4,4,4,2,5,2,5,5,5,5,5,2,6,2,6,3,3,3,3,2,2,2,2,4,4,4,4,2,5,5,5,4,4,4,4,2,4,2,4,4,4,4,4,2,6,2,8,3,3,5,5,2,2,2,2,4,4,6,6,2,5,5,8,4,4,6,6,2,4,2,7,4,4,7,7,2,6,2,8,3,3,5,5,2,2,2,2,4,4,6,6,2,5,5,8,4,4,6,6,2,4,2,7,4,4,7,7} // 65CE02 with "dead cycles" to mimic NMOS 6502
@@ -171,6 +182,33 @@ static int BRANCH8_COST = 1;
 #	endif
 #endif
 
+#ifdef CPU65_PREDECODE_SUPPORT
+struct cpu65_predecode_block_st *cpu65_predecode_blocks[0x100];
+Uint32 cpu65_predecode_generation = 1;
+
+// Called by the target on writes to the memory of the block (while blk->decoded is non-zero), and by cpu65_step()
+// if the block is from an older generation. Opcodes of the block will be decoded again on their next execution.
+void cpu65_predecode_invalidate_block ( struct cpu65_predecode_block_st *blk )
+{
+	if (blk->generation != cpu65_predecode_generation) {
+		blk->generation = cpu65_predecode_generation;
+		blk->invalidations = 0;
+	} else if (blk->decoded)
+		blk->invalidations++;
+	if (blk->decoded) {
+		memset(blk->ops, 0, sizeof blk->ops);
+		blk->decoded = 0;
+	}
+}
+
+// Invalidates all blocks, the target must call this, if it modifies memory without its normal write path (bulk loads, etc).
+// Blocks are actually cleared lazily, when they're used next time.
+void cpu65_predecode_flush ( void )
+{
+	cpu65_predecode_generation++;
+}
+#endif
+
 #ifdef MEGA65
 void cpu65_init_mega_specific ( void )
 {
@@ -393,6 +431,9 @@ void cpu65_reset ( void ) {
 #ifdef MEGA65
 	CPU65.nmos_mode = 0;
 	CPU65.prefix = PREFIX_NOTHING;
+#endif
+#ifdef CPU65_PREDECODE_SUPPORT
+	cpu65_predecode_flush();
 #endif
 	CPU65.pc = readWord(0xFFFC);
 	DEBUGPRINT("CPU[" CPU_TYPE "]: RESET, PC=%04X, BCD_behaviour=%s" NL,
@@ -857,6 +898,14 @@ static XEMU_INLINE void _NEGQ_Q ( void ) {
 #	define DO_CPU65_EXECUTION_CALLBACK(cb_func)
 #endif
 
+#ifdef CPU65_PROFILER_SUPPORT
+#	define DO_CPU65_PROFILER_CALLBACK(cb_func) \
+		if (XEMU_UNLIKELY(cpu65_profiler_enabled)) \
+			cb_func()
+#else
+#	define DO_CPU65_PROFILER_CALLBACK(cb_func)
+#endif
+
 
 /* ------------------------------------------------------------------------ *
  *                    CPU EMULATION, OPCODE DECODING + RUN                  *
@@ -870,63 +919,107 @@ int cpu65_step (
 	void
 #endif
 ) {
+#ifdef CPU65_PREDECODE_SUPPORT
+	static const void *const opcode_labels[0x100] = {
+		&&opcode_0x00, &&opcode_0x01, &&opcode_0x02, &&opcode_0x03, &&opcode_0x04, &&opcode_0x05, &&opcode_0x06, &&opcode_0x07, &&opcode_0x08, &&opcode_0x09, &&opcode_0x0A, &&opcode_0x0B, &&opcode_0x0C, &&opcode_0x0D, &&opcode_0x0E, &&opcode_0x0F,
+		&&opcode_0x10, &&opcode_0x11, &&opcode_0x12, &&opcode_0x13, &&opcode_0x14, &&opcode_0x15, &&opcode_0x16, &&opcode_0x17, &&opcode_0x18, &&opcode_0x19, &&opcode_0x1A, &&opcode_0x1B, &&opcode_0x1C, &&opcode_0x1D, &&opcode_0x1E, &&opcode_0x1F,
+		&&opcode_0x20, &&opcode_0x21, &&opcode_0x22, &&opcode_0x23, &&opcode_0x24, &&opcode_0x25, &&opcode_0x26, &&opcode_0x27, &&opcode_0x28, &&opcode_0x29, &&opcode_0x2A, &&opcode_0x2B, &&opcode_0x2C, &&opcode_0x2D, &&opcode_0x2E, &&opcode_0x2F,
+		&&opcode_0x30, &&opcode_0x31, &&opcode_0x32, &&opcode_0x33, &&opcode_0x34, &&opcode_0x35, &&opcode_0x36, &&opcode_0x37, &&opcode_0x38, &&opcode_0x39, &&opcode_0x3A, &&opcode_0x3B, &&opcode_0x3C, &&opcode_0x3D, &&opcode_0x3E, &&opcode_0x3F,
+		&&opcode_0x40, &&opcode_0x41, &&opcode_0x42, &&opcode_0x43, &&opcode_0x44, &&opcode_0x45, &&opcode_0x46, &&opcode_0x47, &&opcode_0x48, &&opcode_0x49, &&opcode_0x4A, &&opcode_0x4B, &&opcode_0x4C, &&opcode_0x4D, &&opcode_0x4E, &&opcode_0x4F,
+		&&opcode_0x50, &&opcode_0x51, &&opcode_0x52, &&opcode_0x53, &&opcode_0x54, &&opcode_0x55, &&opcode_0x56, &&opcode_0x57, &&opcode_0x58, &&opcode_0x59, &&opcode_0x5A, &&opcode_0x5B, &&opcode_0x5C, &&opcode_0x5D, &&opcode_0x5E, &&opcode_0x5F,
+		&&opcode_0x60, &&opcode_0x61, &&opcode_0x62, &&opcode_0x63, &&opcode_0x64, &&opcode_0x65, &&opcode_0x66, &&opcode_0x67, &&opcode_0x68, &&opcode_0x69, &&opcode_0x6A, &&opcode_0x6B, &&opcode_0x6C, &&opcode_0x6D, &&opcode_0x6E, &&opcode_0x6F,
+		&&opcode_0x70, &&opcode_0x71, &&opcode_0x72, &&opcode_0x73, &&opcode_0x74, &&opcode_0x75, &&opcode_0x76, &&opcode_0x77, &&opcode_0x78, &&opcode_0x79, &&opcode_0x7A, &&opcode_0x7B, &&opcode_0x7C, &&opcode_0x7D, &&opcode_0x7E, &&opcode_0x7F,
+		&&opcode_0x80, &&opcode_0x81, &&opcode_0x82, &&opcode_0x83, &&opcode_0x84, &&opcode_0x85, &&opcode_0x86, &&opcode_0x87, &&opcode_0x88, &&opcode_0x89, &&opcode_0x8A, &&opcode_0x8B, &&opcode_0x8C, &&opcode_0x8D, &&opcode_0x8E, &&opcode_0x8F,
+		&&opcode_0x90, &&opcode_0x91, &&opcode_0x92, &&opcode_0x93, &&opcode_0x94, &&opcode_0x95, &&opcode_0x96, &&opcode_0x97, &&opcode_0x98, &&opcode_0x99, &&opcode_0x9A, &&opcode_0x9B, &&opcode_0x9C, &&opcode_0x9D, &&opcode_0x9E, &&opcode_0x9F,
+		&&opcode_0xA0, &&opcode_0xA1, &&opcode_0xA2, &&opcode_0xA3, &&opcode_0xA4, &&opcode_0xA5, &&opcode_0xA6, &&opcode_0xA7, &&opcode_0xA8, &&opcode_0xA9, &&opcode_0xAA, &&opcode_0xAB, &&opcode_0xAC, &&opcode_0xAD, &&opcode_0xAE, &&opcode_0xAF,
+		&&opcode_0xB0, &&opcode_0xB1, &&opcode_0xB2, &&opcode_0xB3, &&opcode_0xB4, &&opcode_0xB5, &&opcode_0xB6, &&opcode_0xB7, &&opcode_0xB8, &&opcode_0xB9, &&opcode_0xBA, &&opcode_0xBB, &&opcode_0xBC, &&opcode_0xBD, &&opcode_0xBE, &&opcode_0xBF,
+		&&opcode_0xC0, &&opcode_0xC1, &&opcode_0xC2, &&opcode_0xC3, &&opcode_0xC4, &&opcode_0xC5, &&opcode_0xC6, &&opcode_0xC7, &&opcode_0xC8, &&opcode_0xC9, &&opcode_0xCA, &&opcode_0xCB, &&opcode_0xCC, &&opcode_0xCD, &&opcode_0xCE, &&opcode_0xCF,
+		&&opcode_0xD0, &&opcode_0xD1, &&opcode_0xD2, &&opcode_0xD3, &&opcode_0xD4, &&opcode_0xD5, &&opcode_0xD6, &&opcode_0xD7, &&opcode_0xD8, &&opcode_0xD9, &&opcode_0xDA, &&opcode_0xDB, &&opcode_0xDC, &&opcode_0xDD, &&opcode_0xDE, &&opcode_0xDF,
+		&&opcode_0xE0, &&opcode_0xE1, &&opcode_0xE2, &&opcode_0xE3, &&opcode_0xE4, &&opcode_0xE5, &&opcode_0xE6, &&opcode_0xE7, &&opcode_0xE8, &&opcode_0xE9, &&opcode_0xEA, &&opcode_0xEB, &&opcode_0xEC, &&opcode_0xED, &&opcode_0xEE, &&opcode_0xEF,
+		&&opcode_0xF0, &&opcode_0xF1, &&opcode_0xF2, &&opcode_0xF3, &&opcode_0xF4, &&opcode_0xF5, &&opcode_0xF6, &&opcode_0xF7, &&opcode_0xF8, &&opcode_0xF9, &&opcode_0xFA, &&opcode_0xFB, &&opcode_0xFC, &&opcode_0xFD, &&opcode_0xFE, &&opcode_0xFF,
+	};
+#endif
 #ifdef CPU_STEP_MULTI_OPS
 	int all_cycles = 0;
 	do {
 #endif
-	if (XEMU_UNLIKELY(CPU65.nmiEdge
+	// Fast path: most of the time there is no pending interrupt at all, so there is no need to evaluate
+	// the more complex conditions below (inhibit, prefix state, hypervisor mode ...) for every single opcode.
+	if (XEMU_UNLIKELY(CPU65.nmiEdge || CPU65.irqLevel)) {
+		if (XEMU_UNLIKELY(CPU65.nmiEdge
 #ifdef CPU_65CE02
-		&& CPU65.op_cycles != 1 && !CPU65.cpu_inhibit_interrupts
+			&& CPU65.op_cycles != 1 && !CPU65.cpu_inhibit_interrupts
 #endif
 #ifdef MEGA65
-		&& !in_hypervisor && CPU65.prefix == PREFIX_NOTHING
+			&& !in_hypervisor && CPU65.prefix == PREFIX_NOTHING
 #endif
-	)) {
+		)) {
 #ifdef DEBUG_CPU
-		DEBUG("CPU: serving NMI on NMI edge at PC $%04X" NL, CPU65.pc);
-#endif
-		DO_CPU65_EXECUTION_CALLBACK(cpu65_nmi_debug_callback);
-		CPU65.nmiEdge = 0;
-		pushWord(CPU65.pc);
-		push(cpu65_get_pf());	// no CPU65_PF_B is pushed!
-		CPU65.pf_i = 1;
-		CPU65.pf_d = 0;			// NOTE: D flag clearing was not done on the original 6502 I guess, but indeed on the 65C02 already
-		CPU65.pc = readWord(0xFFFA);
+			DEBUG("CPU: serving NMI on NMI edge at PC $%04X" NL, CPU65.pc);
+#endif
+			DO_CPU65_EXECUTION_CALLBACK(cpu65_nmi_debug_callback);
+			CPU65.nmiEdge = 0;
+			pushWord(CPU65.pc);
+			push(cpu65_get_pf());	// no CPU65_PF_B is pushed!
+			CPU65.pf_i = 1;
+			CPU65.pf_d = 0;			// NOTE: D flag clearing was not done on the original 6502 I guess, but indeed on the 65C02 already
+			CPU65.pc = readWord(0xFFFA);
+			DO_CPU65_PROFILER_CALLBACK(cpu65_profiler_interrupt_callback);
 #ifdef CPU_STEP_MULTI_OPS
-		all_cycles += 7;
-		continue;
+			all_cycles += 7;
+			continue;
 #else
-		return 7;
+			return 7;
 #endif
-	}
-	if (XEMU_UNLIKELY(CPU65.irqLevel && (!CPU65.pf_i)
+		}
+		if (XEMU_UNLIKELY(CPU65.irqLevel && (!CPU65.pf_i)
 #ifdef CPU_65CE02
-		&& CPU65.op_cycles != 1 && !CPU65.cpu_inhibit_interrupts
+			&& CPU65.op_cycles != 1 && !CPU65.cpu_inhibit_interrupts
 #endif
 #ifdef MEGA65
-		&& !in_hypervisor && CPU65.prefix == PREFIX_NOTHING
+			&& !in_hypervisor && CPU65.prefix == PREFIX_NOTHING
 #endif
-	)) {
+		)) {
 #ifdef DEBUG_CPU
-		DEBUG("CPU: serving IRQ on IRQ level at PC $%04X" NL, CPU65.pc);
-#endif
-		DO_CPU65_EXECUTION_CALLBACK(cpu65_irq_debug_callback);
-		pushWord(CPU65.pc);
-		push(cpu65_get_pf());	// no CPU65_PF_B is pushed!
-		CPU65.pf_i = 1;
-		CPU65.pf_d = 0;
-		CPU65.pc = readWord(0xFFFE);
+			DEBUG("CPU: serving IRQ on IRQ level at PC $%04X" NL, CPU65.pc);
+#endif
+			DO_CPU65_EXECUTION_CALLBACK(cpu65_irq_debug_callback);
+			pushWord(CPU65.pc);
+			push(cpu65_get_pf());	// no CPU65_PF_B is pushed!
+			CPU65.pf_i = 1;
+			CPU65.pf_d = 0;
+			CPU65.pc = readWord(0xFFFE);
+			DO_CPU65_PROFILER_CALLBACK(cpu65_profiler_interrupt_callback);
 #ifdef CPU_STEP_MULTI_OPS
-		all_cycles += 7;
-		continue;
+			all_cycles += 7;
+			continue;
 #else
-		return 7;
+			return 7;
 #endif
+		}
 	}
 	CPU65.old_pc = CPU65.pc;
 #ifdef DEBUG_CPU
 	if (CPU65.pc == 0)
 		DEBUG("CPU: WARN: PC at zero!" NL);
+#endif
+#ifdef CPU65_PREDECODE_SUPPORT
+	const void *handler = NULL;
+	struct cpu65_predecode_block_st *const blk = cpu65_predecode_blocks[CPU65.pc >> 8];
+	if (XEMU_LIKELY(blk)) {
+		if (XEMU_UNLIKELY(blk->generation != cpu65_predecode_generation))
+			cpu65_predecode_invalidate_block(blk);
+		struct cpu65_predecoded_st *const e = blk->ops + (CPU65.pc & 0xFF);
+		if (XEMU_UNLIKELY(!e->handler) && blk->invalidations < CPU65_PREDECODE_MAX_INVALIDATIONS) {
+			e->op = readByte(CPU65.pc);
+			e->handler = opcode_labels[e->op];
+			if (!blk->decoded++)
+				cpu65_predecode_block_activated(blk);
+		}
+		handler = e->handler;
+		CPU65.op = e->op;
+	}
+	if (XEMU_UNLIKELY(!handler))
 #endif
 	CPU65.op = readByte(CPU65.pc);
 	DO_CPU65_EXECUTION_CALLBACK(cpu65_execution_debug_callback);
@@ -946,8 +1039,12 @@ int cpu65_step (
 	}
 #endif
 	CPU65.op_cycles = opcycles[CPU65.op];
+#ifdef CPU65_PREDECODE_SUPPORT
+	if (XEMU_LIKELY(handler))
+		goto *handler;
+#endif
 	switch (CPU65.op) {
-	case 0x00:	/* BRK Implied */
+	OPCODE(0x00):	/* BRK Implied */
 #ifdef DEBUG_CPU
 			DEBUG("CPU: WARN: BRK is about executing at PC=$%04X" NL, (CPU65.pc - 1) & 0xFFFF);
 #ifdef MEGA65
@@ -960,10 +1057,10 @@ int cpu65_step (
 			CPU65.pf_i = 1;
 			CPU65.pc = readWord(0xFFFE);
 			break;
-	case 0x01:	/* ORA (Zero_Page,X) */
+	OPCODE(0x01):	/* ORA (Zero_Page,X) */
 			SET_NZ(A_OP(|,readByte(_zpxi())));
 			break;
-	case 0x02:	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: CLE
+	OPCODE(0x02):	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: CLE
 			   NMOS: KIL */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
@@ -977,7 +1074,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x03:	/* $03 65C02: NOP (nonstd loc, implied), 65CE02: SEE
+	OPCODE(0x03):	/* $03 65C02: NOP (nonstd loc, implied), 65CE02: SEE
 			   NMOS: SLO ($00,X) -> TODO */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
@@ -986,10 +1083,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x04:	/* TSB Zero_Page */
+	OPCODE(0x04):	/* TSB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else { _TSB(_zp()); }
 			break;
-	case 0x05:	/* ORA Zero_Page */
+	OPCODE(0x05):	/* ORA Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ORQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_05_CYCLES;
@@ -999,7 +1096,7 @@ int cpu65_step (
 #endif
 			SET_NZ(A_OP(|,readByte(_zp())));
 			break;
-	case 0x06:	/* ASL Zero_Page */
+	OPCODE(0x06):	/* ASL Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASLQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_06_CYCLES;
@@ -1009,19 +1106,19 @@ int cpu65_step (
 #endif
 			_ASL(_zp());
 			break;
-	case 0x07:	/* RMB Zero_Page */
+	OPCODE(0x07):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 254);
 			}
 			break;
-	case 0x08:	/* PHP Implied */
+	OPCODE(0x08):	/* PHP Implied */
 			push(cpu65_get_pf() | CPU65_PF_B);
 			break;
-	case 0x09:	/* ORA Immediate */
+	OPCODE(0x09):	/* ORA Immediate */
 			SET_NZ(A_OP(|,readByte(_imm())));
 			break;
-	case 0x0A:	/* ASL Accumulator */
+	OPCODE(0x0A):	/* ASL Accumulator */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASLQ (Q)
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_0A_CYCLES;
@@ -1031,7 +1128,7 @@ int cpu65_step (
 #endif
 			_ASL(-1);
 			break;
-	case 0x0B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: TSY */
+	OPCODE(0x0B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: TSY */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("TSY");
@@ -1039,12 +1136,12 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x0C:	/* TSB Absolute */
+	OPCODE(0x0C):	/* TSB Absolute */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_TSB(_abs());
 			}
 			break;
-	case 0x0D:	/* ORA Absolute */
+	OPCODE(0x0D):	/* ORA Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ORQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_0D_CYCLES;
@@ -1054,7 +1151,7 @@ int cpu65_step (
 #endif
 			SET_NZ(A_OP(|,readByte(_abs())));
 			break;
-	case 0x0E:	/* ASL Absolute */
+	OPCODE(0x0E):	/* ASL Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASLQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_0E_CYCLES;
@@ -1064,22 +1161,22 @@ int cpu65_step (
 #endif
 			_ASL(_abs());
 			break;
-	case 0x0F:	/* BBR Relative */
+	OPCODE(0x0F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 1), 1);
 			}
 			break;
-	case 0x10:	/* BPL Relative */
+	OPCODE(0x10):	/* BPL Relative */
 #ifdef CPU65_DISCRETE_PF_NZ
 			_BRA(! CPU65.pf_n, BRANCH8_COST);
 #else
 			_BRA(!(CPU65.pf_nz & CPU65_PF_N), BRANCH8_COST);
 #endif
 			break;
-	case 0x11:	/* ORA (Zero_Page),Y */
+	OPCODE(0x11):	/* ORA (Zero_Page),Y */
 			SET_NZ(A_OP(|,readByte(_zpiy())));
 			break;
-	case 0x12:	/* ORA (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0x12):	/* ORA (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -1104,7 +1201,7 @@ int cpu65_step (
 			SET_NZ(A_OP(|,readByte(_zpi())));
 			}
 			break;
-	case 0x13:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BPL 16 bit relative */
+	OPCODE(0x13):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BPL 16 bit relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BPL16");
@@ -1116,15 +1213,15 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x14:	/* TRB Zero_Page */
+	OPCODE(0x14):	/* TRB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_TRB(_zp());
 			}
 			break;
-	case 0x15:	/* ORA Zero_Page,X */
+	OPCODE(0x15):	/* ORA Zero_Page,X */
 			SET_NZ(A_OP(|,readByte(_zpx())));
 			break;
-	case 0x16:	/* ASL Zero_Page,X */
+	OPCODE(0x16):	/* ASL Zero_Page,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASLQ $nn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_16_CYCLES;
@@ -1134,18 +1231,18 @@ int cpu65_step (
 #endif
 			_ASL(_zpx());
 			break;
-	case 0x17:	/* RMB Zero_Page */
+	OPCODE(0x17):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp(); writeByte(a, readByte(a) & 253);
 			}
 			break;
-	case 0x18:	/* CLC Implied */
+	OPCODE(0x18):	/* CLC Implied */
 			CPU65.pf_c = 0;
 			break;
-	case 0x19:	/* ORA Absolute,Y */
+	OPCODE(0x19):	/* ORA Absolute,Y */
 			SET_NZ(A_OP(|,readByte(_absy())));
 			break;
-	case 0x1A:	/* INA Accumulator */
+	OPCODE(0x1A):	/* INA Accumulator */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 				if (IS_NEG_NEG_OP()) {	// MEGA65-QOP: INQ (Q)
@@ -1157,7 +1254,7 @@ int cpu65_step (
 				SET_NZ(++CPU65.a);
 			}
 			break;
-	case 0x1B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: INZ */
+	OPCODE(0x1B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: INZ */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("INZ");
@@ -1165,15 +1262,15 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x1C:	/* TRB Absolute */
+	OPCODE(0x1C):	/* TRB Absolute */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_TRB(_abs());
 			}
 			break;
-	case 0x1D:	/* ORA Absolute,X */
+	OPCODE(0x1D):	/* ORA Absolute,X */
 			SET_NZ(A_OP(|,readByte(_absx())));
 			break;
-	case 0x1E:	/* ASL Absolute,X */
+	OPCODE(0x1E):	/* ASL Absolute,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASLQ $nnnn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_1E_CYCLES;
@@ -1183,19 +1280,19 @@ int cpu65_step (
 #endif
 			_ASL(_absx());
 			break;
-	case 0x1F:	/* BBR Relative */
+	OPCODE(0x1F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 2), 1);
 			}
 			break;
-	case 0x20:	/* JSR Absolute */
+	OPCODE(0x20):	/* JSR Absolute */
 			pushWord(CPU65.pc + 1);
 			CPU65.pc = _abs();
 			break;
-	case 0x21:	/* AND (Zero_Page,X) */
+	OPCODE(0x21):	/* AND (Zero_Page,X) */
 			SET_NZ(A_OP(&,readByte(_zpxi())));
 			break;
-	case 0x22:	/* 65C02 NOP imm (non-std NOP with addr mode), 65CE02: JSR (nnnn) */
+	OPCODE(0x22):	/* 65C02 NOP imm (non-std NOP with addr mode), 65CE02: JSR (nnnn) */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("JSR (nnnn)");
@@ -1207,7 +1304,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x23:	/* 65C02 NOP (nonstd loc, implied), 65CE02: JSR (nnnn,X) */
+	OPCODE(0x23):	/* 65C02 NOP (nonstd loc, implied), 65CE02: JSR (nnnn,X) */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("JSR (nnnn,X)");
@@ -1216,7 +1313,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x24:	/* BIT Zero_Page */
+	OPCODE(0x24):	/* BIT Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: BITQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_24_CYCLES;
@@ -1226,7 +1323,7 @@ int cpu65_step (
 #endif
 			_BIT(readByte(_zp()));
 			break;
-	case 0x25:	/* AND Zero_Page */
+	OPCODE(0x25):	/* AND Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ANDQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_25_CYCLES;
@@ -1236,7 +1333,7 @@ int cpu65_step (
 #endif
 			SET_NZ(A_OP(&,readByte(_zp())));
 			break;
-	case 0x26:	/* ROL Zero_Page */
+	OPCODE(0x26):	/* ROL Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ROLQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_26_CYCLES;
@@ -1246,19 +1343,19 @@ int cpu65_step (
 #endif
 			_ROL(_zp());
 			break;
-	case 0x27:	/* RMB Zero_Page */
+	OPCODE(0x27):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 251);
 			}
 			break;
-	case 0x28:	/* PLP Implied */
+	OPCODE(0x28):	/* PLP Implied */
 			cpu65_set_pf(pop());
 			break;
-	case 0x29:	/* AND Immediate */
+	OPCODE(0x29):	/* AND Immediate */
 			SET_NZ(A_OP(&,readByte(_imm())));
 			break;
-	case 0x2A:	/* ROL Accumulator */
+	OPCODE(0x2A):	/* ROL Accumulator */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ROLQ (Q)
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_2A_CYCLES;
@@ -1268,7 +1365,7 @@ int cpu65_step (
 #endif
 			_ROL(-1);
 			break;
-	case 0x2B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: TYS */
+	OPCODE(0x2B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: TYS */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("TYS");
@@ -1280,7 +1377,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x2C:	/* BIT Absolute */
+	OPCODE(0x2C):	/* BIT Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: BITQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_2C_CYCLES;
@@ -1290,7 +1387,7 @@ int cpu65_step (
 #endif
 			_BIT(readByte(_abs()));
 			break;
-	case 0x2D:	/* AND Absolute */
+	OPCODE(0x2D):	/* AND Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ANDQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_2D_CYCLES;
@@ -1300,7 +1397,7 @@ int cpu65_step (
 #endif
 			SET_NZ(A_OP(&,readByte(_abs())));
 			break;
-	case 0x2E:	/* ROL Absolute */
+	OPCODE(0x2E):	/* ROL Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ROLQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_2E_CYCLES;
@@ -1310,22 +1407,22 @@ int cpu65_step (
 #endif
 			_ROL(_abs());
 			break;
-	case 0x2F:	/* BBR Relative */
+	OPCODE(0x2F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 4), 1);
 			}
 			break;
-	case 0x30:	/* BMI Relative */
+	OPCODE(0x30):	/* BMI Relative */
 #ifdef CPU65_DISCRETE_PF_NZ
 			_BRA(CPU65.pf_n, BRANCH8_COST);
 #else
 			_BRA(CPU65.pf_nz & CPU65_PF_N, BRANCH8_COST);
 #endif
 			break;
-	case 0x31:	/* AND (Zero_Page),Y */
+	OPCODE(0x31):	/* AND (Zero_Page),Y */
 			SET_NZ(A_OP(&,readByte(_zpiy())));
 			break;
-	case 0x32:	/* 65C02: AND (Zero_Page), 65CE02: AND (ZP),Z */
+	OPCODE(0x32):	/* 65C02: AND (Zero_Page), 65CE02: AND (ZP),Z */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -1350,7 +1447,7 @@ int cpu65_step (
 			SET_NZ(A_OP(&,readByte(_zpi())));
 			}
 			break;
-	case 0x33:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BMI 16-bit relative */
+	OPCODE(0x33):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BMI 16-bit relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BMI16");
@@ -1362,15 +1459,15 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x34:	/* BIT Zero_Page,X */
+	OPCODE(0x34):	/* BIT Zero_Page,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BIT(readByte(_zpx()));
 			}
 			break;
-	case 0x35:	/* AND Zero_Page,X */
+	OPCODE(0x35):	/* AND Zero_Page,X */
 			SET_NZ(A_OP(&,readByte(_zpx())));
 			break;
-	case 0x36:	/* ROL Zero_Page,X */
+	OPCODE(0x36):	/* ROL Zero_Page,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ROLQ $nn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_36_CYCLES;
@@ -1380,19 +1477,19 @@ int cpu65_step (
 #endif
 			_ROL(_zpx());
 			break;
-	case 0x37:	/* RMB Zero_Page */
+	OPCODE(0x37):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 247);
 			}
 			break;
-	case 0x38:	/* SEC Implied */
+	OPCODE(0x38):	/* SEC Implied */
 			CPU65.pf_c = 1;
 			break;
-	case 0x39:	/* AND Absolute,Y */
+	OPCODE(0x39):	/* AND Absolute,Y */
 			SET_NZ(A_OP(&,readByte(_absy())));
 			break;
-	case 0x3A:	/* DEA Accumulator */
+	OPCODE(0x3A):	/* DEA Accumulator */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 				if (IS_NEG_NEG_OP()) {	// MEGA65-QOP: DEQ (Q)
@@ -1404,7 +1501,7 @@ int cpu65_step (
 				SET_NZ(--CPU65.a);
 			}
 			break;
-	case 0x3B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: DEZ */
+	OPCODE(0x3B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: DEZ */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("DEZ");
@@ -1412,15 +1509,15 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x3C:	/* BIT Absolute,X */
+	OPCODE(0x3C):	/* BIT Absolute,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BIT(readByte(_absx()));
 			}
 			break;
-	case 0x3D:	/* AND Absolute,X */
+	OPCODE(0x3D):	/* AND Absolute,X */
 			SET_NZ(A_OP(&,readByte(_absx())));
 			break;
-	case 0x3E:	/* ROL Absolute,X */
+	OPCODE(0x3E):	/* ROL Absolute,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ROLQ $nnnn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_3E_CYCLES;
@@ -1430,19 +1527,19 @@ int cpu65_step (
 #endif
 			_ROL(_absx());
 			break;
-	case 0x3F:	/* BBR Relative */
+	OPCODE(0x3F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 8), 1);
 			}
 			break;
-	case 0x40:	/* RTI Implied */
+	OPCODE(0x40):	/* RTI Implied */
 			cpu65_set_pf(pop());
 			CPU65.pc = popWord();
 			break;
-	case 0x41:	/* EOR (Zero_Page,X) */
+	OPCODE(0x41):	/* EOR (Zero_Page,X) */
 			SET_NZ(A_OP(^,readByte(_zpxi())));
 			break;
-	case 0x42:	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: NEG */
+	OPCODE(0x42):	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: NEG */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			/* NEG on 65CE02/4510 and MEGA65 as well, of course */
@@ -1473,7 +1570,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x43:	/* 65C02: NOP (nonstd loc, implied), 65CE02: ASR A */
+	OPCODE(0x43):	/* 65C02: NOP (nonstd loc, implied), 65CE02: ASR A */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASRQ (Q)
@@ -1491,7 +1588,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x44:	/* 65C02: NOP zp (non-std NOP with addr mode), 65CE02: ASR $nn */
+	OPCODE(0x44):	/* 65C02: NOP zp (non-std NOP with addr mode), 65CE02: ASR $nn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASRQ $nn
@@ -1508,7 +1605,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x45:	/* EOR Zero_Page */
+	OPCODE(0x45):	/* EOR Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {			// MEGA65-QOP: EORQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_45_CYCLES;
@@ -1518,7 +1615,7 @@ int cpu65_step (
 #endif
 			SET_NZ(A_OP(^,readByte(_zp())));
 			break;
-	case 0x46:	/* LSR Zero_Page */
+	OPCODE(0x46):	/* LSR Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LSRQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_46_CYCLES;
@@ -1528,19 +1625,19 @@ int cpu65_step (
 #endif
 			_LSR(_zp());
 			break;
-	case 0x47:	/* RMB Zero_Page */
+	OPCODE(0x47):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 239);
 			}
 			break;
-	case 0x48:	/* PHA Implied */
+	OPCODE(0x48):	/* PHA Implied */
 			push(CPU65.a);
 			break;
-	case 0x49:	/* EOR Immediate */
+	OPCODE(0x49):	/* EOR Immediate */
 			SET_NZ(A_OP(^,readByte(_imm())));
 			break;
-	case 0x4A:	/* LSR Accumulator */
+	OPCODE(0x4A):	/* LSR Accumulator */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LSRQ (Q)
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_4A_CYCLES;
@@ -1550,7 +1647,7 @@ int cpu65_step (
 #endif
 			_LSR(-1);
 			break;
-	case 0x4B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: TAZ */
+	OPCODE(0x4B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: TAZ */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("TAZ");
@@ -1558,10 +1655,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x4C:	/* JMP Absolute */
+	OPCODE(0x4C):	/* JMP Absolute */
 			CPU65.pc = _abs();
 			break;
-	case 0x4D:	/* EOR Absolute */
+	OPCODE(0x4D):	/* EOR Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {			// MEGA65-QOP: EORQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_4D_CYCLES;
@@ -1571,7 +1668,7 @@ int cpu65_step (
 #endif
 			SET_NZ(A_OP(^,readByte(_abs())));
 			break;
-	case 0x4E:	/* LSR Absolute */
+	OPCODE(0x4E):	/* LSR Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LSRQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_4E_CYCLES;
@@ -1581,18 +1678,18 @@ int cpu65_step (
 #endif
 			_LSR(_abs());
 			break;
-	case 0x4F:	/* BBR Relative */
+	OPCODE(0x4F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 16), 1);
 			}
 			break;
-	case 0x50:	/* BVC Relative */
+	OPCODE(0x50):	/* BVC Relative */
 			_BRA(!CPU65.pf_v, BRANCH8_COST);
 			break;
-	case 0x51:	/* EOR (Zero_Page),Y */
+	OPCODE(0x51):	/* EOR (Zero_Page),Y */
 			SET_NZ(A_OP(^,readByte(_zpiy())));
 			break;
-	case 0x52:	/* EOR (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0x52):	/* EOR (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -1617,7 +1714,7 @@ int cpu65_step (
 			SET_NZ(A_OP(^,readByte(_zpi())));
 			}
 			break;
-	case 0x53:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BVC 16-bit-relative */
+	OPCODE(0x53):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BVC 16-bit-relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BVC16");
@@ -1625,7 +1722,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x54:	/* 65C02: NOP zpx (non-std NOP with addr mode), 65CE02: ASR $nn,X */
+	OPCODE(0x54):	/* 65C02: NOP zpx (non-std NOP with addr mode), 65CE02: ASR $nn,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: ASRQ $nn,X
@@ -1642,10 +1739,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x55:	/* EOR Zero_Page,X */
+	OPCODE(0x55):	/* EOR Zero_Page,X */
 			SET_NZ(A_OP(^,readByte(_zpx())));
 			break;
-	case 0x56:	/* LSR Zero_Page,X */
+	OPCODE(0x56):	/* LSR Zero_Page,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LSRQ $nn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_56_CYCLES;
@@ -1655,24 +1752,24 @@ int cpu65_step (
 #endif
 			_LSR(_zpx());
 			break;
-	case 0x57:	/* RMB Zero_Page */
+	OPCODE(0x57):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 223);
 			}
 			break;
-	case 0x58:	/* CLI Implied */
+	OPCODE(0x58):	/* CLI Implied */
 			CPU65.pf_i = 0;
 			break;
-	case 0x59:	/* EOR Absolute,Y */
+	OPCODE(0x59):	/* EOR Absolute,Y */
 			SET_NZ(A_OP(^,readByte(_absy())));
 			break;
-	case 0x5A:	/* PHY Implied */
+	OPCODE(0x5A):	/* PHY Implied */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			push(CPU65.y);
 			}
 			break;
-	case 0x5B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: TAB */
+	OPCODE(0x5B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: TAB */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("TAB");
@@ -1684,7 +1781,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x5C:	/* 65C02: NOP (nonstd loc, implied FIXME or absolute?!), 65CE02: AUG/MAP */
+	OPCODE(0x5C):	/* 65C02: NOP (nonstd loc, implied FIXME or absolute?!), 65CE02: AUG/MAP */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("MAP");
@@ -1694,10 +1791,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x5D:	/* EOR Absolute,X */
+	OPCODE(0x5D):	/* EOR Absolute,X */
 			SET_NZ(A_OP(^,readByte(_absx())));
 			break;
-	case 0x5E:	/* LSR Absolute,X */
+	OPCODE(0x5E):	/* LSR Absolute,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LSRQ $nnnn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_5E_CYCLES;
@@ -1707,18 +1804,18 @@ int cpu65_step (
 #endif
 			_LSR(_absx());
 			break;
-	case 0x5F:	/* BBR Relative */
+	OPCODE(0x5F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 32), 1);
 			}
 			break;
-	case 0x60:	/* RTS Implied */
+	OPCODE(0x60):	/* RTS Implied */
 			CPU65.pc = popWord() + 1;
 			break;
-	case 0x61:	/* ADC (Zero_Page,X) */
+	OPCODE(0x61):	/* ADC (Zero_Page,X) */
 			_ADC(readByte(_zpxi()));
 			break;
-	case 0x62:	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: RTS #$nn */
+	OPCODE(0x62):	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: RTS #$nn */
 			/* 65CE02 FIXME TODO : what this opcode does _exactly_? Guess: correcting stack pointer with a given value? Also some docs says it's RTN ... */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
@@ -1735,7 +1832,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x63:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BSR16 */
+	OPCODE(0x63):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BSR16 */
 			/* FIXME TODO: BSR $nnnn Interesting 65C02-only? does this opcode exist before 65CE02 as well?! */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
@@ -1746,12 +1843,12 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x64:	/* STZ Zero_Page */
+	OPCODE(0x64):	/* STZ Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			writeByte(_zp(), ZERO_REG);
 			}
 			break;
-	case 0x65:	/* ADC Zero_Page */
+	OPCODE(0x65):	/* ADC Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {			// MEGA65-QOP: ADCQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_65_CYCLES;
@@ -1761,7 +1858,7 @@ int cpu65_step (
 #endif
 			_ADC(readByte(_zp()));
 			break;
-	case 0x66:	/* ROR Zero_Page */
+	OPCODE(0x66):	/* ROR Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: RORQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_66_CYCLES;
@@ -1771,19 +1868,19 @@ int cpu65_step (
 #endif
 			_ROR(_zp());
 			break;
-	case 0x67:	/* RMB Zero_Page */
+	OPCODE(0x67):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 191);
 			}
 			break;
-	case 0x68:	/* PLA Implied */
+	OPCODE(0x68):	/* PLA Implied */
 			SET_NZ(CPU65.a = pop());
 			break;
-	case 0x69:	/* ADC Immediate */
+	OPCODE(0x69):	/* ADC Immediate */
 			_ADC(readByte(_imm()));
 			break;
-	case 0x6A:	/* ROR Accumulator */
+	OPCODE(0x6A):	/* ROR Accumulator */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: RORQ (Q)
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_6A_CYCLES;
@@ -1793,7 +1890,7 @@ int cpu65_step (
 #endif
 			_ROR(-1);
 			break;
-	case 0x6B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: TZA */
+	OPCODE(0x6B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: TZA */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("TZA");
@@ -1801,14 +1898,14 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x6C:	/* JMP (Absolute) */
+	OPCODE(0x6C):	/* JMP (Absolute) */
 			if (HAS_NMOS_BUG_JMP_INDIRECT) {
 				int t = _abs();
 				CPU65.pc = readByte(t) | (readByte((t & 0xFF00) | ((t + 1) & 0xFF)) << 8);
 			} else
 				CPU65.pc = _absi();
 			break;
-	case 0x6D:	/* ADC Absolute */
+	OPCODE(0x6D):	/* ADC Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {			// MEGA65-QOP: ADCQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_6D_CYCLES;
@@ -1818,7 +1915,7 @@ int cpu65_step (
 #endif
 			_ADC(readByte(_abs()));
 			break;
-	case 0x6E:	/* ROR Absolute */
+	OPCODE(0x6E):	/* ROR Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: RORQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_6E_CYCLES;
@@ -1828,18 +1925,18 @@ int cpu65_step (
 #endif
 			_ROR(_abs());
 			break;
-	case 0x6F:	/* BBR Relative */
+	OPCODE(0x6F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 64), 1);
 			}
 			break;
-	case 0x70:	/* BVS Relative */
+	OPCODE(0x70):	/* BVS Relative */
 			_BRA(CPU65.pf_v, BRANCH8_COST);
 			break;
-	case 0x71:	/* ADC (Zero_Page),Y */
+	OPCODE(0x71):	/* ADC (Zero_Page),Y */
 			_ADC(readByte(_zpiy()));
 			break;
-	case 0x72:	/* 0x72 ADC (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0x72):	/* 0x72 ADC (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -1864,7 +1961,7 @@ int cpu65_step (
 			_ADC(readByte(_zpi()));
 			}
 			break;
-	case 0x73:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BVS 16 bit relative */
+	OPCODE(0x73):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BVS 16 bit relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BVS16");
@@ -1872,15 +1969,15 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x74:	/* STZ Zero_Page,X */
+	OPCODE(0x74):	/* STZ Zero_Page,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			writeByte(_zpx(), ZERO_REG);
 			}
 			break;
-	case 0x75:	/* ADC Zero_Page,X */
+	OPCODE(0x75):	/* ADC Zero_Page,X */
 			_ADC(readByte(_zpx()));
 			break;
-	case 0x76:	/* ROR Zero_Page,X */
+	OPCODE(0x76):	/* ROR Zero_Page,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: RORQ $nn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_76_CYCLES;
@@ -1890,24 +1987,24 @@ int cpu65_step (
 #endif
 			_ROR(_zpx());
 			break;
-	case 0x77:	/* RMB Zero_Page */
+	OPCODE(0x77):	/* RMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) & 127);
 			}
 			break;
-	case 0x78:	/* SEI Implied */
+	OPCODE(0x78):	/* SEI Implied */
 			CPU65.pf_i = 1;
 			break;
-	case 0x79:	/* ADC Absolute,Y */
+	OPCODE(0x79):	/* ADC Absolute,Y */
 			_ADC(readByte(_absy()));
 			break;
-	case 0x7A:	/* PLY Implied */
+	OPCODE(0x7A):	/* PLY Implied */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			SET_NZ(CPU65.y = pop());
 			}
 			break;
-	case 0x7B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: TBA */
+	OPCODE(0x7B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: TBA */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("TBA");
@@ -1915,15 +2012,15 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x7C:	/* JMP (Absolute,X) */
+	OPCODE(0x7C):	/* JMP (Absolute,X) */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			CPU65.pc = _absxi();
 			}
 			break;
-	case 0x7D:	/* ADC Absolute,X */
+	OPCODE(0x7D):	/* ADC Absolute,X */
 			_ADC(readByte(_absx()));
 			break;
-	case 0x7E:	/* ROR Absolute,X */
+	OPCODE(0x7E):	/* ROR Absolute,X */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: RORQ $nnnn,X
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_7E_CYCLES;
@@ -1933,20 +2030,20 @@ int cpu65_step (
 #endif
 			_ROR(_absx());
 			break;
-	case 0x7F:	/* BBR Relative */
+	OPCODE(0x7F):	/* BBR Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(!(readByte(_zp()) & 128), 1);
 			}
 			break;
-	case 0x80:	/* BRA Relative */
+	OPCODE(0x80):	/* BRA Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA(1, 0);	// 0 = no extra cost, opcode always taken, opcode cycles tab should contain that!
 			}
 			break;
-	case 0x81:	/* STA (Zero_Page,X) */
+	OPCODE(0x81):	/* STA (Zero_Page,X) */
 			writeByte(_zpxi(), CPU65.a);
 			break;
-	case 0x82:	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: STA ($nn,SP),Y */
+	OPCODE(0x82):	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: STA ($nn,SP),Y */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("STA (nn,S),Y");
@@ -1956,7 +2053,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x83:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BRA $nnnn 16-bit-pc-rel? */
+	OPCODE(0x83):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BRA $nnnn 16-bit-pc-rel? */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BRA16");
@@ -1964,10 +2061,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x84:	/* STY Zero_Page */
+	OPCODE(0x84):	/* STY Zero_Page */
 			writeByte(_zp(), CPU65.y);
 			break;
-	case 0x85:	/* STA Zero_Page */
+	OPCODE(0x85):	/* STA Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: STQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_85_CYCLES;
@@ -1977,19 +2074,19 @@ int cpu65_step (
 #endif
 			writeByte(_zp(), CPU65.a);
 			break;
-	case 0x86:	/* STX Zero_Page */
+	OPCODE(0x86):	/* STX Zero_Page */
 			writeByte(_zp(), CPU65.x);
 			break;
-	case 0x87:	/* SMB Zero_Page */
+	OPCODE(0x87):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 1);
 			}
 			break;
-	case 0x88:	/* DEY Implied */
+	OPCODE(0x88):	/* DEY Implied */
 			SET_NZ(--CPU65.y);
 			break;
-	case 0x89:	/* BIT+ Immediate */
+	OPCODE(0x89):	/* BIT+ Immediate */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			// Note: For the CPU65 emulator I used (maybe old) datasheet on 65C02, which all stated
 			// that BIT #immed is special, and only the Z flag is affected, unlike other BIT
@@ -2008,10 +2105,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x8A:	/* TXA Implied */
+	OPCODE(0x8A):	/* TXA Implied */
 			SET_NZ(CPU65.a = CPU65.x);
 			break;
-	case 0x8B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: STY $nnnn,X */
+	OPCODE(0x8B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: STY $nnnn,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("STY nnnn,X");
@@ -2019,10 +2116,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x8C:	/* STY Absolute */
+	OPCODE(0x8C):	/* STY Absolute */
 			writeByte(_abs(), CPU65.y);
 			break;
-	case 0x8D:	/* STA Absolute */
+	OPCODE(0x8D):	/* STA Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: STQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_8D_CYCLES;
@@ -2032,21 +2129,21 @@ int cpu65_step (
 #endif
 			writeByte(_abs(), CPU65.a);
 			break;
-	case 0x8E:	/* STX Absolute */
+	OPCODE(0x8E):	/* STX Absolute */
 			writeByte(_abs(), CPU65.x);
 			break;
-	case 0x8F:	/* BBS Relative */
+	OPCODE(0x8F):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 1, 1 );
 			}
 			break;
-	case 0x90:	/* BCC Relative */
+	OPCODE(0x90):	/* BCC Relative */
 			_BRA(!CPU65.pf_c, BRANCH8_COST);
 			break;
-	case 0x91:	/* STA (Zero_Page),Y */
+	OPCODE(0x91):	/* STA (Zero_Page),Y */
 			writeByte(_zpiy(), CPU65.a);
 			break;
-	case 0x92:	/* STA (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0x92):	/* STA (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -2071,7 +2168,7 @@ int cpu65_step (
 			writeByte(_zpi(), CPU65.a);
 			}
 			break;
-	case 0x93:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BCC $nnnn */
+	OPCODE(0x93):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BCC $nnnn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BCC16");
@@ -2079,31 +2176,31 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x94:	/* STY Zero_Page,X */
+	OPCODE(0x94):	/* STY Zero_Page,X */
 			writeByte(_zpx(), CPU65.y);
 			break;
-	case 0x95:	/* STA Zero_Page,X */
+	OPCODE(0x95):	/* STA Zero_Page,X */
 			writeByte(_zpx(), CPU65.a);
 			break;
-	case 0x96:	/* STX Zero_Page,Y */
+	OPCODE(0x96):	/* STX Zero_Page,Y */
 			writeByte(_zpy(), CPU65.x);
 			break;
-	case 0x97:	/* SMB Zero_Page */
+	OPCODE(0x97):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 2);
 			}
 			break;
-	case 0x98:	/* TYA Implied */
+	OPCODE(0x98):	/* TYA Implied */
 			SET_NZ(CPU65.a = CPU65.y);
 			break;
-	case 0x99:	/* STA Absolute,Y */
+	OPCODE(0x99):	/* STA Absolute,Y */
 			writeByte(_absy(), CPU65.a);
 			break;
-	case 0x9A:	/* TXS Implied */
+	OPCODE(0x9A):	/* TXS Implied */
 			CPU65.s = CPU65.x;
 			break;
-	case 0x9B:	/* 65C02: NOP (nonstd loc, implied), 65CE02: STX $nnnn,Y */
+	OPCODE(0x9B):	/* 65C02: NOP (nonstd loc, implied), 65CE02: STX $nnnn,Y */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("STX nnnn,Y");
@@ -2111,34 +2208,34 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0x9C:	/* STZ Absolute */
+	OPCODE(0x9C):	/* STZ Absolute */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			writeByte(_abs(), ZERO_REG);
 			}
 			break;
-	case 0x9D:	/* STA Absolute,X */
+	OPCODE(0x9D):	/* STA Absolute,X */
 			writeByte(_absx(), CPU65.a);
 			break;
-	case 0x9E:	/* STZ Absolute,X */
+	OPCODE(0x9E):	/* STZ Absolute,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			writeByte(_absx(), ZERO_REG);
 			}
 			break;
-	case 0x9F:	/* BBS Relative */
+	OPCODE(0x9F):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 2, 1 );
 			}
 			break;
-	case 0xA0:	/* LDY Immediate */
+	OPCODE(0xA0):	/* LDY Immediate */
 			SET_NZ(CPU65.y = readByte(_imm()));
 			break;
-	case 0xA1:	/* LDA (Zero_Page,X) */
+	OPCODE(0xA1):	/* LDA (Zero_Page,X) */
 			SET_NZ(CPU65.a = readByte(_zpxi()));
 			break;
-	case 0xA2:	/* LDX Immediate */
+	OPCODE(0xA2):	/* LDX Immediate */
 			SET_NZ(CPU65.x = readByte(_imm()));
 			break;
-	case 0xA3:	/* 65C02: NOP (nonstd loc, implied), 65CE02: LDZ #$nn */
+	OPCODE(0xA3):	/* 65C02: NOP (nonstd loc, implied), 65CE02: LDZ #$nn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("LDZ #nn");
@@ -2146,10 +2243,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xA4:	/* LDY Zero_Page */
+	OPCODE(0xA4):	/* LDY Zero_Page */
 			SET_NZ(CPU65.y = readByte(_zp()));
 			break;
-	case 0xA5:	/* LDA Zero_Page */
+	OPCODE(0xA5):	/* LDA Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LDQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_A5_CYCLES;
@@ -2159,25 +2256,25 @@ int cpu65_step (
 #endif
 			SET_NZ(CPU65.a = readByte(_zp()));
 			break;
-	case 0xA6:	/* LDX Zero_Page */
+	OPCODE(0xA6):	/* LDX Zero_Page */
 			SET_NZ(CPU65.x = readByte(_zp()));
 			break;
-	case 0xA7:	/* SMB Zero_Page */
+	OPCODE(0xA7):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 4);
 			}
 			break;
-	case 0xA8:	/* TAY Implied */
+	OPCODE(0xA8):	/* TAY Implied */
 			SET_NZ(CPU65.y = CPU65.a);
 			break;
-	case 0xA9:	/* LDA Immediate */
+	OPCODE(0xA9):	/* LDA Immediate */
 			SET_NZ(CPU65.a = readByte(_imm()));
 			break;
-	case 0xAA:	/* TAX Implied */
+	OPCODE(0xAA):	/* TAX Implied */
 			SET_NZ(CPU65.x = CPU65.a);
 			break;
-	case 0xAB:	/* 65C02: NOP (nonstd loc, implied), 65CE02: LDZ $nnnn */
+	OPCODE(0xAB):	/* 65C02: NOP (nonstd loc, implied), 65CE02: LDZ $nnnn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("LDZ nnnn");
@@ -2185,10 +2282,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xAC:	/* LDY Absolute */
+	OPCODE(0xAC):	/* LDY Absolute */
 			SET_NZ(CPU65.y = readByte(_abs()));
 			break;
-	case 0xAD:	/* LDA Absolute */
+	OPCODE(0xAD):	/* LDA Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: LDQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_AD_CYCLES;
@@ -2198,21 +2295,21 @@ int cpu65_step (
 #endif
 			SET_NZ(CPU65.a = readByte(_abs()));
 			break;
-	case 0xAE:	/* LDX Absolute */
+	OPCODE(0xAE):	/* LDX Absolute */
 			SET_NZ(CPU65.x = readByte(_abs()));
 			break;
-	case 0xAF:	/* BSS Relative */
+	OPCODE(0xAF):	/* BSS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 4, 1 );
 			}
 			break;
-	case 0xB0:	/* BCS Relative */
+	OPCODE(0xB0):	/* BCS Relative */
 			_BRA(CPU65.pf_c, BRANCH8_COST);
 			break;
-	case 0xB1:	/* LDA (Zero_Page),Y */
+	OPCODE(0xB1):	/* LDA (Zero_Page),Y */
 			SET_NZ(CPU65.a = readByte(_zpiy()));
 			break;
-	case 0xB2:	/* LDA (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0xB2):	/* LDA (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -2237,7 +2334,7 @@ int cpu65_step (
 			SET_NZ(CPU65.a = readByte(_zpi()));
 			}
 			break;
-	case 0xB3:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BCS $nnnn */
+	OPCODE(0xB3):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BCS $nnnn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BCS16");
@@ -2245,31 +2342,31 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xB4:	/* LDY Zero_Page,X */
+	OPCODE(0xB4):	/* LDY Zero_Page,X */
 			SET_NZ(CPU65.y = readByte(_zpx()));
 			break;
-	case 0xB5:	/* LDA Zero_Page,X */
+	OPCODE(0xB5):	/* LDA Zero_Page,X */
 			SET_NZ(CPU65.a = readByte(_zpx()));
 			break;
-	case 0xB6:	/* LDX Zero_Page,Y */
+	OPCODE(0xB6):	/* LDX Zero_Page,Y */
 			SET_NZ(CPU65.x = readByte(_zpy()));
 			break;
-	case 0xB7:	/* SMB Zero_Page */
+	OPCODE(0xB7):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 8);
 			}
 			break;
-	case 0xB8:	/* CLV Implied */
+	OPCODE(0xB8):	/* CLV Implied */
 			CPU65.pf_v = 0;
 			break;
-	case 0xB9:	/* LDA Absolute,Y */
+	OPCODE(0xB9):	/* LDA Absolute,Y */
 			SET_NZ(CPU65.a = readByte(_absy()));
 			break;
-	case 0xBA:	/* TSX Implied */
+	OPCODE(0xBA):	/* TSX Implied */
 			SET_NZ(CPU65.x = CPU65.s);
 			break;
-	case 0xBB:	/* 65C02: NOP (nonstd loc, implied), 65CE02: LDZ $nnnn,X */
+	OPCODE(0xBB):	/* 65C02: NOP (nonstd loc, implied), 65CE02: LDZ $nnnn,X */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("LDZ nnnn,X");
@@ -2277,27 +2374,27 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xBC:	/* LDY Absolute,X */
+	OPCODE(0xBC):	/* LDY Absolute,X */
 			SET_NZ(CPU65.y = readByte(_absx()));
 			break;
-	case 0xBD:	/* LDA Absolute,X */
+	OPCODE(0xBD):	/* LDA Absolute,X */
 			SET_NZ(CPU65.a = readByte(_absx()));
 			break;
-	case 0xBE:	/* LDX Absolute,Y */
+	OPCODE(0xBE):	/* LDX Absolute,Y */
 			SET_NZ(CPU65.x = readByte(_absy()));
 			break;
-	case 0xBF:	/* BBS Relative */
+	OPCODE(0xBF):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 8, 1 );
 			}
 			break;
-	case 0xC0:	/* CPY Immediate */
+	OPCODE(0xC0):	/* CPY Immediate */
 			_CMP(CPU65.y, readByte(_imm()));
 			break;
-	case 0xC1:	/* CMP (Zero_Page,X) */
+	OPCODE(0xC1):	/* CMP (Zero_Page,X) */
 			_CMP(CPU65.a, readByte(_zpxi()));
 			break;
-	case 0xC2:	/* 65C02: imm (non-std NOP with addr mode), 65CE02: CPZ #$nn */
+	OPCODE(0xC2):	/* 65C02: imm (non-std NOP with addr mode), 65CE02: CPZ #$nn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("CPZ #nn");
@@ -2307,7 +2404,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xC3:	/* 65C02: NOP (nonstd loc, implied), 65CE02: DEW $nn */
+	OPCODE(0xC3):	/* 65C02: NOP (nonstd loc, implied), 65CE02: DEW $nn */
 			/* DEW $nn 65CE02  C3  Decrement Word (maybe an error in 64NET.OPC ...) ANOTHER FIXME: this is zero (errr, base ...) page!!! */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
@@ -2321,10 +2418,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xC4:	/* CPY Zero_Page */
+	OPCODE(0xC4):	/* CPY Zero_Page */
 			_CMP(CPU65.y, readByte(_zp()));
 			break;
-	case 0xC5:	/* CMP Zero_Page */
+	OPCODE(0xC5):	/* CMP Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: CPMQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_C5_CYCLES;
@@ -2334,7 +2431,7 @@ int cpu65_step (
 #endif
 			_CMP(CPU65.a, readByte(_zp()));
 			break;
-	case 0xC6:	/* DEC Zero_Page */
+	OPCODE(0xC6):	/* DEC Zero_Page */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: DEQ $nn
@@ -2349,22 +2446,22 @@ int cpu65_step (
 			writeByte(addr, data);
 			}
 			break;
-	case 0xC7:	/* SMB Zero_Page */
+	OPCODE(0xC7):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 16);
 			}
 			break;
-	case 0xC8:	/* INY Implied */
+	OPCODE(0xC8):	/* INY Implied */
 			SET_NZ(++CPU65.y);
 			break;
-	case 0xC9:	/* CMP Immediate */
+	OPCODE(0xC9):	/* CMP Immediate */
 			_CMP(CPU65.a, readByte(_imm()));
 			break;
-	case 0xCA:	/* DEX Implied */
+	OPCODE(0xCA):	/* DEX Implied */
 			SET_NZ(--CPU65.x);
 			break;
-	case 0xCB:	/* 65C02: NOP (nonstd loc, implied), 65CE02: ASW $nnnn ("Arithmetic Shift Left Word") */
+	OPCODE(0xCB):	/* 65C02: NOP (nonstd loc, implied), 65CE02: ASW $nnnn ("Arithmetic Shift Left Word") */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("ASW nnnn");
@@ -2378,10 +2475,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xCC:	/* CPY Absolute */
+	OPCODE(0xCC):	/* CPY Absolute */
 			_CMP(CPU65.y, readByte(_abs()));
 			break;
-	case 0xCD:	/* CMP Absolute */
+	OPCODE(0xCD):	/* CMP Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: CPMQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_CD_CYCLES;
@@ -2391,7 +2488,7 @@ int cpu65_step (
 #endif
 			_CMP(CPU65.a, readByte(_abs()));
 			break;
-	case 0xCE:	/* DEC Absolute */
+	OPCODE(0xCE):	/* DEC Absolute */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: DEQ $nnnn
@@ -2407,22 +2504,22 @@ int cpu65_step (
 			writeByteTwice(addr, old_data, new_data);
 			}
 			break;
-	case 0xCF:	/* BBS Relative */
+	OPCODE(0xCF):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 16, 1 );
 			}
 			break;
-	case 0xD0:	/* BNE Relative */
+	OPCODE(0xD0):	/* BNE Relative */
 #ifdef CPU65_DISCRETE_PF_NZ
 			_BRA( !CPU65.pf_z, BRANCH8_COST);
 #else
 			_BRA(!(CPU65.pf_nz & CPU65_PF_Z), BRANCH8_COST);
 #endif
 			break;
-	case 0xD1:	/* CMP (Zero_Page),Y */
+	OPCODE(0xD1):	/* CMP (Zero_Page),Y */
 			_CMP(CPU65.a, readByte(_zpiy()));
 			break;
-	case 0xD2:	/* CMP (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0xD2):	/* CMP (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -2447,7 +2544,7 @@ int cpu65_step (
 			_CMP(CPU65.a, readByte(_zpi()));
 			}
 			break;
-	case 0xD3:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BNE16 */
+	OPCODE(0xD3):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BNE16 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BNE16");
@@ -2459,7 +2556,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xD4:	/* 65C02: NOP zpx (non-std NOP with addr mode), 65CE02: CPZ $nn */
+	OPCODE(0xD4):	/* 65C02: NOP zpx (non-std NOP with addr mode), 65CE02: CPZ $nn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("CPZ nn");
@@ -2469,10 +2566,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xD5:	/* CMP Zero_Page,X */
+	OPCODE(0xD5):	/* CMP Zero_Page,X */
 			 _CMP(CPU65.a, readByte(_zpx()));
 			break;
-	case 0xD6:	/* DEC Zero_Page,X */
+	OPCODE(0xD6):	/* DEC Zero_Page,X */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: DEQ $nn,X
@@ -2486,24 +2583,24 @@ int cpu65_step (
 			SET_NZ(data); writeByte(addr, data);
 			}
 			break;
-	case 0xD7:	/* SMB Zero_Page */
+	OPCODE(0xD7):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 32);
 			}
 			break;
-	case 0xD8:	/* CLD Implied */
+	OPCODE(0xD8):	/* CLD Implied */
 			CPU65.pf_d = 0;
 			break;
-	case 0xD9:	/* CMP Absolute,Y */
+	OPCODE(0xD9):	/* CMP Absolute,Y */
 			_CMP(CPU65.a, readByte(_absy()));
 			break;
-	case 0xDA:	/* PHX Implied */
+	OPCODE(0xDA):	/* PHX Implied */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			push(CPU65.x);
 			}
 			break;
-	case 0xDB:	/* 65C02: NOP (nonstd loc, implied), 65CE02: PHZ */
+	OPCODE(0xDB):	/* 65C02: NOP (nonstd loc, implied), 65CE02: PHZ */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("PHZ");
@@ -2511,7 +2608,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xDC:	/* 65C02: NOP (nonstd loc, implied) FIXME: bugfix NOP absolute!, 65CE02: CPZ $nnnn */
+	OPCODE(0xDC):	/* 65C02: NOP (nonstd loc, implied) FIXME: bugfix NOP absolute!, 65CE02: CPZ $nnnn */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("CPZ nnnn");
@@ -2521,10 +2618,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xDD:	/* CMP Absolute,X */
+	OPCODE(0xDD):	/* CMP Absolute,X */
 			_CMP(CPU65.a, readByte(_absx()));
 			break;
-	case 0xDE:	/* DEC Absolute,X */
+	OPCODE(0xDE):	/* DEC Absolute,X */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: DEQ $nnnn,X
@@ -2539,18 +2636,18 @@ int cpu65_step (
 			writeByte(addr, data);
 			}
 			break;
-	case 0xDF:	/* BBS Relative */
+	OPCODE(0xDF):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 32, 1 );
 			}
 			break;
-	case 0xE0:	/* CPX Immediate */
+	OPCODE(0xE0):	/* CPX Immediate */
 			_CMP(CPU65.x, readByte(_imm()));
 			break;
-	case 0xE1:	/* SBC (Zero_Page,X) */
+	OPCODE(0xE1):	/* SBC (Zero_Page,X) */
 			_SBC(readByte(_zpxi()));
 			break;
-	case 0xE2:	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: LDA (nn,S),Y */
+	OPCODE(0xE2):	/* 65C02: NOP imm (non-std NOP with addr mode), 65CE02: LDA (nn,S),Y */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("LDA (nn,S),Y");
@@ -2563,7 +2660,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xE3:	/* 65C02: NOP (nonstd loc, implied), 65CE02: Increment Word (maybe an error in 64NET.OPC ...) ANOTHER FIXME: this is zero (errr, base ...) page!!! */
+	OPCODE(0xE3):	/* 65C02: NOP (nonstd loc, implied), 65CE02: Increment Word (maybe an error in 64NET.OPC ...) ANOTHER FIXME: this is zero (errr, base ...) page!!! */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("INW nn");
@@ -2577,10 +2674,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xE4:	/* CPX Zero_Page */
+	OPCODE(0xE4):	/* CPX Zero_Page */
 			_CMP(CPU65.x, readByte(_zp()));
 			break;
-	case 0xE5:	/* SBC Zero_Page */
+	OPCODE(0xE5):	/* SBC Zero_Page */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: SBCQ $nn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_E5_CYCLES;
@@ -2590,7 +2687,7 @@ int cpu65_step (
 #endif
 			_SBC(readByte(_zp()));
 			break;
-	case 0xE6:	/* INC Zero_Page */
+	OPCODE(0xE6):	/* INC Zero_Page */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: INQ $nn
@@ -2605,19 +2702,19 @@ int cpu65_step (
 			writeByte(addr, data);
 			}
 			break;
-	case 0xE7:	/* SMB Zero_Page */
+	OPCODE(0xE7):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 64);
 			}
 			break;
-	case 0xE8:	/* INX Implied */
+	OPCODE(0xE8):	/* INX Implied */
 			SET_NZ(++CPU65.x);
 			break;
-	case 0xE9:	/* SBC Immediate */
+	OPCODE(0xE9):	/* SBC Immediate */
 			_SBC(readByte(_imm()));
 			break;
-	case 0xEA:	/* NOP, 65CE02: it's not special, but in C65 (4510) it is (EOM). It's up the emulator though (in the the second case) ... */
+	OPCODE(0xEA):	/* NOP, 65CE02: it's not special, but in C65 (4510) it is (EOM). It's up the emulator though (in the the second case) ... */
 #ifdef CPU_65CE02
 #ifdef MEGA65
 			if (XEMU_LIKELY(cpu_mega65_opcodes)) {
@@ -2637,7 +2734,7 @@ int cpu65_step (
 			cpu65_do_nop_callback();
 #endif
 			break;
-	case 0xEB:	/* 65C02: NOP (nonstd loc, implied), 65CE02: ROW $nnnn Rotate word LEFT?! [other documents says RIGHT!!! FIXME] */
+	OPCODE(0xEB):	/* 65C02: NOP (nonstd loc, implied), 65CE02: ROW $nnnn Rotate word LEFT?! [other documents says RIGHT!!! FIXME] */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("ROW nnnn");
@@ -2651,10 +2748,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xEC:	/* CPX Absolute */
+	OPCODE(0xEC):	/* CPX Absolute */
 			_CMP(CPU65.x, readByte(_abs()));
 			break;
-	case 0xED:	/* SBC Absolute */
+	OPCODE(0xED):	/* SBC Absolute */
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: SBCQ $nnnn
 				CPU65.op_cycles = MEGA_FOP_NEG_NEG_ED_CYCLES;
@@ -2664,7 +2761,7 @@ int cpu65_step (
 #endif
 			_SBC(readByte(_abs()));
 			break;
-	case 0xEE:	/* INC Absolute */
+	OPCODE(0xEE):	/* INC Absolute */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: INQ $nnnn
@@ -2680,22 +2777,22 @@ int cpu65_step (
 			writeByteTwice(addr, old_data, new_data);
 			}
 			break;
-	case 0xEF:	/* BBS Relative */
+	OPCODE(0xEF):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 64, 1 );
 			}
 			break;
-	case 0xF0:	/* BEQ Relative */
+	OPCODE(0xF0):	/* BEQ Relative */
 #ifdef CPU65_DISCRETE_PF_NZ
 			_BRA(CPU65.pf_z, BRANCH8_COST);
 #else
 			_BRA(CPU65.pf_nz & CPU65_PF_Z, BRANCH8_COST);
 #endif
 			break;
-	case 0xF1:	/* SBC (Zero_Page),Y */
+	OPCODE(0xF1):	/* SBC (Zero_Page),Y */
 			_SBC(readByte(_zpiy()));
 			break;
-	case 0xF2:	/* SBC (Zero_Page) or (ZP),Z on 65CE02 */
+	OPCODE(0xF2):	/* SBC (Zero_Page) or (ZP),Z on 65CE02 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef MEGA65
 			if (XEMU_UNLIKELY(CPU65.prefix != PREFIX_NOTHING)) {
@@ -2720,7 +2817,7 @@ int cpu65_step (
 			_SBC(readByte(_zpi()));
 			}
 			break;
-	case 0xF3:	/* 65C02: NOP (nonstd loc, implied), 65CE02: BEQ16 */
+	OPCODE(0xF3):	/* 65C02: NOP (nonstd loc, implied), 65CE02: BEQ16 */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("BEQ16");
@@ -2732,7 +2829,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xF4:	/* 65C02: NOP zpx (non-std NOP with addr mode), 65CE02: PHW #$nnnn (push word) */
+	OPCODE(0xF4):	/* 65C02: NOP zpx (non-std NOP with addr mode), 65CE02: PHW #$nnnn (push word) */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("PHW #nnnn");
@@ -2743,10 +2840,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xF5:	/* SBC Zero_Page,X */
+	OPCODE(0xF5):	/* SBC Zero_Page,X */
 			_SBC(readByte(_zpx()));
 			break;
-	case 0xF6:	/* INC Zero_Page,X */
+	OPCODE(0xF6):	/* INC Zero_Page,X */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: INQ $nn,X
@@ -2761,24 +2858,24 @@ int cpu65_step (
 			writeByte(addr, data);
 			}
 			break;
-	case 0xF7:	/* SMB Zero_Page */
+	OPCODE(0xF7):	/* SMB Zero_Page */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			int a = _zp();
 			writeByte(a, readByte(a) | 128);
 			}
 			break;
-	case 0xF8:	/* SED Implied */
+	OPCODE(0xF8):	/* SED Implied */
 			CPU65.pf_d = 1;
 			break;
-	case 0xF9:	/* SBC Absolute,Y */
+	OPCODE(0xF9):	/* SBC Absolute,Y */
 			_SBC(readByte(_absy()));
 			break;
-	case 0xFA:	/* PLX Implied */
+	OPCODE(0xFA):	/* PLX Implied */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			SET_NZ(CPU65.x = pop());
 			}
 			break;
-	case 0xFB:	/* 65C02: NOP (nonstd loc, implied), 65CE02: PLZ */
+	OPCODE(0xFB):	/* 65C02: NOP (nonstd loc, implied), 65CE02: PLZ */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
 			OPC_65CE02("PLZ");
@@ -2786,7 +2883,7 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xFC:	/* 65C02: NOP (nonstd loc, implied) FIXME: bugfix NOP absolute?
+	OPCODE(0xFC):	/* 65C02: NOP (nonstd loc, implied) FIXME: bugfix NOP absolute?
 			   65CE02: PHW $nnnn [? push word from an absolute address, maybe?] Note: C65 BASIC depends on this opcode to be correct! */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 #ifdef CPU_65CE02
@@ -2798,10 +2895,10 @@ int cpu65_step (
 #endif
 			}
 			break;
-	case 0xFD:	/* SBC Absolute,X */
+	OPCODE(0xFD):	/* SBC Absolute,X */
 			_SBC(readByte(_absx()));
 			break;
-	case 0xFE:	/* INC Absolute,X */
+	OPCODE(0xFE):	/* INC Absolute,X */
 			{
 #ifdef MEGA65
 			if (IS_NEG_NEG_OP()) {		// MEGA65-QOP: INQ $nnnn,X
@@ -2816,7 +2913,7 @@ int cpu65_step (
 			writeByte(addr, data);
 			}
 			break;
-	case 0xFF:	/* BBS Relative */
+	OPCODE(0xFF):	/* BBS Relative */
 			if (IS_CPU_NMOS) { NMOS_JAM_OPCODE(); } else {
 			_BRA( readByte(_zp()) & 128, 1 );
 			}
@@ -2830,6 +2927,7 @@ int cpu65_step (
 	CPU65.prefix = PREFIX_NOTHING;
 do_not_clear_prefix:
 #endif
+	DO_CPU65_PROFILER_CALLBACK(cpu65_profiler_opcode_callback);
 #ifdef CPU_STEP_MULTI_OPS
 	all_cycles += CPU65.op_cycles;
 	if (XEMU_UNLIKELY(CPU65.multi_step_stop_trigger)) {
@@ -2894,6 +2992,9 @@ int cpu65_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, s
 	CPU65.bphi = (Uint16)buffer[65] << 8;
 	CPU65.sphi = (Uint16)buffer[66] << 8;
 	CPU65.cpu_inhibit_interrupts = (int)P_AS_BE32(buffer + 96);
+#endif
+#ifdef MEGA65
+	CPU65.prefix = (int)P_AS_BE32(buffer + 100);
 #endif
 	return 0;
 }
@@ -2921,6 +3022,9 @@ int cpu65_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
 	buffer[65] = CPU65.bphi >> 8;
 	buffer[66] = CPU65.sphi >> 8;
 	U32_AS_BE(buffer + 96, (Uint32)CPU65.cpu_inhibit_interrupts);
+#endif
+#ifdef MEGA65
+	U32_AS_BE(buffer + 100, (Uint32)CPU65.prefix);
 #endif
 	return xemusnap_write_sub_block(buffer, sizeof buffer);
 }
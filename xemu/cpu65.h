@@ -124,6 +124,39 @@ extern int  cpu65_step  (
 #endif
 );
 
+#ifdef CPU65_PROFILER_SUPPORT
+// These must be provided by the target emulator, they are called only if cpu65_profiler_enabled is true:
+// the opcode callback after executing an opcode at CPU65.old_pc, the interrupt one after accepting an IRQ/NMI
+extern bool cpu65_profiler_enabled;
+extern void cpu65_profiler_opcode_callback ( void );
+extern void cpu65_profiler_interrupt_callback ( void );
+#endif
+
+#ifdef CPU65_PREDECODE_SUPPORT
+// Predecoded opcode cache: the target maps 256 byte pages of its memory to these blocks, per CPU address page in
+// cpu65_predecode_blocks[] (NULL: not cacheable, eg I/O). An opcode once fetched from a page is not read and
+// decoded again, but cpu65_step() jumps to its emulation directly (computed goto) till the block is invalidated.
+// Cycle counts are still taken from the current timing table when the opcode is executed.
+struct cpu65_predecoded_st {
+	const void *handler;		// label of the opcode emulation in cpu65_step(), NULL: not decoded (yet)
+	Uint8 op;
+};
+struct cpu65_predecode_block_st {
+	Uint32 generation;		// the block is valid only if it matches with cpu65_predecode_generation, see cpu65_predecode_flush()
+	int decoded;			// number of decoded opcodes, while non-zero, the target must call cpu65_predecode_invalidate_block() on writes
+	int invalidations;		// number of invalidations caused by writes, to give up caching pages with self-modifying code
+	Uint32 addr;			// not used by the CPU emulator, the target can use it for the address of the page
+	struct cpu65_predecoded_st ops[0x100];
+};
+#define CPU65_PREDECODE_MAX_INVALIDATIONS 16
+extern struct cpu65_predecode_block_st *cpu65_predecode_blocks[0x100];
+extern Uint32 cpu65_predecode_generation;
+extern void cpu65_predecode_invalidate_block ( struct cpu65_predecode_block_st *blk );
+extern void cpu65_predecode_flush ( void );
+// Must be provided by the target emulator: called when the first opcode of a block has been decoded
+extern void cpu65_predecode_block_activated ( struct cpu65_predecode_block_st *blk );
+#endif
+
 #ifdef CPU65_EXECUTION_CALLBACK_SUPPORT
 // These must be provided by the target emulator:
 extern void cpu65_nmi_debug_callback ( void );
@@ -42,6 +42,20 @@ static struct {
 } d81[8];
 static int enable_mode_transient_callback = -1;
 
+// Sector cache: on a miss, the whole track (the unit of the read-ahead) is read, or synthesized in case of
+// the FAKE64 and PRG modes. It's write-through, and invalidated on close (thus mode change as well). If the
+// caller modifies the image behind d81access (eg MEGA65 SD-card writes into an on-SD mounted D81), it must
+// call d81access_cache_invalidate().
+#define CACHE_TRACK_SIZE	0x2800	// one D81 track, both sides
+#define CACHE_TRACKS		4
+static struct {
+	int	offset[CACHE_TRACKS];	// image offset of the cached track, -1 if the slot is not used
+	int	size[CACHE_TRACKS];	// valid bytes, can be less than CACHE_TRACK_SIZE at the end of the image
+	Uint32	last_used[CACHE_TRACKS];
+	Uint32	clock;
+	Uint8	*data;			// CACHE_TRACKS * CACHE_TRACK_SIZE bytes, allocated on the first use
+} cache[8];
+
 #define IS_RO(p)	(!!((p) & D81ACCESS_RO))
 #define IS_RW(p)	(!((p) & D81ACCESS_RO))
 #define HAS_DISK(p)	(((p)&& 0xFF) != D81ACCESS_EMPTY)
@@ -59,11 +73,21 @@ void d81access_init ( void )
 		d81[i].dir = NULL;
 		d81[i].start_at = 0;
 		d81[i].mode = D81ACCESS_EMPTY;
+		d81access_cache_invalidate(i);
 		d81access_cb_chgmode(i, d81[i].mode);
 	}
 }
 
 
+void d81access_cache_invalidate ( const int which )
+{
+	for (int i = 0; i < CACHE_TRACKS; i++) {
+		cache[which].offset[i] = -1;
+		cache[which].last_used[i] = 0;
+	}
+}
+
+
 int d81access_get_mode ( const int which )
 {
 	return d81[which].mode;
@@ -93,6 +117,7 @@ void d81access_close ( const int which )
 	}
 	d81[which].mode = D81ACCESS_EMPTY;
 	d81[which].start_at = 0;
+	d81access_cache_invalidate(which);
 	if (enable_mode_transient_callback)
 		d81access_cb_chgmode(which, d81[which].mode);
 }
@@ -298,14 +323,14 @@ static int read_fake64 ( const int which, Uint8 *buffer, int d81_offset, int num
 		int sector = (d81_offset % 0x2800) >> 8;// Calculate D81 requested sector number, in _256_ bytes long sectors though! (starting from 0)
 		if (track == 18) {
 			memset(buffer, 0, 0x100);
-			DEBUGPRINT("D81: FAKE64: D81 track 18 tried to be read, which would be the D64 dir/sys track. Ignoring!" NL);
+			DEBUG("D81: FAKE64: D81 track 18 tried to be read, which would be the D64 dir/sys track. Ignoring!" NL);
 			continue;
 		}
 		if (track == 40)	// track 40 on D81 is the directory. We replace that with track 18 on the D64 (some workarounds still needed to be applied later, possibly)
 			track = 18;
 		if (!track || track > 35) {	// not existing track on D64
 			memset(buffer, 0, 0x100);
-			DEBUGPRINT("D81: FAKE64: invalid track for D64 %d" NL, track);
+			DEBUG("D81: FAKE64: invalid track for D64 %d" NL, track);
 			continue;
 		}
 		// Resolve number of sectors on D64 given by the track (unlike D81, it's not a constant!)
@@ -326,7 +351,7 @@ static int read_fake64 ( const int which, Uint8 *buffer, int d81_offset, int num
 		}
 		if (sector >= d64_max_sectors) {	// requested sector does not exist on D64 on the given track
 			memset(buffer, 0, 0x100);
-			DEBUGPRINT("D81: FAKE64: invalid sector for D64 %d on track %d" NL, sector, track);
+			DEBUG("D81: FAKE64: invalid sector for D64 %d on track %d" NL, sector, track);
 			continue;
 		}
 		// This is now checks for 18, as we already translated our 40 to 18 as the directory track!!
@@ -339,9 +364,9 @@ static int read_fake64 ( const int which, Uint8 *buffer, int d81_offset, int num
 		} else
 			sector_to_read = sector;
 		if (track == 18 || sector_to_read != sector)
-			DEBUGPRINT("D81: FAKE64: translated to D64 track:sector %d:%d from the orginal requested %d:%d" NL, track, sector_to_read, track == 18 ? 40 : track, sector);
+			DEBUG("D81: FAKE64: translated to D64 track:sector %d:%d from the orginal requested %d:%d" NL, track, sector_to_read, track == 18 ? 40 : track, sector);
 		if (file_io_op(which, 0, d64_track_ofs + sector_to_read * 256, buffer, 0x100) != 0x100) {
-			DEBUGPRINT("D81: FAKE64: read failed!" NL);
+			DEBUG("D81: FAKE64: read failed!" NL);
 			return -1;
 		}
 		// This is now checks for 18, as we already translated our 40 to 18 as the directory track!!
@@ -416,7 +441,7 @@ static int read_prg ( const int which, Uint8 *buffer, int d81_offset, int number
 	// disk organization at CBM-DOS level is 256 byte sector based, though FDC F011 itself is 512 bytes sectored stuff
 	// so we always need to check to 256 bytes "DOS-evel" sectors even if F011 itself handled 512 bytes long sectors
 	for (; number_of_logical_sectors; number_of_logical_sectors--, d81_offset += 0x100, buffer += 0x100) {
-		DEBUGPRINT("D81VIRTUAL: reading sub-sector @ $%X" NL, d81_offset);
+		DEBUG("D81VIRTUAL: reading sub-sector @ $%X" NL, d81_offset);
 		if (d81_offset == 0x61800) {		// the header sector
 			memcpy(buffer, vdsk_head_sect, sizeof vdsk_head_sect);
 		} else if (d81_offset == 0x61900 || d81_offset == 0x61A00) {	// BAM sectors (we don't handle BAM entries at all, so it will be a filled disk ...)
@@ -455,13 +480,13 @@ static int read_prg ( const int which, Uint8 *buffer, int d81_offset, int number
 					buffer[1] = (block + 1) % 40;
 				}
 				ret = file_io_op(which, 0, block * 254, buffer + 2, reqsize);
-				DEBUGPRINT("D81VIRTUAL: ... data block, block number %d, next_track = $%02X next_sector = $%02X" NL, block, buffer[0], buffer[1]);
+				DEBUG("D81VIRTUAL: ... data block, block number %d, next_track = $%02X next_sector = $%02X" NL, block, buffer[0], buffer[1]);
 #if 0
 				if (host_seek_to(NULL, block * 254, "reading[PRG81VIRT@HOST]", d81_is_prg + 512, d81fd) < 0)
 					return -1;
 				block = xemu_safe_read(d81fd, buffer + 2, reqsize);
 #endif
-				DEBUGPRINT("D81VIRTUAL: ... reading result: expected %d retval %d" NL, reqsize, ret);
+				DEBUG("D81VIRTUAL: ... reading result: expected %d retval %d" NL, reqsize, ret);
 				if (ret != reqsize)
 					return -1;
 			} // if it's not our block of the file, not BAMs, header block or directory, the default zeroed area is returned, what we memset()'ed to zero
@@ -537,13 +562,83 @@ static int check_io_req_params ( const int which, const Uint8 side, const Uint8
 }
 
 
+// Reads (or synthesizes) a whole track into the cache buffer. Returns the number of valid bytes or -1 on error
+static int read_track ( const int which, Uint8 *data, const int offset )
+{
+	int size = d81[which].image_size - offset;
+	if (size > CACHE_TRACK_SIZE)
+		size = CACHE_TRACK_SIZE;
+	if ((d81[which].mode & 0xFF) == D81ACCESS_PRG) {
+		for (int i = 0; i < size; i += 0x200)	// read_prg() pre-zeroes 512 bytes, so do not ask for more
+			if (read_prg(which, data + i, offset + i, 2))
+				return -1;
+		return size;
+	}
+	if (XEMU_UNLIKELY(d81[which].mode & D81ACCESS_FAKE64))
+		return read_fake64(which, data, offset, size >> 8) ? -1 : size;
+	return file_io_op(which, 0, offset, data, size) == size ? size : -1;
+}
+
+
+static int cached_read ( const int which, Uint8 *buffer, const int offset, const int sector_size, const int io_size )
+{
+	const int track_offset = offset - offset % CACHE_TRACK_SIZE;
+	if (XEMU_UNLIKELY(offset + sector_size > track_offset + CACHE_TRACK_SIZE))
+		return -2;	// crossing track boundary, let the caller handle it without the cache
+	if (XEMU_UNLIKELY(!cache[which].data))
+		cache[which].data = xemu_malloc(CACHE_TRACKS * CACHE_TRACK_SIZE);
+	int slot = 0;
+	for (int i = 0; i < CACHE_TRACKS; i++) {
+		if (cache[which].offset[i] == track_offset) {
+			slot = i;
+			goto hit;
+		}
+		if (cache[which].last_used[i] < cache[which].last_used[slot])	// unused slots have zero here, so they are preferred
+			slot = i;
+	}
+	cache[which].offset[slot] = -1;
+	cache[which].size[slot] = read_track(which, cache[which].data + slot * CACHE_TRACK_SIZE, track_offset);
+	if (cache[which].size[slot] < 0)
+		return -1;
+	cache[which].offset[slot] = track_offset;
+hit:
+	cache[which].last_used[slot] = ++cache[which].clock;
+	if (XEMU_UNLIKELY(offset - track_offset + io_size > cache[which].size[slot]))
+		return -1;
+	// we fill the buffer if partial read is done to have consistent "tail"
+	if (XEMU_UNLIKELY(io_size != sector_size))
+		memset(buffer, 0xFF, sector_size);
+	memcpy(buffer, cache[which].data + slot * CACHE_TRACK_SIZE + offset - track_offset, io_size);
+	return 0;
+}
+
+
+// Write-through: only updates the already cached data, no allocation on writes
+static void cached_write ( const int which, const Uint8 *buffer, const int offset, const int io_size )
+{
+	const int track_offset = offset - offset % CACHE_TRACK_SIZE;
+	for (int i = 0; i < CACHE_TRACKS; i++)
+		if (cache[which].offset[i] == track_offset) {
+			if (XEMU_UNLIKELY(offset - track_offset + io_size > cache[which].size[i]))
+				cache[which].offset[i] = -1;	// should not happen, but anyway
+			else
+				memcpy(cache[which].data + i * CACHE_TRACK_SIZE + offset - track_offset, buffer, io_size);
+			return;
+		}
+}
+
+
 int d81access_read_sect_raw ( const int which, Uint8 *buffer, const int offset, const int sector_size, const int io_size )
 {
+	int ret;
 	switch (d81[which].mode & 0xFF) {
 		case D81ACCESS_EMPTY:
 			return -1;
 		case D81ACCESS_IMG:
-			if (XEMU_UNLIKELY(d81[which].mode & D81ACCESS_FAKE64)) {
+			ret = cached_read(which, buffer, offset, sector_size, io_size);
+			if (XEMU_LIKELY(ret != -2)) {
+				return ret;
+			} else if (XEMU_UNLIKELY(d81[which].mode & D81ACCESS_FAKE64)) {
 				return read_fake64(which, buffer, offset, sector_size >> 8);
 			} else {
 				// we fill the buffer if partial read is done to have consistent "tail"
@@ -552,6 +647,9 @@ int d81access_read_sect_raw ( const int which, Uint8 *buffer, const int offset,
 				return file_io_op(which, 0, offset, buffer, io_size) == io_size ? 0 : -1;
 			}
 		case D81ACCESS_PRG:
+			ret = cached_read(which, buffer, offset, sector_size, io_size);
+			if (XEMU_LIKELY(ret != -2))
+				return ret;
 			return read_prg(which, buffer, offset, sector_size >> 8);
 		case D81ACCESS_DIR:
 			FATAL("D81ACCESS: DIR access method is not yet implemented in Xemu, sorry :-(");
@@ -584,7 +682,12 @@ int d81access_write_sect_raw ( const int which, Uint8 *buffer, const int offset,
 		case D81ACCESS_EMPTY:
 			return -1;
 		case D81ACCESS_IMG:
-			return file_io_op(which, 1, offset, buffer, io_size) == io_size ? 0 : -1;
+			if (file_io_op(which, 1, offset, buffer, io_size) != io_size) {
+				d81access_cache_invalidate(which);
+				return -1;
+			}
+			cached_write(which, buffer, offset, io_size);
+			return 0;
 		case D81ACCESS_PRG:
 		case D81ACCESS_DIR:
 			return -1;	// currently, these are all read-only, even if caller forgets that and try :-O
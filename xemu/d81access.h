@@ -65,6 +65,7 @@ extern int  d81access_get_mode     ( const int which );
 extern void d81access_close        ( const int which );
 extern int  d81access_get_size     ( const int which );
 extern void d81access_close_all    ( void      );
+extern void d81access_cache_invalidate ( const int which );
 extern void d81access_attach_fd    ( int which, int fd, off_t offset, int mode );
 extern int  d81access_attach_fsobj ( int which, const char *fn, int mode );
 extern Uint8 *d81access_create_image ( Uint8 *img, const char *diskname, const int name_from_fn );
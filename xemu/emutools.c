@@ -129,6 +129,9 @@ int sdl_default_win_y_pos = SDL_WINDOWPOS_UNDEFINED;
 static SDL_Rect sdl_whole_screen;
 static SDL_Rect sdl_viewport, *sdl_viewport_ptr = NULL;
 static unsigned int sdl_texture_x_size, sdl_texture_y_size;
+// Partial texture update (non-locked texture access only): copy of the last uploaded frame, to find the changed rows
+static Uint32 *sdl_pixel_shadow = NULL;
+static bool screen_force_update = true;
 static Uint32 main_thread_id = 0xFFFFFFFFU;
 
 static SDL_bool grabbed_mouse = SDL_FALSE, grabbed_mouse_saved = SDL_FALSE;
@@ -410,7 +413,7 @@ void xemu_set_screen_mode ( int setting )
 
 static inline void do_sleep ( int td )
 {
-	if (XEMU_UNLIKELY(emu_is_sleepless))
+	if (XEMU_UNLIKELY(emu_is_sleepless || emu_is_headless))
 		return;
 #ifdef XEMU_ARCH_HTML
 #define __SLEEP_METHOD_DESC "emscripten_set_main_loop_timing"
@@ -488,7 +491,8 @@ void xemu_timekeeping_delay ( int td_em )
 			window_title_custom_addon ? window_title_custom_addon : "running",
 			window_title_info_addon ? window_title_info_addon : ""
 		);
-		SDL_SetWindowTitle(sdl_win, window_title_buffer);
+		if (sdl_win)
+			SDL_SetWindowTitle(sdl_win, window_title_buffer);
 		td_pc_ALL = td_pc;
 		td_em_ALL = td_em;
 	} else {
@@ -1061,7 +1065,7 @@ void xemu_window_snap_to_optimal_size ( int forced )
 			forced = 1;
 		}
 	}
-	if (!forced)
+	if (!forced || !sdl_win)
 		return;
 	int w, h;
 	SDL_GetWindowSize(sdl_win, &w, &h);
@@ -1104,9 +1108,11 @@ void xemu_set_viewport ( unsigned int x1, unsigned int y1, unsigned int x2, unsi
 		}
 	}
 	sdl_viewport_changed = 1;
+	screen_force_update = true;
 	follow_win_size = 0;
 	if ((flags & XEMU_VIEWPORT_ADJUST_LOGICAL_SIZE)) {
-		SDL_RenderSetLogicalSize(sdl_ren, sdl_viewport.w, sdl_viewport.h);
+		if (sdl_ren)
+			SDL_RenderSetLogicalSize(sdl_ren, sdl_viewport.w, sdl_viewport.h);
 		// XXX this should be not handled this way
 		sdl_default_win_x_size = sdl_viewport.w;
 		sdl_default_win_y_size = sdl_viewport.h;
@@ -1132,6 +1138,8 @@ void xemu_get_viewport ( unsigned int *x1, unsigned int *y1, unsigned int *x2, u
 
 static int xemu_create_main_texture ( void )
 {
+	if (!sdl_ren)		// headless mode: no renderer, the pixel buffer is never uploaded anywhere
+		return 0;
 	DEBUGPRINT("SDL: creating main texture %d x %d" NL, sdl_texture_x_size, sdl_texture_y_size);
 	SDL_Texture *new_tex = SDL_CreateTexture(sdl_ren, sdl_pixel_format_id, SDL_TEXTUREACCESS_STREAMING, sdl_texture_x_size, sdl_texture_y_size);
 	if (!new_tex) {
@@ -1143,6 +1151,7 @@ static int xemu_create_main_texture ( void )
 		SDL_DestroyTexture(sdl_tex);
 	}
 	sdl_tex = new_tex;
+	screen_force_update = true;	// new texture has no content at all, the next frame must be fully uploaded
 	return 0;
 }
 
@@ -1167,6 +1176,8 @@ void xemu_default_win_pos_file_op ( const char r_or_w )
 	strcpy(fn, sdl_pref_dir);
 	strcat(fn, relpath);
 	fmode[0] = r_or_w;
+	if (r_or_w == 'w' && !sdl_win)
+		return;
 	FILE *f = fopen(fn, fmode);
 	if (f) {
 		int x, y;
@@ -1280,6 +1291,68 @@ static bool android_populate_assets ( const char *listfn )
 #endif
 
 
+static int create_window_and_renderer ( const char *window_title, int is_resizable, int logical_x_size, int logical_y_size, int win_x_size, int win_y_size )
+{
+	if (sdl_default_win_x_pos == SDL_WINDOWPOS_UNDEFINED && sdl_default_win_y_pos == SDL_WINDOWPOS_UNDEFINED)
+		xemu_default_win_pos_file_op('r');	// try to load window position if sdl_default_win_?_pos not yet initialised
+	if (
+		sdl_default_win_x_pos != SDL_WINDOWPOS_UNDEFINED && sdl_default_win_y_pos != SDL_WINDOWPOS_UNDEFINED &&
+		(sdl_default_win_x_pos < 0 || sdl_default_win_y_pos < 0 || sdl_default_win_x_pos > sdl_whole_screen.w - 32 || sdl_default_win_y_pos > sdl_whole_screen.h - 32)
+	) {
+		DEBUGPRINT("SDL: default win pos coords (%d,%d) are invalid for screen (%dx%d)." NL, sdl_default_win_x_pos, sdl_default_win_y_pos, sdl_whole_screen.w, sdl_whole_screen.h);
+		sdl_default_win_x_pos = SDL_WINDOWPOS_UNDEFINED;
+		sdl_default_win_y_pos = SDL_WINDOWPOS_UNDEFINED;
+	}
+	DEBUGPRINT("SDL: opening window at (%d,%d) with size of (%d,%d)" NL, sdl_default_win_x_pos, sdl_default_win_y_pos, win_x_size, win_y_size);
+	sdl_win = SDL_CreateWindow(
+		window_title,
+		sdl_default_win_x_pos, sdl_default_win_y_pos,
+		win_x_size, win_y_size,
+		SDL_WINDOW_SHOWN | (is_resizable ? SDL_WINDOW_RESIZABLE : 0)
+	);
+	DEBUGPRINT("SDL window native pixel format: %s" NL, SDL_GetPixelFormatName(SDL_GetWindowPixelFormat(sdl_win)));
+	if (!sdl_win) {
+		ERROR_WINDOW("Cannot create SDL window: %s", SDL_GetError());
+		return 1;
+	}
+	//SDL_SetWindowMinimumSize(sdl_win, SCREEN_WIDTH, SCREEN_HEIGHT * 2);
+	SDL_RendererInfo ren_info;
+	for (int a = 0, max = SDL_GetNumRenderDrivers(); a < max; a++) {
+		if (!SDL_GetRenderDriverInfo(a, &ren_info))
+			DEBUGPRINT("SDL renderer driver #%d: \"%s\"" NL, a, ren_info.name);
+		else
+			DEBUGPRINT("SDL renderer driver #%d: FAILURE TO QUERY (%s)" NL, a, SDL_GetError());
+	}
+	sdl_ren = SDL_CreateRenderer(sdl_win, -1, SDL_RENDERER_ACCELERATED);
+	if (!sdl_ren) {
+		ERROR_WINDOW("Cannot create accelerated SDL renderer: %s", SDL_GetError());
+		sdl_ren = SDL_CreateRenderer(sdl_win, -1, 0);
+		if (!sdl_ren) {
+			ERROR_WINDOW("... and not even non-accelerated driver could be created, giving up: %s", SDL_GetError());
+			return 1;
+		} else {
+			INFO_WINDOW("Created non-accelerated driver. NOTE: it will severly affect the performance!");
+		}
+	}
+	SDL_SetRenderDrawColor(sdl_ren, 0, 0, 0, SDL_ALPHA_OPAQUE);
+	if (!SDL_GetRendererInfo(sdl_ren, &ren_info)) {
+		DEBUGPRINT("SDL renderer used: \"%s\" max_tex=%dx%d tex_formats=%d ", ren_info.name, ren_info.max_texture_width, ren_info.max_texture_height, ren_info.num_texture_formats);
+		for (int a = 0; a < ren_info.num_texture_formats; a++) {
+			const char *p = SDL_GetPixelFormatName(ren_info.texture_formats[a]);
+			if (p) {
+				static const char name_head[] = { 'S','D','L','_','P','I','X','E','L','F','O','R','M','A','T','_' };
+				if (!strncmp(p, name_head, sizeof name_head))
+					p += sizeof name_head;
+			}
+			DEBUGPRINT("%c%s", a ? ' ' : '(', p ? p : "?");
+		}
+		DEBUGPRINT(")" NL);
+	}
+	SDL_RenderSetLogicalSize(sdl_ren, logical_x_size, logical_y_size);	// this helps SDL to know the "logical ratio" of screen, even in full screen mode when scaling is needed!
+	return 0;
+}
+
+
 /* Return value: 0 = ok, otherwise: ERROR, caller must exit, and can't use any other functionality, otherwise crash would happen.*/
 int xemu_post_init (
 	const char *window_title,		// title of our window
@@ -1382,68 +1455,22 @@ int xemu_post_init (
 	SDL_SetHint(SDL_HINT_ANDROID_TRAP_BACK_BUTTON, "1");
 #endif
 	/* end of SDL hints section */
-	if (sdl_default_win_x_pos == SDL_WINDOWPOS_UNDEFINED && sdl_default_win_y_pos == SDL_WINDOWPOS_UNDEFINED)
-		xemu_default_win_pos_file_op('r');	// try to load window position if sdl_default_win_?_pos not yet initialised
-	if (
-		sdl_default_win_x_pos != SDL_WINDOWPOS_UNDEFINED && sdl_default_win_y_pos != SDL_WINDOWPOS_UNDEFINED &&
-		(sdl_default_win_x_pos < 0 || sdl_default_win_y_pos < 0 || sdl_default_win_x_pos > sdl_whole_screen.w - 32 || sdl_default_win_y_pos > sdl_whole_screen.h - 32)
-	) {
-		DEBUGPRINT("SDL: default win pos coords (%d,%d) are invalid for screen (%dx%d)." NL, sdl_default_win_x_pos, sdl_default_win_y_pos, sdl_whole_screen.w, sdl_whole_screen.h);
-		sdl_default_win_x_pos = SDL_WINDOWPOS_UNDEFINED;
-		sdl_default_win_y_pos = SDL_WINDOWPOS_UNDEFINED;
-	}
-	DEBUGPRINT("SDL: opening window at (%d,%d) with size of (%d,%d)" NL, sdl_default_win_x_pos, sdl_default_win_y_pos, win_x_size, win_y_size);
 	sdl_window_title = xemu_strdup(window_title);
-	sdl_win = SDL_CreateWindow(
-		window_title,
-		sdl_default_win_x_pos, sdl_default_win_y_pos,
-		win_x_size, win_y_size,
-		SDL_WINDOW_SHOWN | (is_resizable ? SDL_WINDOW_RESIZABLE : 0)
-	);
-	sdl_default_win_x_size = win_x_size;
-	sdl_default_win_y_size = win_y_size;
-	DEBUGPRINT("SDL window native pixel format: %s" NL, SDL_GetPixelFormatName(SDL_GetWindowPixelFormat(sdl_win)));
-	if (!sdl_win) {
-		ERROR_WINDOW("Cannot create SDL window: %s", SDL_GetError());
-		return 1;
-	}
 	window_title_buffer = xemu_malloc(strlen(window_title) + 128);
 	strcpy(window_title_buffer, window_title);
 	window_title_buffer_end = window_title_buffer + strlen(window_title);
-	//SDL_SetWindowMinimumSize(sdl_win, SCREEN_WIDTH, SCREEN_HEIGHT * 2);
-	SDL_RendererInfo ren_info;
-	for (int a = 0, max = SDL_GetNumRenderDrivers(); a < max; a++) {
-		if (!SDL_GetRenderDriverInfo(a, &ren_info))
-			DEBUGPRINT("SDL renderer driver #%d: \"%s\"" NL, a, ren_info.name);
-		else
-			DEBUGPRINT("SDL renderer driver #%d: FAILURE TO QUERY (%s)" NL, a, SDL_GetError());
-	}
-	sdl_ren = SDL_CreateRenderer(sdl_win, -1, SDL_RENDERER_ACCELERATED);
-	if (!sdl_ren) {
-		ERROR_WINDOW("Cannot create accelerated SDL renderer: %s", SDL_GetError());
-		sdl_ren = SDL_CreateRenderer(sdl_win, -1, 0);
-		if (!sdl_ren) {
-			ERROR_WINDOW("... and not even non-accelerated driver could be created, giving up: %s", SDL_GetError());
+	sdl_default_win_x_size = win_x_size;
+	sdl_default_win_y_size = win_y_size;
+	if (!emu_is_headless) {
+		if (create_window_and_renderer(window_title, is_resizable, logical_x_size, logical_y_size, win_x_size, win_y_size))
 			return 1;
-		} else {
-			INFO_WINDOW("Created non-accelerated driver. NOTE: it will severly affect the performance!");
-		}
-	}
-	SDL_SetRenderDrawColor(sdl_ren, 0, 0, 0, SDL_ALPHA_OPAQUE);
-	if (!SDL_GetRendererInfo(sdl_ren, &ren_info)) {
-		DEBUGPRINT("SDL renderer used: \"%s\" max_tex=%dx%d tex_formats=%d ", ren_info.name, ren_info.max_texture_width, ren_info.max_texture_height, ren_info.num_texture_formats);
-		for (int a = 0; a < ren_info.num_texture_formats; a++) {
-			const char *p = SDL_GetPixelFormatName(ren_info.texture_formats[a]);
-			if (p) {
-				static const char name_head[] = { 'S','D','L','_','P','I','X','E','L','F','O','R','M','A','T','_' };
-				if (!strncmp(p, name_head, sizeof name_head))
-					p += sizeof name_head;
-			}
-			DEBUGPRINT("%c%s", a ? ' ' : '(', p ? p : "?");
-		}
-		DEBUGPRINT(")" NL);
+	} else {
+		// Headless mode: no window, renderer or texture at all. Rendering goes into our own pixel buffer only
+		// (thus the locked texture method cannot be used), which is never presented, but still can be used
+		// for screenshots, etc.
+		DEBUGPRINT("SDL: headless mode, no window and renderer is created" NL);
+		locked_texture_update = 0;
 	}
-	SDL_RenderSetLogicalSize(sdl_ren, logical_x_size, logical_y_size);	// this helps SDL to know the "logical ratio" of screen, even in full screen mode when scaling is needed!
 	sdl_texture_x_size = texture_x_size;
 	sdl_texture_y_size = texture_y_size;
 	sdl_pixel_format_id = pixel_format;
@@ -1453,21 +1480,25 @@ int xemu_post_init (
 		return 1;
 	}
 	texture_x_size_in_bytes = texture_x_size * 4;
-	sdl_winid = SDL_GetWindowID(sdl_win);
+	sdl_winid = sdl_win ? SDL_GetWindowID(sdl_win) : 0;
 	/* Intitialize palette from given RGB components */
 	sdl_pix_fmt = SDL_AllocFormat(pixel_format);
 	black_colour = SDL_MapRGBA(sdl_pix_fmt, 0, 0, 0, 0xFF);	// used to initialize pixel buffer
 	while (n_colours--)
 		store_palette[n_colours] = SDL_MapRGBA(sdl_pix_fmt, colours[n_colours * 3], colours[n_colours * 3 + 1], colours[n_colours * 3 + 2], 0xFF);
 	/* texture access / buffer */
-	if (!locked_texture_update)
+	if (!locked_texture_update) {
 		sdl_pixel_buffer = xemu_malloc_ALIGNED(texture_x_size_in_bytes * texture_y_size);
+		if (sdl_ren)
+			sdl_pixel_shadow = xemu_malloc_ALIGNED(texture_x_size_in_bytes * texture_y_size);
+	}
 	// play a single frame game, to set a consistent colour (all black ...) for the emulator. Also, it reveals possible errors with rendering
 	xemu_render_dummy_frame(black_colour, texture_x_size, texture_y_size);
 	if (chatty_xemu)
 		printf(NL);
 #	include "build/xemu-48x48.xpm"
-	xemu_set_icon_from_xpm(favicon_xpm);
+	if (sdl_win)
+		xemu_set_icon_from_xpm(favicon_xpm);
 #ifdef	XEMU_ARCH_ANDROID
 	SDL_AndroidRequestPermission("android.permission.READ_EXTERNAL_STORAGE");
 	android_populate_assets("list");
@@ -1619,14 +1650,71 @@ Uint32 *xemu_start_pixel_buffer_access ( int *texture_tail )
 }
 
 
+// Forces the next xemu_update_screen() to upload and present the whole frame, even if it seems to be unchanged
+void xemu_force_screen_update ( void )
+{
+	screen_force_update = true;
+}
+
+
+// Non-locked texture access only: uploads only the rows changed since the last frame (compared to the shadow
+// copy of the previous one), also merging close-by dirty row runs into one rectangle, to avoid too many
+// small uploads. Returns the number of uploaded rows.
+static int upload_changed_rows ( void )
+{
+	if (screen_force_update) {
+		screen_force_update = false;
+		SDL_UpdateTexture(sdl_tex, NULL, sdl_pixel_buffer, texture_x_size_in_bytes);
+		memcpy(sdl_pixel_shadow, sdl_pixel_buffer, texture_x_size_in_bytes * sdl_texture_y_size);
+		return sdl_texture_y_size;
+	}
+	static const int max_gap = 8;	// unchanged rows between two dirty runs to upload still as one rectangle
+	int uploaded = 0, run_start = -1, run_end = -1;
+	for (int y = 0; y <= (int)sdl_texture_y_size; y++) {
+		if (y < (int)sdl_texture_y_size) {
+			const Uint32 *src = sdl_pixel_buffer + y * sdl_texture_x_size;
+			Uint32 *shadow = sdl_pixel_shadow + y * sdl_texture_x_size;
+			if (memcmp(src, shadow, texture_x_size_in_bytes)) {
+				memcpy(shadow, src, texture_x_size_in_bytes);
+				if (run_start < 0)
+					run_start = y;
+				run_end = y;
+				continue;
+			}
+			if (run_start < 0 || y - run_end <= max_gap)
+				continue;
+		} else if (run_start < 0)
+			break;
+		const SDL_Rect rect = { .x = 0, .y = run_start, .w = sdl_texture_x_size, .h = run_end - run_start + 1 };
+		SDL_UpdateTexture(sdl_tex, &rect, sdl_pixel_buffer + run_start * sdl_texture_x_size, texture_x_size_in_bytes);
+		uploaded += rect.h;
+		run_start = -1;
+	}
+	return uploaded;
+}
+
+
 /* Call this, to "show" the result given by filled pixel buffer whose pointer is
    got by calling emu_start_pixel_buffer_access(). Please read the notes at
    emu_start_pixel_buffer_access() carefully, especially, if you use the locked
    texture method! */
 void xemu_update_screen ( void )
 {
+	if (XEMU_UNLIKELY(!sdl_ren))
+		return;		// headless mode: the frame stays in sdl_pixel_buffer, nothing to upload or present
 	if (sdl_pixel_buffer) {
-		SDL_UpdateTexture(sdl_tex, NULL, sdl_pixel_buffer, texture_x_size_in_bytes);
+		// With our own pixel buffer, only changed rows are uploaded. If nothing changed at all, and there
+		// is no OSD/OSK on top to be rendered, we can skip the rendering and presenting as well. Still do it
+		// once per second, so the window content is restored eventually, if the window manager lost it.
+		if (!upload_changed_rows() && !seconds_timer_trigger
+#ifdef		XEMU_OSD_SUPPORT
+			&& !osd_status
+#endif
+#ifdef		XEMU_OSK_SUPPORT
+			&& !osk_status()
+#endif
+		)
+			return;
 	} else {
 		SDL_UnlockTexture(sdl_tex);
 		xemu_frame_pixel_access_p = NULL;	// not valid anymore!
@@ -666,6 +666,12 @@ int hid_handle_one_sdl_event ( SDL_Event *event )
 		case SDL_TEXTINPUT:
 			TRY_CUSTOM_CALLBACKS(sdl_textinput_event_cbs, &event->text);
 			break;
+		case SDL_WINDOWEVENT:
+			// Window content may be lost/resized: make sure the next frame is presented, even if it's unchanged
+			if (event->window.event == SDL_WINDOWEVENT_EXPOSED || event->window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+				xemu_force_screen_update();
+			handled = 0;
+			break;
 #ifdef		XEMU_ARCH_ANDROID
 		case SDL_MULTIGESTURE:
 			if (event->mgesture.numFingers >= 2) {
@@ -250,6 +250,8 @@ bool osk_show ( const bool on )
 			keys[k].pressed = false;
 		}
 	last_pressed = -1;
+	if (!on)
+		xemu_force_screen_update();	// OSK must be removed from the screen, even if the emulated screen is unchanged
 	in_use = on;
 	hid_ignore_mouse_lbutton = on;
 	mod_use = false;
@@ -347,6 +349,10 @@ bool osk_init ( const struct osk_desc_st *desc, const int sx, const int sy, cons
 {
 	if (tex)
 		FATAL("You cannot call %s() twice!", __func__);
+	if (!sdl_ren) {
+		DEBUGPRINT("OSK: no renderer (headless mode?), OSK won't be available" NL);
+		return false;
+	}
 	size_x = sx;
 	size_y = sy;
 	kheight = kh;
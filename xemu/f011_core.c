@@ -63,6 +63,15 @@ static int   swap_mask = 0;
 static int   warn_disk = 1;
 static int   warn_swap_bit = 1;
 static int   allowed_disk = FDC_ALLOW_DISK_ACCESS;	// provides a way to TEMPORARLY reject disk access (eg: avoid autoboot)
+static int   timing_mode = FDC_TIMING_INSTANT;
+static double busy_usec = 0;		// remaining BUSY time of the pending command in usecs, if timing_mode is not FDC_TIMING_INSTANT (0 = no pending command)
+static double rotation_usec = 0;	// rotational position of the disk, 0 = the start of sector 1
+static struct {
+	int drive, track, side, sector;
+} last_read = { .drive = -1 };		// the last successfully read sector, for the sequential read detection of FDC_TIMING_TURBO
+static struct {
+	int drive, track, side, sector;
+} issued;				// drive and sector parameters latched when the command is issued, a pending command must not see later register writes
 static struct {
 	int have_disk, have_write;
 #ifdef FDC_PRIVATE_STATUS_A
@@ -103,8 +112,14 @@ static struct {
 #	define DRV_HEAD_TRACK(drv_no)	head_track_storage
 #endif
 
+// Disk geometry/mechanics used for the timing emulation (3.5" DD drive, 300 RPM, 10 sectors per track on a side)
+#define REVOLUTION_USEC		200000.0
+#define SECTORS_PER_TRACK	10
+#define SECTOR_USEC		(REVOLUTION_USEC / SECTORS_PER_TRACK)
+#define STEP_UNIT_USEC		62.5	// unit of the STEP register
 
 static void  execute_command ( void );
+static void  latch_command   ( void );
 
 
 void fdc_init ( Uint8 *cache_set )
@@ -131,6 +146,88 @@ void fdc_init ( Uint8 *cache_set )
 		DRV_STATUS_B(i) &= 0x7F;	// at this point we don't want disk changed signal (bit 7) yet
 	}
 	allowed_disk = FDC_ALLOW_DISK_ACCESS;
+	busy_usec = 0;
+	last_read.drive = -1;
+	latch_command();
+}
+
+
+/* FDC_TIMING_INSTANT: commands are done at the time when they are issued (the original behaviour of Xemu)
+   FDC_TIMING_ACCURATE: BUSY is kept for the time of head stepping and the rotational latency of the sector, see fdc_tick()
+   FDC_TIMING_TURBO: accurate, except sequential sector reads (what DOS does on file loading) are instant. It is not a bulk
+                     transfer: every sector is still read by its own command, so it is never faster than FDC_TIMING_INSTANT */
+void fdc_set_timing_mode ( const int mode )
+{
+	static const char *names[] = { "instant", "accurate", "turbo" };
+	timing_mode = (mode >= FDC_TIMING_INSTANT && mode <= FDC_TIMING_TURBO) ? mode : FDC_TIMING_INSTANT;
+	DEBUGPRINT("FDC: timing mode is set to \"%s\"" NL, names[timing_mode]);
+	if (timing_mode == FDC_TIMING_INSTANT && busy_usec > 0) {
+		busy_usec = 0;
+		execute_command();	// do not leave a pending command behind
+	}
+}
+
+
+/* Must be called by the emulator regularly (eg: on each scanline) with the elapsed emulated time, if timing mode is not FDC_TIMING_INSTANT */
+void fdc_tick ( const float usecs )
+{
+	rotation_usec += usecs;
+	if (rotation_usec >= REVOLUTION_USEC)
+		rotation_usec -= REVOLUTION_USEC;
+	if (busy_usec > 0) {
+		busy_usec -= usecs;
+		if (busy_usec <= 0) {
+			busy_usec = 0;
+			execute_command();
+		}
+	}
+}
+
+
+static bool is_sequential_read ( void )
+{
+	if (last_read.drive != issued.drive)
+		return false;
+	if (issued.track == last_read.track && issued.side == last_read.side)
+		return issued.sector == last_read.sector + 1;
+	// first sector on the other side of the same track, or on the next track
+	return issued.sector == 1 && (issued.track == last_read.track || issued.track == last_read.track + 1);
+}
+
+
+static void latch_command ( void )
+{
+	issued.drive = drive;
+	issued.track = track;
+	issued.side = side;
+	issued.sector = sector;
+}
+
+
+// Returns the emulated time needed by the just issued command in usecs (0 = can be done now)
+static double command_latency ( void )
+{
+	if (timing_mode == FDC_TIMING_INSTANT || curcmd < 0 || curcmd > 0xFF)
+		return 0;
+	switch (cmd & 0xF8) {
+		case 0x40:	// read sector
+			if (timing_mode == FDC_TIMING_TURBO && is_sequential_read())
+				return 0;
+			/* fall through */
+		case 0x80: {	// write sector
+			// Waiting for the sector to arrive under the head, then transferring it. F011 does not seek on its own, the
+			// head is positioned by the step commands (which are timed themselves), so no seek time is charged here.
+			double wait = ((issued.sector + SECTORS_PER_TRACK - 1) % SECTORS_PER_TRACK) * SECTOR_USEC - rotation_usec;
+			if (wait < 0)
+				wait += REVOLUTION_USEC;
+			return wait + SECTOR_USEC;
+		}
+		case 0x10:	// head step out or no step (TIME): both takes one step time
+		case 0x18:	// head step in
+			return step * STEP_UNIT_USEC;
+		default:
+			return 0;
+	}
 }
 
 
@@ -180,6 +277,8 @@ void fdc_set_disk ( int which, int in_have_disk, int in_have_write )
 	drives[which].have_write = in_have_write;
 	DEBUG("FDC: init: set have_disk=%d, have_write=%d on drive %d" NL, in_have_disk, in_have_write, which);
 	DRV_STATUS_B(which) |= 0x01;		// disk changed signal is set, since the purpose of this function is to set new disk
+	if (last_read.drive == which)
+		last_read.drive = -1;
 	if (in_have_disk) {
 		DRV_STATUS_A(which) |= 1;	// on track-0
 		DRV_STATUS_B(which) |= 8;	// disk inserted
@@ -202,10 +301,10 @@ void fdc_set_disk ( int which, int in_have_disk, int in_have_write )
 static void read_sector ( void )
 {
 	int error = 0;
-	if (drives[drive].have_disk && allowed_disk == FDC_ALLOW_DISK_ACCESS) {
-		DEBUG("FDC: reading sector drive=%d track=%d sector=%d side=%d @ PC=$%04X" NL, drive, track, sector, side, cpu65.old_pc);
+	if (drives[issued.drive].have_disk && allowed_disk == FDC_ALLOW_DISK_ACCESS) {
+		DEBUG("FDC: reading sector drive=%d track=%d sector=%d side=%d @ PC=$%04X" NL, issued.drive, issued.track, issued.sector, issued.side, cpu65.old_pc);
 		Uint8 read_buffer[512];
-		error = fdc_cb_rd_sec(drive, read_buffer, side, track, sector);
+		error = fdc_cb_rd_sec(issued.drive, read_buffer, issued.side, issued.track, issued.sector);
 		if (error)
 			DEBUG("FDC: sector read-callback returned with error!" NL);
 		else {
@@ -225,12 +324,17 @@ static void read_sector ( void )
 		}
 	}
 	if (error) {
-		DRV_STATUS_A(drive) |= 16; // record not found ...
-		DRV_STATUS_B(drive) &= 15; // RDREQ/WTREQ/RUN/GATE off
+		DRV_STATUS_A(issued.drive) |= 16; // record not found ...
+		DRV_STATUS_B(issued.drive) &= 15; // RDREQ/WTREQ/RUN/GATE off
+		last_read.drive = -1;
 	} else {
-		DRV_STATUS_A(drive) |= 64; // DRQ, for buffered reads indicates that FDC accessed the buffer last (DRQ should be cleared by CPU reads, set by FDC access)
-		DRV_STATUS_B(drive) |= 128 | 32 ;  // RDREQ, RUN to set! (important: ROM waits for RDREQ to be high after issued read operation, also we must clear it SOME time later ...)
-		DRV_STATUS_A(drive) &= ~32;  // clear EQ, missing this in general freezes DOS as it usually does not expect to have EQ set even before the first data read [??]
+		last_read.drive = issued.drive;
+		last_read.track = issued.track;
+		last_read.side = issued.side;
+		last_read.sector = issued.sector;
+		DRV_STATUS_A(issued.drive) |= 64; // DRQ, for buffered reads indicates that FDC accessed the buffer last (DRQ should be cleared by CPU reads, set by FDC access)
+		DRV_STATUS_B(issued.drive) |= 128 | 32 ;  // RDREQ, RUN to set! (important: ROM waits for RDREQ to be high after issued read operation, also we must clear it SOME time later ...)
+		DRV_STATUS_A(issued.drive) &= ~32;  // clear EQ, missing this in general freezes DOS as it usually does not expect to have EQ set even before the first data read [??]
 	}
 	if (allowed_disk == FDC_DENY_DISK_ACCESS_ONCE)
 		allowed_disk = FDC_ALLOW_DISK_ACCESS;
@@ -240,15 +344,16 @@ static void read_sector ( void )
 static void write_sector ( void )
 {
 	int error = 0;
-	if (drives[drive].have_disk && allowed_disk == FDC_ALLOW_DISK_ACCESS && drives[drive].have_write) {
-		DEBUG("FDC: writing sector drive=%d track=%d sector=%d side=%d @ PC=$%04X" NL, drive, track, sector, side, cpu65.old_pc);
+	last_read.drive = -1;	// a write breaks the sequence of reads
+	if (drives[issued.drive].have_disk && allowed_disk == FDC_ALLOW_DISK_ACCESS && drives[issued.drive].have_write) {
+		DEBUG("FDC: writing sector drive=%d track=%d sector=%d side=%d @ PC=$%04X" NL, issued.drive, issued.track, issued.sector, issued.side, cpu65.old_pc);
 		Uint8 write_buffer[512];
 		int n;
 		for (n = 0; n < 512; n++) {
 			write_buffer[n] = cache[cache_p_fdc];
 			cache_p_fdc = (cache_p_fdc + 1) & 511;
 		}
-		error = fdc_cb_wr_sec(drive, write_buffer, side, track, sector);
+		error = fdc_cb_wr_sec(issued.drive, write_buffer, issued.side, issued.track, issued.sector);
 		if (error)
 			DEBUG("FDC: sector write-callback returned with error!" NL);
 		else
@@ -262,12 +367,12 @@ static void write_sector ( void )
 		}
 	}
 	if (error) {
-		DRV_STATUS_A(drive) |= 16; // record not found ...
-		DRV_STATUS_B(drive) &= 15; // RDREQ/WTREQ/RUN/GATE off
+		DRV_STATUS_A(issued.drive) |= 16; // record not found ...
+		DRV_STATUS_B(issued.drive) &= 15; // RDREQ/WTREQ/RUN/GATE off
 	} else {
-		DRV_STATUS_A(drive) |= 64; // DRQ, for buffered reads indicates that FDC accessed the buffer last (DRQ should be cleared by CPU reads, set by FDC access)
-		DRV_STATUS_B(drive) |= 64 | 32 ;  // WTREQ, RUN to set!
-		DRV_STATUS_A(drive) &= ~32;  // clear EQ, missing this in general freezes DOS as it usually does not expect to have EQ set even before the first data read [??]
+		DRV_STATUS_A(issued.drive) |= 64; // DRQ, for buffered reads indicates that FDC accessed the buffer last (DRQ should be cleared by CPU reads, set by FDC access)
+		DRV_STATUS_B(issued.drive) |= 64 | 32 ;  // WTREQ, RUN to set!
+		DRV_STATUS_A(issued.drive) &= ~32;  // clear EQ, missing this in general freezes DOS as it usually does not expect to have EQ set even before the first data read [??]
 	}
 	if (allowed_disk == FDC_DENY_DISK_ACCESS_ONCE)
 		allowed_disk = FDC_ALLOW_DISK_ACCESS;
@@ -323,6 +428,7 @@ void fdc_write_reg ( int addr, Uint8 data )
 			}
 			cmd = data;
 			curcmd = data;
+			busy_usec = 0;			// only the cancel command can be here if BUSY, it drops the pending command
 			DRV_STATUS_A(drive) |= 128; 	// simulate busy status ...
 			DRV_STATUS_B(drive) &= 255 - 2;	// turn IRQ flag OFF
 			DRV_STATUS_A(drive) &= 255 - (4 + 8 + 16);	// turn RNF/CRC/LOST flags OFF
@@ -359,9 +465,14 @@ void fdc_write_reg ( int addr, Uint8 data )
 			step = data;
 			break;
 	}
-	if (DRV_STATUS_A(drive) & 128) {
+	if ((DRV_STATUS_A(drive) & 128) && busy_usec <= 0) {
 		emulate_busy = 10;
-		execute_command();	// do it NOW!!!! With this setting now: there is no even BUSY state, everything happens within one OPC... seems to work still. Real F011 won't do this surely
+		latch_command();
+		busy_usec = command_latency();
+		if (busy_usec > 0)
+			DEBUG("FDC: command $%02X will be done in %d usecs" NL, cmd, (int)busy_usec);
+		else
+			execute_command();	// do it NOW!!!! With this setting now: there is no even BUSY state, everything happens within one OPC... seems to work still. Real F011 won't do this surely
 	}
 #ifdef DEBUG_FOR_PAUL
 	printf("PAUL: FDC register %d has been written, data was $%02X buffer pointer is %d now" NL, addr, data, cache_p_cpu);
@@ -374,8 +485,8 @@ static void execute_command ( void )
 #ifdef DEBUG_FOR_PAUL
 	printf("PAUL: issuing FDC command $%02X pointer was %d" NL, cmd, cache_p_cpu);
 #endif
-	DRV_STATUS_A(drive) &= 127;	// turn BUSY flag OFF
-	DRV_STATUS_B(drive) |= 2;	// turn IRQ flag ON
+	DRV_STATUS_A(issued.drive) &= 127;	// turn BUSY flag OFF
+	DRV_STATUS_B(issued.drive) |= 2;	// turn IRQ flag ON
 	if (control & 128)
 		INFO_WINDOW("Sorry, FDC-IRQ is not supported yet, by FDC emulation!");
 	if (curcmd < 0)
@@ -388,32 +499,32 @@ static void execute_command ( void )
 	switch (cmd & 0xF8) {	// high 5 bits of the command ...
 		case 0x40:	// read sector
 			//status_a |= 16;		// record not found for testing ...
-			DRV_STATUS_B(drive) |= 128;	// RDREQ: if it's not here, you won't get a READY. prompt!
+			DRV_STATUS_B(issued.drive) |= 128;	// RDREQ: if it's not here, you won't get a READY. prompt!
 			//status_b |= 32;		// RUN?!
-			DRV_STATUS_A(drive) |= 64;		// set DRQ
-			DRV_STATUS_A(drive) &= (255 - 32); // clear EQ
+			DRV_STATUS_A(issued.drive) |= 64;		// set DRQ
+			DRV_STATUS_A(issued.drive) &= (255 - 32); // clear EQ
 			//status_a |= 32; // set EQ?!
 			//cache_p_cpu = cache_p_fdc;	// yayy .... If it's not here we can't get READY. prompt!!
 			read_sector();
 			//cache_p_drive = (cache_p_drive + BLOCK_SIZE) & 511;
 			//////////////cache_p_cpu = 0; // yayy .... If it's not here we can't get READY. prompt!!
 #ifdef SOME_DEBUG
-			printf("READ: cache_p_cpu=%d / cache_p_fdc=%d drive_selected=%d" NL, cache_p_cpu, cache_p_fdc, drive);
+			printf("READ: cache_p_cpu=%d / cache_p_fdc=%d drive_selected=%d" NL, cache_p_cpu, cache_p_fdc, issued.drive);
 #endif
 			DEBUG("FDC: READ: head_track=%d need_track=%d head_side=%d need_side=%d need_sector=%d drive_selected=%d" NL,
-				DRV_HEAD_TRACK(drive), track, DRV_HEAD_SIDE(drive), side, sector, drive
+				DRV_HEAD_TRACK(issued.drive), issued.track, DRV_HEAD_SIDE(issued.drive), issued.side, issued.sector, issued.drive
 			);
 			break;
 		case 0x80:	// write sector
-			if (!(DRV_STATUS_A(drive) & 2)) {	// if not write protected ....
-				DRV_STATUS_A(drive) |= 64;         // set DRQ
-				DRV_STATUS_A(drive) &= (255 - 32); // clear EQ
+			if (!(DRV_STATUS_A(issued.drive) & 2)) {	// if not write protected ....
+				DRV_STATUS_A(issued.drive) |= 64;         // set DRQ
+				DRV_STATUS_A(issued.drive) &= (255 - 32); // clear EQ
 				write_sector();
 #ifdef SOME_DEBUG
-				printf("WRITE: cache_p_cpu=%d / cache_p_fdc=%d drive_selected=%d" NL, cache_p_cpu, cache_p_fdc, drive);
+				printf("WRITE: cache_p_cpu=%d / cache_p_fdc=%d drive_selected=%d" NL, cache_p_cpu, cache_p_fdc, issued.drive);
 #endif
 				DEBUG("FDC: WRITE: head_track=%d need_track=%d head_side=%d need_side=%d need_sector=%d drive_selected=%d" NL,
-					DRV_HEAD_TRACK(drive), track, DRV_HEAD_SIDE(drive), side, sector, drive
+					DRV_HEAD_TRACK(issued.drive), issued.track, DRV_HEAD_SIDE(issued.drive), issued.side, issued.sector, issued.drive
                         	);
 			} else {
 #ifdef SOME_DEBUG
@@ -423,22 +534,22 @@ static void execute_command ( void )
 			break;
 		case 0x10:	// head step out or no step
 			if (!(cmd & 4)) {	// if only not TIME operation, which does not step!
-				if (DRV_HEAD_TRACK(drive))
-					DRV_HEAD_TRACK(drive)--;
-				if (!DRV_HEAD_TRACK(drive))
-					DRV_STATUS_A(drive) |= 1;	// track 0 flag
-				DEBUG("FDC: head position = %d" NL, DRV_HEAD_TRACK(drive));
+				if (DRV_HEAD_TRACK(issued.drive))
+					DRV_HEAD_TRACK(issued.drive)--;
+				if (!DRV_HEAD_TRACK(issued.drive))
+					DRV_STATUS_A(issued.drive) |= 1;	// track 0 flag
+				DEBUG("FDC: head position = %d" NL, DRV_HEAD_TRACK(issued.drive));
 			}
 			break;
 		case 0x18:	// head step in
-			if (DRV_HEAD_TRACK(drive) < 128)
-				DRV_HEAD_TRACK(drive)++;
-			DEBUG("FDC: head position = %d" NL, DRV_HEAD_TRACK(drive));
-			DRV_STATUS_A(drive) &= 0xFE;	// track 0 flag off
+			if (DRV_HEAD_TRACK(issued.drive) < 128)
+				DRV_HEAD_TRACK(issued.drive)++;
+			DEBUG("FDC: head position = %d" NL, DRV_HEAD_TRACK(issued.drive));
+			DRV_STATUS_A(issued.drive) &= 0xFE;	// track 0 flag off
 			break;
 		case 0x20:	// motor spin up
 			control |= 32;
-			DRV_STATUS_A(drive) |= 16; // according to the specification, RNF bit should be set at the end of the operation
+			DRV_STATUS_A(issued.drive) |= 16; // according to the specification, RNF bit should be set at the end of the operation
 			break;
 		case 0x00:	// cancel running command?? NOTE: also if low bit is 1: clear pointer!
 			// Note: there was a typo in my previous versions ... to have break HERE! So pointer reset never executed actually ...... :-@
@@ -452,8 +563,8 @@ static void execute_command ( void )
 				cache_p_fdc = 0;
 				DEBUG("FDC: WARN: resetting cache pointers" NL);
 				//status_a |= 32; // turn EQ on
-				DRV_STATUS_A(drive) &= 255 - 64; // turn DRQ off
-				DRV_STATUS_B(drive) &= 127;      // turn RDREQ off
+				DRV_STATUS_A(issued.drive) &= 255 - 64; // turn DRQ off
+				DRV_STATUS_B(issued.drive) &= 127;      // turn RDREQ off
 
 			}
 			break;
@@ -478,7 +589,7 @@ Uint8 fdc_read_reg  ( int addr )
 	/* Emulate BUSY timing, with a very bad manner: ie, decrement a counter on each register read to give some time to wait.
 	   FIXME: not sure if it's needed and what happen if C65 DOS gots "instant" operations done without BUSY ever set ... Not a real happening, but it can be with my primitive emulation :)
 	   Won't work if DOS is IRQ driven ... */
-	if (DRV_STATUS_A(drive) & 128) {	// check the BUSY flag
+	if ((DRV_STATUS_A(drive) & 128) && busy_usec <= 0) {	// check the BUSY flag (but not if timing emulation is in effect with a pending command)
 		// Note: this is may not used at all, check the end of write reg func!
 		if (emulate_busy > 0)
 			emulate_busy--;
@@ -486,6 +597,7 @@ Uint8 fdc_read_reg  ( int addr )
 #ifdef SOME_DEBUG
 			printf("Delayed command execution!!!" NL);
 #endif
+			latch_command();
 			execute_command();	// execute the command only now for real ... (it will also turn BUSY flag - bit 7 - OFF in status_a)
 		}
 	}
@@ -591,6 +703,17 @@ int fdc_snapshot_load_state ( const struct xemu_snapshot_definition_st *def, str
 	cmd = buffer[135];
 	dskclock = buffer[136];
 	step = buffer[137];
+	busy_usec = (int)P_AS_BE32(buffer + 36);	// 0xFFFFFFFF (-1) from older snapshots: no pending command
+	if (busy_usec < 0 || timing_mode == FDC_TIMING_INSTANT)
+		busy_usec = 0;
+	latch_command();
+	if (busy_usec > 0 && buffer[138] != 0xFF) {	// parameters of the pending command (0xFF: older snapshot without them)
+		issued.drive = buffer[138] & 7;
+		issued.track = buffer[139];
+		issued.sector = buffer[140];
+		issued.side = buffer[141];
+	}
+	last_read.drive = -1;
 #ifndef MEGA65
 	memcpy(cache, buffer + 0x100, CACHE_SIZE);
 #endif
@@ -614,6 +737,7 @@ int fdc_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
 	U32_AS_BE(buffer + 24, swap_mask);
 	U32_AS_BE(buffer + 28, drives[drive].have_disk);
 	U32_AS_BE(buffer + 32, drives[drive].have_write);
+	U32_AS_BE(buffer + 36, (int)busy_usec);
 	buffer[128] = DRV_HEAD_TRACK(drive);
 	buffer[129] = track;
 	buffer[130] = sector;
@@ -624,6 +748,12 @@ int fdc_snapshot_save_state ( const struct xemu_snapshot_definition_st *def )
 	buffer[135] = cmd;
 	buffer[136] = dskclock;
 	buffer[137] = step;
+	if (busy_usec > 0) {
+		buffer[138] = issued.drive;
+		buffer[139] = issued.track;
+		buffer[140] = issued.sector;
+		buffer[141] = issued.side;
+	}
 #ifndef MEGA65
 	memcpy(buffer + 0x100, cache, CACHE_SIZE);
 #endif
@@ -23,6 +23,10 @@ Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
 #define FDC_ALLOW_DISK_ACCESS		1
 #define FDC_DENY_DISK_ACCESS_ONCE	2
 
+#define FDC_TIMING_INSTANT		0
+#define FDC_TIMING_ACCURATE		1
+#define FDC_TIMING_TURBO		2
+
 extern void  fdc_write_reg ( int addr, Uint8 data );
 extern Uint8 fdc_read_reg  ( int addr );
 extern void  fdc_init      ( Uint8 *cache_set );
@@ -33,6 +37,8 @@ extern int   fdc_get_buffer_cpu_address  ( void );
 extern int   fdc_get_buffer_disk_address ( void );
 extern int   fdc_get_status_a ( const int which );
 extern int   fdc_get_status_b ( const int which );
+extern void  fdc_set_timing_mode ( const int mode );
+extern void  fdc_tick ( const float usecs );
 
 /* must defined by the user */
 extern int   fdc_cb_rd_sec ( const int which, Uint8 *buffer, const Uint8 side, const Uint8 track, const Uint8 sector );
@@ -91,6 +91,7 @@ static XEMU_INLINE void _osd_render ( void )
 			DEBUG("OSD: end of fade at %d" NL, osd_status);
 			osd_status = 0;
 			osd.alpha_last = 0;
+			xemu_force_screen_update();	// the next frame must be presented (without OSD) even if the screen is unchanged
 		} else {
 			int alpha = osd_status > 0xFF ? 0xFF : osd_status;
 			if (alpha != osd.alpha_last) {
@@ -171,6 +172,10 @@ int osd_init ( int xsize, int ysize, const Uint8 *palette, int palette_entries,
 	osd.enabled = 0;
 	if (osd.tex || osd.pixels)
 		FATAL("Calling osd_init() multiple times?");
+	if (!sdl_ren) {
+		DEBUGPRINT("OSD: no renderer (headless mode?), OSD won't be available" NL);
+		return 1;
+	}
 	osd.tex = SDL_CreateTexture(sdl_ren, sdl_pix_fmt->format, SDL_TEXTUREACCESS_STREAMING, xsize, ysize);
 	if (!osd.tex) {
 		ERROR_WINDOW("Error with SDL_CreateTexture(), OSD won't be available: %s", SDL_GetError());
@@ -232,6 +237,8 @@ void osd_on ( int value )
 
 void osd_off ( void )
 {
+	if (osd_status)
+		xemu_force_screen_update();	// see the comment at _osd_render()
 	osd_status = 0;
 	DEBUG("OSD: osd_off() called." NL);
 }
@@ -241,6 +248,8 @@ void osd_global_enable ( int status )
 {
 	osd.enabled = (status && osd.available);
 	osd.alpha_last = -1;
+	if (osd_status)
+		xemu_force_screen_update();	// see the comment at _osd_render()
 	osd_status = 0;
 	DEBUG("OSD: osd_global_enable(%d), result of status = %d" NL, status, osd.enabled);
 }
@@ -0,0 +1,129 @@
+/* A work-in-progess MEGA65 (Commodore 65 clone origins) emulator
+   Part of the Xemu project, please visit: https://github.com/lgblgblgb/xemu
+   Copyright (C)2016-2025 LGB (Gábor Lénárt) <lgblgblgb@gmail.com>
+
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA */
+
+#ifndef XEMU_COMMON_ARCH_OPT_EXPAND32_H_INCLUDED
+#define XEMU_COMMON_ARCH_OPT_EXPAND32_H_INCLUDED
+
+/* Pixel expansion helpers for the scanline renderers. All of them write "rep" (1 or 2: pixel
+   doubling) destination pixels per source pixel, also the "attribute" byte of the source pixel
+   into the "attr" buffer in the same manner (this is used for the foreground/background info).
+   "rep" should be a compile time constant at the call site, so the compiler can throw the
+   unused code path away after inlining. */
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+// Expands the 8 bits of "bits" (MSB first) into 8 pixels: set bits with colour "fg", cleared
+// bits with colour "bg", or the destination is left intact for cleared bits if "transparent"
+static XEMU_INLINE void expand32_mono8 ( Uint32 *dst, Uint8 *attr, const Uint8 bits, const Uint32 fg, const Uint32 bg, const bool transparent, const int rep )
+{
+	const __m128i vbits = _mm_set1_epi32(bits);
+	const __m128i vfg = _mm_set1_epi32(fg);
+	const __m128i vbg = _mm_set1_epi32(bg);
+	const int steps = rep * 2;
+	for (int a = 0; a < steps; a++) {
+		const __m128i bitmask = rep == 1 ?
+			(a ? _mm_setr_epi32(0x08, 0x04, 0x02, 0x01) : _mm_setr_epi32(0x80, 0x40, 0x20, 0x10)) :
+			_mm_setr_epi32(0x80 >> (a * 2), 0x80 >> (a * 2), 0x40 >> (a * 2), 0x40 >> (a * 2));
+		const __m128i sel = _mm_cmpeq_epi32(_mm_and_si128(vbits, bitmask), bitmask);
+		const __m128i other = transparent ? _mm_loadu_si128((const __m128i*)(dst + a * 4)) : vbg;
+		_mm_storeu_si128((__m128i*)(dst + a * 4), _mm_or_si128(_mm_and_si128(sel, vfg), _mm_andnot_si128(sel, other)));
+	}
+	for (int a = 0; a < 8 * rep; a++)
+		attr[a] = bits & (0x80 >> (a / rep));
+}
+
+
+// Stores "n" pixels of colours "col" with attributes "attrsrc". If "keep" is true, destination is
+// left intact where the corresponding "opaque" byte is zero.
+static XEMU_INLINE void expand32_store ( Uint32 *dst, Uint8 *attr, const Uint32 *col, const Uint8 *attrsrc, const Uint8 *opaque, const int n, const bool keep, const int rep )
+{
+	const __m128i zero = _mm_setzero_si128();
+	int a = 0;
+	for (; a + 4 <= n; a += 4) {
+		__m128i c = _mm_loadu_si128((const __m128i*)(col + a));
+		__m128i m = zero;	// all-ones lanes: keep the destination pixel
+		if (keep) {
+			Uint32 o;
+			memcpy(&o, opaque + a, 4);
+			m = _mm_cmpeq_epi32(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(o), zero), zero), zero);
+		}
+		if (rep == 1) {
+			if (keep)
+				c = _mm_or_si128(_mm_and_si128(m, _mm_loadu_si128((const __m128i*)(dst + a))), _mm_andnot_si128(m, c));
+			_mm_storeu_si128((__m128i*)(dst + a), c);
+		} else {
+			__m128i lo = _mm_unpacklo_epi32(c, c);
+			__m128i hi = _mm_unpackhi_epi32(c, c);
+			if (keep) {
+				const __m128i mlo = _mm_unpacklo_epi32(m, m);
+				const __m128i mhi = _mm_unpackhi_epi32(m, m);
+				lo = _mm_or_si128(_mm_and_si128(mlo, _mm_loadu_si128((const __m128i*)(dst + a * 2))), _mm_andnot_si128(mlo, lo));
+				hi = _mm_or_si128(_mm_and_si128(mhi, _mm_loadu_si128((const __m128i*)(dst + a * 2 + 4))), _mm_andnot_si128(mhi, hi));
+			}
+			_mm_storeu_si128((__m128i*)(dst + a * 2), lo);
+			_mm_storeu_si128((__m128i*)(dst + a * 2 + 4), hi);
+		}
+	}
+	for (; a < n; a++) {	// the remaining (less than 4) pixels, if any
+		if (!keep || opaque[a]) {
+			dst[a * rep] = col[a];
+			if (rep == 2)
+				dst[a * 2 + 1] = col[a];
+		}
+	}
+	if (rep == 1) {
+		memcpy(attr, attrsrc, n);
+	} else {
+		for (a = 0; a < n; a++)
+			attr[a * 2] = attr[a * 2 + 1] = attrsrc[a];
+	}
+}
+
+#else
+
+static XEMU_INLINE void expand32_mono8 ( Uint32 *dst, Uint8 *attr, const Uint8 bits, const Uint32 fg, const Uint32 bg, const bool transparent, const int rep )
+{
+	for (int a = 0; a < 8 * rep; a++) {
+		const Uint8 bit = bits & (0x80 >> (a / rep));
+		if (bit)
+			dst[a] = fg;
+		else if (!transparent)
+			dst[a] = bg;
+		attr[a] = bit;
+	}
+}
+
+
+static XEMU_INLINE void expand32_store ( Uint32 *dst, Uint8 *attr, const Uint32 *col, const Uint8 *attrsrc, const Uint8 *opaque, const int n, const bool keep, const int rep )
+{
+	for (int a = 0; a < n; a++) {
+		if (!keep || opaque[a]) {
+			dst[a * rep] = col[a];
+			if (rep == 2)
+				dst[a * 2 + 1] = col[a];
+		}
+		attr[a * rep] = attrsrc[a];
+		if (rep == 2)
+			attr[a * 2 + 1] = attrsrc[a];
+	}
+}
+
+#endif
+
+#endif
@@ -51,8 +51,6 @@
 #ifndef __SIDENGINE_H_IS_INCLUDED
 #define __SIDENGINE_H_IS_INCLUDED
 
-#include <SDL_atomic.h>
-
 // 0x38: supposedly DC level for MOS6581 (whereas it would be 0x80 for the "crappy new chip")
 #define SID_DC_LEVEL 0x38
 
@@ -145,7 +143,6 @@ struct SidEmulation {
 	unsigned char bval;
 	unsigned short wval;
 	unsigned long sLastPolledOsc;
-	SDL_SpinLock spinlock;
 };
 
 
@@ -14,65 +14,65 @@
 
 
 /* Macros used for accessing the registers */
-#define A   z80ex.af.b.h
-#define F   z80ex.af.b.l
-#define AF  z80ex.af.w
+#define A   cpu->af.b.h
+#define F   cpu->af.b.l
+#define AF  cpu->af.w
 
-#define B   z80ex.bc.b.h
-#define C   z80ex.bc.b.l
-#define BC  z80ex.bc.w
+#define B   cpu->bc.b.h
+#define C   cpu->bc.b.l
+#define BC  cpu->bc.w
 
-#define D   z80ex.de.b.h
-#define E   z80ex.de.b.l
-#define DE  z80ex.de.w
+#define D   cpu->de.b.h
+#define E   cpu->de.b.l
+#define DE  cpu->de.w
 
-#define H   z80ex.hl.b.h
-#define L   z80ex.hl.b.l
-#define HL  z80ex.hl.w
+#define H   cpu->hl.b.h
+#define L   cpu->hl.b.l
+#define HL  cpu->hl.w
 
-#define A_  z80ex.af_.b.h
-#define F_  z80ex.af_.b.l
-#define AF_ z80ex.af_.w
+#define A_  cpu->af_.b.h
+#define F_  cpu->af_.b.l
+#define AF_ cpu->af_.w
 
-#define B_  z80ex.bc_.b.h
-#define C_  z80ex.bc_.b.l
-#define BC_ z80ex.bc_.w
+#define B_  cpu->bc_.b.h
+#define C_  cpu->bc_.b.l
+#define BC_ cpu->bc_.w
 
-#define D_  z80ex.de_.b.h
-#define E_  z80ex.de_.b.l
-#define DE_ z80ex.de_.w
+#define D_  cpu->de_.b.h
+#define E_  cpu->de_.b.l
+#define DE_ cpu->de_.w
 
-#define H_  z80ex.hl_.b.h
-#define L_  z80ex.hl_.b.l
-#define HL_ z80ex.hl_.w
+#define H_  cpu->hl_.b.h
+#define L_  cpu->hl_.b.l
+#define HL_ cpu->hl_.w
 
-#define IXH z80ex.ix.b.h
-#define IXL z80ex.ix.b.l
-#define IX  z80ex.ix.w
+#define IXH cpu->ix.b.h
+#define IXL cpu->ix.b.l
+#define IX  cpu->ix.w
 
-#define IYH z80ex.iy.b.h
-#define IYL z80ex.iy.b.l
-#define IY  z80ex.iy.w
+#define IYH cpu->iy.b.h
+#define IYL cpu->iy.b.l
+#define IY  cpu->iy.w
 
-#define SPH z80ex.sp.b.h
-#define SPL z80ex.sp.b.l
-#define SP  z80ex.sp.w
+#define SPH cpu->sp.b.h
+#define SPL cpu->sp.b.l
+#define SP  cpu->sp.w
 
-#define PCH z80ex.pc.b.h
-#define PCL z80ex.pc.b.l
-#define PC  z80ex.pc.w
+#define PCH cpu->pc.b.h
+#define PCL cpu->pc.b.l
+#define PC  cpu->pc.w
 
-#define I  z80ex.i
-#define R  z80ex.r
-#define R7 z80ex.r7
+#define I  cpu->i
+#define R  cpu->r
+#define R7 cpu->r7
 
-#define IFF1 z80ex.iff1
-#define IFF2 z80ex.iff2
-#define IM   z80ex.im
+#define IFF1 cpu->iff1
+#define IFF2 cpu->iff2
+#define IM   cpu->im
 
-#define MEMPTRh z80ex.memptr.b.h
-#define MEMPTRl z80ex.memptr.b.l
-#define MEMPTR z80ex.memptr.w
+#define MEMPTRh cpu->memptr.b.h
+#define MEMPTRl cpu->memptr.b.l
+#define MEMPTR cpu->memptr.w
 
 /* The flags */
 
@@ -86,11 +86,34 @@
 #define FLAG_Z  0x40
 #define FLAG_S  0x80
 
+/* Callbacks: either from the callback table of the context, or the statically linked ones (see z80ex.h) */
+#ifdef Z80EX_CONTEXT_CALLBACKS
+#define CB_MREAD(addr,m1)	cpu->cb->mread(cpu, addr, m1)
+#define CB_MWRITE(addr,value)	cpu->cb->mwrite(cpu, addr, value)
+#define CB_PREAD(port)		cpu->cb->pread(cpu, port)
+#define CB_PWRITE(port,value)	cpu->cb->pwrite(cpu, port, value)
+#define CB_INTREAD()		cpu->cb->intread(cpu)
+#define CB_RETI()		cpu->cb->reti(cpu)
+#define CB_TSTATE()		cpu->cb->tstate(cpu)
+#define CB_ED(opcode)		cpu->cb->ed(cpu, opcode)
+#define CB_Z180(pc,prefix,series,opcode,itc76)	cpu->cb->z180(cpu, pc, prefix, series, opcode, itc76)
+#else
+#define CB_MREAD(addr,m1)	z80ex_mread_cb(addr, m1)
+#define CB_MWRITE(addr,value)	z80ex_mwrite_cb(addr, value)
+#define CB_PREAD(port)		z80ex_pread_cb(port)
+#define CB_PWRITE(port,value)	z80ex_pwrite_cb(port, value)
+#define CB_INTREAD()		z80ex_intread_cb()
+#define CB_RETI()		z80ex_reti_cb()
+#define CB_TSTATE()		z80ex_tstate_cb()
+#define CB_ED(opcode)		z80ex_ed_cb(opcode)
+#define CB_Z180(pc,prefix,series,opcode,itc76)	z80ex_z180_cb(pc, prefix, series, opcode, itc76)
+#endif
+
 /*read opcode*/
-#define READ_OP_M1() (z80ex.int_vector_req? z80ex_intread_cb() : z80ex_mread_cb(PC++, 1))
+#define READ_OP_M1() (cpu->int_vector_req? CB_INTREAD() : CB_MREAD(PC++, 1))
 
 /*read opcode argument*/
-#define READ_OP() (z80ex.int_vector_req? z80ex_intread_cb() : z80ex_mread_cb(PC++, 0))
+#define READ_OP() (cpu->int_vector_req? CB_INTREAD() : CB_MREAD(PC++, 0))
 
 
 #ifndef Z80EX_OPSTEP_FAST_AND_ROUGH
@@ -101,25 +124,25 @@
 { \
 	unsigned nn; \
 	if(!IS_TSTATE_CB) { \
-		if (t_state > z80ex.op_tstate) { \
-			z80ex.tstate += t_state - z80ex.op_tstate; \
-			z80ex.op_tstate = t_state; \
+		if (t_state > cpu->op_tstate) { \
+			cpu->tstate += t_state - cpu->op_tstate; \
+			cpu->op_tstate = t_state; \
 		} \
 	} \
 	else { \
-		for(nn=z80ex.op_tstate;nn < t_state;nn++) { \
-			z80ex.op_tstate++; \
-			z80ex.tstate++; \
-			z80ex_tstate_cb(); \
+		for(nn=cpu->op_tstate;nn < t_state;nn++) { \
+			cpu->op_tstate++; \
+			cpu->tstate++; \
+			CB_TSTATE(); \
 		} \
 	} \
 }
 
 #else
 #define T_WAIT_UNTIL(t_state) \
-	if (t_state > z80ex.op_tstate) { \
-		z80ex.tstate += t_state - z80ex.op_tstate; \
-		z80ex.op_tstate = t_state; \
+	if (t_state > cpu->op_tstate) { \
+		cpu->tstate += t_state - cpu->op_tstate; \
+		cpu->op_tstate = t_state; \
 	}
 #endif
 
@@ -130,76 +153,76 @@ for using outside of certain opcode execution)*/
 {\
 	int nn;\
 	if(!IS_TSTATE_CB) { \
-		z80ex.tstate += amount; \
+		cpu->tstate += amount; \
 	} \
 	else { \
 		for(nn=0; nn < amount; nn++) { \
-			z80ex.tstate++; \
-			z80ex_tstate_cb(); \
+			cpu->tstate++; \
+			CB_TSTATE(); \
 		}\
 	} \
 }
 #else
-#define TSTATES(amount) z80ex.tstate += amount
+#define TSTATES(amount) cpu->tstate += amount
 #endif
 
 /*read byte from memory*/
 #define READ_MEM(result, addr, t_state) \
 { \
 	T_WAIT_UNTIL(t_state); \
-	result=(z80ex_mread_cb((addr), 0)); \
+	result=(CB_MREAD((addr), 0)); \
 }
 
 /*read byte from port*/
 #define READ_PORT(result, port, t_state) \
 { \
 	T_WAIT_UNTIL(t_state); \
-	result=(z80ex_pread_cb((port))); \
+	result=(CB_PREAD((port))); \
 }
 
 /*write byte to memory*/
 #define WRITE_MEM(addr, vbyte, t_state) \
 { \
 	T_WAIT_UNTIL(t_state); \
-	z80ex_mwrite_cb(addr, vbyte); \
+	CB_MWRITE(addr, vbyte); \
 }
 
 /*write byte to port*/
 #define WRITE_PORT(port, vbyte, t_state) \
 { \
 	T_WAIT_UNTIL(t_state); \
-	z80ex_pwrite_cb((port), vbyte); \
+	CB_PWRITE((port), vbyte); \
 }
 
 #else
 /*Z80EX_OPSTEP_FAST_AND_ROUGH*/
 
-#define T_WAIT_UNTIL(t_state) {z80ex.tstate = t_state; z80ex.op_tstate = t_state;}
+#define T_WAIT_UNTIL(t_state) {cpu->tstate = t_state; cpu->op_tstate = t_state;}
 
-#define TSTATES(amount) {z80ex.tstate += amount;}
+#define TSTATES(amount) {cpu->tstate += amount;}
 
 /*read byte from memory*/
 #define READ_MEM(result, addr, t_state) \
 { \
-	result=(z80ex_mread_cb((addr), 0)); \
+	result=(CB_MREAD((addr), 0)); \
 }
 
 /*read byte from port*/
 #define READ_PORT(result, port, t_state) \
 { \
-	result=(z80ex_pread_cb((port))); \
+	result=(CB_PREAD((port))); \
 }
 
 /*write byte to memory*/
 #define WRITE_MEM(addr, vbyte, t_state) \
 { \
-	z80ex_mwrite_cb(addr, vbyte); \
+	CB_MWRITE(addr, vbyte); \
 }
 
 /*write byte to port*/
 #define WRITE_PORT(port, vbyte, t_state) \
 { \
-	z80ex_pwrite_cb((port), vbyte); \
+	CB_PWRITE((port), vbyte); \
 }
 
 #endif
@@ -580,7 +603,7 @@ for using outside of certain opcode execution)*/
 {\
 	A=(R&0x7f) | (R7&0x80);\
 	F = ( F & FLAG_C ) | sz53_table[A] | ( IFF2 ? FLAG_V : 0 );\
-	if (z80ex.nmos) z80ex.reset_PV_on_int=1;\
+	if (cpu->nmos) cpu->reset_PV_on_int=1;\
 }
 
 #define LD_R_A() \
@@ -592,7 +615,7 @@ for using outside of certain opcode execution)*/
 {\
 	A=I;\
 	F = ( F & FLAG_C ) | sz53_table[A] | ( IFF2 ? FLAG_V : 0 );\
-	if (z80ex.nmos) z80ex.reset_PV_on_int=1;\
+	if (cpu->nmos) cpu->reset_PV_on_int=1;\
 }
 
 #define NEG() \
@@ -606,7 +629,7 @@ for using outside of certain opcode execution)*/
 {\
 	IFF1=IFF2;\
 	RET(rd1, rd2);\
-	z80ex_reti_cb(); \
+	CB_RETI(); \
 }
 
 /*same as RETI, only opcode is different*/
@@ -1008,7 +1031,7 @@ for using outside of certain opcode execution)*/
 
 #define HALT() \
 {\
-	z80ex.halted=1;\
+	cpu->halted=1;\
 	PC--;\
 }
 
@@ -1028,7 +1051,7 @@ for using outside of certain opcode execution)*/
 #define EI() \
 {\
 	IFF1 = IFF2 = 1;\
-	z80ex.noint_once=1;\
+	cpu->noint_once=1;\
 }
 
 #define SET(bit, val) \
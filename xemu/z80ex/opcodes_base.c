@@ -1,14 +1,14 @@
 /* autogenerated from ./opcodes_base.dat, do not edit */
 
 /*NOP*/
-static void op_0x00(void)
+static void op_0x00(Z80EX_CONTEXT *cpu)
 {
 	T_WAIT_UNTIL(4);
 	return;
 }
 
 /*LD BC,@*/
-static void op_0x01(void)
+static void op_0x01(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -18,7 +18,7 @@ static void op_0x01(void)
 }
 
 /*LD (BC),A*/
-static void op_0x02(void)
+static void op_0x02(Z80EX_CONTEXT *cpu)
 {
 	LD_A_TO_ADDR_MPTR(temp_byte,A, (BC));
 	WRITE_MEM((BC),temp_byte,4);
@@ -27,7 +27,7 @@ static void op_0x02(void)
 }
 
 /*INC BC*/
-static void op_0x03(void)
+static void op_0x03(Z80EX_CONTEXT *cpu)
 {
 	INC16(BC);
 	T_WAIT_UNTIL(6);
@@ -35,7 +35,7 @@ static void op_0x03(void)
 }
 
 /*INC B*/
-static void op_0x04(void)
+static void op_0x04(Z80EX_CONTEXT *cpu)
 {
 	INC(B);
 	T_WAIT_UNTIL(4);
@@ -43,7 +43,7 @@ static void op_0x04(void)
 }
 
 /*DEC B*/
-static void op_0x05(void)
+static void op_0x05(Z80EX_CONTEXT *cpu)
 {
 	DEC(B);
 	T_WAIT_UNTIL(4);
@@ -51,7 +51,7 @@ static void op_0x05(void)
 }
 
 /*LD B,#*/
-static void op_0x06(void)
+static void op_0x06(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(B,temp_byte);
@@ -60,7 +60,7 @@ static void op_0x06(void)
 }
 
 /*RLCA*/
-static void op_0x07(void)
+static void op_0x07(Z80EX_CONTEXT *cpu)
 {
 	RLCA();
 	T_WAIT_UNTIL(4);
@@ -68,7 +68,7 @@ static void op_0x07(void)
 }
 
 /*EX AF,AF'*/
-static void op_0x08(void)
+static void op_0x08(Z80EX_CONTEXT *cpu)
 {
 	EX(AF,AF_);
 	T_WAIT_UNTIL(4);
@@ -76,7 +76,7 @@ static void op_0x08(void)
 }
 
 /*ADD HL,BC*/
-static void op_0x09(void)
+static void op_0x09(Z80EX_CONTEXT *cpu)
 {
 	ADD16(HL,BC);
 	T_WAIT_UNTIL(11);
@@ -84,7 +84,7 @@ static void op_0x09(void)
 }
 
 /*LD A,(BC)*/
-static void op_0x0a(void)
+static void op_0x0a(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(BC),4);
 	LD_A_FROM_ADDR_MPTR(A,temp_byte, (BC));
@@ -93,7 +93,7 @@ static void op_0x0a(void)
 }
 
 /*DEC BC*/
-static void op_0x0b(void)
+static void op_0x0b(Z80EX_CONTEXT *cpu)
 {
 	DEC16(BC);
 	T_WAIT_UNTIL(6);
@@ -101,7 +101,7 @@ static void op_0x0b(void)
 }
 
 /*INC C*/
-static void op_0x0c(void)
+static void op_0x0c(Z80EX_CONTEXT *cpu)
 {
 	INC(C);
 	T_WAIT_UNTIL(4);
@@ -109,7 +109,7 @@ static void op_0x0c(void)
 }
 
 /*DEC C*/
-static void op_0x0d(void)
+static void op_0x0d(Z80EX_CONTEXT *cpu)
 {
 	DEC(C);
 	T_WAIT_UNTIL(4);
@@ -117,7 +117,7 @@ static void op_0x0d(void)
 }
 
 /*LD C,#*/
-static void op_0x0e(void)
+static void op_0x0e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(C,temp_byte);
@@ -126,7 +126,7 @@ static void op_0x0e(void)
 }
 
 /*RRCA*/
-static void op_0x0f(void)
+static void op_0x0f(Z80EX_CONTEXT *cpu)
 {
 	RRCA();
 	T_WAIT_UNTIL(4);
@@ -134,7 +134,7 @@ static void op_0x0f(void)
 }
 
 /*DJNZ %*/
-static void op_0x10(void)
+static void op_0x10(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -143,7 +143,7 @@ static void op_0x10(void)
 }
 
 /*LD DE,@*/
-static void op_0x11(void)
+static void op_0x11(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -153,7 +153,7 @@ static void op_0x11(void)
 }
 
 /*LD (DE),A*/
-static void op_0x12(void)
+static void op_0x12(Z80EX_CONTEXT *cpu)
 {
 	LD_A_TO_ADDR_MPTR(temp_byte,A, (DE));
 	WRITE_MEM((DE),temp_byte,4);
@@ -162,7 +162,7 @@ static void op_0x12(void)
 }
 
 /*INC DE*/
-static void op_0x13(void)
+static void op_0x13(Z80EX_CONTEXT *cpu)
 {
 	INC16(DE);
 	T_WAIT_UNTIL(6);
@@ -170,7 +170,7 @@ static void op_0x13(void)
 }
 
 /*INC D*/
-static void op_0x14(void)
+static void op_0x14(Z80EX_CONTEXT *cpu)
 {
 	INC(D);
 	T_WAIT_UNTIL(4);
@@ -178,7 +178,7 @@ static void op_0x14(void)
 }
 
 /*DEC D*/
-static void op_0x15(void)
+static void op_0x15(Z80EX_CONTEXT *cpu)
 {
 	DEC(D);
 	T_WAIT_UNTIL(4);
@@ -186,7 +186,7 @@ static void op_0x15(void)
 }
 
 /*LD D,#*/
-static void op_0x16(void)
+static void op_0x16(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(D,temp_byte);
@@ -195,7 +195,7 @@ static void op_0x16(void)
 }
 
 /*RLA*/
-static void op_0x17(void)
+static void op_0x17(Z80EX_CONTEXT *cpu)
 {
 	RLA();
 	T_WAIT_UNTIL(4);
@@ -203,7 +203,7 @@ static void op_0x17(void)
 }
 
 /*JR %*/
-static void op_0x18(void)
+static void op_0x18(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -213,7 +213,7 @@ static void op_0x18(void)
 }
 
 /*ADD HL,DE*/
-static void op_0x19(void)
+static void op_0x19(Z80EX_CONTEXT *cpu)
 {
 	ADD16(HL,DE);
 	T_WAIT_UNTIL(11);
@@ -221,7 +221,7 @@ static void op_0x19(void)
 }
 
 /*LD A,(DE)*/
-static void op_0x1a(void)
+static void op_0x1a(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(DE),4);
 	LD_A_FROM_ADDR_MPTR(A,temp_byte, (DE));
@@ -230,7 +230,7 @@ static void op_0x1a(void)
 }
 
 /*DEC DE*/
-static void op_0x1b(void)
+static void op_0x1b(Z80EX_CONTEXT *cpu)
 {
 	DEC16(DE);
 	T_WAIT_UNTIL(6);
@@ -238,7 +238,7 @@ static void op_0x1b(void)
 }
 
 /*INC E*/
-static void op_0x1c(void)
+static void op_0x1c(Z80EX_CONTEXT *cpu)
 {
 	INC(E);
 	T_WAIT_UNTIL(4);
@@ -246,7 +246,7 @@ static void op_0x1c(void)
 }
 
 /*DEC E*/
-static void op_0x1d(void)
+static void op_0x1d(Z80EX_CONTEXT *cpu)
 {
 	DEC(E);
 	T_WAIT_UNTIL(4);
@@ -254,7 +254,7 @@ static void op_0x1d(void)
 }
 
 /*LD E,#*/
-static void op_0x1e(void)
+static void op_0x1e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(E,temp_byte);
@@ -263,7 +263,7 @@ static void op_0x1e(void)
 }
 
 /*RRA*/
-static void op_0x1f(void)
+static void op_0x1f(Z80EX_CONTEXT *cpu)
 {
 	RRA();
 	T_WAIT_UNTIL(4);
@@ -271,7 +271,7 @@ static void op_0x1f(void)
 }
 
 /*JR NZ,%*/
-static void op_0x20(void)
+static void op_0x20(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -284,7 +284,7 @@ static void op_0x20(void)
 }
 
 /*LD HL,@*/
-static void op_0x21(void)
+static void op_0x21(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -294,7 +294,7 @@ static void op_0x21(void)
 }
 
 /*LD (@),HL*/
-static void op_0x22(void)
+static void op_0x22(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -306,7 +306,7 @@ static void op_0x22(void)
 }
 
 /*INC HL*/
-static void op_0x23(void)
+static void op_0x23(Z80EX_CONTEXT *cpu)
 {
 	INC16(HL);
 	T_WAIT_UNTIL(6);
@@ -314,7 +314,7 @@ static void op_0x23(void)
 }
 
 /*INC H*/
-static void op_0x24(void)
+static void op_0x24(Z80EX_CONTEXT *cpu)
 {
 	INC(H);
 	T_WAIT_UNTIL(4);
@@ -322,7 +322,7 @@ static void op_0x24(void)
 }
 
 /*DEC H*/
-static void op_0x25(void)
+static void op_0x25(Z80EX_CONTEXT *cpu)
 {
 	DEC(H);
 	T_WAIT_UNTIL(4);
@@ -330,7 +330,7 @@ static void op_0x25(void)
 }
 
 /*LD H,#*/
-static void op_0x26(void)
+static void op_0x26(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(H,temp_byte);
@@ -339,7 +339,7 @@ static void op_0x26(void)
 }
 
 /*DAA*/
-static void op_0x27(void)
+static void op_0x27(Z80EX_CONTEXT *cpu)
 {
 	DAA();
 	T_WAIT_UNTIL(4);
@@ -347,7 +347,7 @@ static void op_0x27(void)
 }
 
 /*JR Z,%*/
-static void op_0x28(void)
+static void op_0x28(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -360,7 +360,7 @@ static void op_0x28(void)
 }
 
 /*ADD HL,HL*/
-static void op_0x29(void)
+static void op_0x29(Z80EX_CONTEXT *cpu)
 {
 	ADD16(HL,HL);
 	T_WAIT_UNTIL(11);
@@ -368,7 +368,7 @@ static void op_0x29(void)
 }
 
 /*LD HL,(@)*/
-static void op_0x2a(void)
+static void op_0x2a(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -380,7 +380,7 @@ static void op_0x2a(void)
 }
 
 /*DEC HL*/
-static void op_0x2b(void)
+static void op_0x2b(Z80EX_CONTEXT *cpu)
 {
 	DEC16(HL);
 	T_WAIT_UNTIL(6);
@@ -388,7 +388,7 @@ static void op_0x2b(void)
 }
 
 /*INC L*/
-static void op_0x2c(void)
+static void op_0x2c(Z80EX_CONTEXT *cpu)
 {
 	INC(L);
 	T_WAIT_UNTIL(4);
@@ -396,7 +396,7 @@ static void op_0x2c(void)
 }
 
 /*DEC L*/
-static void op_0x2d(void)
+static void op_0x2d(Z80EX_CONTEXT *cpu)
 {
 	DEC(L);
 	T_WAIT_UNTIL(4);
@@ -404,7 +404,7 @@ static void op_0x2d(void)
 }
 
 /*LD L,#*/
-static void op_0x2e(void)
+static void op_0x2e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(L,temp_byte);
@@ -413,7 +413,7 @@ static void op_0x2e(void)
 }
 
 /*CPL*/
-static void op_0x2f(void)
+static void op_0x2f(Z80EX_CONTEXT *cpu)
 {
 	CPL();
 	T_WAIT_UNTIL(4);
@@ -421,7 +421,7 @@ static void op_0x2f(void)
 }
 
 /*JR NC,%*/
-static void op_0x30(void)
+static void op_0x30(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -434,7 +434,7 @@ static void op_0x30(void)
 }
 
 /*LD SP,@*/
-static void op_0x31(void)
+static void op_0x31(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -444,7 +444,7 @@ static void op_0x31(void)
 }
 
 /*LD (@),A*/
-static void op_0x32(void)
+static void op_0x32(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -455,7 +455,7 @@ static void op_0x32(void)
 }
 
 /*INC SP*/
-static void op_0x33(void)
+static void op_0x33(Z80EX_CONTEXT *cpu)
 {
 	INC16(SP);
 	T_WAIT_UNTIL(6);
@@ -463,7 +463,7 @@ static void op_0x33(void)
 }
 
 /*INC (HL)*/
-static void op_0x34(void)
+static void op_0x34(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	INC(temp_byte);
@@ -473,7 +473,7 @@ static void op_0x34(void)
 }
 
 /*DEC (HL)*/
-static void op_0x35(void)
+static void op_0x35(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	DEC(temp_byte);
@@ -483,7 +483,7 @@ static void op_0x35(void)
 }
 
 /*LD (HL),#*/
-static void op_0x36(void)
+static void op_0x36(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(temp_byte,temp_byte);
@@ -493,7 +493,7 @@ static void op_0x36(void)
 }
 
 /*SCF*/
-static void op_0x37(void)
+static void op_0x37(Z80EX_CONTEXT *cpu)
 {
 	SCF();
 	T_WAIT_UNTIL(4);
@@ -501,7 +501,7 @@ static void op_0x37(void)
 }
 
 /*JR C,%*/
-static void op_0x38(void)
+static void op_0x38(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -514,7 +514,7 @@ static void op_0x38(void)
 }
 
 /*ADD HL,SP*/
-static void op_0x39(void)
+static void op_0x39(Z80EX_CONTEXT *cpu)
 {
 	ADD16(HL,SP);
 	T_WAIT_UNTIL(11);
@@ -522,7 +522,7 @@ static void op_0x39(void)
 }
 
 /*LD A,(@)*/
-static void op_0x3a(void)
+static void op_0x3a(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -533,7 +533,7 @@ static void op_0x3a(void)
 }
 
 /*DEC SP*/
-static void op_0x3b(void)
+static void op_0x3b(Z80EX_CONTEXT *cpu)
 {
 	DEC16(SP);
 	T_WAIT_UNTIL(6);
@@ -541,7 +541,7 @@ static void op_0x3b(void)
 }
 
 /*INC A*/
-static void op_0x3c(void)
+static void op_0x3c(Z80EX_CONTEXT *cpu)
 {
 	INC(A);
 	T_WAIT_UNTIL(4);
@@ -549,7 +549,7 @@ static void op_0x3c(void)
 }
 
 /*DEC A*/
-static void op_0x3d(void)
+static void op_0x3d(Z80EX_CONTEXT *cpu)
 {
 	DEC(A);
 	T_WAIT_UNTIL(4);
@@ -557,7 +557,7 @@ static void op_0x3d(void)
 }
 
 /*LD A,#*/
-static void op_0x3e(void)
+static void op_0x3e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(A,temp_byte);
@@ -566,7 +566,7 @@ static void op_0x3e(void)
 }
 
 /*CCF*/
-static void op_0x3f(void)
+static void op_0x3f(Z80EX_CONTEXT *cpu)
 {
 	CCF();
 	T_WAIT_UNTIL(4);
@@ -574,7 +574,7 @@ static void op_0x3f(void)
 }
 
 /*LD B,B*/
-static void op_0x40(void)
+static void op_0x40(Z80EX_CONTEXT *cpu)
 {
 	LD(B,B);
 	T_WAIT_UNTIL(4);
@@ -582,7 +582,7 @@ static void op_0x40(void)
 }
 
 /*LD B,C*/
-static void op_0x41(void)
+static void op_0x41(Z80EX_CONTEXT *cpu)
 {
 	LD(B,C);
 	T_WAIT_UNTIL(4);
@@ -590,7 +590,7 @@ static void op_0x41(void)
 }
 
 /*LD B,D*/
-static void op_0x42(void)
+static void op_0x42(Z80EX_CONTEXT *cpu)
 {
 	LD(B,D);
 	T_WAIT_UNTIL(4);
@@ -598,7 +598,7 @@ static void op_0x42(void)
 }
 
 /*LD B,E*/
-static void op_0x43(void)
+static void op_0x43(Z80EX_CONTEXT *cpu)
 {
 	LD(B,E);
 	T_WAIT_UNTIL(4);
@@ -606,7 +606,7 @@ static void op_0x43(void)
 }
 
 /*LD B,H*/
-static void op_0x44(void)
+static void op_0x44(Z80EX_CONTEXT *cpu)
 {
 	LD(B,H);
 	T_WAIT_UNTIL(4);
@@ -614,7 +614,7 @@ static void op_0x44(void)
 }
 
 /*LD B,L*/
-static void op_0x45(void)
+static void op_0x45(Z80EX_CONTEXT *cpu)
 {
 	LD(B,L);
 	T_WAIT_UNTIL(4);
@@ -622,7 +622,7 @@ static void op_0x45(void)
 }
 
 /*LD B,(HL)*/
-static void op_0x46(void)
+static void op_0x46(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(B,temp_byte);
@@ -631,7 +631,7 @@ static void op_0x46(void)
 }
 
 /*LD B,A*/
-static void op_0x47(void)
+static void op_0x47(Z80EX_CONTEXT *cpu)
 {
 	LD(B,A);
 	T_WAIT_UNTIL(4);
@@ -639,7 +639,7 @@ static void op_0x47(void)
 }
 
 /*LD C,B*/
-static void op_0x48(void)
+static void op_0x48(Z80EX_CONTEXT *cpu)
 {
 	LD(C,B);
 	T_WAIT_UNTIL(4);
@@ -647,7 +647,7 @@ static void op_0x48(void)
 }
 
 /*LD C,C*/
-static void op_0x49(void)
+static void op_0x49(Z80EX_CONTEXT *cpu)
 {
 	LD(C,C);
 	T_WAIT_UNTIL(4);
@@ -655,7 +655,7 @@ static void op_0x49(void)
 }
 
 /*LD C,D*/
-static void op_0x4a(void)
+static void op_0x4a(Z80EX_CONTEXT *cpu)
 {
 	LD(C,D);
 	T_WAIT_UNTIL(4);
@@ -663,7 +663,7 @@ static void op_0x4a(void)
 }
 
 /*LD C,E*/
-static void op_0x4b(void)
+static void op_0x4b(Z80EX_CONTEXT *cpu)
 {
 	LD(C,E);
 	T_WAIT_UNTIL(4);
@@ -671,7 +671,7 @@ static void op_0x4b(void)
 }
 
 /*LD C,H*/
-static void op_0x4c(void)
+static void op_0x4c(Z80EX_CONTEXT *cpu)
 {
 	LD(C,H);
 	T_WAIT_UNTIL(4);
@@ -679,7 +679,7 @@ static void op_0x4c(void)
 }
 
 /*LD C,L*/
-static void op_0x4d(void)
+static void op_0x4d(Z80EX_CONTEXT *cpu)
 {
 	LD(C,L);
 	T_WAIT_UNTIL(4);
@@ -687,7 +687,7 @@ static void op_0x4d(void)
 }
 
 /*LD C,(HL)*/
-static void op_0x4e(void)
+static void op_0x4e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(C,temp_byte);
@@ -696,7 +696,7 @@ static void op_0x4e(void)
 }
 
 /*LD C,A*/
-static void op_0x4f(void)
+static void op_0x4f(Z80EX_CONTEXT *cpu)
 {
 	LD(C,A);
 	T_WAIT_UNTIL(4);
@@ -704,7 +704,7 @@ static void op_0x4f(void)
 }
 
 /*LD D,B*/
-static void op_0x50(void)
+static void op_0x50(Z80EX_CONTEXT *cpu)
 {
 	LD(D,B);
 	T_WAIT_UNTIL(4);
@@ -712,7 +712,7 @@ static void op_0x50(void)
 }
 
 /*LD D,C*/
-static void op_0x51(void)
+static void op_0x51(Z80EX_CONTEXT *cpu)
 {
 	LD(D,C);
 	T_WAIT_UNTIL(4);
@@ -720,7 +720,7 @@ static void op_0x51(void)
 }
 
 /*LD D,D*/
-static void op_0x52(void)
+static void op_0x52(Z80EX_CONTEXT *cpu)
 {
 	LD(D,D);
 	T_WAIT_UNTIL(4);
@@ -728,7 +728,7 @@ static void op_0x52(void)
 }
 
 /*LD D,E*/
-static void op_0x53(void)
+static void op_0x53(Z80EX_CONTEXT *cpu)
 {
 	LD(D,E);
 	T_WAIT_UNTIL(4);
@@ -736,7 +736,7 @@ static void op_0x53(void)
 }
 
 /*LD D,H*/
-static void op_0x54(void)
+static void op_0x54(Z80EX_CONTEXT *cpu)
 {
 	LD(D,H);
 	T_WAIT_UNTIL(4);
@@ -744,7 +744,7 @@ static void op_0x54(void)
 }
 
 /*LD D,L*/
-static void op_0x55(void)
+static void op_0x55(Z80EX_CONTEXT *cpu)
 {
 	LD(D,L);
 	T_WAIT_UNTIL(4);
@@ -752,7 +752,7 @@ static void op_0x55(void)
 }
 
 /*LD D,(HL)*/
-static void op_0x56(void)
+static void op_0x56(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(D,temp_byte);
@@ -761,7 +761,7 @@ static void op_0x56(void)
 }
 
 /*LD D,A*/
-static void op_0x57(void)
+static void op_0x57(Z80EX_CONTEXT *cpu)
 {
 	LD(D,A);
 	T_WAIT_UNTIL(4);
@@ -769,7 +769,7 @@ static void op_0x57(void)
 }
 
 /*LD E,B*/
-static void op_0x58(void)
+static void op_0x58(Z80EX_CONTEXT *cpu)
 {
 	LD(E,B);
 	T_WAIT_UNTIL(4);
@@ -777,7 +777,7 @@ static void op_0x58(void)
 }
 
 /*LD E,C*/
-static void op_0x59(void)
+static void op_0x59(Z80EX_CONTEXT *cpu)
 {
 	LD(E,C);
 	T_WAIT_UNTIL(4);
@@ -785,7 +785,7 @@ static void op_0x59(void)
 }
 
 /*LD E,D*/
-static void op_0x5a(void)
+static void op_0x5a(Z80EX_CONTEXT *cpu)
 {
 	LD(E,D);
 	T_WAIT_UNTIL(4);
@@ -793,7 +793,7 @@ static void op_0x5a(void)
 }
 
 /*LD E,E*/
-static void op_0x5b(void)
+static void op_0x5b(Z80EX_CONTEXT *cpu)
 {
 	LD(E,E);
 	T_WAIT_UNTIL(4);
@@ -801,7 +801,7 @@ static void op_0x5b(void)
 }
 
 /*LD E,H*/
-static void op_0x5c(void)
+static void op_0x5c(Z80EX_CONTEXT *cpu)
 {
 	LD(E,H);
 	T_WAIT_UNTIL(4);
@@ -809,7 +809,7 @@ static void op_0x5c(void)
 }
 
 /*LD E,L*/
-static void op_0x5d(void)
+static void op_0x5d(Z80EX_CONTEXT *cpu)
 {
 	LD(E,L);
 	T_WAIT_UNTIL(4);
@@ -817,7 +817,7 @@ static void op_0x5d(void)
 }
 
 /*LD E,(HL)*/
-static void op_0x5e(void)
+static void op_0x5e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(E,temp_byte);
@@ -826,7 +826,7 @@ static void op_0x5e(void)
 }
 
 /*LD E,A*/
-static void op_0x5f(void)
+static void op_0x5f(Z80EX_CONTEXT *cpu)
 {
 	LD(E,A);
 	T_WAIT_UNTIL(4);
@@ -834,7 +834,7 @@ static void op_0x5f(void)
 }
 
 /*LD H,B*/
-static void op_0x60(void)
+static void op_0x60(Z80EX_CONTEXT *cpu)
 {
 	LD(H,B);
 	T_WAIT_UNTIL(4);
@@ -842,7 +842,7 @@ static void op_0x60(void)
 }
 
 /*LD H,C*/
-static void op_0x61(void)
+static void op_0x61(Z80EX_CONTEXT *cpu)
 {
 	LD(H,C);
 	T_WAIT_UNTIL(4);
@@ -850,7 +850,7 @@ static void op_0x61(void)
 }
 
 /*LD H,D*/
-static void op_0x62(void)
+static void op_0x62(Z80EX_CONTEXT *cpu)
 {
 	LD(H,D);
 	T_WAIT_UNTIL(4);
@@ -858,7 +858,7 @@ static void op_0x62(void)
 }
 
 /*LD H,E*/
-static void op_0x63(void)
+static void op_0x63(Z80EX_CONTEXT *cpu)
 {
 	LD(H,E);
 	T_WAIT_UNTIL(4);
@@ -866,7 +866,7 @@ static void op_0x63(void)
 }
 
 /*LD H,H*/
-static void op_0x64(void)
+static void op_0x64(Z80EX_CONTEXT *cpu)
 {
 	LD(H,H);
 	T_WAIT_UNTIL(4);
@@ -874,7 +874,7 @@ static void op_0x64(void)
 }
 
 /*LD H,L*/
-static void op_0x65(void)
+static void op_0x65(Z80EX_CONTEXT *cpu)
 {
 	LD(H,L);
 	T_WAIT_UNTIL(4);
@@ -882,7 +882,7 @@ static void op_0x65(void)
 }
 
 /*LD H,(HL)*/
-static void op_0x66(void)
+static void op_0x66(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(H,temp_byte);
@@ -891,7 +891,7 @@ static void op_0x66(void)
 }
 
 /*LD H,A*/
-static void op_0x67(void)
+static void op_0x67(Z80EX_CONTEXT *cpu)
 {
 	LD(H,A);
 	T_WAIT_UNTIL(4);
@@ -899,7 +899,7 @@ static void op_0x67(void)
 }
 
 /*LD L,B*/
-static void op_0x68(void)
+static void op_0x68(Z80EX_CONTEXT *cpu)
 {
 	LD(L,B);
 	T_WAIT_UNTIL(4);
@@ -907,7 +907,7 @@ static void op_0x68(void)
 }
 
 /*LD L,C*/
-static void op_0x69(void)
+static void op_0x69(Z80EX_CONTEXT *cpu)
 {
 	LD(L,C);
 	T_WAIT_UNTIL(4);
@@ -915,7 +915,7 @@ static void op_0x69(void)
 }
 
 /*LD L,D*/
-static void op_0x6a(void)
+static void op_0x6a(Z80EX_CONTEXT *cpu)
 {
 	LD(L,D);
 	T_WAIT_UNTIL(4);
@@ -923,7 +923,7 @@ static void op_0x6a(void)
 }
 
 /*LD L,E*/
-static void op_0x6b(void)
+static void op_0x6b(Z80EX_CONTEXT *cpu)
 {
 	LD(L,E);
 	T_WAIT_UNTIL(4);
@@ -931,7 +931,7 @@ static void op_0x6b(void)
 }
 
 /*LD L,H*/
-static void op_0x6c(void)
+static void op_0x6c(Z80EX_CONTEXT *cpu)
 {
 	LD(L,H);
 	T_WAIT_UNTIL(4);
@@ -939,7 +939,7 @@ static void op_0x6c(void)
 }
 
 /*LD L,L*/
-static void op_0x6d(void)
+static void op_0x6d(Z80EX_CONTEXT *cpu)
 {
 	LD(L,L);
 	T_WAIT_UNTIL(4);
@@ -947,7 +947,7 @@ static void op_0x6d(void)
 }
 
 /*LD L,(HL)*/
-static void op_0x6e(void)
+static void op_0x6e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(L,temp_byte);
@@ -956,7 +956,7 @@ static void op_0x6e(void)
 }
 
 /*LD L,A*/
-static void op_0x6f(void)
+static void op_0x6f(Z80EX_CONTEXT *cpu)
 {
 	LD(L,A);
 	T_WAIT_UNTIL(4);
@@ -964,7 +964,7 @@ static void op_0x6f(void)
 }
 
 /*LD (HL),B*/
-static void op_0x70(void)
+static void op_0x70(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,B);
 	WRITE_MEM((HL),temp_byte,4);
@@ -973,7 +973,7 @@ static void op_0x70(void)
 }
 
 /*LD (HL),C*/
-static void op_0x71(void)
+static void op_0x71(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,C);
 	WRITE_MEM((HL),temp_byte,4);
@@ -982,7 +982,7 @@ static void op_0x71(void)
 }
 
 /*LD (HL),D*/
-static void op_0x72(void)
+static void op_0x72(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,D);
 	WRITE_MEM((HL),temp_byte,4);
@@ -991,7 +991,7 @@ static void op_0x72(void)
 }
 
 /*LD (HL),E*/
-static void op_0x73(void)
+static void op_0x73(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,E);
 	WRITE_MEM((HL),temp_byte,4);
@@ -1000,7 +1000,7 @@ static void op_0x73(void)
 }
 
 /*LD (HL),H*/
-static void op_0x74(void)
+static void op_0x74(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,H);
 	WRITE_MEM((HL),temp_byte,4);
@@ -1009,7 +1009,7 @@ static void op_0x74(void)
 }
 
 /*LD (HL),L*/
-static void op_0x75(void)
+static void op_0x75(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,L);
 	WRITE_MEM((HL),temp_byte,4);
@@ -1018,7 +1018,7 @@ static void op_0x75(void)
 }
 
 /*HALT*/
-static void op_0x76(void)
+static void op_0x76(Z80EX_CONTEXT *cpu)
 {
 	HALT();
 	T_WAIT_UNTIL(4);
@@ -1026,7 +1026,7 @@ static void op_0x76(void)
 }
 
 /*LD (HL),A*/
-static void op_0x77(void)
+static void op_0x77(Z80EX_CONTEXT *cpu)
 {
 	LD(temp_byte,A);
 	WRITE_MEM((HL),temp_byte,4);
@@ -1035,7 +1035,7 @@ static void op_0x77(void)
 }
 
 /*LD A,B*/
-static void op_0x78(void)
+static void op_0x78(Z80EX_CONTEXT *cpu)
 {
 	LD(A,B);
 	T_WAIT_UNTIL(4);
@@ -1043,7 +1043,7 @@ static void op_0x78(void)
 }
 
 /*LD A,C*/
-static void op_0x79(void)
+static void op_0x79(Z80EX_CONTEXT *cpu)
 {
 	LD(A,C);
 	T_WAIT_UNTIL(4);
@@ -1051,7 +1051,7 @@ static void op_0x79(void)
 }
 
 /*LD A,D*/
-static void op_0x7a(void)
+static void op_0x7a(Z80EX_CONTEXT *cpu)
 {
 	LD(A,D);
 	T_WAIT_UNTIL(4);
@@ -1059,7 +1059,7 @@ static void op_0x7a(void)
 }
 
 /*LD A,E*/
-static void op_0x7b(void)
+static void op_0x7b(Z80EX_CONTEXT *cpu)
 {
 	LD(A,E);
 	T_WAIT_UNTIL(4);
@@ -1067,7 +1067,7 @@ static void op_0x7b(void)
 }
 
 /*LD A,H*/
-static void op_0x7c(void)
+static void op_0x7c(Z80EX_CONTEXT *cpu)
 {
 	LD(A,H);
 	T_WAIT_UNTIL(4);
@@ -1075,7 +1075,7 @@ static void op_0x7c(void)
 }
 
 /*LD A,L*/
-static void op_0x7d(void)
+static void op_0x7d(Z80EX_CONTEXT *cpu)
 {
 	LD(A,L);
 	T_WAIT_UNTIL(4);
@@ -1083,7 +1083,7 @@ static void op_0x7d(void)
 }
 
 /*LD A,(HL)*/
-static void op_0x7e(void)
+static void op_0x7e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	LD(A,temp_byte);
@@ -1092,7 +1092,7 @@ static void op_0x7e(void)
 }
 
 /*LD A,A*/
-static void op_0x7f(void)
+static void op_0x7f(Z80EX_CONTEXT *cpu)
 {
 	LD(A,A);
 	T_WAIT_UNTIL(4);
@@ -1100,7 +1100,7 @@ static void op_0x7f(void)
 }
 
 /*ADD A,B*/
-static void op_0x80(void)
+static void op_0x80(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,B);
 	T_WAIT_UNTIL(4);
@@ -1108,7 +1108,7 @@ static void op_0x80(void)
 }
 
 /*ADD A,C*/
-static void op_0x81(void)
+static void op_0x81(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,C);
 	T_WAIT_UNTIL(4);
@@ -1116,7 +1116,7 @@ static void op_0x81(void)
 }
 
 /*ADD A,D*/
-static void op_0x82(void)
+static void op_0x82(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,D);
 	T_WAIT_UNTIL(4);
@@ -1124,7 +1124,7 @@ static void op_0x82(void)
 }
 
 /*ADD A,E*/
-static void op_0x83(void)
+static void op_0x83(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,E);
 	T_WAIT_UNTIL(4);
@@ -1132,7 +1132,7 @@ static void op_0x83(void)
 }
 
 /*ADD A,H*/
-static void op_0x84(void)
+static void op_0x84(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,H);
 	T_WAIT_UNTIL(4);
@@ -1140,7 +1140,7 @@ static void op_0x84(void)
 }
 
 /*ADD A,L*/
-static void op_0x85(void)
+static void op_0x85(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,L);
 	T_WAIT_UNTIL(4);
@@ -1148,7 +1148,7 @@ static void op_0x85(void)
 }
 
 /*ADD A,(HL)*/
-static void op_0x86(void)
+static void op_0x86(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	ADD(A,temp_byte);
@@ -1157,7 +1157,7 @@ static void op_0x86(void)
 }
 
 /*ADD A,A*/
-static void op_0x87(void)
+static void op_0x87(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,A);
 	T_WAIT_UNTIL(4);
@@ -1165,7 +1165,7 @@ static void op_0x87(void)
 }
 
 /*ADC A,B*/
-static void op_0x88(void)
+static void op_0x88(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,B);
 	T_WAIT_UNTIL(4);
@@ -1173,7 +1173,7 @@ static void op_0x88(void)
 }
 
 /*ADC A,C*/
-static void op_0x89(void)
+static void op_0x89(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,C);
 	T_WAIT_UNTIL(4);
@@ -1181,7 +1181,7 @@ static void op_0x89(void)
 }
 
 /*ADC A,D*/
-static void op_0x8a(void)
+static void op_0x8a(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,D);
 	T_WAIT_UNTIL(4);
@@ -1189,7 +1189,7 @@ static void op_0x8a(void)
 }
 
 /*ADC A,E*/
-static void op_0x8b(void)
+static void op_0x8b(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,E);
 	T_WAIT_UNTIL(4);
@@ -1197,7 +1197,7 @@ static void op_0x8b(void)
 }
 
 /*ADC A,H*/
-static void op_0x8c(void)
+static void op_0x8c(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,H);
 	T_WAIT_UNTIL(4);
@@ -1205,7 +1205,7 @@ static void op_0x8c(void)
 }
 
 /*ADC A,L*/
-static void op_0x8d(void)
+static void op_0x8d(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,L);
 	T_WAIT_UNTIL(4);
@@ -1213,7 +1213,7 @@ static void op_0x8d(void)
 }
 
 /*ADC A,(HL)*/
-static void op_0x8e(void)
+static void op_0x8e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	ADC(A,temp_byte);
@@ -1222,7 +1222,7 @@ static void op_0x8e(void)
 }
 
 /*ADC A,A*/
-static void op_0x8f(void)
+static void op_0x8f(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,A);
 	T_WAIT_UNTIL(4);
@@ -1230,7 +1230,7 @@ static void op_0x8f(void)
 }
 
 /*SUB B*/
-static void op_0x90(void)
+static void op_0x90(Z80EX_CONTEXT *cpu)
 {
 	SUB(B);
 	T_WAIT_UNTIL(4);
@@ -1238,7 +1238,7 @@ static void op_0x90(void)
 }
 
 /*SUB C*/
-static void op_0x91(void)
+static void op_0x91(Z80EX_CONTEXT *cpu)
 {
 	SUB(C);
 	T_WAIT_UNTIL(4);
@@ -1246,7 +1246,7 @@ static void op_0x91(void)
 }
 
 /*SUB D*/
-static void op_0x92(void)
+static void op_0x92(Z80EX_CONTEXT *cpu)
 {
 	SUB(D);
 	T_WAIT_UNTIL(4);
@@ -1254,7 +1254,7 @@ static void op_0x92(void)
 }
 
 /*SUB E*/
-static void op_0x93(void)
+static void op_0x93(Z80EX_CONTEXT *cpu)
 {
 	SUB(E);
 	T_WAIT_UNTIL(4);
@@ -1262,7 +1262,7 @@ static void op_0x93(void)
 }
 
 /*SUB H*/
-static void op_0x94(void)
+static void op_0x94(Z80EX_CONTEXT *cpu)
 {
 	SUB(H);
 	T_WAIT_UNTIL(4);
@@ -1270,7 +1270,7 @@ static void op_0x94(void)
 }
 
 /*SUB L*/
-static void op_0x95(void)
+static void op_0x95(Z80EX_CONTEXT *cpu)
 {
 	SUB(L);
 	T_WAIT_UNTIL(4);
@@ -1278,7 +1278,7 @@ static void op_0x95(void)
 }
 
 /*SUB (HL)*/
-static void op_0x96(void)
+static void op_0x96(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SUB(temp_byte);
@@ -1287,7 +1287,7 @@ static void op_0x96(void)
 }
 
 /*SUB A*/
-static void op_0x97(void)
+static void op_0x97(Z80EX_CONTEXT *cpu)
 {
 	SUB(A);
 	T_WAIT_UNTIL(4);
@@ -1295,7 +1295,7 @@ static void op_0x97(void)
 }
 
 /*SBC A,B*/
-static void op_0x98(void)
+static void op_0x98(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,B);
 	T_WAIT_UNTIL(4);
@@ -1303,7 +1303,7 @@ static void op_0x98(void)
 }
 
 /*SBC A,C*/
-static void op_0x99(void)
+static void op_0x99(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,C);
 	T_WAIT_UNTIL(4);
@@ -1311,7 +1311,7 @@ static void op_0x99(void)
 }
 
 /*SBC A,D*/
-static void op_0x9a(void)
+static void op_0x9a(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,D);
 	T_WAIT_UNTIL(4);
@@ -1319,7 +1319,7 @@ static void op_0x9a(void)
 }
 
 /*SBC A,E*/
-static void op_0x9b(void)
+static void op_0x9b(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,E);
 	T_WAIT_UNTIL(4);
@@ -1327,7 +1327,7 @@ static void op_0x9b(void)
 }
 
 /*SBC A,H*/
-static void op_0x9c(void)
+static void op_0x9c(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,H);
 	T_WAIT_UNTIL(4);
@@ -1335,7 +1335,7 @@ static void op_0x9c(void)
 }
 
 /*SBC A,L*/
-static void op_0x9d(void)
+static void op_0x9d(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,L);
 	T_WAIT_UNTIL(4);
@@ -1343,7 +1343,7 @@ static void op_0x9d(void)
 }
 
 /*SBC A,(HL)*/
-static void op_0x9e(void)
+static void op_0x9e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SBC(A,temp_byte);
@@ -1352,7 +1352,7 @@ static void op_0x9e(void)
 }
 
 /*SBC A,A*/
-static void op_0x9f(void)
+static void op_0x9f(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,A);
 	T_WAIT_UNTIL(4);
@@ -1360,7 +1360,7 @@ static void op_0x9f(void)
 }
 
 /*AND B*/
-static void op_0xa0(void)
+static void op_0xa0(Z80EX_CONTEXT *cpu)
 {
 	AND(B);
 	T_WAIT_UNTIL(4);
@@ -1368,7 +1368,7 @@ static void op_0xa0(void)
 }
 
 /*AND C*/
-static void op_0xa1(void)
+static void op_0xa1(Z80EX_CONTEXT *cpu)
 {
 	AND(C);
 	T_WAIT_UNTIL(4);
@@ -1376,7 +1376,7 @@ static void op_0xa1(void)
 }
 
 /*AND D*/
-static void op_0xa2(void)
+static void op_0xa2(Z80EX_CONTEXT *cpu)
 {
 	AND(D);
 	T_WAIT_UNTIL(4);
@@ -1384,7 +1384,7 @@ static void op_0xa2(void)
 }
 
 /*AND E*/
-static void op_0xa3(void)
+static void op_0xa3(Z80EX_CONTEXT *cpu)
 {
 	AND(E);
 	T_WAIT_UNTIL(4);
@@ -1392,7 +1392,7 @@ static void op_0xa3(void)
 }
 
 /*AND H*/
-static void op_0xa4(void)
+static void op_0xa4(Z80EX_CONTEXT *cpu)
 {
 	AND(H);
 	T_WAIT_UNTIL(4);
@@ -1400,7 +1400,7 @@ static void op_0xa4(void)
 }
 
 /*AND L*/
-static void op_0xa5(void)
+static void op_0xa5(Z80EX_CONTEXT *cpu)
 {
 	AND(L);
 	T_WAIT_UNTIL(4);
@@ -1408,7 +1408,7 @@ static void op_0xa5(void)
 }
 
 /*AND (HL)*/
-static void op_0xa6(void)
+static void op_0xa6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	AND(temp_byte);
@@ -1417,7 +1417,7 @@ static void op_0xa6(void)
 }
 
 /*AND A*/
-static void op_0xa7(void)
+static void op_0xa7(Z80EX_CONTEXT *cpu)
 {
 	AND(A);
 	T_WAIT_UNTIL(4);
@@ -1425,7 +1425,7 @@ static void op_0xa7(void)
 }
 
 /*XOR B*/
-static void op_0xa8(void)
+static void op_0xa8(Z80EX_CONTEXT *cpu)
 {
 	XOR(B);
 	T_WAIT_UNTIL(4);
@@ -1433,7 +1433,7 @@ static void op_0xa8(void)
 }
 
 /*XOR C*/
-static void op_0xa9(void)
+static void op_0xa9(Z80EX_CONTEXT *cpu)
 {
 	XOR(C);
 	T_WAIT_UNTIL(4);
@@ -1441,7 +1441,7 @@ static void op_0xa9(void)
 }
 
 /*XOR D*/
-static void op_0xaa(void)
+static void op_0xaa(Z80EX_CONTEXT *cpu)
 {
 	XOR(D);
 	T_WAIT_UNTIL(4);
@@ -1449,7 +1449,7 @@ static void op_0xaa(void)
 }
 
 /*XOR E*/
-static void op_0xab(void)
+static void op_0xab(Z80EX_CONTEXT *cpu)
 {
 	XOR(E);
 	T_WAIT_UNTIL(4);
@@ -1457,7 +1457,7 @@ static void op_0xab(void)
 }
 
 /*XOR H*/
-static void op_0xac(void)
+static void op_0xac(Z80EX_CONTEXT *cpu)
 {
 	XOR(H);
 	T_WAIT_UNTIL(4);
@@ -1465,7 +1465,7 @@ static void op_0xac(void)
 }
 
 /*XOR L*/
-static void op_0xad(void)
+static void op_0xad(Z80EX_CONTEXT *cpu)
 {
 	XOR(L);
 	T_WAIT_UNTIL(4);
@@ -1473,7 +1473,7 @@ static void op_0xad(void)
 }
 
 /*XOR (HL)*/
-static void op_0xae(void)
+static void op_0xae(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	XOR(temp_byte);
@@ -1482,7 +1482,7 @@ static void op_0xae(void)
 }
 
 /*XOR A*/
-static void op_0xaf(void)
+static void op_0xaf(Z80EX_CONTEXT *cpu)
 {
 	XOR(A);
 	T_WAIT_UNTIL(4);
@@ -1490,7 +1490,7 @@ static void op_0xaf(void)
 }
 
 /*OR B*/
-static void op_0xb0(void)
+static void op_0xb0(Z80EX_CONTEXT *cpu)
 {
 	OR(B);
 	T_WAIT_UNTIL(4);
@@ -1498,7 +1498,7 @@ static void op_0xb0(void)
 }
 
 /*OR C*/
-static void op_0xb1(void)
+static void op_0xb1(Z80EX_CONTEXT *cpu)
 {
 	OR(C);
 	T_WAIT_UNTIL(4);
@@ -1506,7 +1506,7 @@ static void op_0xb1(void)
 }
 
 /*OR D*/
-static void op_0xb2(void)
+static void op_0xb2(Z80EX_CONTEXT *cpu)
 {
 	OR(D);
 	T_WAIT_UNTIL(4);
@@ -1514,7 +1514,7 @@ static void op_0xb2(void)
 }
 
 /*OR E*/
-static void op_0xb3(void)
+static void op_0xb3(Z80EX_CONTEXT *cpu)
 {
 	OR(E);
 	T_WAIT_UNTIL(4);
@@ -1522,7 +1522,7 @@ static void op_0xb3(void)
 }
 
 /*OR H*/
-static void op_0xb4(void)
+static void op_0xb4(Z80EX_CONTEXT *cpu)
 {
 	OR(H);
 	T_WAIT_UNTIL(4);
@@ -1530,7 +1530,7 @@ static void op_0xb4(void)
 }
 
 /*OR L*/
-static void op_0xb5(void)
+static void op_0xb5(Z80EX_CONTEXT *cpu)
 {
 	OR(L);
 	T_WAIT_UNTIL(4);
@@ -1538,7 +1538,7 @@ static void op_0xb5(void)
 }
 
 /*OR (HL)*/
-static void op_0xb6(void)
+static void op_0xb6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	OR(temp_byte);
@@ -1547,7 +1547,7 @@ static void op_0xb6(void)
 }
 
 /*OR A*/
-static void op_0xb7(void)
+static void op_0xb7(Z80EX_CONTEXT *cpu)
 {
 	OR(A);
 	T_WAIT_UNTIL(4);
@@ -1555,7 +1555,7 @@ static void op_0xb7(void)
 }
 
 /*CP B*/
-static void op_0xb8(void)
+static void op_0xb8(Z80EX_CONTEXT *cpu)
 {
 	CP(B);
 	T_WAIT_UNTIL(4);
@@ -1563,7 +1563,7 @@ static void op_0xb8(void)
 }
 
 /*CP C*/
-static void op_0xb9(void)
+static void op_0xb9(Z80EX_CONTEXT *cpu)
 {
 	CP(C);
 	T_WAIT_UNTIL(4);
@@ -1571,7 +1571,7 @@ static void op_0xb9(void)
 }
 
 /*CP D*/
-static void op_0xba(void)
+static void op_0xba(Z80EX_CONTEXT *cpu)
 {
 	CP(D);
 	T_WAIT_UNTIL(4);
@@ -1579,7 +1579,7 @@ static void op_0xba(void)
 }
 
 /*CP E*/
-static void op_0xbb(void)
+static void op_0xbb(Z80EX_CONTEXT *cpu)
 {
 	CP(E);
 	T_WAIT_UNTIL(4);
@@ -1587,7 +1587,7 @@ static void op_0xbb(void)
 }
 
 /*CP H*/
-static void op_0xbc(void)
+static void op_0xbc(Z80EX_CONTEXT *cpu)
 {
 	CP(H);
 	T_WAIT_UNTIL(4);
@@ -1595,7 +1595,7 @@ static void op_0xbc(void)
 }
 
 /*CP L*/
-static void op_0xbd(void)
+static void op_0xbd(Z80EX_CONTEXT *cpu)
 {
 	CP(L);
 	T_WAIT_UNTIL(4);
@@ -1603,7 +1603,7 @@ static void op_0xbd(void)
 }
 
 /*CP (HL)*/
-static void op_0xbe(void)
+static void op_0xbe(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	CP(temp_byte);
@@ -1612,7 +1612,7 @@ static void op_0xbe(void)
 }
 
 /*CP A*/
-static void op_0xbf(void)
+static void op_0xbf(Z80EX_CONTEXT *cpu)
 {
 	CP(A);
 	T_WAIT_UNTIL(4);
@@ -1620,7 +1620,7 @@ static void op_0xbf(void)
 }
 
 /*RET NZ*/
-static void op_0xc0(void)
+static void op_0xc0(Z80EX_CONTEXT *cpu)
 {
 	if(!(F & FLAG_Z)) {
 	RET(/*rd*/5,8);
@@ -1631,7 +1631,7 @@ static void op_0xc0(void)
 }
 
 /*POP BC*/
-static void op_0xc1(void)
+static void op_0xc1(Z80EX_CONTEXT *cpu)
 {
 	POP(BC, /*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -1639,7 +1639,7 @@ static void op_0xc1(void)
 }
 
 /*JP NZ,@*/
-static void op_0xc2(void)
+static void op_0xc2(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1652,7 +1652,7 @@ static void op_0xc2(void)
 }
 
 /*JP @*/
-static void op_0xc3(void)
+static void op_0xc3(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1662,7 +1662,7 @@ static void op_0xc3(void)
 }
 
 /*CALL NZ,@*/
-static void op_0xc4(void)
+static void op_0xc4(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1675,7 +1675,7 @@ static void op_0xc4(void)
 }
 
 /*PUSH BC*/
-static void op_0xc5(void)
+static void op_0xc5(Z80EX_CONTEXT *cpu)
 {
 	PUSH(BC, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1683,7 +1683,7 @@ static void op_0xc5(void)
 }
 
 /*ADD A,#*/
-static void op_0xc6(void)
+static void op_0xc6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	ADD(A,temp_byte);
@@ -1692,7 +1692,7 @@ static void op_0xc6(void)
 }
 
 /*RST 0x00*/
-static void op_0xc7(void)
+static void op_0xc7(Z80EX_CONTEXT *cpu)
 {
 	RST(0x00, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1700,7 +1700,7 @@ static void op_0xc7(void)
 }
 
 /*RET Z*/
-static void op_0xc8(void)
+static void op_0xc8(Z80EX_CONTEXT *cpu)
 {
 	if(F & FLAG_Z) {
 	RET(/*rd*/5,8);
@@ -1711,7 +1711,7 @@ static void op_0xc8(void)
 }
 
 /*RET*/
-static void op_0xc9(void)
+static void op_0xc9(Z80EX_CONTEXT *cpu)
 {
 	RET(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -1719,7 +1719,7 @@ static void op_0xc9(void)
 }
 
 /*JP Z,@*/
-static void op_0xca(void)
+static void op_0xca(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1731,14 +1731,14 @@ static void op_0xca(void)
 	return;
 }
 
-static void op_p_CB(void)
+static void op_p_CB(Z80EX_CONTEXT *cpu)
 {
-	z80ex.prefix=0xCB;
-	z80ex.noint_once=1;
+	cpu->prefix=0xCB;
+	cpu->noint_once=1;
 }
 
 /*CALL Z,@*/
-static void op_0xcc(void)
+static void op_0xcc(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1751,7 +1751,7 @@ static void op_0xcc(void)
 }
 
 /*CALL @*/
-static void op_0xcd(void)
+static void op_0xcd(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1761,7 +1761,7 @@ static void op_0xcd(void)
 }
 
 /*ADC A,#*/
-static void op_0xce(void)
+static void op_0xce(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	ADC(A,temp_byte);
@@ -1770,7 +1770,7 @@ static void op_0xce(void)
 }
 
 /*RST 0x08*/
-static void op_0xcf(void)
+static void op_0xcf(Z80EX_CONTEXT *cpu)
 {
 	RST(0x08, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1778,7 +1778,7 @@ static void op_0xcf(void)
 }
 
 /*RET NC*/
-static void op_0xd0(void)
+static void op_0xd0(Z80EX_CONTEXT *cpu)
 {
 	if(!(F & FLAG_C)) {
 	RET(/*rd*/5,8);
@@ -1789,7 +1789,7 @@ static void op_0xd0(void)
 }
 
 /*POP DE*/
-static void op_0xd1(void)
+static void op_0xd1(Z80EX_CONTEXT *cpu)
 {
 	POP(DE, /*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -1797,7 +1797,7 @@ static void op_0xd1(void)
 }
 
 /*JP NC,@*/
-static void op_0xd2(void)
+static void op_0xd2(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1810,7 +1810,7 @@ static void op_0xd2(void)
 }
 
 /*OUT (#),A*/
-static void op_0xd3(void)
+static void op_0xd3(Z80EX_CONTEXT *cpu)
 {
 	temp_word.w=(READ_OP() + ( A << 8 ));
 	OUT_A(temp_word.w,A, /*wr*/8);
@@ -1819,7 +1819,7 @@ static void op_0xd3(void)
 }
 
 /*CALL NC,@*/
-static void op_0xd4(void)
+static void op_0xd4(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1832,7 +1832,7 @@ static void op_0xd4(void)
 }
 
 /*PUSH DE*/
-static void op_0xd5(void)
+static void op_0xd5(Z80EX_CONTEXT *cpu)
 {
 	PUSH(DE, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1840,7 +1840,7 @@ static void op_0xd5(void)
 }
 
 /*SUB #*/
-static void op_0xd6(void)
+static void op_0xd6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	SUB(temp_byte);
@@ -1849,7 +1849,7 @@ static void op_0xd6(void)
 }
 
 /*RST 0x10*/
-static void op_0xd7(void)
+static void op_0xd7(Z80EX_CONTEXT *cpu)
 {
 	RST(0x10, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1857,7 +1857,7 @@ static void op_0xd7(void)
 }
 
 /*RET C*/
-static void op_0xd8(void)
+static void op_0xd8(Z80EX_CONTEXT *cpu)
 {
 	if(F & FLAG_C) {
 	RET(/*rd*/5,8);
@@ -1868,7 +1868,7 @@ static void op_0xd8(void)
 }
 
 /*EXX*/
-static void op_0xd9(void)
+static void op_0xd9(Z80EX_CONTEXT *cpu)
 {
 	EXX();
 	T_WAIT_UNTIL(4);
@@ -1876,7 +1876,7 @@ static void op_0xd9(void)
 }
 
 /*JP C,@*/
-static void op_0xda(void)
+static void op_0xda(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1889,7 +1889,7 @@ static void op_0xda(void)
 }
 
 /*IN A,(#)*/
-static void op_0xdb(void)
+static void op_0xdb(Z80EX_CONTEXT *cpu)
 {
 	temp_word.w=(READ_OP() + ( A << 8 ));
 	IN_A(A,temp_word.w, /*rd*/8);
@@ -1898,7 +1898,7 @@ static void op_0xdb(void)
 }
 
 /*CALL C,@*/
-static void op_0xdc(void)
+static void op_0xdc(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1910,14 +1910,14 @@ static void op_0xdc(void)
 	return;
 }
 
-static void op_p_DD(void)
+static void op_p_DD(Z80EX_CONTEXT *cpu)
 {
-	z80ex.prefix=0xDD;
-	z80ex.noint_once=1;
+	cpu->prefix=0xDD;
+	cpu->noint_once=1;
 }
 
 /*SBC A,#*/
-static void op_0xde(void)
+static void op_0xde(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	SBC(A,temp_byte);
@@ -1926,7 +1926,7 @@ static void op_0xde(void)
 }
 
 /*RST 0x18*/
-static void op_0xdf(void)
+static void op_0xdf(Z80EX_CONTEXT *cpu)
 {
 	RST(0x18, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1934,7 +1934,7 @@ static void op_0xdf(void)
 }
 
 /*RET PO*/
-static void op_0xe0(void)
+static void op_0xe0(Z80EX_CONTEXT *cpu)
 {
 	if(!(F & FLAG_P)) {
 	RET(/*rd*/5,8);
@@ -1945,7 +1945,7 @@ static void op_0xe0(void)
 }
 
 /*POP HL*/
-static void op_0xe1(void)
+static void op_0xe1(Z80EX_CONTEXT *cpu)
 {
 	POP(HL, /*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -1953,7 +1953,7 @@ static void op_0xe1(void)
 }
 
 /*JP PO,@*/
-static void op_0xe2(void)
+static void op_0xe2(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1966,7 +1966,7 @@ static void op_0xe2(void)
 }
 
 /*EX (SP),HL*/
-static void op_0xe3(void)
+static void op_0xe3(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_word.b.l,(SP),4);
 	READ_MEM(temp_word.b.h,(SP+1),7);
@@ -1978,7 +1978,7 @@ static void op_0xe3(void)
 }
 
 /*CALL PO,@*/
-static void op_0xe4(void)
+static void op_0xe4(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -1991,7 +1991,7 @@ static void op_0xe4(void)
 }
 
 /*PUSH HL*/
-static void op_0xe5(void)
+static void op_0xe5(Z80EX_CONTEXT *cpu)
 {
 	PUSH(HL, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -1999,7 +1999,7 @@ static void op_0xe5(void)
 }
 
 /*AND #*/
-static void op_0xe6(void)
+static void op_0xe6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	AND(temp_byte);
@@ -2008,7 +2008,7 @@ static void op_0xe6(void)
 }
 
 /*RST 0x20*/
-static void op_0xe7(void)
+static void op_0xe7(Z80EX_CONTEXT *cpu)
 {
 	RST(0x20, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -2016,7 +2016,7 @@ static void op_0xe7(void)
 }
 
 /*RET PE*/
-static void op_0xe8(void)
+static void op_0xe8(Z80EX_CONTEXT *cpu)
 {
 	if(F & FLAG_P) {
 	RET(/*rd*/5,8);
@@ -2027,7 +2027,7 @@ static void op_0xe8(void)
 }
 
 /*JP HL*/
-static void op_0xe9(void)
+static void op_0xe9(Z80EX_CONTEXT *cpu)
 {
 	JP_NO_MPTR(HL);
 	T_WAIT_UNTIL(4);
@@ -2035,7 +2035,7 @@ static void op_0xe9(void)
 }
 
 /*JP PE,@*/
-static void op_0xea(void)
+static void op_0xea(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -2048,7 +2048,7 @@ static void op_0xea(void)
 }
 
 /*EX DE,HL*/
-static void op_0xeb(void)
+static void op_0xeb(Z80EX_CONTEXT *cpu)
 {
 	EX(DE,HL);
 	T_WAIT_UNTIL(4);
@@ -2056,7 +2056,7 @@ static void op_0xeb(void)
 }
 
 /*CALL PE,@*/
-static void op_0xec(void)
+static void op_0xec(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -2068,14 +2068,14 @@ static void op_0xec(void)
 	return;
 }
 
-static void op_p_ED(void)
+static void op_p_ED(Z80EX_CONTEXT *cpu)
 {
-	z80ex.prefix=0xED;
-	z80ex.noint_once=1;
+	cpu->prefix=0xED;
+	cpu->noint_once=1;
 }
 
 /*XOR #*/
-static void op_0xee(void)
+static void op_0xee(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	XOR(temp_byte);
@@ -2084,7 +2084,7 @@ static void op_0xee(void)
 }
 
 /*RST 0x28*/
-static void op_0xef(void)
+static void op_0xef(Z80EX_CONTEXT *cpu)
 {
 	RST(0x28, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -2092,7 +2092,7 @@ static void op_0xef(void)
 }
 
 /*RET P*/
-static void op_0xf0(void)
+static void op_0xf0(Z80EX_CONTEXT *cpu)
 {
 	if(!(F & FLAG_S)) {
 	RET(/*rd*/5,8);
@@ -2103,7 +2103,7 @@ static void op_0xf0(void)
 }
 
 /*POP AF*/
-static void op_0xf1(void)
+static void op_0xf1(Z80EX_CONTEXT *cpu)
 {
 	POP(AF, /*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -2111,7 +2111,7 @@ static void op_0xf1(void)
 }
 
 /*JP P,@*/
-static void op_0xf2(void)
+static void op_0xf2(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -2124,7 +2124,7 @@ static void op_0xf2(void)
 }
 
 /*DI*/
-static void op_0xf3(void)
+static void op_0xf3(Z80EX_CONTEXT *cpu)
 {
 	DI();
 	T_WAIT_UNTIL(4);
@@ -2132,7 +2132,7 @@ static void op_0xf3(void)
 }
 
 /*CALL P,@*/
-static void op_0xf4(void)
+static void op_0xf4(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -2145,7 +2145,7 @@ static void op_0xf4(void)
 }
 
 /*PUSH AF*/
-static void op_0xf5(void)
+static void op_0xf5(Z80EX_CONTEXT *cpu)
 {
 	PUSH(AF, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -2153,7 +2153,7 @@ static void op_0xf5(void)
 }
 
 /*OR #*/
-static void op_0xf6(void)
+static void op_0xf6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	OR(temp_byte);
@@ -2162,7 +2162,7 @@ static void op_0xf6(void)
 }
 
 /*RST 0x30*/
-static void op_0xf7(void)
+static void op_0xf7(Z80EX_CONTEXT *cpu)
 {
 	RST(0x30, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -2170,7 +2170,7 @@ static void op_0xf7(void)
 }
 
 /*RET M*/
-static void op_0xf8(void)
+static void op_0xf8(Z80EX_CONTEXT *cpu)
 {
 	if(F & FLAG_S) {
 	RET(/*rd*/5,8);
@@ -2181,7 +2181,7 @@ static void op_0xf8(void)
 }
 
 /*LD SP,HL*/
-static void op_0xf9(void)
+static void op_0xf9(Z80EX_CONTEXT *cpu)
 {
 	LD16(SP,HL);
 	T_WAIT_UNTIL(6);
@@ -2189,7 +2189,7 @@ static void op_0xf9(void)
 }
 
 /*JP M,@*/
-static void op_0xfa(void)
+static void op_0xfa(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -2202,7 +2202,7 @@ static void op_0xfa(void)
 }
 
 /*EI*/
-static void op_0xfb(void)
+static void op_0xfb(Z80EX_CONTEXT *cpu)
 {
 	EI();
 	T_WAIT_UNTIL(4);
@@ -2210,7 +2210,7 @@ static void op_0xfb(void)
 }
 
 /*CALL M,@*/
-static void op_0xfc(void)
+static void op_0xfc(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -2222,14 +2222,14 @@ static void op_0xfc(void)
 	return;
 }
 
-static void op_p_FD(void)
+static void op_p_FD(Z80EX_CONTEXT *cpu)
 {
-	z80ex.prefix=0xFD;
-	z80ex.noint_once=1;
+	cpu->prefix=0xFD;
+	cpu->noint_once=1;
 }
 
 /*CP #*/
-static void op_0xfe(void)
+static void op_0xfe(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	CP(temp_byte);
@@ -2238,7 +2238,7 @@ static void op_0xfe(void)
 }
 
 /*RST 0x38*/
-static void op_0xff(void)
+static void op_0xff(Z80EX_CONTEXT *cpu)
 {
 	RST(0x38, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
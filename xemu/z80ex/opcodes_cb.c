@@ -1,7 +1,7 @@
 /* autogenerated from ./opcodes_cb.dat, do not edit */
 
 /*RLC B*/
-static void op_CB_0x00(void)
+static void op_CB_0x00(Z80EX_CONTEXT *cpu)
 {
 	RLC(B);
 	T_WAIT_UNTIL(4);
@@ -9,7 +9,7 @@ static void op_CB_0x00(void)
 }
 
 /*RLC C*/
-static void op_CB_0x01(void)
+static void op_CB_0x01(Z80EX_CONTEXT *cpu)
 {
 	RLC(C);
 	T_WAIT_UNTIL(4);
@@ -17,7 +17,7 @@ static void op_CB_0x01(void)
 }
 
 /*RLC D*/
-static void op_CB_0x02(void)
+static void op_CB_0x02(Z80EX_CONTEXT *cpu)
 {
 	RLC(D);
 	T_WAIT_UNTIL(4);
@@ -25,7 +25,7 @@ static void op_CB_0x02(void)
 }
 
 /*RLC E*/
-static void op_CB_0x03(void)
+static void op_CB_0x03(Z80EX_CONTEXT *cpu)
 {
 	RLC(E);
 	T_WAIT_UNTIL(4);
@@ -33,7 +33,7 @@ static void op_CB_0x03(void)
 }
 
 /*RLC H*/
-static void op_CB_0x04(void)
+static void op_CB_0x04(Z80EX_CONTEXT *cpu)
 {
 	RLC(H);
 	T_WAIT_UNTIL(4);
@@ -41,7 +41,7 @@ static void op_CB_0x04(void)
 }
 
 /*RLC L*/
-static void op_CB_0x05(void)
+static void op_CB_0x05(Z80EX_CONTEXT *cpu)
 {
 	RLC(L);
 	T_WAIT_UNTIL(4);
@@ -49,7 +49,7 @@ static void op_CB_0x05(void)
 }
 
 /*RLC (HL)*/
-static void op_CB_0x06(void)
+static void op_CB_0x06(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RLC(temp_byte);
@@ -59,7 +59,7 @@ static void op_CB_0x06(void)
 }
 
 /*RLC A*/
-static void op_CB_0x07(void)
+static void op_CB_0x07(Z80EX_CONTEXT *cpu)
 {
 	RLC(A);
 	T_WAIT_UNTIL(4);
@@ -67,7 +67,7 @@ static void op_CB_0x07(void)
 }
 
 /*RRC B*/
-static void op_CB_0x08(void)
+static void op_CB_0x08(Z80EX_CONTEXT *cpu)
 {
 	RRC(B);
 	T_WAIT_UNTIL(4);
@@ -75,7 +75,7 @@ static void op_CB_0x08(void)
 }
 
 /*RRC C*/
-static void op_CB_0x09(void)
+static void op_CB_0x09(Z80EX_CONTEXT *cpu)
 {
 	RRC(C);
 	T_WAIT_UNTIL(4);
@@ -83,7 +83,7 @@ static void op_CB_0x09(void)
 }
 
 /*RRC D*/
-static void op_CB_0x0a(void)
+static void op_CB_0x0a(Z80EX_CONTEXT *cpu)
 {
 	RRC(D);
 	T_WAIT_UNTIL(4);
@@ -91,7 +91,7 @@ static void op_CB_0x0a(void)
 }
 
 /*RRC E*/
-static void op_CB_0x0b(void)
+static void op_CB_0x0b(Z80EX_CONTEXT *cpu)
 {
 	RRC(E);
 	T_WAIT_UNTIL(4);
@@ -99,7 +99,7 @@ static void op_CB_0x0b(void)
 }
 
 /*RRC H*/
-static void op_CB_0x0c(void)
+static void op_CB_0x0c(Z80EX_CONTEXT *cpu)
 {
 	RRC(H);
 	T_WAIT_UNTIL(4);
@@ -107,7 +107,7 @@ static void op_CB_0x0c(void)
 }
 
 /*RRC L*/
-static void op_CB_0x0d(void)
+static void op_CB_0x0d(Z80EX_CONTEXT *cpu)
 {
 	RRC(L);
 	T_WAIT_UNTIL(4);
@@ -115,7 +115,7 @@ static void op_CB_0x0d(void)
 }
 
 /*RRC (HL)*/
-static void op_CB_0x0e(void)
+static void op_CB_0x0e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RRC(temp_byte);
@@ -125,7 +125,7 @@ static void op_CB_0x0e(void)
 }
 
 /*RRC A*/
-static void op_CB_0x0f(void)
+static void op_CB_0x0f(Z80EX_CONTEXT *cpu)
 {
 	RRC(A);
 	T_WAIT_UNTIL(4);
@@ -133,7 +133,7 @@ static void op_CB_0x0f(void)
 }
 
 /*RL B*/
-static void op_CB_0x10(void)
+static void op_CB_0x10(Z80EX_CONTEXT *cpu)
 {
 	RL(B);
 	T_WAIT_UNTIL(4);
@@ -141,7 +141,7 @@ static void op_CB_0x10(void)
 }
 
 /*RL C*/
-static void op_CB_0x11(void)
+static void op_CB_0x11(Z80EX_CONTEXT *cpu)
 {
 	RL(C);
 	T_WAIT_UNTIL(4);
@@ -149,7 +149,7 @@ static void op_CB_0x11(void)
 }
 
 /*RL D*/
-static void op_CB_0x12(void)
+static void op_CB_0x12(Z80EX_CONTEXT *cpu)
 {
 	RL(D);
 	T_WAIT_UNTIL(4);
@@ -157,7 +157,7 @@ static void op_CB_0x12(void)
 }
 
 /*RL E*/
-static void op_CB_0x13(void)
+static void op_CB_0x13(Z80EX_CONTEXT *cpu)
 {
 	RL(E);
 	T_WAIT_UNTIL(4);
@@ -165,7 +165,7 @@ static void op_CB_0x13(void)
 }
 
 /*RL H*/
-static void op_CB_0x14(void)
+static void op_CB_0x14(Z80EX_CONTEXT *cpu)
 {
 	RL(H);
 	T_WAIT_UNTIL(4);
@@ -173,7 +173,7 @@ static void op_CB_0x14(void)
 }
 
 /*RL L*/
-static void op_CB_0x15(void)
+static void op_CB_0x15(Z80EX_CONTEXT *cpu)
 {
 	RL(L);
 	T_WAIT_UNTIL(4);
@@ -181,7 +181,7 @@ static void op_CB_0x15(void)
 }
 
 /*RL (HL)*/
-static void op_CB_0x16(void)
+static void op_CB_0x16(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RL(temp_byte);
@@ -191,7 +191,7 @@ static void op_CB_0x16(void)
 }
 
 /*RL A*/
-static void op_CB_0x17(void)
+static void op_CB_0x17(Z80EX_CONTEXT *cpu)
 {
 	RL(A);
 	T_WAIT_UNTIL(4);
@@ -199,7 +199,7 @@ static void op_CB_0x17(void)
 }
 
 /*RR B*/
-static void op_CB_0x18(void)
+static void op_CB_0x18(Z80EX_CONTEXT *cpu)
 {
 	RR(B);
 	T_WAIT_UNTIL(4);
@@ -207,7 +207,7 @@ static void op_CB_0x18(void)
 }
 
 /*RR C*/
-static void op_CB_0x19(void)
+static void op_CB_0x19(Z80EX_CONTEXT *cpu)
 {
 	RR(C);
 	T_WAIT_UNTIL(4);
@@ -215,7 +215,7 @@ static void op_CB_0x19(void)
 }
 
 /*RR D*/
-static void op_CB_0x1a(void)
+static void op_CB_0x1a(Z80EX_CONTEXT *cpu)
 {
 	RR(D);
 	T_WAIT_UNTIL(4);
@@ -223,7 +223,7 @@ static void op_CB_0x1a(void)
 }
 
 /*RR E*/
-static void op_CB_0x1b(void)
+static void op_CB_0x1b(Z80EX_CONTEXT *cpu)
 {
 	RR(E);
 	T_WAIT_UNTIL(4);
@@ -231,7 +231,7 @@ static void op_CB_0x1b(void)
 }
 
 /*RR H*/
-static void op_CB_0x1c(void)
+static void op_CB_0x1c(Z80EX_CONTEXT *cpu)
 {
 	RR(H);
 	T_WAIT_UNTIL(4);
@@ -239,7 +239,7 @@ static void op_CB_0x1c(void)
 }
 
 /*RR L*/
-static void op_CB_0x1d(void)
+static void op_CB_0x1d(Z80EX_CONTEXT *cpu)
 {
 	RR(L);
 	T_WAIT_UNTIL(4);
@@ -247,7 +247,7 @@ static void op_CB_0x1d(void)
 }
 
 /*RR (HL)*/
-static void op_CB_0x1e(void)
+static void op_CB_0x1e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RR(temp_byte);
@@ -257,7 +257,7 @@ static void op_CB_0x1e(void)
 }
 
 /*RR A*/
-static void op_CB_0x1f(void)
+static void op_CB_0x1f(Z80EX_CONTEXT *cpu)
 {
 	RR(A);
 	T_WAIT_UNTIL(4);
@@ -265,7 +265,7 @@ static void op_CB_0x1f(void)
 }
 
 /*SLA B*/
-static void op_CB_0x20(void)
+static void op_CB_0x20(Z80EX_CONTEXT *cpu)
 {
 	SLA(B);
 	T_WAIT_UNTIL(4);
@@ -273,7 +273,7 @@ static void op_CB_0x20(void)
 }
 
 /*SLA C*/
-static void op_CB_0x21(void)
+static void op_CB_0x21(Z80EX_CONTEXT *cpu)
 {
 	SLA(C);
 	T_WAIT_UNTIL(4);
@@ -281,7 +281,7 @@ static void op_CB_0x21(void)
 }
 
 /*SLA D*/
-static void op_CB_0x22(void)
+static void op_CB_0x22(Z80EX_CONTEXT *cpu)
 {
 	SLA(D);
 	T_WAIT_UNTIL(4);
@@ -289,7 +289,7 @@ static void op_CB_0x22(void)
 }
 
 /*SLA E*/
-static void op_CB_0x23(void)
+static void op_CB_0x23(Z80EX_CONTEXT *cpu)
 {
 	SLA(E);
 	T_WAIT_UNTIL(4);
@@ -297,7 +297,7 @@ static void op_CB_0x23(void)
 }
 
 /*SLA H*/
-static void op_CB_0x24(void)
+static void op_CB_0x24(Z80EX_CONTEXT *cpu)
 {
 	SLA(H);
 	T_WAIT_UNTIL(4);
@@ -305,7 +305,7 @@ static void op_CB_0x24(void)
 }
 
 /*SLA L*/
-static void op_CB_0x25(void)
+static void op_CB_0x25(Z80EX_CONTEXT *cpu)
 {
 	SLA(L);
 	T_WAIT_UNTIL(4);
@@ -313,7 +313,7 @@ static void op_CB_0x25(void)
 }
 
 /*SLA (HL)*/
-static void op_CB_0x26(void)
+static void op_CB_0x26(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SLA(temp_byte);
@@ -323,7 +323,7 @@ static void op_CB_0x26(void)
 }
 
 /*SLA A*/
-static void op_CB_0x27(void)
+static void op_CB_0x27(Z80EX_CONTEXT *cpu)
 {
 	SLA(A);
 	T_WAIT_UNTIL(4);
@@ -331,7 +331,7 @@ static void op_CB_0x27(void)
 }
 
 /*SRA B*/
-static void op_CB_0x28(void)
+static void op_CB_0x28(Z80EX_CONTEXT *cpu)
 {
 	SRA(B);
 	T_WAIT_UNTIL(4);
@@ -339,7 +339,7 @@ static void op_CB_0x28(void)
 }
 
 /*SRA C*/
-static void op_CB_0x29(void)
+static void op_CB_0x29(Z80EX_CONTEXT *cpu)
 {
 	SRA(C);
 	T_WAIT_UNTIL(4);
@@ -347,7 +347,7 @@ static void op_CB_0x29(void)
 }
 
 /*SRA D*/
-static void op_CB_0x2a(void)
+static void op_CB_0x2a(Z80EX_CONTEXT *cpu)
 {
 	SRA(D);
 	T_WAIT_UNTIL(4);
@@ -355,7 +355,7 @@ static void op_CB_0x2a(void)
 }
 
 /*SRA E*/
-static void op_CB_0x2b(void)
+static void op_CB_0x2b(Z80EX_CONTEXT *cpu)
 {
 	SRA(E);
 	T_WAIT_UNTIL(4);
@@ -363,7 +363,7 @@ static void op_CB_0x2b(void)
 }
 
 /*SRA H*/
-static void op_CB_0x2c(void)
+static void op_CB_0x2c(Z80EX_CONTEXT *cpu)
 {
 	SRA(H);
 	T_WAIT_UNTIL(4);
@@ -371,7 +371,7 @@ static void op_CB_0x2c(void)
 }
 
 /*SRA L*/
-static void op_CB_0x2d(void)
+static void op_CB_0x2d(Z80EX_CONTEXT *cpu)
 {
 	SRA(L);
 	T_WAIT_UNTIL(4);
@@ -379,7 +379,7 @@ static void op_CB_0x2d(void)
 }
 
 /*SRA (HL)*/
-static void op_CB_0x2e(void)
+static void op_CB_0x2e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SRA(temp_byte);
@@ -389,7 +389,7 @@ static void op_CB_0x2e(void)
 }
 
 /*SRA A*/
-static void op_CB_0x2f(void)
+static void op_CB_0x2f(Z80EX_CONTEXT *cpu)
 {
 	SRA(A);
 	T_WAIT_UNTIL(4);
@@ -397,7 +397,7 @@ static void op_CB_0x2f(void)
 }
 
 /*SLL B*/
-static void op_CB_0x30(void)
+static void op_CB_0x30(Z80EX_CONTEXT *cpu)
 {
 	SLL(B);
 	T_WAIT_UNTIL(4);
@@ -405,7 +405,7 @@ static void op_CB_0x30(void)
 }
 
 /*SLL C*/
-static void op_CB_0x31(void)
+static void op_CB_0x31(Z80EX_CONTEXT *cpu)
 {
 	SLL(C);
 	T_WAIT_UNTIL(4);
@@ -413,7 +413,7 @@ static void op_CB_0x31(void)
 }
 
 /*SLL D*/
-static void op_CB_0x32(void)
+static void op_CB_0x32(Z80EX_CONTEXT *cpu)
 {
 	SLL(D);
 	T_WAIT_UNTIL(4);
@@ -421,7 +421,7 @@ static void op_CB_0x32(void)
 }
 
 /*SLL E*/
-static void op_CB_0x33(void)
+static void op_CB_0x33(Z80EX_CONTEXT *cpu)
 {
 	SLL(E);
 	T_WAIT_UNTIL(4);
@@ -429,7 +429,7 @@ static void op_CB_0x33(void)
 }
 
 /*SLL H*/
-static void op_CB_0x34(void)
+static void op_CB_0x34(Z80EX_CONTEXT *cpu)
 {
 	SLL(H);
 	T_WAIT_UNTIL(4);
@@ -437,7 +437,7 @@ static void op_CB_0x34(void)
 }
 
 /*SLL L*/
-static void op_CB_0x35(void)
+static void op_CB_0x35(Z80EX_CONTEXT *cpu)
 {
 	SLL(L);
 	T_WAIT_UNTIL(4);
@@ -445,7 +445,7 @@ static void op_CB_0x35(void)
 }
 
 /*SLL (HL)*/
-static void op_CB_0x36(void)
+static void op_CB_0x36(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SLL(temp_byte);
@@ -455,7 +455,7 @@ static void op_CB_0x36(void)
 }
 
 /*SLL A*/
-static void op_CB_0x37(void)
+static void op_CB_0x37(Z80EX_CONTEXT *cpu)
 {
 	SLL(A);
 	T_WAIT_UNTIL(4);
@@ -463,7 +463,7 @@ static void op_CB_0x37(void)
 }
 
 /*SRL B*/
-static void op_CB_0x38(void)
+static void op_CB_0x38(Z80EX_CONTEXT *cpu)
 {
 	SRL(B);
 	T_WAIT_UNTIL(4);
@@ -471,7 +471,7 @@ static void op_CB_0x38(void)
 }
 
 /*SRL C*/
-static void op_CB_0x39(void)
+static void op_CB_0x39(Z80EX_CONTEXT *cpu)
 {
 	SRL(C);
 	T_WAIT_UNTIL(4);
@@ -479,7 +479,7 @@ static void op_CB_0x39(void)
 }
 
 /*SRL D*/
-static void op_CB_0x3a(void)
+static void op_CB_0x3a(Z80EX_CONTEXT *cpu)
 {
 	SRL(D);
 	T_WAIT_UNTIL(4);
@@ -487,7 +487,7 @@ static void op_CB_0x3a(void)
 }
 
 /*SRL E*/
-static void op_CB_0x3b(void)
+static void op_CB_0x3b(Z80EX_CONTEXT *cpu)
 {
 	SRL(E);
 	T_WAIT_UNTIL(4);
@@ -495,7 +495,7 @@ static void op_CB_0x3b(void)
 }
 
 /*SRL H*/
-static void op_CB_0x3c(void)
+static void op_CB_0x3c(Z80EX_CONTEXT *cpu)
 {
 	SRL(H);
 	T_WAIT_UNTIL(4);
@@ -503,7 +503,7 @@ static void op_CB_0x3c(void)
 }
 
 /*SRL L*/
-static void op_CB_0x3d(void)
+static void op_CB_0x3d(Z80EX_CONTEXT *cpu)
 {
 	SRL(L);
 	T_WAIT_UNTIL(4);
@@ -511,7 +511,7 @@ static void op_CB_0x3d(void)
 }
 
 /*SRL (HL)*/
-static void op_CB_0x3e(void)
+static void op_CB_0x3e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SRL(temp_byte);
@@ -521,7 +521,7 @@ static void op_CB_0x3e(void)
 }
 
 /*SRL A*/
-static void op_CB_0x3f(void)
+static void op_CB_0x3f(Z80EX_CONTEXT *cpu)
 {
 	SRL(A);
 	T_WAIT_UNTIL(4);
@@ -529,7 +529,7 @@ static void op_CB_0x3f(void)
 }
 
 /*BIT 0,B*/
-static void op_CB_0x40(void)
+static void op_CB_0x40(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,B);
 	T_WAIT_UNTIL(4);
@@ -537,7 +537,7 @@ static void op_CB_0x40(void)
 }
 
 /*BIT 0,C*/
-static void op_CB_0x41(void)
+static void op_CB_0x41(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,C);
 	T_WAIT_UNTIL(4);
@@ -545,7 +545,7 @@ static void op_CB_0x41(void)
 }
 
 /*BIT 0,D*/
-static void op_CB_0x42(void)
+static void op_CB_0x42(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,D);
 	T_WAIT_UNTIL(4);
@@ -553,7 +553,7 @@ static void op_CB_0x42(void)
 }
 
 /*BIT 0,E*/
-static void op_CB_0x43(void)
+static void op_CB_0x43(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,E);
 	T_WAIT_UNTIL(4);
@@ -561,7 +561,7 @@ static void op_CB_0x43(void)
 }
 
 /*BIT 0,H*/
-static void op_CB_0x44(void)
+static void op_CB_0x44(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,H);
 	T_WAIT_UNTIL(4);
@@ -569,7 +569,7 @@ static void op_CB_0x44(void)
 }
 
 /*BIT 0,L*/
-static void op_CB_0x45(void)
+static void op_CB_0x45(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,L);
 	T_WAIT_UNTIL(4);
@@ -577,7 +577,7 @@ static void op_CB_0x45(void)
 }
 
 /*BIT 0,(HL)*/
-static void op_CB_0x46(void)
+static void op_CB_0x46(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(0,temp_byte);
@@ -586,7 +586,7 @@ static void op_CB_0x46(void)
 }
 
 /*BIT 0,A*/
-static void op_CB_0x47(void)
+static void op_CB_0x47(Z80EX_CONTEXT *cpu)
 {
 	BIT(0,A);
 	T_WAIT_UNTIL(4);
@@ -594,7 +594,7 @@ static void op_CB_0x47(void)
 }
 
 /*BIT 1,B*/
-static void op_CB_0x48(void)
+static void op_CB_0x48(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,B);
 	T_WAIT_UNTIL(4);
@@ -602,7 +602,7 @@ static void op_CB_0x48(void)
 }
 
 /*BIT 1,C*/
-static void op_CB_0x49(void)
+static void op_CB_0x49(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,C);
 	T_WAIT_UNTIL(4);
@@ -610,7 +610,7 @@ static void op_CB_0x49(void)
 }
 
 /*BIT 1,D*/
-static void op_CB_0x4a(void)
+static void op_CB_0x4a(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,D);
 	T_WAIT_UNTIL(4);
@@ -618,7 +618,7 @@ static void op_CB_0x4a(void)
 }
 
 /*BIT 1,E*/
-static void op_CB_0x4b(void)
+static void op_CB_0x4b(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,E);
 	T_WAIT_UNTIL(4);
@@ -626,7 +626,7 @@ static void op_CB_0x4b(void)
 }
 
 /*BIT 1,H*/
-static void op_CB_0x4c(void)
+static void op_CB_0x4c(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,H);
 	T_WAIT_UNTIL(4);
@@ -634,7 +634,7 @@ static void op_CB_0x4c(void)
 }
 
 /*BIT 1,L*/
-static void op_CB_0x4d(void)
+static void op_CB_0x4d(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,L);
 	T_WAIT_UNTIL(4);
@@ -642,7 +642,7 @@ static void op_CB_0x4d(void)
 }
 
 /*BIT 1,(HL)*/
-static void op_CB_0x4e(void)
+static void op_CB_0x4e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(1,temp_byte);
@@ -651,7 +651,7 @@ static void op_CB_0x4e(void)
 }
 
 /*BIT 1,A*/
-static void op_CB_0x4f(void)
+static void op_CB_0x4f(Z80EX_CONTEXT *cpu)
 {
 	BIT(1,A);
 	T_WAIT_UNTIL(4);
@@ -659,7 +659,7 @@ static void op_CB_0x4f(void)
 }
 
 /*BIT 2,B*/
-static void op_CB_0x50(void)
+static void op_CB_0x50(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,B);
 	T_WAIT_UNTIL(4);
@@ -667,7 +667,7 @@ static void op_CB_0x50(void)
 }
 
 /*BIT 2,C*/
-static void op_CB_0x51(void)
+static void op_CB_0x51(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,C);
 	T_WAIT_UNTIL(4);
@@ -675,7 +675,7 @@ static void op_CB_0x51(void)
 }
 
 /*BIT 2,D*/
-static void op_CB_0x52(void)
+static void op_CB_0x52(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,D);
 	T_WAIT_UNTIL(4);
@@ -683,7 +683,7 @@ static void op_CB_0x52(void)
 }
 
 /*BIT 2,E*/
-static void op_CB_0x53(void)
+static void op_CB_0x53(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,E);
 	T_WAIT_UNTIL(4);
@@ -691,7 +691,7 @@ static void op_CB_0x53(void)
 }
 
 /*BIT 2,H*/
-static void op_CB_0x54(void)
+static void op_CB_0x54(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,H);
 	T_WAIT_UNTIL(4);
@@ -699,7 +699,7 @@ static void op_CB_0x54(void)
 }
 
 /*BIT 2,L*/
-static void op_CB_0x55(void)
+static void op_CB_0x55(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,L);
 	T_WAIT_UNTIL(4);
@@ -707,7 +707,7 @@ static void op_CB_0x55(void)
 }
 
 /*BIT 2,(HL)*/
-static void op_CB_0x56(void)
+static void op_CB_0x56(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(2,temp_byte);
@@ -716,7 +716,7 @@ static void op_CB_0x56(void)
 }
 
 /*BIT 2,A*/
-static void op_CB_0x57(void)
+static void op_CB_0x57(Z80EX_CONTEXT *cpu)
 {
 	BIT(2,A);
 	T_WAIT_UNTIL(4);
@@ -724,7 +724,7 @@ static void op_CB_0x57(void)
 }
 
 /*BIT 3,B*/
-static void op_CB_0x58(void)
+static void op_CB_0x58(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,B);
 	T_WAIT_UNTIL(4);
@@ -732,7 +732,7 @@ static void op_CB_0x58(void)
 }
 
 /*BIT 3,C*/
-static void op_CB_0x59(void)
+static void op_CB_0x59(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,C);
 	T_WAIT_UNTIL(4);
@@ -740,7 +740,7 @@ static void op_CB_0x59(void)
 }
 
 /*BIT 3,D*/
-static void op_CB_0x5a(void)
+static void op_CB_0x5a(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,D);
 	T_WAIT_UNTIL(4);
@@ -748,7 +748,7 @@ static void op_CB_0x5a(void)
 }
 
 /*BIT 3,E*/
-static void op_CB_0x5b(void)
+static void op_CB_0x5b(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,E);
 	T_WAIT_UNTIL(4);
@@ -756,7 +756,7 @@ static void op_CB_0x5b(void)
 }
 
 /*BIT 3,H*/
-static void op_CB_0x5c(void)
+static void op_CB_0x5c(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,H);
 	T_WAIT_UNTIL(4);
@@ -764,7 +764,7 @@ static void op_CB_0x5c(void)
 }
 
 /*BIT 3,L*/
-static void op_CB_0x5d(void)
+static void op_CB_0x5d(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,L);
 	T_WAIT_UNTIL(4);
@@ -772,7 +772,7 @@ static void op_CB_0x5d(void)
 }
 
 /*BIT 3,(HL)*/
-static void op_CB_0x5e(void)
+static void op_CB_0x5e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(3,temp_byte);
@@ -781,7 +781,7 @@ static void op_CB_0x5e(void)
 }
 
 /*BIT 3,A*/
-static void op_CB_0x5f(void)
+static void op_CB_0x5f(Z80EX_CONTEXT *cpu)
 {
 	BIT(3,A);
 	T_WAIT_UNTIL(4);
@@ -789,7 +789,7 @@ static void op_CB_0x5f(void)
 }
 
 /*BIT 4,B*/
-static void op_CB_0x60(void)
+static void op_CB_0x60(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,B);
 	T_WAIT_UNTIL(4);
@@ -797,7 +797,7 @@ static void op_CB_0x60(void)
 }
 
 /*BIT 4,C*/
-static void op_CB_0x61(void)
+static void op_CB_0x61(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,C);
 	T_WAIT_UNTIL(4);
@@ -805,7 +805,7 @@ static void op_CB_0x61(void)
 }
 
 /*BIT 4,D*/
-static void op_CB_0x62(void)
+static void op_CB_0x62(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,D);
 	T_WAIT_UNTIL(4);
@@ -813,7 +813,7 @@ static void op_CB_0x62(void)
 }
 
 /*BIT 4,E*/
-static void op_CB_0x63(void)
+static void op_CB_0x63(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,E);
 	T_WAIT_UNTIL(4);
@@ -821,7 +821,7 @@ static void op_CB_0x63(void)
 }
 
 /*BIT 4,H*/
-static void op_CB_0x64(void)
+static void op_CB_0x64(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,H);
 	T_WAIT_UNTIL(4);
@@ -829,7 +829,7 @@ static void op_CB_0x64(void)
 }
 
 /*BIT 4,L*/
-static void op_CB_0x65(void)
+static void op_CB_0x65(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,L);
 	T_WAIT_UNTIL(4);
@@ -837,7 +837,7 @@ static void op_CB_0x65(void)
 }
 
 /*BIT 4,(HL)*/
-static void op_CB_0x66(void)
+static void op_CB_0x66(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(4,temp_byte);
@@ -846,7 +846,7 @@ static void op_CB_0x66(void)
 }
 
 /*BIT 4,A*/
-static void op_CB_0x67(void)
+static void op_CB_0x67(Z80EX_CONTEXT *cpu)
 {
 	BIT(4,A);
 	T_WAIT_UNTIL(4);
@@ -854,7 +854,7 @@ static void op_CB_0x67(void)
 }
 
 /*BIT 5,B*/
-static void op_CB_0x68(void)
+static void op_CB_0x68(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,B);
 	T_WAIT_UNTIL(4);
@@ -862,7 +862,7 @@ static void op_CB_0x68(void)
 }
 
 /*BIT 5,C*/
-static void op_CB_0x69(void)
+static void op_CB_0x69(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,C);
 	T_WAIT_UNTIL(4);
@@ -870,7 +870,7 @@ static void op_CB_0x69(void)
 }
 
 /*BIT 5,D*/
-static void op_CB_0x6a(void)
+static void op_CB_0x6a(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,D);
 	T_WAIT_UNTIL(4);
@@ -878,7 +878,7 @@ static void op_CB_0x6a(void)
 }
 
 /*BIT 5,E*/
-static void op_CB_0x6b(void)
+static void op_CB_0x6b(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,E);
 	T_WAIT_UNTIL(4);
@@ -886,7 +886,7 @@ static void op_CB_0x6b(void)
 }
 
 /*BIT 5,H*/
-static void op_CB_0x6c(void)
+static void op_CB_0x6c(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,H);
 	T_WAIT_UNTIL(4);
@@ -894,7 +894,7 @@ static void op_CB_0x6c(void)
 }
 
 /*BIT 5,L*/
-static void op_CB_0x6d(void)
+static void op_CB_0x6d(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,L);
 	T_WAIT_UNTIL(4);
@@ -902,7 +902,7 @@ static void op_CB_0x6d(void)
 }
 
 /*BIT 5,(HL)*/
-static void op_CB_0x6e(void)
+static void op_CB_0x6e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(5,temp_byte);
@@ -911,7 +911,7 @@ static void op_CB_0x6e(void)
 }
 
 /*BIT 5,A*/
-static void op_CB_0x6f(void)
+static void op_CB_0x6f(Z80EX_CONTEXT *cpu)
 {
 	BIT(5,A);
 	T_WAIT_UNTIL(4);
@@ -919,7 +919,7 @@ static void op_CB_0x6f(void)
 }
 
 /*BIT 6,B*/
-static void op_CB_0x70(void)
+static void op_CB_0x70(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,B);
 	T_WAIT_UNTIL(4);
@@ -927,7 +927,7 @@ static void op_CB_0x70(void)
 }
 
 /*BIT 6,C*/
-static void op_CB_0x71(void)
+static void op_CB_0x71(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,C);
 	T_WAIT_UNTIL(4);
@@ -935,7 +935,7 @@ static void op_CB_0x71(void)
 }
 
 /*BIT 6,D*/
-static void op_CB_0x72(void)
+static void op_CB_0x72(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,D);
 	T_WAIT_UNTIL(4);
@@ -943,7 +943,7 @@ static void op_CB_0x72(void)
 }
 
 /*BIT 6,E*/
-static void op_CB_0x73(void)
+static void op_CB_0x73(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,E);
 	T_WAIT_UNTIL(4);
@@ -951,7 +951,7 @@ static void op_CB_0x73(void)
 }
 
 /*BIT 6,H*/
-static void op_CB_0x74(void)
+static void op_CB_0x74(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,H);
 	T_WAIT_UNTIL(4);
@@ -959,7 +959,7 @@ static void op_CB_0x74(void)
 }
 
 /*BIT 6,L*/
-static void op_CB_0x75(void)
+static void op_CB_0x75(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,L);
 	T_WAIT_UNTIL(4);
@@ -967,7 +967,7 @@ static void op_CB_0x75(void)
 }
 
 /*BIT 6,(HL)*/
-static void op_CB_0x76(void)
+static void op_CB_0x76(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(6,temp_byte);
@@ -976,7 +976,7 @@ static void op_CB_0x76(void)
 }
 
 /*BIT 6,A*/
-static void op_CB_0x77(void)
+static void op_CB_0x77(Z80EX_CONTEXT *cpu)
 {
 	BIT(6,A);
 	T_WAIT_UNTIL(4);
@@ -984,7 +984,7 @@ static void op_CB_0x77(void)
 }
 
 /*BIT 7,B*/
-static void op_CB_0x78(void)
+static void op_CB_0x78(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,B);
 	T_WAIT_UNTIL(4);
@@ -992,7 +992,7 @@ static void op_CB_0x78(void)
 }
 
 /*BIT 7,C*/
-static void op_CB_0x79(void)
+static void op_CB_0x79(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,C);
 	T_WAIT_UNTIL(4);
@@ -1000,7 +1000,7 @@ static void op_CB_0x79(void)
 }
 
 /*BIT 7,D*/
-static void op_CB_0x7a(void)
+static void op_CB_0x7a(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,D);
 	T_WAIT_UNTIL(4);
@@ -1008,7 +1008,7 @@ static void op_CB_0x7a(void)
 }
 
 /*BIT 7,E*/
-static void op_CB_0x7b(void)
+static void op_CB_0x7b(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,E);
 	T_WAIT_UNTIL(4);
@@ -1016,7 +1016,7 @@ static void op_CB_0x7b(void)
 }
 
 /*BIT 7,H*/
-static void op_CB_0x7c(void)
+static void op_CB_0x7c(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,H);
 	T_WAIT_UNTIL(4);
@@ -1024,7 +1024,7 @@ static void op_CB_0x7c(void)
 }
 
 /*BIT 7,L*/
-static void op_CB_0x7d(void)
+static void op_CB_0x7d(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,L);
 	T_WAIT_UNTIL(4);
@@ -1032,7 +1032,7 @@ static void op_CB_0x7d(void)
 }
 
 /*BIT 7,(HL)*/
-static void op_CB_0x7e(void)
+static void op_CB_0x7e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	BIT_MPTR(7,temp_byte);
@@ -1041,7 +1041,7 @@ static void op_CB_0x7e(void)
 }
 
 /*BIT 7,A*/
-static void op_CB_0x7f(void)
+static void op_CB_0x7f(Z80EX_CONTEXT *cpu)
 {
 	BIT(7,A);
 	T_WAIT_UNTIL(4);
@@ -1049,7 +1049,7 @@ static void op_CB_0x7f(void)
 }
 
 /*RES 0,B*/
-static void op_CB_0x80(void)
+static void op_CB_0x80(Z80EX_CONTEXT *cpu)
 {
 	RES(0,B);
 	T_WAIT_UNTIL(4);
@@ -1057,7 +1057,7 @@ static void op_CB_0x80(void)
 }
 
 /*RES 0,C*/
-static void op_CB_0x81(void)
+static void op_CB_0x81(Z80EX_CONTEXT *cpu)
 {
 	RES(0,C);
 	T_WAIT_UNTIL(4);
@@ -1065,7 +1065,7 @@ static void op_CB_0x81(void)
 }
 
 /*RES 0,D*/
-static void op_CB_0x82(void)
+static void op_CB_0x82(Z80EX_CONTEXT *cpu)
 {
 	RES(0,D);
 	T_WAIT_UNTIL(4);
@@ -1073,7 +1073,7 @@ static void op_CB_0x82(void)
 }
 
 /*RES 0,E*/
-static void op_CB_0x83(void)
+static void op_CB_0x83(Z80EX_CONTEXT *cpu)
 {
 	RES(0,E);
 	T_WAIT_UNTIL(4);
@@ -1081,7 +1081,7 @@ static void op_CB_0x83(void)
 }
 
 /*RES 0,H*/
-static void op_CB_0x84(void)
+static void op_CB_0x84(Z80EX_CONTEXT *cpu)
 {
 	RES(0,H);
 	T_WAIT_UNTIL(4);
@@ -1089,7 +1089,7 @@ static void op_CB_0x84(void)
 }
 
 /*RES 0,L*/
-static void op_CB_0x85(void)
+static void op_CB_0x85(Z80EX_CONTEXT *cpu)
 {
 	RES(0,L);
 	T_WAIT_UNTIL(4);
@@ -1097,7 +1097,7 @@ static void op_CB_0x85(void)
 }
 
 /*RES 0,(HL)*/
-static void op_CB_0x86(void)
+static void op_CB_0x86(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(0,temp_byte);
@@ -1107,7 +1107,7 @@ static void op_CB_0x86(void)
 }
 
 /*RES 0,A*/
-static void op_CB_0x87(void)
+static void op_CB_0x87(Z80EX_CONTEXT *cpu)
 {
 	RES(0,A);
 	T_WAIT_UNTIL(4);
@@ -1115,7 +1115,7 @@ static void op_CB_0x87(void)
 }
 
 /*RES 1,B*/
-static void op_CB_0x88(void)
+static void op_CB_0x88(Z80EX_CONTEXT *cpu)
 {
 	RES(1,B);
 	T_WAIT_UNTIL(4);
@@ -1123,7 +1123,7 @@ static void op_CB_0x88(void)
 }
 
 /*RES 1,C*/
-static void op_CB_0x89(void)
+static void op_CB_0x89(Z80EX_CONTEXT *cpu)
 {
 	RES(1,C);
 	T_WAIT_UNTIL(4);
@@ -1131,7 +1131,7 @@ static void op_CB_0x89(void)
 }
 
 /*RES 1,D*/
-static void op_CB_0x8a(void)
+static void op_CB_0x8a(Z80EX_CONTEXT *cpu)
 {
 	RES(1,D);
 	T_WAIT_UNTIL(4);
@@ -1139,7 +1139,7 @@ static void op_CB_0x8a(void)
 }
 
 /*RES 1,E*/
-static void op_CB_0x8b(void)
+static void op_CB_0x8b(Z80EX_CONTEXT *cpu)
 {
 	RES(1,E);
 	T_WAIT_UNTIL(4);
@@ -1147,7 +1147,7 @@ static void op_CB_0x8b(void)
 }
 
 /*RES 1,H*/
-static void op_CB_0x8c(void)
+static void op_CB_0x8c(Z80EX_CONTEXT *cpu)
 {
 	RES(1,H);
 	T_WAIT_UNTIL(4);
@@ -1155,7 +1155,7 @@ static void op_CB_0x8c(void)
 }
 
 /*RES 1,L*/
-static void op_CB_0x8d(void)
+static void op_CB_0x8d(Z80EX_CONTEXT *cpu)
 {
 	RES(1,L);
 	T_WAIT_UNTIL(4);
@@ -1163,7 +1163,7 @@ static void op_CB_0x8d(void)
 }
 
 /*RES 1,(HL)*/
-static void op_CB_0x8e(void)
+static void op_CB_0x8e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(1,temp_byte);
@@ -1173,7 +1173,7 @@ static void op_CB_0x8e(void)
 }
 
 /*RES 1,A*/
-static void op_CB_0x8f(void)
+static void op_CB_0x8f(Z80EX_CONTEXT *cpu)
 {
 	RES(1,A);
 	T_WAIT_UNTIL(4);
@@ -1181,7 +1181,7 @@ static void op_CB_0x8f(void)
 }
 
 /*RES 2,B*/
-static void op_CB_0x90(void)
+static void op_CB_0x90(Z80EX_CONTEXT *cpu)
 {
 	RES(2,B);
 	T_WAIT_UNTIL(4);
@@ -1189,7 +1189,7 @@ static void op_CB_0x90(void)
 }
 
 /*RES 2,C*/
-static void op_CB_0x91(void)
+static void op_CB_0x91(Z80EX_CONTEXT *cpu)
 {
 	RES(2,C);
 	T_WAIT_UNTIL(4);
@@ -1197,7 +1197,7 @@ static void op_CB_0x91(void)
 }
 
 /*RES 2,D*/
-static void op_CB_0x92(void)
+static void op_CB_0x92(Z80EX_CONTEXT *cpu)
 {
 	RES(2,D);
 	T_WAIT_UNTIL(4);
@@ -1205,7 +1205,7 @@ static void op_CB_0x92(void)
 }
 
 /*RES 2,E*/
-static void op_CB_0x93(void)
+static void op_CB_0x93(Z80EX_CONTEXT *cpu)
 {
 	RES(2,E);
 	T_WAIT_UNTIL(4);
@@ -1213,7 +1213,7 @@ static void op_CB_0x93(void)
 }
 
 /*RES 2,H*/
-static void op_CB_0x94(void)
+static void op_CB_0x94(Z80EX_CONTEXT *cpu)
 {
 	RES(2,H);
 	T_WAIT_UNTIL(4);
@@ -1221,7 +1221,7 @@ static void op_CB_0x94(void)
 }
 
 /*RES 2,L*/
-static void op_CB_0x95(void)
+static void op_CB_0x95(Z80EX_CONTEXT *cpu)
 {
 	RES(2,L);
 	T_WAIT_UNTIL(4);
@@ -1229,7 +1229,7 @@ static void op_CB_0x95(void)
 }
 
 /*RES 2,(HL)*/
-static void op_CB_0x96(void)
+static void op_CB_0x96(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(2,temp_byte);
@@ -1239,7 +1239,7 @@ static void op_CB_0x96(void)
 }
 
 /*RES 2,A*/
-static void op_CB_0x97(void)
+static void op_CB_0x97(Z80EX_CONTEXT *cpu)
 {
 	RES(2,A);
 	T_WAIT_UNTIL(4);
@@ -1247,7 +1247,7 @@ static void op_CB_0x97(void)
 }
 
 /*RES 3,B*/
-static void op_CB_0x98(void)
+static void op_CB_0x98(Z80EX_CONTEXT *cpu)
 {
 	RES(3,B);
 	T_WAIT_UNTIL(4);
@@ -1255,7 +1255,7 @@ static void op_CB_0x98(void)
 }
 
 /*RES 3,C*/
-static void op_CB_0x99(void)
+static void op_CB_0x99(Z80EX_CONTEXT *cpu)
 {
 	RES(3,C);
 	T_WAIT_UNTIL(4);
@@ -1263,7 +1263,7 @@ static void op_CB_0x99(void)
 }
 
 /*RES 3,D*/
-static void op_CB_0x9a(void)
+static void op_CB_0x9a(Z80EX_CONTEXT *cpu)
 {
 	RES(3,D);
 	T_WAIT_UNTIL(4);
@@ -1271,7 +1271,7 @@ static void op_CB_0x9a(void)
 }
 
 /*RES 3,E*/
-static void op_CB_0x9b(void)
+static void op_CB_0x9b(Z80EX_CONTEXT *cpu)
 {
 	RES(3,E);
 	T_WAIT_UNTIL(4);
@@ -1279,7 +1279,7 @@ static void op_CB_0x9b(void)
 }
 
 /*RES 3,H*/
-static void op_CB_0x9c(void)
+static void op_CB_0x9c(Z80EX_CONTEXT *cpu)
 {
 	RES(3,H);
 	T_WAIT_UNTIL(4);
@@ -1287,7 +1287,7 @@ static void op_CB_0x9c(void)
 }
 
 /*RES 3,L*/
-static void op_CB_0x9d(void)
+static void op_CB_0x9d(Z80EX_CONTEXT *cpu)
 {
 	RES(3,L);
 	T_WAIT_UNTIL(4);
@@ -1295,7 +1295,7 @@ static void op_CB_0x9d(void)
 }
 
 /*RES 3,(HL)*/
-static void op_CB_0x9e(void)
+static void op_CB_0x9e(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(3,temp_byte);
@@ -1305,7 +1305,7 @@ static void op_CB_0x9e(void)
 }
 
 /*RES 3,A*/
-static void op_CB_0x9f(void)
+static void op_CB_0x9f(Z80EX_CONTEXT *cpu)
 {
 	RES(3,A);
 	T_WAIT_UNTIL(4);
@@ -1313,7 +1313,7 @@ static void op_CB_0x9f(void)
 }
 
 /*RES 4,B*/
-static void op_CB_0xa0(void)
+static void op_CB_0xa0(Z80EX_CONTEXT *cpu)
 {
 	RES(4,B);
 	T_WAIT_UNTIL(4);
@@ -1321,7 +1321,7 @@ static void op_CB_0xa0(void)
 }
 
 /*RES 4,C*/
-static void op_CB_0xa1(void)
+static void op_CB_0xa1(Z80EX_CONTEXT *cpu)
 {
 	RES(4,C);
 	T_WAIT_UNTIL(4);
@@ -1329,7 +1329,7 @@ static void op_CB_0xa1(void)
 }
 
 /*RES 4,D*/
-static void op_CB_0xa2(void)
+static void op_CB_0xa2(Z80EX_CONTEXT *cpu)
 {
 	RES(4,D);
 	T_WAIT_UNTIL(4);
@@ -1337,7 +1337,7 @@ static void op_CB_0xa2(void)
 }
 
 /*RES 4,E*/
-static void op_CB_0xa3(void)
+static void op_CB_0xa3(Z80EX_CONTEXT *cpu)
 {
 	RES(4,E);
 	T_WAIT_UNTIL(4);
@@ -1345,7 +1345,7 @@ static void op_CB_0xa3(void)
 }
 
 /*RES 4,H*/
-static void op_CB_0xa4(void)
+static void op_CB_0xa4(Z80EX_CONTEXT *cpu)
 {
 	RES(4,H);
 	T_WAIT_UNTIL(4);
@@ -1353,7 +1353,7 @@ static void op_CB_0xa4(void)
 }
 
 /*RES 4,L*/
-static void op_CB_0xa5(void)
+static void op_CB_0xa5(Z80EX_CONTEXT *cpu)
 {
 	RES(4,L);
 	T_WAIT_UNTIL(4);
@@ -1361,7 +1361,7 @@ static void op_CB_0xa5(void)
 }
 
 /*RES 4,(HL)*/
-static void op_CB_0xa6(void)
+static void op_CB_0xa6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(4,temp_byte);
@@ -1371,7 +1371,7 @@ static void op_CB_0xa6(void)
 }
 
 /*RES 4,A*/
-static void op_CB_0xa7(void)
+static void op_CB_0xa7(Z80EX_CONTEXT *cpu)
 {
 	RES(4,A);
 	T_WAIT_UNTIL(4);
@@ -1379,7 +1379,7 @@ static void op_CB_0xa7(void)
 }
 
 /*RES 5,B*/
-static void op_CB_0xa8(void)
+static void op_CB_0xa8(Z80EX_CONTEXT *cpu)
 {
 	RES(5,B);
 	T_WAIT_UNTIL(4);
@@ -1387,7 +1387,7 @@ static void op_CB_0xa8(void)
 }
 
 /*RES 5,C*/
-static void op_CB_0xa9(void)
+static void op_CB_0xa9(Z80EX_CONTEXT *cpu)
 {
 	RES(5,C);
 	T_WAIT_UNTIL(4);
@@ -1395,7 +1395,7 @@ static void op_CB_0xa9(void)
 }
 
 /*RES 5,D*/
-static void op_CB_0xaa(void)
+static void op_CB_0xaa(Z80EX_CONTEXT *cpu)
 {
 	RES(5,D);
 	T_WAIT_UNTIL(4);
@@ -1403,7 +1403,7 @@ static void op_CB_0xaa(void)
 }
 
 /*RES 5,E*/
-static void op_CB_0xab(void)
+static void op_CB_0xab(Z80EX_CONTEXT *cpu)
 {
 	RES(5,E);
 	T_WAIT_UNTIL(4);
@@ -1411,7 +1411,7 @@ static void op_CB_0xab(void)
 }
 
 /*RES 5,H*/
-static void op_CB_0xac(void)
+static void op_CB_0xac(Z80EX_CONTEXT *cpu)
 {
 	RES(5,H);
 	T_WAIT_UNTIL(4);
@@ -1419,7 +1419,7 @@ static void op_CB_0xac(void)
 }
 
 /*RES 5,L*/
-static void op_CB_0xad(void)
+static void op_CB_0xad(Z80EX_CONTEXT *cpu)
 {
 	RES(5,L);
 	T_WAIT_UNTIL(4);
@@ -1427,7 +1427,7 @@ static void op_CB_0xad(void)
 }
 
 /*RES 5,(HL)*/
-static void op_CB_0xae(void)
+static void op_CB_0xae(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(5,temp_byte);
@@ -1437,7 +1437,7 @@ static void op_CB_0xae(void)
 }
 
 /*RES 5,A*/
-static void op_CB_0xaf(void)
+static void op_CB_0xaf(Z80EX_CONTEXT *cpu)
 {
 	RES(5,A);
 	T_WAIT_UNTIL(4);
@@ -1445,7 +1445,7 @@ static void op_CB_0xaf(void)
 }
 
 /*RES 6,B*/
-static void op_CB_0xb0(void)
+static void op_CB_0xb0(Z80EX_CONTEXT *cpu)
 {
 	RES(6,B);
 	T_WAIT_UNTIL(4);
@@ -1453,7 +1453,7 @@ static void op_CB_0xb0(void)
 }
 
 /*RES 6,C*/
-static void op_CB_0xb1(void)
+static void op_CB_0xb1(Z80EX_CONTEXT *cpu)
 {
 	RES(6,C);
 	T_WAIT_UNTIL(4);
@@ -1461,7 +1461,7 @@ static void op_CB_0xb1(void)
 }
 
 /*RES 6,D*/
-static void op_CB_0xb2(void)
+static void op_CB_0xb2(Z80EX_CONTEXT *cpu)
 {
 	RES(6,D);
 	T_WAIT_UNTIL(4);
@@ -1469,7 +1469,7 @@ static void op_CB_0xb2(void)
 }
 
 /*RES 6,E*/
-static void op_CB_0xb3(void)
+static void op_CB_0xb3(Z80EX_CONTEXT *cpu)
 {
 	RES(6,E);
 	T_WAIT_UNTIL(4);
@@ -1477,7 +1477,7 @@ static void op_CB_0xb3(void)
 }
 
 /*RES 6,H*/
-static void op_CB_0xb4(void)
+static void op_CB_0xb4(Z80EX_CONTEXT *cpu)
 {
 	RES(6,H);
 	T_WAIT_UNTIL(4);
@@ -1485,7 +1485,7 @@ static void op_CB_0xb4(void)
 }
 
 /*RES 6,L*/
-static void op_CB_0xb5(void)
+static void op_CB_0xb5(Z80EX_CONTEXT *cpu)
 {
 	RES(6,L);
 	T_WAIT_UNTIL(4);
@@ -1493,7 +1493,7 @@ static void op_CB_0xb5(void)
 }
 
 /*RES 6,(HL)*/
-static void op_CB_0xb6(void)
+static void op_CB_0xb6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(6,temp_byte);
@@ -1503,7 +1503,7 @@ static void op_CB_0xb6(void)
 }
 
 /*RES 6,A*/
-static void op_CB_0xb7(void)
+static void op_CB_0xb7(Z80EX_CONTEXT *cpu)
 {
 	RES(6,A);
 	T_WAIT_UNTIL(4);
@@ -1511,7 +1511,7 @@ static void op_CB_0xb7(void)
 }
 
 /*RES 7,B*/
-static void op_CB_0xb8(void)
+static void op_CB_0xb8(Z80EX_CONTEXT *cpu)
 {
 	RES(7,B);
 	T_WAIT_UNTIL(4);
@@ -1519,7 +1519,7 @@ static void op_CB_0xb8(void)
 }
 
 /*RES 7,C*/
-static void op_CB_0xb9(void)
+static void op_CB_0xb9(Z80EX_CONTEXT *cpu)
 {
 	RES(7,C);
 	T_WAIT_UNTIL(4);
@@ -1527,7 +1527,7 @@ static void op_CB_0xb9(void)
 }
 
 /*RES 7,D*/
-static void op_CB_0xba(void)
+static void op_CB_0xba(Z80EX_CONTEXT *cpu)
 {
 	RES(7,D);
 	T_WAIT_UNTIL(4);
@@ -1535,7 +1535,7 @@ static void op_CB_0xba(void)
 }
 
 /*RES 7,E*/
-static void op_CB_0xbb(void)
+static void op_CB_0xbb(Z80EX_CONTEXT *cpu)
 {
 	RES(7,E);
 	T_WAIT_UNTIL(4);
@@ -1543,7 +1543,7 @@ static void op_CB_0xbb(void)
 }
 
 /*RES 7,H*/
-static void op_CB_0xbc(void)
+static void op_CB_0xbc(Z80EX_CONTEXT *cpu)
 {
 	RES(7,H);
 	T_WAIT_UNTIL(4);
@@ -1551,7 +1551,7 @@ static void op_CB_0xbc(void)
 }
 
 /*RES 7,L*/
-static void op_CB_0xbd(void)
+static void op_CB_0xbd(Z80EX_CONTEXT *cpu)
 {
 	RES(7,L);
 	T_WAIT_UNTIL(4);
@@ -1559,7 +1559,7 @@ static void op_CB_0xbd(void)
 }
 
 /*RES 7,(HL)*/
-static void op_CB_0xbe(void)
+static void op_CB_0xbe(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	RES(7,temp_byte);
@@ -1569,7 +1569,7 @@ static void op_CB_0xbe(void)
 }
 
 /*RES 7,A*/
-static void op_CB_0xbf(void)
+static void op_CB_0xbf(Z80EX_CONTEXT *cpu)
 {
 	RES(7,A);
 	T_WAIT_UNTIL(4);
@@ -1577,7 +1577,7 @@ static void op_CB_0xbf(void)
 }
 
 /*SET 0,B*/
-static void op_CB_0xc0(void)
+static void op_CB_0xc0(Z80EX_CONTEXT *cpu)
 {
 	SET(0,B);
 	T_WAIT_UNTIL(4);
@@ -1585,7 +1585,7 @@ static void op_CB_0xc0(void)
 }
 
 /*SET 0,C*/
-static void op_CB_0xc1(void)
+static void op_CB_0xc1(Z80EX_CONTEXT *cpu)
 {
 	SET(0,C);
 	T_WAIT_UNTIL(4);
@@ -1593,7 +1593,7 @@ static void op_CB_0xc1(void)
 }
 
 /*SET 0,D*/
-static void op_CB_0xc2(void)
+static void op_CB_0xc2(Z80EX_CONTEXT *cpu)
 {
 	SET(0,D);
 	T_WAIT_UNTIL(4);
@@ -1601,7 +1601,7 @@ static void op_CB_0xc2(void)
 }
 
 /*SET 0,E*/
-static void op_CB_0xc3(void)
+static void op_CB_0xc3(Z80EX_CONTEXT *cpu)
 {
 	SET(0,E);
 	T_WAIT_UNTIL(4);
@@ -1609,7 +1609,7 @@ static void op_CB_0xc3(void)
 }
 
 /*SET 0,H*/
-static void op_CB_0xc4(void)
+static void op_CB_0xc4(Z80EX_CONTEXT *cpu)
 {
 	SET(0,H);
 	T_WAIT_UNTIL(4);
@@ -1617,7 +1617,7 @@ static void op_CB_0xc4(void)
 }
 
 /*SET 0,L*/
-static void op_CB_0xc5(void)
+static void op_CB_0xc5(Z80EX_CONTEXT *cpu)
 {
 	SET(0,L);
 	T_WAIT_UNTIL(4);
@@ -1625,7 +1625,7 @@ static void op_CB_0xc5(void)
 }
 
 /*SET 0,(HL)*/
-static void op_CB_0xc6(void)
+static void op_CB_0xc6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(0,temp_byte);
@@ -1635,7 +1635,7 @@ static void op_CB_0xc6(void)
 }
 
 /*SET 0,A*/
-static void op_CB_0xc7(void)
+static void op_CB_0xc7(Z80EX_CONTEXT *cpu)
 {
 	SET(0,A);
 	T_WAIT_UNTIL(4);
@@ -1643,7 +1643,7 @@ static void op_CB_0xc7(void)
 }
 
 /*SET 1,B*/
-static void op_CB_0xc8(void)
+static void op_CB_0xc8(Z80EX_CONTEXT *cpu)
 {
 	SET(1,B);
 	T_WAIT_UNTIL(4);
@@ -1651,7 +1651,7 @@ static void op_CB_0xc8(void)
 }
 
 /*SET 1,C*/
-static void op_CB_0xc9(void)
+static void op_CB_0xc9(Z80EX_CONTEXT *cpu)
 {
 	SET(1,C);
 	T_WAIT_UNTIL(4);
@@ -1659,7 +1659,7 @@ static void op_CB_0xc9(void)
 }
 
 /*SET 1,D*/
-static void op_CB_0xca(void)
+static void op_CB_0xca(Z80EX_CONTEXT *cpu)
 {
 	SET(1,D);
 	T_WAIT_UNTIL(4);
@@ -1667,7 +1667,7 @@ static void op_CB_0xca(void)
 }
 
 /*SET 1,E*/
-static void op_CB_0xcb(void)
+static void op_CB_0xcb(Z80EX_CONTEXT *cpu)
 {
 	SET(1,E);
 	T_WAIT_UNTIL(4);
@@ -1675,7 +1675,7 @@ static void op_CB_0xcb(void)
 }
 
 /*SET 1,H*/
-static void op_CB_0xcc(void)
+static void op_CB_0xcc(Z80EX_CONTEXT *cpu)
 {
 	SET(1,H);
 	T_WAIT_UNTIL(4);
@@ -1683,7 +1683,7 @@ static void op_CB_0xcc(void)
 }
 
 /*SET 1,L*/
-static void op_CB_0xcd(void)
+static void op_CB_0xcd(Z80EX_CONTEXT *cpu)
 {
 	SET(1,L);
 	T_WAIT_UNTIL(4);
@@ -1691,7 +1691,7 @@ static void op_CB_0xcd(void)
 }
 
 /*SET 1,(HL)*/
-static void op_CB_0xce(void)
+static void op_CB_0xce(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(1,temp_byte);
@@ -1701,7 +1701,7 @@ static void op_CB_0xce(void)
 }
 
 /*SET 1,A*/
-static void op_CB_0xcf(void)
+static void op_CB_0xcf(Z80EX_CONTEXT *cpu)
 {
 	SET(1,A);
 	T_WAIT_UNTIL(4);
@@ -1709,7 +1709,7 @@ static void op_CB_0xcf(void)
 }
 
 /*SET 2,B*/
-static void op_CB_0xd0(void)
+static void op_CB_0xd0(Z80EX_CONTEXT *cpu)
 {
 	SET(2,B);
 	T_WAIT_UNTIL(4);
@@ -1717,7 +1717,7 @@ static void op_CB_0xd0(void)
 }
 
 /*SET 2,C*/
-static void op_CB_0xd1(void)
+static void op_CB_0xd1(Z80EX_CONTEXT *cpu)
 {
 	SET(2,C);
 	T_WAIT_UNTIL(4);
@@ -1725,7 +1725,7 @@ static void op_CB_0xd1(void)
 }
 
 /*SET 2,D*/
-static void op_CB_0xd2(void)
+static void op_CB_0xd2(Z80EX_CONTEXT *cpu)
 {
 	SET(2,D);
 	T_WAIT_UNTIL(4);
@@ -1733,7 +1733,7 @@ static void op_CB_0xd2(void)
 }
 
 /*SET 2,E*/
-static void op_CB_0xd3(void)
+static void op_CB_0xd3(Z80EX_CONTEXT *cpu)
 {
 	SET(2,E);
 	T_WAIT_UNTIL(4);
@@ -1741,7 +1741,7 @@ static void op_CB_0xd3(void)
 }
 
 /*SET 2,H*/
-static void op_CB_0xd4(void)
+static void op_CB_0xd4(Z80EX_CONTEXT *cpu)
 {
 	SET(2,H);
 	T_WAIT_UNTIL(4);
@@ -1749,7 +1749,7 @@ static void op_CB_0xd4(void)
 }
 
 /*SET 2,L*/
-static void op_CB_0xd5(void)
+static void op_CB_0xd5(Z80EX_CONTEXT *cpu)
 {
 	SET(2,L);
 	T_WAIT_UNTIL(4);
@@ -1757,7 +1757,7 @@ static void op_CB_0xd5(void)
 }
 
 /*SET 2,(HL)*/
-static void op_CB_0xd6(void)
+static void op_CB_0xd6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(2,temp_byte);
@@ -1767,7 +1767,7 @@ static void op_CB_0xd6(void)
 }
 
 /*SET 2,A*/
-static void op_CB_0xd7(void)
+static void op_CB_0xd7(Z80EX_CONTEXT *cpu)
 {
 	SET(2,A);
 	T_WAIT_UNTIL(4);
@@ -1775,7 +1775,7 @@ static void op_CB_0xd7(void)
 }
 
 /*SET 3,B*/
-static void op_CB_0xd8(void)
+static void op_CB_0xd8(Z80EX_CONTEXT *cpu)
 {
 	SET(3,B);
 	T_WAIT_UNTIL(4);
@@ -1783,7 +1783,7 @@ static void op_CB_0xd8(void)
 }
 
 /*SET 3,C*/
-static void op_CB_0xd9(void)
+static void op_CB_0xd9(Z80EX_CONTEXT *cpu)
 {
 	SET(3,C);
 	T_WAIT_UNTIL(4);
@@ -1791,7 +1791,7 @@ static void op_CB_0xd9(void)
 }
 
 /*SET 3,D*/
-static void op_CB_0xda(void)
+static void op_CB_0xda(Z80EX_CONTEXT *cpu)
 {
 	SET(3,D);
 	T_WAIT_UNTIL(4);
@@ -1799,7 +1799,7 @@ static void op_CB_0xda(void)
 }
 
 /*SET 3,E*/
-static void op_CB_0xdb(void)
+static void op_CB_0xdb(Z80EX_CONTEXT *cpu)
 {
 	SET(3,E);
 	T_WAIT_UNTIL(4);
@@ -1807,7 +1807,7 @@ static void op_CB_0xdb(void)
 }
 
 /*SET 3,H*/
-static void op_CB_0xdc(void)
+static void op_CB_0xdc(Z80EX_CONTEXT *cpu)
 {
 	SET(3,H);
 	T_WAIT_UNTIL(4);
@@ -1815,7 +1815,7 @@ static void op_CB_0xdc(void)
 }
 
 /*SET 3,L*/
-static void op_CB_0xdd(void)
+static void op_CB_0xdd(Z80EX_CONTEXT *cpu)
 {
 	SET(3,L);
 	T_WAIT_UNTIL(4);
@@ -1823,7 +1823,7 @@ static void op_CB_0xdd(void)
 }
 
 /*SET 3,(HL)*/
-static void op_CB_0xde(void)
+static void op_CB_0xde(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(3,temp_byte);
@@ -1833,7 +1833,7 @@ static void op_CB_0xde(void)
 }
 
 /*SET 3,A*/
-static void op_CB_0xdf(void)
+static void op_CB_0xdf(Z80EX_CONTEXT *cpu)
 {
 	SET(3,A);
 	T_WAIT_UNTIL(4);
@@ -1841,7 +1841,7 @@ static void op_CB_0xdf(void)
 }
 
 /*SET 4,B*/
-static void op_CB_0xe0(void)
+static void op_CB_0xe0(Z80EX_CONTEXT *cpu)
 {
 	SET(4,B);
 	T_WAIT_UNTIL(4);
@@ -1849,7 +1849,7 @@ static void op_CB_0xe0(void)
 }
 
 /*SET 4,C*/
-static void op_CB_0xe1(void)
+static void op_CB_0xe1(Z80EX_CONTEXT *cpu)
 {
 	SET(4,C);
 	T_WAIT_UNTIL(4);
@@ -1857,7 +1857,7 @@ static void op_CB_0xe1(void)
 }
 
 /*SET 4,D*/
-static void op_CB_0xe2(void)
+static void op_CB_0xe2(Z80EX_CONTEXT *cpu)
 {
 	SET(4,D);
 	T_WAIT_UNTIL(4);
@@ -1865,7 +1865,7 @@ static void op_CB_0xe2(void)
 }
 
 /*SET 4,E*/
-static void op_CB_0xe3(void)
+static void op_CB_0xe3(Z80EX_CONTEXT *cpu)
 {
 	SET(4,E);
 	T_WAIT_UNTIL(4);
@@ -1873,7 +1873,7 @@ static void op_CB_0xe3(void)
 }
 
 /*SET 4,H*/
-static void op_CB_0xe4(void)
+static void op_CB_0xe4(Z80EX_CONTEXT *cpu)
 {
 	SET(4,H);
 	T_WAIT_UNTIL(4);
@@ -1881,7 +1881,7 @@ static void op_CB_0xe4(void)
 }
 
 /*SET 4,L*/
-static void op_CB_0xe5(void)
+static void op_CB_0xe5(Z80EX_CONTEXT *cpu)
 {
 	SET(4,L);
 	T_WAIT_UNTIL(4);
@@ -1889,7 +1889,7 @@ static void op_CB_0xe5(void)
 }
 
 /*SET 4,(HL)*/
-static void op_CB_0xe6(void)
+static void op_CB_0xe6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(4,temp_byte);
@@ -1899,7 +1899,7 @@ static void op_CB_0xe6(void)
 }
 
 /*SET 4,A*/
-static void op_CB_0xe7(void)
+static void op_CB_0xe7(Z80EX_CONTEXT *cpu)
 {
 	SET(4,A);
 	T_WAIT_UNTIL(4);
@@ -1907,7 +1907,7 @@ static void op_CB_0xe7(void)
 }
 
 /*SET 5,B*/
-static void op_CB_0xe8(void)
+static void op_CB_0xe8(Z80EX_CONTEXT *cpu)
 {
 	SET(5,B);
 	T_WAIT_UNTIL(4);
@@ -1915,7 +1915,7 @@ static void op_CB_0xe8(void)
 }
 
 /*SET 5,C*/
-static void op_CB_0xe9(void)
+static void op_CB_0xe9(Z80EX_CONTEXT *cpu)
 {
 	SET(5,C);
 	T_WAIT_UNTIL(4);
@@ -1923,7 +1923,7 @@ static void op_CB_0xe9(void)
 }
 
 /*SET 5,D*/
-static void op_CB_0xea(void)
+static void op_CB_0xea(Z80EX_CONTEXT *cpu)
 {
 	SET(5,D);
 	T_WAIT_UNTIL(4);
@@ -1931,7 +1931,7 @@ static void op_CB_0xea(void)
 }
 
 /*SET 5,E*/
-static void op_CB_0xeb(void)
+static void op_CB_0xeb(Z80EX_CONTEXT *cpu)
 {
 	SET(5,E);
 	T_WAIT_UNTIL(4);
@@ -1939,7 +1939,7 @@ static void op_CB_0xeb(void)
 }
 
 /*SET 5,H*/
-static void op_CB_0xec(void)
+static void op_CB_0xec(Z80EX_CONTEXT *cpu)
 {
 	SET(5,H);
 	T_WAIT_UNTIL(4);
@@ -1947,7 +1947,7 @@ static void op_CB_0xec(void)
 }
 
 /*SET 5,L*/
-static void op_CB_0xed(void)
+static void op_CB_0xed(Z80EX_CONTEXT *cpu)
 {
 	SET(5,L);
 	T_WAIT_UNTIL(4);
@@ -1955,7 +1955,7 @@ static void op_CB_0xed(void)
 }
 
 /*SET 5,(HL)*/
-static void op_CB_0xee(void)
+static void op_CB_0xee(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(5,temp_byte);
@@ -1965,7 +1965,7 @@ static void op_CB_0xee(void)
 }
 
 /*SET 5,A*/
-static void op_CB_0xef(void)
+static void op_CB_0xef(Z80EX_CONTEXT *cpu)
 {
 	SET(5,A);
 	T_WAIT_UNTIL(4);
@@ -1973,7 +1973,7 @@ static void op_CB_0xef(void)
 }
 
 /*SET 6,B*/
-static void op_CB_0xf0(void)
+static void op_CB_0xf0(Z80EX_CONTEXT *cpu)
 {
 	SET(6,B);
 	T_WAIT_UNTIL(4);
@@ -1981,7 +1981,7 @@ static void op_CB_0xf0(void)
 }
 
 /*SET 6,C*/
-static void op_CB_0xf1(void)
+static void op_CB_0xf1(Z80EX_CONTEXT *cpu)
 {
 	SET(6,C);
 	T_WAIT_UNTIL(4);
@@ -1989,7 +1989,7 @@ static void op_CB_0xf1(void)
 }
 
 /*SET 6,D*/
-static void op_CB_0xf2(void)
+static void op_CB_0xf2(Z80EX_CONTEXT *cpu)
 {
 	SET(6,D);
 	T_WAIT_UNTIL(4);
@@ -1997,7 +1997,7 @@ static void op_CB_0xf2(void)
 }
 
 /*SET 6,E*/
-static void op_CB_0xf3(void)
+static void op_CB_0xf3(Z80EX_CONTEXT *cpu)
 {
 	SET(6,E);
 	T_WAIT_UNTIL(4);
@@ -2005,7 +2005,7 @@ static void op_CB_0xf3(void)
 }
 
 /*SET 6,H*/
-static void op_CB_0xf4(void)
+static void op_CB_0xf4(Z80EX_CONTEXT *cpu)
 {
 	SET(6,H);
 	T_WAIT_UNTIL(4);
@@ -2013,7 +2013,7 @@ static void op_CB_0xf4(void)
 }
 
 /*SET 6,L*/
-static void op_CB_0xf5(void)
+static void op_CB_0xf5(Z80EX_CONTEXT *cpu)
 {
 	SET(6,L);
 	T_WAIT_UNTIL(4);
@@ -2021,7 +2021,7 @@ static void op_CB_0xf5(void)
 }
 
 /*SET 6,(HL)*/
-static void op_CB_0xf6(void)
+static void op_CB_0xf6(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(6,temp_byte);
@@ -2031,7 +2031,7 @@ static void op_CB_0xf6(void)
 }
 
 /*SET 6,A*/
-static void op_CB_0xf7(void)
+static void op_CB_0xf7(Z80EX_CONTEXT *cpu)
 {
 	SET(6,A);
 	T_WAIT_UNTIL(4);
@@ -2039,7 +2039,7 @@ static void op_CB_0xf7(void)
 }
 
 /*SET 7,B*/
-static void op_CB_0xf8(void)
+static void op_CB_0xf8(Z80EX_CONTEXT *cpu)
 {
 	SET(7,B);
 	T_WAIT_UNTIL(4);
@@ -2047,7 +2047,7 @@ static void op_CB_0xf8(void)
 }
 
 /*SET 7,C*/
-static void op_CB_0xf9(void)
+static void op_CB_0xf9(Z80EX_CONTEXT *cpu)
 {
 	SET(7,C);
 	T_WAIT_UNTIL(4);
@@ -2055,7 +2055,7 @@ static void op_CB_0xf9(void)
 }
 
 /*SET 7,D*/
-static void op_CB_0xfa(void)
+static void op_CB_0xfa(Z80EX_CONTEXT *cpu)
 {
 	SET(7,D);
 	T_WAIT_UNTIL(4);
@@ -2063,7 +2063,7 @@ static void op_CB_0xfa(void)
 }
 
 /*SET 7,E*/
-static void op_CB_0xfb(void)
+static void op_CB_0xfb(Z80EX_CONTEXT *cpu)
 {
 	SET(7,E);
 	T_WAIT_UNTIL(4);
@@ -2071,7 +2071,7 @@ static void op_CB_0xfb(void)
 }
 
 /*SET 7,H*/
-static void op_CB_0xfc(void)
+static void op_CB_0xfc(Z80EX_CONTEXT *cpu)
 {
 	SET(7,H);
 	T_WAIT_UNTIL(4);
@@ -2079,7 +2079,7 @@ static void op_CB_0xfc(void)
 }
 
 /*SET 7,L*/
-static void op_CB_0xfd(void)
+static void op_CB_0xfd(Z80EX_CONTEXT *cpu)
 {
 	SET(7,L);
 	T_WAIT_UNTIL(4);
@@ -2087,7 +2087,7 @@ static void op_CB_0xfd(void)
 }
 
 /*SET 7,(HL)*/
-static void op_CB_0xfe(void)
+static void op_CB_0xfe(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_byte,(HL),4);
 	SET(7,temp_byte);
@@ -2097,7 +2097,7 @@ static void op_CB_0xfe(void)
 }
 
 /*SET 7,A*/
-static void op_CB_0xff(void)
+static void op_CB_0xff(Z80EX_CONTEXT *cpu)
 {
 	SET(7,A);
 	T_WAIT_UNTIL(4);
@@ -1,7 +1,7 @@
 /* autogenerated from ./opcodes_ddfd.dat, do not edit */
 
 /*ADD IX,BC*/
-static void op_DD_0x09(void)
+static void op_DD_0x09(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IX,BC);
 	T_WAIT_UNTIL(11);
@@ -9,7 +9,7 @@ static void op_DD_0x09(void)
 }
 
 /*ADD IX,DE*/
-static void op_DD_0x19(void)
+static void op_DD_0x19(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IX,DE);
 	T_WAIT_UNTIL(11);
@@ -17,7 +17,7 @@ static void op_DD_0x19(void)
 }
 
 /*LD IX,@*/
-static void op_DD_0x21(void)
+static void op_DD_0x21(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -27,7 +27,7 @@ static void op_DD_0x21(void)
 }
 
 /*LD (@),IX*/
-static void op_DD_0x22(void)
+static void op_DD_0x22(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -39,7 +39,7 @@ static void op_DD_0x22(void)
 }
 
 /*INC IX*/
-static void op_DD_0x23(void)
+static void op_DD_0x23(Z80EX_CONTEXT *cpu)
 {
 	INC16(IX);
 	T_WAIT_UNTIL(6);
@@ -47,7 +47,7 @@ static void op_DD_0x23(void)
 }
 
 /*INC IXH*/
-static void op_DD_0x24(void)
+static void op_DD_0x24(Z80EX_CONTEXT *cpu)
 {
 	INC(IXH);
 	T_WAIT_UNTIL(4);
@@ -55,7 +55,7 @@ static void op_DD_0x24(void)
 }
 
 /*DEC IXH*/
-static void op_DD_0x25(void)
+static void op_DD_0x25(Z80EX_CONTEXT *cpu)
 {
 	DEC(IXH);
 	T_WAIT_UNTIL(4);
@@ -63,7 +63,7 @@ static void op_DD_0x25(void)
 }
 
 /*LD IXH,#*/
-static void op_DD_0x26(void)
+static void op_DD_0x26(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(IXH,temp_byte);
@@ -72,7 +72,7 @@ static void op_DD_0x26(void)
 }
 
 /*ADD IX,IX*/
-static void op_DD_0x29(void)
+static void op_DD_0x29(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IX,IX);
 	T_WAIT_UNTIL(11);
@@ -80,7 +80,7 @@ static void op_DD_0x29(void)
 }
 
 /*LD IX,(@)*/
-static void op_DD_0x2a(void)
+static void op_DD_0x2a(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -92,7 +92,7 @@ static void op_DD_0x2a(void)
 }
 
 /*DEC IX*/
-static void op_DD_0x2b(void)
+static void op_DD_0x2b(Z80EX_CONTEXT *cpu)
 {
 	DEC16(IX);
 	T_WAIT_UNTIL(6);
@@ -100,7 +100,7 @@ static void op_DD_0x2b(void)
 }
 
 /*INC IXL*/
-static void op_DD_0x2c(void)
+static void op_DD_0x2c(Z80EX_CONTEXT *cpu)
 {
 	INC(IXL);
 	T_WAIT_UNTIL(4);
@@ -108,7 +108,7 @@ static void op_DD_0x2c(void)
 }
 
 /*DEC IXL*/
-static void op_DD_0x2d(void)
+static void op_DD_0x2d(Z80EX_CONTEXT *cpu)
 {
 	DEC(IXL);
 	T_WAIT_UNTIL(4);
@@ -116,7 +116,7 @@ static void op_DD_0x2d(void)
 }
 
 /*LD IXL,#*/
-static void op_DD_0x2e(void)
+static void op_DD_0x2e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(IXL,temp_byte);
@@ -125,7 +125,7 @@ static void op_DD_0x2e(void)
 }
 
 /*INC (IX+$)*/
-static void op_DD_0x34(void)
+static void op_DD_0x34(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -138,7 +138,7 @@ static void op_DD_0x34(void)
 }
 
 /*DEC (IX+$)*/
-static void op_DD_0x35(void)
+static void op_DD_0x35(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -151,7 +151,7 @@ static void op_DD_0x35(void)
 }
 
 /*LD (IX+$),#*/
-static void op_DD_0x36(void)
+static void op_DD_0x36(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -164,7 +164,7 @@ static void op_DD_0x36(void)
 }
 
 /*ADD IX,SP*/
-static void op_DD_0x39(void)
+static void op_DD_0x39(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IX,SP);
 	T_WAIT_UNTIL(11);
@@ -172,7 +172,7 @@ static void op_DD_0x39(void)
 }
 
 /*LD B,IXH*/
-static void op_DD_0x44(void)
+static void op_DD_0x44(Z80EX_CONTEXT *cpu)
 {
 	LD(B,IXH);
 	T_WAIT_UNTIL(4);
@@ -180,7 +180,7 @@ static void op_DD_0x44(void)
 }
 
 /*LD B,IXL*/
-static void op_DD_0x45(void)
+static void op_DD_0x45(Z80EX_CONTEXT *cpu)
 {
 	LD(B,IXL);
 	T_WAIT_UNTIL(4);
@@ -188,7 +188,7 @@ static void op_DD_0x45(void)
 }
 
 /*LD B,(IX+$)*/
-static void op_DD_0x46(void)
+static void op_DD_0x46(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -200,7 +200,7 @@ static void op_DD_0x46(void)
 }
 
 /*LD C,IXH*/
-static void op_DD_0x4c(void)
+static void op_DD_0x4c(Z80EX_CONTEXT *cpu)
 {
 	LD(C,IXH);
 	T_WAIT_UNTIL(4);
@@ -208,7 +208,7 @@ static void op_DD_0x4c(void)
 }
 
 /*LD C,IXL*/
-static void op_DD_0x4d(void)
+static void op_DD_0x4d(Z80EX_CONTEXT *cpu)
 {
 	LD(C,IXL);
 	T_WAIT_UNTIL(4);
@@ -216,7 +216,7 @@ static void op_DD_0x4d(void)
 }
 
 /*LD C,(IX+$)*/
-static void op_DD_0x4e(void)
+static void op_DD_0x4e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -228,7 +228,7 @@ static void op_DD_0x4e(void)
 }
 
 /*LD D,IXH*/
-static void op_DD_0x54(void)
+static void op_DD_0x54(Z80EX_CONTEXT *cpu)
 {
 	LD(D,IXH);
 	T_WAIT_UNTIL(4);
@@ -236,7 +236,7 @@ static void op_DD_0x54(void)
 }
 
 /*LD D,IXL*/
-static void op_DD_0x55(void)
+static void op_DD_0x55(Z80EX_CONTEXT *cpu)
 {
 	LD(D,IXL);
 	T_WAIT_UNTIL(4);
@@ -244,7 +244,7 @@ static void op_DD_0x55(void)
 }
 
 /*LD D,(IX+$)*/
-static void op_DD_0x56(void)
+static void op_DD_0x56(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -256,7 +256,7 @@ static void op_DD_0x56(void)
 }
 
 /*LD E,IXH*/
-static void op_DD_0x5c(void)
+static void op_DD_0x5c(Z80EX_CONTEXT *cpu)
 {
 	LD(E,IXH);
 	T_WAIT_UNTIL(4);
@@ -264,7 +264,7 @@ static void op_DD_0x5c(void)
 }
 
 /*LD E,IXL*/
-static void op_DD_0x5d(void)
+static void op_DD_0x5d(Z80EX_CONTEXT *cpu)
 {
 	LD(E,IXL);
 	T_WAIT_UNTIL(4);
@@ -272,7 +272,7 @@ static void op_DD_0x5d(void)
 }
 
 /*LD E,(IX+$)*/
-static void op_DD_0x5e(void)
+static void op_DD_0x5e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -284,7 +284,7 @@ static void op_DD_0x5e(void)
 }
 
 /*LD IXH,B*/
-static void op_DD_0x60(void)
+static void op_DD_0x60(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,B);
 	T_WAIT_UNTIL(4);
@@ -292,7 +292,7 @@ static void op_DD_0x60(void)
 }
 
 /*LD IXH,C*/
-static void op_DD_0x61(void)
+static void op_DD_0x61(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,C);
 	T_WAIT_UNTIL(4);
@@ -300,7 +300,7 @@ static void op_DD_0x61(void)
 }
 
 /*LD IXH,D*/
-static void op_DD_0x62(void)
+static void op_DD_0x62(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,D);
 	T_WAIT_UNTIL(4);
@@ -308,7 +308,7 @@ static void op_DD_0x62(void)
 }
 
 /*LD IXH,E*/
-static void op_DD_0x63(void)
+static void op_DD_0x63(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,E);
 	T_WAIT_UNTIL(4);
@@ -316,7 +316,7 @@ static void op_DD_0x63(void)
 }
 
 /*LD IXH,IXH*/
-static void op_DD_0x64(void)
+static void op_DD_0x64(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,IXH);
 	T_WAIT_UNTIL(4);
@@ -324,7 +324,7 @@ static void op_DD_0x64(void)
 }
 
 /*LD IXH,IXL*/
-static void op_DD_0x65(void)
+static void op_DD_0x65(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,IXL);
 	T_WAIT_UNTIL(4);
@@ -332,7 +332,7 @@ static void op_DD_0x65(void)
 }
 
 /*LD H,(IX+$)*/
-static void op_DD_0x66(void)
+static void op_DD_0x66(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -344,7 +344,7 @@ static void op_DD_0x66(void)
 }
 
 /*LD IXH,A*/
-static void op_DD_0x67(void)
+static void op_DD_0x67(Z80EX_CONTEXT *cpu)
 {
 	LD(IXH,A);
 	T_WAIT_UNTIL(4);
@@ -352,7 +352,7 @@ static void op_DD_0x67(void)
 }
 
 /*LD IXL,B*/
-static void op_DD_0x68(void)
+static void op_DD_0x68(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,B);
 	T_WAIT_UNTIL(4);
@@ -360,7 +360,7 @@ static void op_DD_0x68(void)
 }
 
 /*LD IXL,C*/
-static void op_DD_0x69(void)
+static void op_DD_0x69(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,C);
 	T_WAIT_UNTIL(4);
@@ -368,7 +368,7 @@ static void op_DD_0x69(void)
 }
 
 /*LD IXL,D*/
-static void op_DD_0x6a(void)
+static void op_DD_0x6a(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,D);
 	T_WAIT_UNTIL(4);
@@ -376,7 +376,7 @@ static void op_DD_0x6a(void)
 }
 
 /*LD IXL,E*/
-static void op_DD_0x6b(void)
+static void op_DD_0x6b(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,E);
 	T_WAIT_UNTIL(4);
@@ -384,7 +384,7 @@ static void op_DD_0x6b(void)
 }
 
 /*LD IXL,IXH*/
-static void op_DD_0x6c(void)
+static void op_DD_0x6c(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,IXH);
 	T_WAIT_UNTIL(4);
@@ -392,7 +392,7 @@ static void op_DD_0x6c(void)
 }
 
 /*LD IXL,IXL*/
-static void op_DD_0x6d(void)
+static void op_DD_0x6d(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,IXL);
 	T_WAIT_UNTIL(4);
@@ -400,7 +400,7 @@ static void op_DD_0x6d(void)
 }
 
 /*LD L,(IX+$)*/
-static void op_DD_0x6e(void)
+static void op_DD_0x6e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -412,7 +412,7 @@ static void op_DD_0x6e(void)
 }
 
 /*LD IXL,A*/
-static void op_DD_0x6f(void)
+static void op_DD_0x6f(Z80EX_CONTEXT *cpu)
 {
 	LD(IXL,A);
 	T_WAIT_UNTIL(4);
@@ -420,7 +420,7 @@ static void op_DD_0x6f(void)
 }
 
 /*LD (IX+$),B*/
-static void op_DD_0x70(void)
+static void op_DD_0x70(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -432,7 +432,7 @@ static void op_DD_0x70(void)
 }
 
 /*LD (IX+$),C*/
-static void op_DD_0x71(void)
+static void op_DD_0x71(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -444,7 +444,7 @@ static void op_DD_0x71(void)
 }
 
 /*LD (IX+$),D*/
-static void op_DD_0x72(void)
+static void op_DD_0x72(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -456,7 +456,7 @@ static void op_DD_0x72(void)
 }
 
 /*LD (IX+$),E*/
-static void op_DD_0x73(void)
+static void op_DD_0x73(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -468,7 +468,7 @@ static void op_DD_0x73(void)
 }
 
 /*LD (IX+$),H*/
-static void op_DD_0x74(void)
+static void op_DD_0x74(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -480,7 +480,7 @@ static void op_DD_0x74(void)
 }
 
 /*LD (IX+$),L*/
-static void op_DD_0x75(void)
+static void op_DD_0x75(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -492,7 +492,7 @@ static void op_DD_0x75(void)
 }
 
 /*LD (IX+$),A*/
-static void op_DD_0x77(void)
+static void op_DD_0x77(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -504,7 +504,7 @@ static void op_DD_0x77(void)
 }
 
 /*LD A,IXH*/
-static void op_DD_0x7c(void)
+static void op_DD_0x7c(Z80EX_CONTEXT *cpu)
 {
 	LD(A,IXH);
 	T_WAIT_UNTIL(4);
@@ -512,7 +512,7 @@ static void op_DD_0x7c(void)
 }
 
 /*LD A,IXL*/
-static void op_DD_0x7d(void)
+static void op_DD_0x7d(Z80EX_CONTEXT *cpu)
 {
 	LD(A,IXL);
 	T_WAIT_UNTIL(4);
@@ -520,7 +520,7 @@ static void op_DD_0x7d(void)
 }
 
 /*LD A,(IX+$)*/
-static void op_DD_0x7e(void)
+static void op_DD_0x7e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -532,7 +532,7 @@ static void op_DD_0x7e(void)
 }
 
 /*ADD A,IXH*/
-static void op_DD_0x84(void)
+static void op_DD_0x84(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,IXH);
 	T_WAIT_UNTIL(4);
@@ -540,7 +540,7 @@ static void op_DD_0x84(void)
 }
 
 /*ADD A,IXL*/
-static void op_DD_0x85(void)
+static void op_DD_0x85(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,IXL);
 	T_WAIT_UNTIL(4);
@@ -548,7 +548,7 @@ static void op_DD_0x85(void)
 }
 
 /*ADD A,(IX+$)*/
-static void op_DD_0x86(void)
+static void op_DD_0x86(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -560,7 +560,7 @@ static void op_DD_0x86(void)
 }
 
 /*ADC A,IXH*/
-static void op_DD_0x8c(void)
+static void op_DD_0x8c(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,IXH);
 	T_WAIT_UNTIL(4);
@@ -568,7 +568,7 @@ static void op_DD_0x8c(void)
 }
 
 /*ADC A,IXL*/
-static void op_DD_0x8d(void)
+static void op_DD_0x8d(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,IXL);
 	T_WAIT_UNTIL(4);
@@ -576,7 +576,7 @@ static void op_DD_0x8d(void)
 }
 
 /*ADC A,(IX+$)*/
-static void op_DD_0x8e(void)
+static void op_DD_0x8e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -588,7 +588,7 @@ static void op_DD_0x8e(void)
 }
 
 /*SUB IXH*/
-static void op_DD_0x94(void)
+static void op_DD_0x94(Z80EX_CONTEXT *cpu)
 {
 	SUB(IXH);
 	T_WAIT_UNTIL(4);
@@ -596,7 +596,7 @@ static void op_DD_0x94(void)
 }
 
 /*SUB IXL*/
-static void op_DD_0x95(void)
+static void op_DD_0x95(Z80EX_CONTEXT *cpu)
 {
 	SUB(IXL);
 	T_WAIT_UNTIL(4);
@@ -604,7 +604,7 @@ static void op_DD_0x95(void)
 }
 
 /*SUB (IX+$)*/
-static void op_DD_0x96(void)
+static void op_DD_0x96(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -616,7 +616,7 @@ static void op_DD_0x96(void)
 }
 
 /*SBC A,IXH*/
-static void op_DD_0x9c(void)
+static void op_DD_0x9c(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,IXH);
 	T_WAIT_UNTIL(4);
@@ -624,7 +624,7 @@ static void op_DD_0x9c(void)
 }
 
 /*SBC A,IXL*/
-static void op_DD_0x9d(void)
+static void op_DD_0x9d(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,IXL);
 	T_WAIT_UNTIL(4);
@@ -632,7 +632,7 @@ static void op_DD_0x9d(void)
 }
 
 /*SBC A,(IX+$)*/
-static void op_DD_0x9e(void)
+static void op_DD_0x9e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -644,7 +644,7 @@ static void op_DD_0x9e(void)
 }
 
 /*AND IXH*/
-static void op_DD_0xa4(void)
+static void op_DD_0xa4(Z80EX_CONTEXT *cpu)
 {
 	AND(IXH);
 	T_WAIT_UNTIL(4);
@@ -652,7 +652,7 @@ static void op_DD_0xa4(void)
 }
 
 /*AND IXL*/
-static void op_DD_0xa5(void)
+static void op_DD_0xa5(Z80EX_CONTEXT *cpu)
 {
 	AND(IXL);
 	T_WAIT_UNTIL(4);
@@ -660,7 +660,7 @@ static void op_DD_0xa5(void)
 }
 
 /*AND (IX+$)*/
-static void op_DD_0xa6(void)
+static void op_DD_0xa6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -672,7 +672,7 @@ static void op_DD_0xa6(void)
 }
 
 /*XOR IXH*/
-static void op_DD_0xac(void)
+static void op_DD_0xac(Z80EX_CONTEXT *cpu)
 {
 	XOR(IXH);
 	T_WAIT_UNTIL(4);
@@ -680,7 +680,7 @@ static void op_DD_0xac(void)
 }
 
 /*XOR IXL*/
-static void op_DD_0xad(void)
+static void op_DD_0xad(Z80EX_CONTEXT *cpu)
 {
 	XOR(IXL);
 	T_WAIT_UNTIL(4);
@@ -688,7 +688,7 @@ static void op_DD_0xad(void)
 }
 
 /*XOR (IX+$)*/
-static void op_DD_0xae(void)
+static void op_DD_0xae(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -700,7 +700,7 @@ static void op_DD_0xae(void)
 }
 
 /*OR IXH*/
-static void op_DD_0xb4(void)
+static void op_DD_0xb4(Z80EX_CONTEXT *cpu)
 {
 	OR(IXH);
 	T_WAIT_UNTIL(4);
@@ -708,7 +708,7 @@ static void op_DD_0xb4(void)
 }
 
 /*OR IXL*/
-static void op_DD_0xb5(void)
+static void op_DD_0xb5(Z80EX_CONTEXT *cpu)
 {
 	OR(IXL);
 	T_WAIT_UNTIL(4);
@@ -716,7 +716,7 @@ static void op_DD_0xb5(void)
 }
 
 /*OR (IX+$)*/
-static void op_DD_0xb6(void)
+static void op_DD_0xb6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -728,7 +728,7 @@ static void op_DD_0xb6(void)
 }
 
 /*CP IXH*/
-static void op_DD_0xbc(void)
+static void op_DD_0xbc(Z80EX_CONTEXT *cpu)
 {
 	CP(IXH);
 	T_WAIT_UNTIL(4);
@@ -736,7 +736,7 @@ static void op_DD_0xbc(void)
 }
 
 /*CP IXL*/
-static void op_DD_0xbd(void)
+static void op_DD_0xbd(Z80EX_CONTEXT *cpu)
 {
 	CP(IXL);
 	T_WAIT_UNTIL(4);
@@ -744,7 +744,7 @@ static void op_DD_0xbd(void)
 }
 
 /*CP (IX+$)*/
-static void op_DD_0xbe(void)
+static void op_DD_0xbe(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -757,7 +757,7 @@ static void op_DD_0xbe(void)
 
 
 /*POP IX*/
-static void op_DD_0xe1(void)
+static void op_DD_0xe1(Z80EX_CONTEXT *cpu)
 {
 	POP(IX, /*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -765,7 +765,7 @@ static void op_DD_0xe1(void)
 }
 
 /*EX (SP),IX*/
-static void op_DD_0xe3(void)
+static void op_DD_0xe3(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_word.b.l,(SP),4);
 	READ_MEM(temp_word.b.h,(SP+1),7);
@@ -777,7 +777,7 @@ static void op_DD_0xe3(void)
 }
 
 /*PUSH IX*/
-static void op_DD_0xe5(void)
+static void op_DD_0xe5(Z80EX_CONTEXT *cpu)
 {
 	PUSH(IX, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -785,7 +785,7 @@ static void op_DD_0xe5(void)
 }
 
 /*JP IX*/
-static void op_DD_0xe9(void)
+static void op_DD_0xe9(Z80EX_CONTEXT *cpu)
 {
 	JP_NO_MPTR(IX);
 	T_WAIT_UNTIL(4);
@@ -793,7 +793,7 @@ static void op_DD_0xe9(void)
 }
 
 /*LD SP,IX*/
-static void op_DD_0xf9(void)
+static void op_DD_0xf9(Z80EX_CONTEXT *cpu)
 {
 	LD16(SP,IX);
 	T_WAIT_UNTIL(6);
@@ -1,7 +1,7 @@
 /* autogenerated from ./opcodes_ddfdcb.dat, do not edit */
 
 /*LD B,RLC (IX+$)*/
-static void op_DDCB_0x00(void)
+static void op_DDCB_0x00(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -13,7 +13,7 @@ static void op_DDCB_0x00(void)
 }
 
 /*LD C,RLC (IX+$)*/
-static void op_DDCB_0x01(void)
+static void op_DDCB_0x01(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -25,7 +25,7 @@ static void op_DDCB_0x01(void)
 }
 
 /*LD D,RLC (IX+$)*/
-static void op_DDCB_0x02(void)
+static void op_DDCB_0x02(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -37,7 +37,7 @@ static void op_DDCB_0x02(void)
 }
 
 /*LD E,RLC (IX+$)*/
-static void op_DDCB_0x03(void)
+static void op_DDCB_0x03(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -49,7 +49,7 @@ static void op_DDCB_0x03(void)
 }
 
 /*LD H,RLC (IX+$)*/
-static void op_DDCB_0x04(void)
+static void op_DDCB_0x04(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -61,7 +61,7 @@ static void op_DDCB_0x04(void)
 }
 
 /*LD L,RLC (IX+$)*/
-static void op_DDCB_0x05(void)
+static void op_DDCB_0x05(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -73,7 +73,7 @@ static void op_DDCB_0x05(void)
 }
 
 /*RLC (IX+$)*/
-static void op_DDCB_0x06(void)
+static void op_DDCB_0x06(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -84,7 +84,7 @@ static void op_DDCB_0x06(void)
 }
 
 /*LD A,RLC (IX+$)*/
-static void op_DDCB_0x07(void)
+static void op_DDCB_0x07(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -96,7 +96,7 @@ static void op_DDCB_0x07(void)
 }
 
 /*LD B,RRC (IX+$)*/
-static void op_DDCB_0x08(void)
+static void op_DDCB_0x08(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -108,7 +108,7 @@ static void op_DDCB_0x08(void)
 }
 
 /*LD C,RRC (IX+$)*/
-static void op_DDCB_0x09(void)
+static void op_DDCB_0x09(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -120,7 +120,7 @@ static void op_DDCB_0x09(void)
 }
 
 /*LD D,RRC (IX+$)*/
-static void op_DDCB_0x0a(void)
+static void op_DDCB_0x0a(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -132,7 +132,7 @@ static void op_DDCB_0x0a(void)
 }
 
 /*LD E,RRC (IX+$)*/
-static void op_DDCB_0x0b(void)
+static void op_DDCB_0x0b(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -144,7 +144,7 @@ static void op_DDCB_0x0b(void)
 }
 
 /*LD H,RRC (IX+$)*/
-static void op_DDCB_0x0c(void)
+static void op_DDCB_0x0c(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -156,7 +156,7 @@ static void op_DDCB_0x0c(void)
 }
 
 /*LD L,RRC (IX+$)*/
-static void op_DDCB_0x0d(void)
+static void op_DDCB_0x0d(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -168,7 +168,7 @@ static void op_DDCB_0x0d(void)
 }
 
 /*RRC (IX+$)*/
-static void op_DDCB_0x0e(void)
+static void op_DDCB_0x0e(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -179,7 +179,7 @@ static void op_DDCB_0x0e(void)
 }
 
 /*LD A,RRC (IX+$)*/
-static void op_DDCB_0x0f(void)
+static void op_DDCB_0x0f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -191,7 +191,7 @@ static void op_DDCB_0x0f(void)
 }
 
 /*LD B,RL (IX+$)*/
-static void op_DDCB_0x10(void)
+static void op_DDCB_0x10(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -203,7 +203,7 @@ static void op_DDCB_0x10(void)
 }
 
 /*LD C,RL (IX+$)*/
-static void op_DDCB_0x11(void)
+static void op_DDCB_0x11(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -215,7 +215,7 @@ static void op_DDCB_0x11(void)
 }
 
 /*LD D,RL (IX+$)*/
-static void op_DDCB_0x12(void)
+static void op_DDCB_0x12(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -227,7 +227,7 @@ static void op_DDCB_0x12(void)
 }
 
 /*LD E,RL (IX+$)*/
-static void op_DDCB_0x13(void)
+static void op_DDCB_0x13(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -239,7 +239,7 @@ static void op_DDCB_0x13(void)
 }
 
 /*LD H,RL (IX+$)*/
-static void op_DDCB_0x14(void)
+static void op_DDCB_0x14(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -251,7 +251,7 @@ static void op_DDCB_0x14(void)
 }
 
 /*LD L,RL (IX+$)*/
-static void op_DDCB_0x15(void)
+static void op_DDCB_0x15(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -263,7 +263,7 @@ static void op_DDCB_0x15(void)
 }
 
 /*RL (IX+$)*/
-static void op_DDCB_0x16(void)
+static void op_DDCB_0x16(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -274,7 +274,7 @@ static void op_DDCB_0x16(void)
 }
 
 /*LD A,RL (IX+$)*/
-static void op_DDCB_0x17(void)
+static void op_DDCB_0x17(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -286,7 +286,7 @@ static void op_DDCB_0x17(void)
 }
 
 /*LD B,RR (IX+$)*/
-static void op_DDCB_0x18(void)
+static void op_DDCB_0x18(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -298,7 +298,7 @@ static void op_DDCB_0x18(void)
 }
 
 /*LD C,RR (IX+$)*/
-static void op_DDCB_0x19(void)
+static void op_DDCB_0x19(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -310,7 +310,7 @@ static void op_DDCB_0x19(void)
 }
 
 /*LD D,RR (IX+$)*/
-static void op_DDCB_0x1a(void)
+static void op_DDCB_0x1a(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -322,7 +322,7 @@ static void op_DDCB_0x1a(void)
 }
 
 /*LD E,RR (IX+$)*/
-static void op_DDCB_0x1b(void)
+static void op_DDCB_0x1b(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -334,7 +334,7 @@ static void op_DDCB_0x1b(void)
 }
 
 /*LD H,RR (IX+$)*/
-static void op_DDCB_0x1c(void)
+static void op_DDCB_0x1c(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -346,7 +346,7 @@ static void op_DDCB_0x1c(void)
 }
 
 /*LD L,RR (IX+$)*/
-static void op_DDCB_0x1d(void)
+static void op_DDCB_0x1d(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -358,7 +358,7 @@ static void op_DDCB_0x1d(void)
 }
 
 /*RR (IX+$)*/
-static void op_DDCB_0x1e(void)
+static void op_DDCB_0x1e(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -369,7 +369,7 @@ static void op_DDCB_0x1e(void)
 }
 
 /*LD A,RR (IX+$)*/
-static void op_DDCB_0x1f(void)
+static void op_DDCB_0x1f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -381,7 +381,7 @@ static void op_DDCB_0x1f(void)
 }
 
 /*LD B,SLA (IX+$)*/
-static void op_DDCB_0x20(void)
+static void op_DDCB_0x20(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -393,7 +393,7 @@ static void op_DDCB_0x20(void)
 }
 
 /*LD C,SLA (IX+$)*/
-static void op_DDCB_0x21(void)
+static void op_DDCB_0x21(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -405,7 +405,7 @@ static void op_DDCB_0x21(void)
 }
 
 /*LD D,SLA (IX+$)*/
-static void op_DDCB_0x22(void)
+static void op_DDCB_0x22(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -417,7 +417,7 @@ static void op_DDCB_0x22(void)
 }
 
 /*LD E,SLA (IX+$)*/
-static void op_DDCB_0x23(void)
+static void op_DDCB_0x23(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -429,7 +429,7 @@ static void op_DDCB_0x23(void)
 }
 
 /*LD H,SLA (IX+$)*/
-static void op_DDCB_0x24(void)
+static void op_DDCB_0x24(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -441,7 +441,7 @@ static void op_DDCB_0x24(void)
 }
 
 /*LD L,SLA (IX+$)*/
-static void op_DDCB_0x25(void)
+static void op_DDCB_0x25(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -453,7 +453,7 @@ static void op_DDCB_0x25(void)
 }
 
 /*SLA (IX+$)*/
-static void op_DDCB_0x26(void)
+static void op_DDCB_0x26(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -464,7 +464,7 @@ static void op_DDCB_0x26(void)
 }
 
 /*LD A,SLA (IX+$)*/
-static void op_DDCB_0x27(void)
+static void op_DDCB_0x27(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -476,7 +476,7 @@ static void op_DDCB_0x27(void)
 }
 
 /*LD B,SRA (IX+$)*/
-static void op_DDCB_0x28(void)
+static void op_DDCB_0x28(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -488,7 +488,7 @@ static void op_DDCB_0x28(void)
 }
 
 /*LD C,SRA (IX+$)*/
-static void op_DDCB_0x29(void)
+static void op_DDCB_0x29(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -500,7 +500,7 @@ static void op_DDCB_0x29(void)
 }
 
 /*LD D,SRA (IX+$)*/
-static void op_DDCB_0x2a(void)
+static void op_DDCB_0x2a(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -512,7 +512,7 @@ static void op_DDCB_0x2a(void)
 }
 
 /*LD E,SRA (IX+$)*/
-static void op_DDCB_0x2b(void)
+static void op_DDCB_0x2b(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -524,7 +524,7 @@ static void op_DDCB_0x2b(void)
 }
 
 /*LD H,SRA (IX+$)*/
-static void op_DDCB_0x2c(void)
+static void op_DDCB_0x2c(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -536,7 +536,7 @@ static void op_DDCB_0x2c(void)
 }
 
 /*LD L,SRA (IX+$)*/
-static void op_DDCB_0x2d(void)
+static void op_DDCB_0x2d(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -548,7 +548,7 @@ static void op_DDCB_0x2d(void)
 }
 
 /*SRA (IX+$)*/
-static void op_DDCB_0x2e(void)
+static void op_DDCB_0x2e(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -559,7 +559,7 @@ static void op_DDCB_0x2e(void)
 }
 
 /*LD A,SRA (IX+$)*/
-static void op_DDCB_0x2f(void)
+static void op_DDCB_0x2f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -571,7 +571,7 @@ static void op_DDCB_0x2f(void)
 }
 
 /*LD B,SLL (IX+$)*/
-static void op_DDCB_0x30(void)
+static void op_DDCB_0x30(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -583,7 +583,7 @@ static void op_DDCB_0x30(void)
 }
 
 /*LD C,SLL (IX+$)*/
-static void op_DDCB_0x31(void)
+static void op_DDCB_0x31(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -595,7 +595,7 @@ static void op_DDCB_0x31(void)
 }
 
 /*LD D,SLL (IX+$)*/
-static void op_DDCB_0x32(void)
+static void op_DDCB_0x32(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -607,7 +607,7 @@ static void op_DDCB_0x32(void)
 }
 
 /*LD E,SLL (IX+$)*/
-static void op_DDCB_0x33(void)
+static void op_DDCB_0x33(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -619,7 +619,7 @@ static void op_DDCB_0x33(void)
 }
 
 /*LD H,SLL (IX+$)*/
-static void op_DDCB_0x34(void)
+static void op_DDCB_0x34(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -631,7 +631,7 @@ static void op_DDCB_0x34(void)
 }
 
 /*LD L,SLL (IX+$)*/
-static void op_DDCB_0x35(void)
+static void op_DDCB_0x35(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -643,7 +643,7 @@ static void op_DDCB_0x35(void)
 }
 
 /*SLL (IX+$)*/
-static void op_DDCB_0x36(void)
+static void op_DDCB_0x36(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -654,7 +654,7 @@ static void op_DDCB_0x36(void)
 }
 
 /*LD A,SLL (IX+$)*/
-static void op_DDCB_0x37(void)
+static void op_DDCB_0x37(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -666,7 +666,7 @@ static void op_DDCB_0x37(void)
 }
 
 /*LD B,SRL (IX+$)*/
-static void op_DDCB_0x38(void)
+static void op_DDCB_0x38(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -678,7 +678,7 @@ static void op_DDCB_0x38(void)
 }
 
 /*LD C,SRL (IX+$)*/
-static void op_DDCB_0x39(void)
+static void op_DDCB_0x39(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -690,7 +690,7 @@ static void op_DDCB_0x39(void)
 }
 
 /*LD D,SRL (IX+$)*/
-static void op_DDCB_0x3a(void)
+static void op_DDCB_0x3a(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -702,7 +702,7 @@ static void op_DDCB_0x3a(void)
 }
 
 /*LD E,SRL (IX+$)*/
-static void op_DDCB_0x3b(void)
+static void op_DDCB_0x3b(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -714,7 +714,7 @@ static void op_DDCB_0x3b(void)
 }
 
 /*LD H,SRL (IX+$)*/
-static void op_DDCB_0x3c(void)
+static void op_DDCB_0x3c(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -726,7 +726,7 @@ static void op_DDCB_0x3c(void)
 }
 
 /*LD L,SRL (IX+$)*/
-static void op_DDCB_0x3d(void)
+static void op_DDCB_0x3d(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -738,7 +738,7 @@ static void op_DDCB_0x3d(void)
 }
 
 /*SRL (IX+$)*/
-static void op_DDCB_0x3e(void)
+static void op_DDCB_0x3e(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -749,7 +749,7 @@ static void op_DDCB_0x3e(void)
 }
 
 /*LD A,SRL (IX+$)*/
-static void op_DDCB_0x3f(void)
+static void op_DDCB_0x3f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -761,7 +761,7 @@ static void op_DDCB_0x3f(void)
 }
 
 /*BIT 0,(IX+$)*/
-static void op_DDCB_0x47(void)
+static void op_DDCB_0x47(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -771,7 +771,7 @@ static void op_DDCB_0x47(void)
 }
 
 /*BIT 1,(IX+$)*/
-static void op_DDCB_0x4f(void)
+static void op_DDCB_0x4f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -781,7 +781,7 @@ static void op_DDCB_0x4f(void)
 }
 
 /*BIT 2,(IX+$)*/
-static void op_DDCB_0x57(void)
+static void op_DDCB_0x57(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -791,7 +791,7 @@ static void op_DDCB_0x57(void)
 }
 
 /*BIT 3,(IX+$)*/
-static void op_DDCB_0x5f(void)
+static void op_DDCB_0x5f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -801,7 +801,7 @@ static void op_DDCB_0x5f(void)
 }
 
 /*BIT 4,(IX+$)*/
-static void op_DDCB_0x67(void)
+static void op_DDCB_0x67(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -811,7 +811,7 @@ static void op_DDCB_0x67(void)
 }
 
 /*BIT 5,(IX+$)*/
-static void op_DDCB_0x6f(void)
+static void op_DDCB_0x6f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -821,7 +821,7 @@ static void op_DDCB_0x6f(void)
 }
 
 /*BIT 6,(IX+$)*/
-static void op_DDCB_0x77(void)
+static void op_DDCB_0x77(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -831,7 +831,7 @@ static void op_DDCB_0x77(void)
 }
 
 /*BIT 7,(IX+$)*/
-static void op_DDCB_0x7f(void)
+static void op_DDCB_0x7f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -841,7 +841,7 @@ static void op_DDCB_0x7f(void)
 }
 
 /*LD B,RES 0,(IX+$)*/
-static void op_DDCB_0x80(void)
+static void op_DDCB_0x80(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -853,7 +853,7 @@ static void op_DDCB_0x80(void)
 }
 
 /*LD C,RES 0,(IX+$)*/
-static void op_DDCB_0x81(void)
+static void op_DDCB_0x81(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -865,7 +865,7 @@ static void op_DDCB_0x81(void)
 }
 
 /*LD D,RES 0,(IX+$)*/
-static void op_DDCB_0x82(void)
+static void op_DDCB_0x82(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -877,7 +877,7 @@ static void op_DDCB_0x82(void)
 }
 
 /*LD E,RES 0,(IX+$)*/
-static void op_DDCB_0x83(void)
+static void op_DDCB_0x83(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -889,7 +889,7 @@ static void op_DDCB_0x83(void)
 }
 
 /*LD H,RES 0,(IX+$)*/
-static void op_DDCB_0x84(void)
+static void op_DDCB_0x84(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -901,7 +901,7 @@ static void op_DDCB_0x84(void)
 }
 
 /*LD L,RES 0,(IX+$)*/
-static void op_DDCB_0x85(void)
+static void op_DDCB_0x85(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -913,7 +913,7 @@ static void op_DDCB_0x85(void)
 }
 
 /*RES 0,(IX+$)*/
-static void op_DDCB_0x86(void)
+static void op_DDCB_0x86(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -924,7 +924,7 @@ static void op_DDCB_0x86(void)
 }
 
 /*LD A,RES 0,(IX+$)*/
-static void op_DDCB_0x87(void)
+static void op_DDCB_0x87(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -936,7 +936,7 @@ static void op_DDCB_0x87(void)
 }
 
 /*LD B,RES 1,(IX+$)*/
-static void op_DDCB_0x88(void)
+static void op_DDCB_0x88(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -948,7 +948,7 @@ static void op_DDCB_0x88(void)
 }
 
 /*LD C,RES 1,(IX+$)*/
-static void op_DDCB_0x89(void)
+static void op_DDCB_0x89(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -960,7 +960,7 @@ static void op_DDCB_0x89(void)
 }
 
 /*LD D,RES 1,(IX+$)*/
-static void op_DDCB_0x8a(void)
+static void op_DDCB_0x8a(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -972,7 +972,7 @@ static void op_DDCB_0x8a(void)
 }
 
 /*LD E,RES 1,(IX+$)*/
-static void op_DDCB_0x8b(void)
+static void op_DDCB_0x8b(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -984,7 +984,7 @@ static void op_DDCB_0x8b(void)
 }
 
 /*LD H,RES 1,(IX+$)*/
-static void op_DDCB_0x8c(void)
+static void op_DDCB_0x8c(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -996,7 +996,7 @@ static void op_DDCB_0x8c(void)
 }
 
 /*LD L,RES 1,(IX+$)*/
-static void op_DDCB_0x8d(void)
+static void op_DDCB_0x8d(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1008,7 +1008,7 @@ static void op_DDCB_0x8d(void)
 }
 
 /*RES 1,(IX+$)*/
-static void op_DDCB_0x8e(void)
+static void op_DDCB_0x8e(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1019,7 +1019,7 @@ static void op_DDCB_0x8e(void)
 }
 
 /*LD A,RES 1,(IX+$)*/
-static void op_DDCB_0x8f(void)
+static void op_DDCB_0x8f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1031,7 +1031,7 @@ static void op_DDCB_0x8f(void)
 }
 
 /*LD B,RES 2,(IX+$)*/
-static void op_DDCB_0x90(void)
+static void op_DDCB_0x90(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1043,7 +1043,7 @@ static void op_DDCB_0x90(void)
 }
 
 /*LD C,RES 2,(IX+$)*/
-static void op_DDCB_0x91(void)
+static void op_DDCB_0x91(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1055,7 +1055,7 @@ static void op_DDCB_0x91(void)
 }
 
 /*LD D,RES 2,(IX+$)*/
-static void op_DDCB_0x92(void)
+static void op_DDCB_0x92(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1067,7 +1067,7 @@ static void op_DDCB_0x92(void)
 }
 
 /*LD E,RES 2,(IX+$)*/
-static void op_DDCB_0x93(void)
+static void op_DDCB_0x93(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1079,7 +1079,7 @@ static void op_DDCB_0x93(void)
 }
 
 /*LD H,RES 2,(IX+$)*/
-static void op_DDCB_0x94(void)
+static void op_DDCB_0x94(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1091,7 +1091,7 @@ static void op_DDCB_0x94(void)
 }
 
 /*LD L,RES 2,(IX+$)*/
-static void op_DDCB_0x95(void)
+static void op_DDCB_0x95(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1103,7 +1103,7 @@ static void op_DDCB_0x95(void)
 }
 
 /*RES 2,(IX+$)*/
-static void op_DDCB_0x96(void)
+static void op_DDCB_0x96(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1114,7 +1114,7 @@ static void op_DDCB_0x96(void)
 }
 
 /*LD A,RES 2,(IX+$)*/
-static void op_DDCB_0x97(void)
+static void op_DDCB_0x97(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1126,7 +1126,7 @@ static void op_DDCB_0x97(void)
 }
 
 /*LD B,RES 3,(IX+$)*/
-static void op_DDCB_0x98(void)
+static void op_DDCB_0x98(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1138,7 +1138,7 @@ static void op_DDCB_0x98(void)
 }
 
 /*LD C,RES 3,(IX+$)*/
-static void op_DDCB_0x99(void)
+static void op_DDCB_0x99(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1150,7 +1150,7 @@ static void op_DDCB_0x99(void)
 }
 
 /*LD D,RES 3,(IX+$)*/
-static void op_DDCB_0x9a(void)
+static void op_DDCB_0x9a(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1162,7 +1162,7 @@ static void op_DDCB_0x9a(void)
 }
 
 /*LD E,RES 3,(IX+$)*/
-static void op_DDCB_0x9b(void)
+static void op_DDCB_0x9b(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1174,7 +1174,7 @@ static void op_DDCB_0x9b(void)
 }
 
 /*LD H,RES 3,(IX+$)*/
-static void op_DDCB_0x9c(void)
+static void op_DDCB_0x9c(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1186,7 +1186,7 @@ static void op_DDCB_0x9c(void)
 }
 
 /*LD L,RES 3,(IX+$)*/
-static void op_DDCB_0x9d(void)
+static void op_DDCB_0x9d(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1198,7 +1198,7 @@ static void op_DDCB_0x9d(void)
 }
 
 /*RES 3,(IX+$)*/
-static void op_DDCB_0x9e(void)
+static void op_DDCB_0x9e(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1209,7 +1209,7 @@ static void op_DDCB_0x9e(void)
 }
 
 /*LD A,RES 3,(IX+$)*/
-static void op_DDCB_0x9f(void)
+static void op_DDCB_0x9f(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1221,7 +1221,7 @@ static void op_DDCB_0x9f(void)
 }
 
 /*LD B,RES 4,(IX+$)*/
-static void op_DDCB_0xa0(void)
+static void op_DDCB_0xa0(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1233,7 +1233,7 @@ static void op_DDCB_0xa0(void)
 }
 
 /*LD C,RES 4,(IX+$)*/
-static void op_DDCB_0xa1(void)
+static void op_DDCB_0xa1(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1245,7 +1245,7 @@ static void op_DDCB_0xa1(void)
 }
 
 /*LD D,RES 4,(IX+$)*/
-static void op_DDCB_0xa2(void)
+static void op_DDCB_0xa2(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1257,7 +1257,7 @@ static void op_DDCB_0xa2(void)
 }
 
 /*LD E,RES 4,(IX+$)*/
-static void op_DDCB_0xa3(void)
+static void op_DDCB_0xa3(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1269,7 +1269,7 @@ static void op_DDCB_0xa3(void)
 }
 
 /*LD H,RES 4,(IX+$)*/
-static void op_DDCB_0xa4(void)
+static void op_DDCB_0xa4(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1281,7 +1281,7 @@ static void op_DDCB_0xa4(void)
 }
 
 /*LD L,RES 4,(IX+$)*/
-static void op_DDCB_0xa5(void)
+static void op_DDCB_0xa5(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1293,7 +1293,7 @@ static void op_DDCB_0xa5(void)
 }
 
 /*RES 4,(IX+$)*/
-static void op_DDCB_0xa6(void)
+static void op_DDCB_0xa6(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1304,7 +1304,7 @@ static void op_DDCB_0xa6(void)
 }
 
 /*LD A,RES 4,(IX+$)*/
-static void op_DDCB_0xa7(void)
+static void op_DDCB_0xa7(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1316,7 +1316,7 @@ static void op_DDCB_0xa7(void)
 }
 
 /*LD B,RES 5,(IX+$)*/
-static void op_DDCB_0xa8(void)
+static void op_DDCB_0xa8(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1328,7 +1328,7 @@ static void op_DDCB_0xa8(void)
 }
 
 /*LD C,RES 5,(IX+$)*/
-static void op_DDCB_0xa9(void)
+static void op_DDCB_0xa9(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1340,7 +1340,7 @@ static void op_DDCB_0xa9(void)
 }
 
 /*LD D,RES 5,(IX+$)*/
-static void op_DDCB_0xaa(void)
+static void op_DDCB_0xaa(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1352,7 +1352,7 @@ static void op_DDCB_0xaa(void)
 }
 
 /*LD E,RES 5,(IX+$)*/
-static void op_DDCB_0xab(void)
+static void op_DDCB_0xab(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1364,7 +1364,7 @@ static void op_DDCB_0xab(void)
 }
 
 /*LD H,RES 5,(IX+$)*/
-static void op_DDCB_0xac(void)
+static void op_DDCB_0xac(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1376,7 +1376,7 @@ static void op_DDCB_0xac(void)
 }
 
 /*LD L,RES 5,(IX+$)*/
-static void op_DDCB_0xad(void)
+static void op_DDCB_0xad(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1388,7 +1388,7 @@ static void op_DDCB_0xad(void)
 }
 
 /*RES 5,(IX+$)*/
-static void op_DDCB_0xae(void)
+static void op_DDCB_0xae(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1399,7 +1399,7 @@ static void op_DDCB_0xae(void)
 }
 
 /*LD A,RES 5,(IX+$)*/
-static void op_DDCB_0xaf(void)
+static void op_DDCB_0xaf(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1411,7 +1411,7 @@ static void op_DDCB_0xaf(void)
 }
 
 /*LD B,RES 6,(IX+$)*/
-static void op_DDCB_0xb0(void)
+static void op_DDCB_0xb0(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1423,7 +1423,7 @@ static void op_DDCB_0xb0(void)
 }
 
 /*LD C,RES 6,(IX+$)*/
-static void op_DDCB_0xb1(void)
+static void op_DDCB_0xb1(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1435,7 +1435,7 @@ static void op_DDCB_0xb1(void)
 }
 
 /*LD D,RES 6,(IX+$)*/
-static void op_DDCB_0xb2(void)
+static void op_DDCB_0xb2(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1447,7 +1447,7 @@ static void op_DDCB_0xb2(void)
 }
 
 /*LD E,RES 6,(IX+$)*/
-static void op_DDCB_0xb3(void)
+static void op_DDCB_0xb3(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1459,7 +1459,7 @@ static void op_DDCB_0xb3(void)
 }
 
 /*LD H,RES 6,(IX+$)*/
-static void op_DDCB_0xb4(void)
+static void op_DDCB_0xb4(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1471,7 +1471,7 @@ static void op_DDCB_0xb4(void)
 }
 
 /*LD L,RES 6,(IX+$)*/
-static void op_DDCB_0xb5(void)
+static void op_DDCB_0xb5(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1483,7 +1483,7 @@ static void op_DDCB_0xb5(void)
 }
 
 /*RES 6,(IX+$)*/
-static void op_DDCB_0xb6(void)
+static void op_DDCB_0xb6(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1494,7 +1494,7 @@ static void op_DDCB_0xb6(void)
 }
 
 /*LD A,RES 6,(IX+$)*/
-static void op_DDCB_0xb7(void)
+static void op_DDCB_0xb7(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1506,7 +1506,7 @@ static void op_DDCB_0xb7(void)
 }
 
 /*LD B,RES 7,(IX+$)*/
-static void op_DDCB_0xb8(void)
+static void op_DDCB_0xb8(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1518,7 +1518,7 @@ static void op_DDCB_0xb8(void)
 }
 
 /*LD C,RES 7,(IX+$)*/
-static void op_DDCB_0xb9(void)
+static void op_DDCB_0xb9(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1530,7 +1530,7 @@ static void op_DDCB_0xb9(void)
 }
 
 /*LD D,RES 7,(IX+$)*/
-static void op_DDCB_0xba(void)
+static void op_DDCB_0xba(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1542,7 +1542,7 @@ static void op_DDCB_0xba(void)
 }
 
 /*LD E,RES 7,(IX+$)*/
-static void op_DDCB_0xbb(void)
+static void op_DDCB_0xbb(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1554,7 +1554,7 @@ static void op_DDCB_0xbb(void)
 }
 
 /*LD H,RES 7,(IX+$)*/
-static void op_DDCB_0xbc(void)
+static void op_DDCB_0xbc(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1566,7 +1566,7 @@ static void op_DDCB_0xbc(void)
 }
 
 /*LD L,RES 7,(IX+$)*/
-static void op_DDCB_0xbd(void)
+static void op_DDCB_0xbd(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1578,7 +1578,7 @@ static void op_DDCB_0xbd(void)
 }
 
 /*RES 7,(IX+$)*/
-static void op_DDCB_0xbe(void)
+static void op_DDCB_0xbe(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1589,7 +1589,7 @@ static void op_DDCB_0xbe(void)
 }
 
 /*LD A,RES 7,(IX+$)*/
-static void op_DDCB_0xbf(void)
+static void op_DDCB_0xbf(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1601,7 +1601,7 @@ static void op_DDCB_0xbf(void)
 }
 
 /*LD B,SET 0,(IX+$)*/
-static void op_DDCB_0xc0(void)
+static void op_DDCB_0xc0(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1613,7 +1613,7 @@ static void op_DDCB_0xc0(void)
 }
 
 /*LD C,SET 0,(IX+$)*/
-static void op_DDCB_0xc1(void)
+static void op_DDCB_0xc1(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1625,7 +1625,7 @@ static void op_DDCB_0xc1(void)
 }
 
 /*LD D,SET 0,(IX+$)*/
-static void op_DDCB_0xc2(void)
+static void op_DDCB_0xc2(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1637,7 +1637,7 @@ static void op_DDCB_0xc2(void)
 }
 
 /*LD E,SET 0,(IX+$)*/
-static void op_DDCB_0xc3(void)
+static void op_DDCB_0xc3(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1649,7 +1649,7 @@ static void op_DDCB_0xc3(void)
 }
 
 /*LD H,SET 0,(IX+$)*/
-static void op_DDCB_0xc4(void)
+static void op_DDCB_0xc4(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1661,7 +1661,7 @@ static void op_DDCB_0xc4(void)
 }
 
 /*LD L,SET 0,(IX+$)*/
-static void op_DDCB_0xc5(void)
+static void op_DDCB_0xc5(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1673,7 +1673,7 @@ static void op_DDCB_0xc5(void)
 }
 
 /*SET 0,(IX+$)*/
-static void op_DDCB_0xc6(void)
+static void op_DDCB_0xc6(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1684,7 +1684,7 @@ static void op_DDCB_0xc6(void)
 }
 
 /*LD A,SET 0,(IX+$)*/
-static void op_DDCB_0xc7(void)
+static void op_DDCB_0xc7(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1696,7 +1696,7 @@ static void op_DDCB_0xc7(void)
 }
 
 /*LD B,SET 1,(IX+$)*/
-static void op_DDCB_0xc8(void)
+static void op_DDCB_0xc8(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1708,7 +1708,7 @@ static void op_DDCB_0xc8(void)
 }
 
 /*LD C,SET 1,(IX+$)*/
-static void op_DDCB_0xc9(void)
+static void op_DDCB_0xc9(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1720,7 +1720,7 @@ static void op_DDCB_0xc9(void)
 }
 
 /*LD D,SET 1,(IX+$)*/
-static void op_DDCB_0xca(void)
+static void op_DDCB_0xca(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1732,7 +1732,7 @@ static void op_DDCB_0xca(void)
 }
 
 /*LD E,SET 1,(IX+$)*/
-static void op_DDCB_0xcb(void)
+static void op_DDCB_0xcb(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1744,7 +1744,7 @@ static void op_DDCB_0xcb(void)
 }
 
 /*LD H,SET 1,(IX+$)*/
-static void op_DDCB_0xcc(void)
+static void op_DDCB_0xcc(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1756,7 +1756,7 @@ static void op_DDCB_0xcc(void)
 }
 
 /*LD L,SET 1,(IX+$)*/
-static void op_DDCB_0xcd(void)
+static void op_DDCB_0xcd(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1768,7 +1768,7 @@ static void op_DDCB_0xcd(void)
 }
 
 /*SET 1,(IX+$)*/
-static void op_DDCB_0xce(void)
+static void op_DDCB_0xce(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1779,7 +1779,7 @@ static void op_DDCB_0xce(void)
 }
 
 /*LD A,SET 1,(IX+$)*/
-static void op_DDCB_0xcf(void)
+static void op_DDCB_0xcf(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1791,7 +1791,7 @@ static void op_DDCB_0xcf(void)
 }
 
 /*LD B,SET 2,(IX+$)*/
-static void op_DDCB_0xd0(void)
+static void op_DDCB_0xd0(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1803,7 +1803,7 @@ static void op_DDCB_0xd0(void)
 }
 
 /*LD C,SET 2,(IX+$)*/
-static void op_DDCB_0xd1(void)
+static void op_DDCB_0xd1(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1815,7 +1815,7 @@ static void op_DDCB_0xd1(void)
 }
 
 /*LD D,SET 2,(IX+$)*/
-static void op_DDCB_0xd2(void)
+static void op_DDCB_0xd2(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1827,7 +1827,7 @@ static void op_DDCB_0xd2(void)
 }
 
 /*LD E,SET 2,(IX+$)*/
-static void op_DDCB_0xd3(void)
+static void op_DDCB_0xd3(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1839,7 +1839,7 @@ static void op_DDCB_0xd3(void)
 }
 
 /*LD H,SET 2,(IX+$)*/
-static void op_DDCB_0xd4(void)
+static void op_DDCB_0xd4(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1851,7 +1851,7 @@ static void op_DDCB_0xd4(void)
 }
 
 /*LD L,SET 2,(IX+$)*/
-static void op_DDCB_0xd5(void)
+static void op_DDCB_0xd5(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1863,7 +1863,7 @@ static void op_DDCB_0xd5(void)
 }
 
 /*SET 2,(IX+$)*/
-static void op_DDCB_0xd6(void)
+static void op_DDCB_0xd6(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1874,7 +1874,7 @@ static void op_DDCB_0xd6(void)
 }
 
 /*LD A,SET 2,(IX+$)*/
-static void op_DDCB_0xd7(void)
+static void op_DDCB_0xd7(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1886,7 +1886,7 @@ static void op_DDCB_0xd7(void)
 }
 
 /*LD B,SET 3,(IX+$)*/
-static void op_DDCB_0xd8(void)
+static void op_DDCB_0xd8(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1898,7 +1898,7 @@ static void op_DDCB_0xd8(void)
 }
 
 /*LD C,SET 3,(IX+$)*/
-static void op_DDCB_0xd9(void)
+static void op_DDCB_0xd9(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1910,7 +1910,7 @@ static void op_DDCB_0xd9(void)
 }
 
 /*LD D,SET 3,(IX+$)*/
-static void op_DDCB_0xda(void)
+static void op_DDCB_0xda(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1922,7 +1922,7 @@ static void op_DDCB_0xda(void)
 }
 
 /*LD E,SET 3,(IX+$)*/
-static void op_DDCB_0xdb(void)
+static void op_DDCB_0xdb(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1934,7 +1934,7 @@ static void op_DDCB_0xdb(void)
 }
 
 /*LD H,SET 3,(IX+$)*/
-static void op_DDCB_0xdc(void)
+static void op_DDCB_0xdc(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1946,7 +1946,7 @@ static void op_DDCB_0xdc(void)
 }
 
 /*LD L,SET 3,(IX+$)*/
-static void op_DDCB_0xdd(void)
+static void op_DDCB_0xdd(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1958,7 +1958,7 @@ static void op_DDCB_0xdd(void)
 }
 
 /*SET 3,(IX+$)*/
-static void op_DDCB_0xde(void)
+static void op_DDCB_0xde(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1969,7 +1969,7 @@ static void op_DDCB_0xde(void)
 }
 
 /*LD A,SET 3,(IX+$)*/
-static void op_DDCB_0xdf(void)
+static void op_DDCB_0xdf(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1981,7 +1981,7 @@ static void op_DDCB_0xdf(void)
 }
 
 /*LD B,SET 4,(IX+$)*/
-static void op_DDCB_0xe0(void)
+static void op_DDCB_0xe0(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -1993,7 +1993,7 @@ static void op_DDCB_0xe0(void)
 }
 
 /*LD C,SET 4,(IX+$)*/
-static void op_DDCB_0xe1(void)
+static void op_DDCB_0xe1(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2005,7 +2005,7 @@ static void op_DDCB_0xe1(void)
 }
 
 /*LD D,SET 4,(IX+$)*/
-static void op_DDCB_0xe2(void)
+static void op_DDCB_0xe2(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2017,7 +2017,7 @@ static void op_DDCB_0xe2(void)
 }
 
 /*LD E,SET 4,(IX+$)*/
-static void op_DDCB_0xe3(void)
+static void op_DDCB_0xe3(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2029,7 +2029,7 @@ static void op_DDCB_0xe3(void)
 }
 
 /*LD H,SET 4,(IX+$)*/
-static void op_DDCB_0xe4(void)
+static void op_DDCB_0xe4(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2041,7 +2041,7 @@ static void op_DDCB_0xe4(void)
 }
 
 /*LD L,SET 4,(IX+$)*/
-static void op_DDCB_0xe5(void)
+static void op_DDCB_0xe5(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2053,7 +2053,7 @@ static void op_DDCB_0xe5(void)
 }
 
 /*SET 4,(IX+$)*/
-static void op_DDCB_0xe6(void)
+static void op_DDCB_0xe6(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2064,7 +2064,7 @@ static void op_DDCB_0xe6(void)
 }
 
 /*LD A,SET 4,(IX+$)*/
-static void op_DDCB_0xe7(void)
+static void op_DDCB_0xe7(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2076,7 +2076,7 @@ static void op_DDCB_0xe7(void)
 }
 
 /*LD B,SET 5,(IX+$)*/
-static void op_DDCB_0xe8(void)
+static void op_DDCB_0xe8(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2088,7 +2088,7 @@ static void op_DDCB_0xe8(void)
 }
 
 /*LD C,SET 5,(IX+$)*/
-static void op_DDCB_0xe9(void)
+static void op_DDCB_0xe9(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2100,7 +2100,7 @@ static void op_DDCB_0xe9(void)
 }
 
 /*LD D,SET 5,(IX+$)*/
-static void op_DDCB_0xea(void)
+static void op_DDCB_0xea(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2112,7 +2112,7 @@ static void op_DDCB_0xea(void)
 }
 
 /*LD E,SET 5,(IX+$)*/
-static void op_DDCB_0xeb(void)
+static void op_DDCB_0xeb(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2124,7 +2124,7 @@ static void op_DDCB_0xeb(void)
 }
 
 /*LD H,SET 5,(IX+$)*/
-static void op_DDCB_0xec(void)
+static void op_DDCB_0xec(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2136,7 +2136,7 @@ static void op_DDCB_0xec(void)
 }
 
 /*LD L,SET 5,(IX+$)*/
-static void op_DDCB_0xed(void)
+static void op_DDCB_0xed(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2148,7 +2148,7 @@ static void op_DDCB_0xed(void)
 }
 
 /*SET 5,(IX+$)*/
-static void op_DDCB_0xee(void)
+static void op_DDCB_0xee(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2159,7 +2159,7 @@ static void op_DDCB_0xee(void)
 }
 
 /*LD A,SET 5,(IX+$)*/
-static void op_DDCB_0xef(void)
+static void op_DDCB_0xef(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2171,7 +2171,7 @@ static void op_DDCB_0xef(void)
 }
 
 /*LD B,SET 6,(IX+$)*/
-static void op_DDCB_0xf0(void)
+static void op_DDCB_0xf0(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2183,7 +2183,7 @@ static void op_DDCB_0xf0(void)
 }
 
 /*LD C,SET 6,(IX+$)*/
-static void op_DDCB_0xf1(void)
+static void op_DDCB_0xf1(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2195,7 +2195,7 @@ static void op_DDCB_0xf1(void)
 }
 
 /*LD D,SET 6,(IX+$)*/
-static void op_DDCB_0xf2(void)
+static void op_DDCB_0xf2(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2207,7 +2207,7 @@ static void op_DDCB_0xf2(void)
 }
 
 /*LD E,SET 6,(IX+$)*/
-static void op_DDCB_0xf3(void)
+static void op_DDCB_0xf3(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2219,7 +2219,7 @@ static void op_DDCB_0xf3(void)
 }
 
 /*LD H,SET 6,(IX+$)*/
-static void op_DDCB_0xf4(void)
+static void op_DDCB_0xf4(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2231,7 +2231,7 @@ static void op_DDCB_0xf4(void)
 }
 
 /*LD L,SET 6,(IX+$)*/
-static void op_DDCB_0xf5(void)
+static void op_DDCB_0xf5(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2243,7 +2243,7 @@ static void op_DDCB_0xf5(void)
 }
 
 /*SET 6,(IX+$)*/
-static void op_DDCB_0xf6(void)
+static void op_DDCB_0xf6(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2254,7 +2254,7 @@ static void op_DDCB_0xf6(void)
 }
 
 /*LD A,SET 6,(IX+$)*/
-static void op_DDCB_0xf7(void)
+static void op_DDCB_0xf7(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2266,7 +2266,7 @@ static void op_DDCB_0xf7(void)
 }
 
 /*LD B,SET 7,(IX+$)*/
-static void op_DDCB_0xf8(void)
+static void op_DDCB_0xf8(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2278,7 +2278,7 @@ static void op_DDCB_0xf8(void)
 }
 
 /*LD C,SET 7,(IX+$)*/
-static void op_DDCB_0xf9(void)
+static void op_DDCB_0xf9(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2290,7 +2290,7 @@ static void op_DDCB_0xf9(void)
 }
 
 /*LD D,SET 7,(IX+$)*/
-static void op_DDCB_0xfa(void)
+static void op_DDCB_0xfa(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2302,7 +2302,7 @@ static void op_DDCB_0xfa(void)
 }
 
 /*LD E,SET 7,(IX+$)*/
-static void op_DDCB_0xfb(void)
+static void op_DDCB_0xfb(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2314,7 +2314,7 @@ static void op_DDCB_0xfb(void)
 }
 
 /*LD H,SET 7,(IX+$)*/
-static void op_DDCB_0xfc(void)
+static void op_DDCB_0xfc(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2326,7 +2326,7 @@ static void op_DDCB_0xfc(void)
 }
 
 /*LD L,SET 7,(IX+$)*/
-static void op_DDCB_0xfd(void)
+static void op_DDCB_0xfd(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2338,7 +2338,7 @@ static void op_DDCB_0xfd(void)
 }
 
 /*SET 7,(IX+$)*/
-static void op_DDCB_0xfe(void)
+static void op_DDCB_0xfe(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2349,7 +2349,7 @@ static void op_DDCB_0xfe(void)
 }
 
 /*LD A,SET 7,(IX+$)*/
-static void op_DDCB_0xff(void)
+static void op_DDCB_0xff(Z80EX_CONTEXT *cpu)
 {
 	MEMPTR=(IX+temp_byte_s);
 	READ_MEM(temp_byte,(IX+temp_byte_s),12);
@@ -2,7 +2,7 @@
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: SWAPNIB*/
-static void op_ED_0x23_EX(void)
+static void op_ED_0x23_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -12,7 +12,7 @@ static void op_ED_0x23_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: MIRROR*/
-static void op_ED_0x24_EX(void)
+static void op_ED_0x24_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 	7 6 5 4 3 2 1 0
@@ -26,7 +26,7 @@ static void op_ED_0x24_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: TEST $nn*/
-static void op_ED_0x27_EX(void)
+static void op_ED_0x27_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -36,7 +36,7 @@ static void op_ED_0x27_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: BSLA DE,B*/
-static void op_ED_0x28_EX(void)
+static void op_ED_0x28_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -46,7 +46,7 @@ static void op_ED_0x28_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: BSRA DE,B*/
-static void op_ED_0x29_EX(void)
+static void op_ED_0x29_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -56,7 +56,7 @@ static void op_ED_0x29_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: BSRL DE,B*/
-static void op_ED_0x2a_EX(void)
+static void op_ED_0x2a_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -66,7 +66,7 @@ static void op_ED_0x2a_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: BSRF DE,B*/
-static void op_ED_0x2b_EX(void)
+static void op_ED_0x2b_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -76,7 +76,7 @@ static void op_ED_0x2b_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: BRLC DE,B*/
-static void op_ED_0x2c_EX(void)
+static void op_ED_0x2c_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -86,7 +86,7 @@ static void op_ED_0x2c_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: MUL D,E*/
-static void op_ED_0x30_EX(void)
+static void op_ED_0x30_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -96,7 +96,7 @@ static void op_ED_0x30_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: ADD HL,A*/
-static void op_ED_0x31_EX(void)
+static void op_ED_0x31_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -106,7 +106,7 @@ static void op_ED_0x31_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: ADD DE,A*/
-static void op_ED_0x32_EX(void)
+static void op_ED_0x32_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -116,7 +116,7 @@ static void op_ED_0x32_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: ADD BC,A*/
-static void op_ED_0x33_EX(void)
+static void op_ED_0x33_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -126,7 +126,7 @@ static void op_ED_0x33_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: ADD HL,$nnnn*/
-static void op_ED_0x34_EX(void)
+static void op_ED_0x34_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -136,7 +136,7 @@ static void op_ED_0x34_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: ADD DE,$nnnn*/
-static void op_ED_0x35_EX(void)
+static void op_ED_0x35_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -146,7 +146,7 @@ static void op_ED_0x35_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: ADD BC,$nnnn*/
-static void op_ED_0x36_EX(void)
+static void op_ED_0x36_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -156,7 +156,7 @@ static void op_ED_0x36_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: PUSH $nnnn*/
-static void op_ED_0x8a_EX(void)
+static void op_ED_0x8a_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -166,7 +166,7 @@ static void op_ED_0x8a_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: OUTINB*/
-static void op_ED_0x90_EX(void)
+static void op_ED_0x90_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -176,7 +176,7 @@ static void op_ED_0x90_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: NEXTREG $rr,$nn*/
-static void op_ED_0x91_EX(void)
+static void op_ED_0x91_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -186,7 +186,7 @@ static void op_ED_0x91_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: NEXTREG $rr,A*/
-static void op_ED_0x92_EX(void)
+static void op_ED_0x92_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -196,7 +196,7 @@ static void op_ED_0x92_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: PIXELDN*/
-static void op_ED_0x93_EX(void)
+static void op_ED_0x93_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -206,7 +206,7 @@ static void op_ED_0x93_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: PIXELAD*/
-static void op_ED_0x94_EX(void)
+static void op_ED_0x94_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -216,7 +216,7 @@ static void op_ED_0x94_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: SETAE*/
-static void op_ED_0x95_EX(void)
+static void op_ED_0x95_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -226,7 +226,7 @@ static void op_ED_0x95_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: JP (C)*/
-static void op_ED_0x98_EX(void)
+static void op_ED_0x98_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -236,7 +236,7 @@ static void op_ED_0x98_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: LDIX*/
-static void op_ED_0xa4_EX(void)
+static void op_ED_0xa4_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -246,7 +246,7 @@ static void op_ED_0xa4_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: LDWS*/
-static void op_ED_0xa5_EX(void)
+static void op_ED_0xa5_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -256,7 +256,7 @@ static void op_ED_0xa5_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: LDDX*/
-static void op_ED_0xac_EX(void)
+static void op_ED_0xac_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -266,7 +266,7 @@ static void op_ED_0xac_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: LDIRX*/
-static void op_ED_0xb4_EX(void)
+static void op_ED_0xb4_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -276,7 +276,7 @@ static void op_ED_0xb4_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: LDPIRX*/
-static void op_ED_0xb7_EX(void)
+static void op_ED_0xb7_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -286,7 +286,7 @@ static void op_ED_0xb7_EX(void)
 
 #if defined(Z80EX_SPECTRUM_NEXT_SUPPORT)
 /*ZX Spectrum Next: LDDRX*/
-static void op_ED_0xbc_EX(void)
+static void op_ED_0xbc_EX(Z80EX_CONTEXT *cpu)
 {
 	// TODO: implement this ZX Spectrum Next opcode
 }
@@ -295,7 +295,7 @@ static void op_ED_0xbc_EX(void)
 #endif
 
 /*IN B,(C)*/
-static void op_ED_0x40(void)
+static void op_ED_0x40(Z80EX_CONTEXT *cpu)
 {
 	IN(B,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -303,7 +303,7 @@ static void op_ED_0x40(void)
 }
 
 /*OUT (C),B*/
-static void op_ED_0x41(void)
+static void op_ED_0x41(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,B, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -311,7 +311,7 @@ static void op_ED_0x41(void)
 }
 
 /*SBC HL,BC*/
-static void op_ED_0x42(void)
+static void op_ED_0x42(Z80EX_CONTEXT *cpu)
 {
 	SBC16(HL,BC);
 	T_WAIT_UNTIL(11);
@@ -319,7 +319,7 @@ static void op_ED_0x42(void)
 }
 
 /*LD (@),BC*/
-static void op_ED_0x43(void)
+static void op_ED_0x43(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -331,7 +331,7 @@ static void op_ED_0x43(void)
 }
 
 /*NEG*/
-static void op_ED_0x44(void)
+static void op_ED_0x44(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -339,7 +339,7 @@ static void op_ED_0x44(void)
 }
 
 /*RETN*/
-static void op_ED_0x45(void)
+static void op_ED_0x45(Z80EX_CONTEXT *cpu)
 {
 	RETN(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -347,7 +347,7 @@ static void op_ED_0x45(void)
 }
 
 /*IM 0*/
-static void op_ED_0x46(void)
+static void op_ED_0x46(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM0);
 	T_WAIT_UNTIL(4);
@@ -355,7 +355,7 @@ static void op_ED_0x46(void)
 }
 
 /*LD I,A*/
-static void op_ED_0x47(void)
+static void op_ED_0x47(Z80EX_CONTEXT *cpu)
 {
 	LD(I,A);
 	T_WAIT_UNTIL(5);
@@ -363,7 +363,7 @@ static void op_ED_0x47(void)
 }
 
 /*IN C,(C)*/
-static void op_ED_0x48(void)
+static void op_ED_0x48(Z80EX_CONTEXT *cpu)
 {
 	IN(C,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -371,7 +371,7 @@ static void op_ED_0x48(void)
 }
 
 /*OUT (C),C*/
-static void op_ED_0x49(void)
+static void op_ED_0x49(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,C, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -379,7 +379,7 @@ static void op_ED_0x49(void)
 }
 
 /*ADC HL,BC*/
-static void op_ED_0x4a(void)
+static void op_ED_0x4a(Z80EX_CONTEXT *cpu)
 {
 	ADC16(HL,BC);
 	T_WAIT_UNTIL(11);
@@ -387,7 +387,7 @@ static void op_ED_0x4a(void)
 }
 
 /*LD BC,(@)*/
-static void op_ED_0x4b(void)
+static void op_ED_0x4b(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -399,7 +399,7 @@ static void op_ED_0x4b(void)
 }
 
 /*NEG*/
-static void op_ED_0x4c(void)
+static void op_ED_0x4c(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -407,7 +407,7 @@ static void op_ED_0x4c(void)
 }
 
 /*RETI*/
-static void op_ED_0x4d(void)
+static void op_ED_0x4d(Z80EX_CONTEXT *cpu)
 {
 	RETI(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -415,7 +415,7 @@ static void op_ED_0x4d(void)
 }
 
 /*IM 0*/
-static void op_ED_0x4e(void)
+static void op_ED_0x4e(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM0);
 	T_WAIT_UNTIL(4);
@@ -423,7 +423,7 @@ static void op_ED_0x4e(void)
 }
 
 /*LD R,A*/
-static void op_ED_0x4f(void)
+static void op_ED_0x4f(Z80EX_CONTEXT *cpu)
 {
 	LD_R_A();
 	T_WAIT_UNTIL(5);
@@ -431,7 +431,7 @@ static void op_ED_0x4f(void)
 }
 
 /*IN D,(C)*/
-static void op_ED_0x50(void)
+static void op_ED_0x50(Z80EX_CONTEXT *cpu)
 {
 	IN(D,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -439,7 +439,7 @@ static void op_ED_0x50(void)
 }
 
 /*OUT (C),D*/
-static void op_ED_0x51(void)
+static void op_ED_0x51(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,D, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -447,7 +447,7 @@ static void op_ED_0x51(void)
 }
 
 /*SBC HL,DE*/
-static void op_ED_0x52(void)
+static void op_ED_0x52(Z80EX_CONTEXT *cpu)
 {
 	SBC16(HL,DE);
 	T_WAIT_UNTIL(11);
@@ -455,7 +455,7 @@ static void op_ED_0x52(void)
 }
 
 /*LD (@),DE*/
-static void op_ED_0x53(void)
+static void op_ED_0x53(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -467,7 +467,7 @@ static void op_ED_0x53(void)
 }
 
 /*NEG*/
-static void op_ED_0x54(void)
+static void op_ED_0x54(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -475,7 +475,7 @@ static void op_ED_0x54(void)
 }
 
 /*RETN*/
-static void op_ED_0x55(void)
+static void op_ED_0x55(Z80EX_CONTEXT *cpu)
 {
 	RETN(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -483,7 +483,7 @@ static void op_ED_0x55(void)
 }
 
 /*IM 1*/
-static void op_ED_0x56(void)
+static void op_ED_0x56(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM1);
 	T_WAIT_UNTIL(4);
@@ -491,7 +491,7 @@ static void op_ED_0x56(void)
 }
 
 /*LD A,I*/
-static void op_ED_0x57(void)
+static void op_ED_0x57(Z80EX_CONTEXT *cpu)
 {
 	LD_A_I();
 	T_WAIT_UNTIL(5);
@@ -499,7 +499,7 @@ static void op_ED_0x57(void)
 }
 
 /*IN E,(C)*/
-static void op_ED_0x58(void)
+static void op_ED_0x58(Z80EX_CONTEXT *cpu)
 {
 	IN(E,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -507,7 +507,7 @@ static void op_ED_0x58(void)
 }
 
 /*OUT (C),E*/
-static void op_ED_0x59(void)
+static void op_ED_0x59(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,E, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -515,7 +515,7 @@ static void op_ED_0x59(void)
 }
 
 /*ADC HL,DE*/
-static void op_ED_0x5a(void)
+static void op_ED_0x5a(Z80EX_CONTEXT *cpu)
 {
 	ADC16(HL,DE);
 	T_WAIT_UNTIL(11);
@@ -523,7 +523,7 @@ static void op_ED_0x5a(void)
 }
 
 /*LD DE,(@)*/
-static void op_ED_0x5b(void)
+static void op_ED_0x5b(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -535,7 +535,7 @@ static void op_ED_0x5b(void)
 }
 
 /*NEG*/
-static void op_ED_0x5c(void)
+static void op_ED_0x5c(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -543,7 +543,7 @@ static void op_ED_0x5c(void)
 }
 
 /*RETI*/
-static void op_ED_0x5d(void)
+static void op_ED_0x5d(Z80EX_CONTEXT *cpu)
 {
 	RETI(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -551,7 +551,7 @@ static void op_ED_0x5d(void)
 }
 
 /*IM 2*/
-static void op_ED_0x5e(void)
+static void op_ED_0x5e(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM2);
 	T_WAIT_UNTIL(4);
@@ -559,7 +559,7 @@ static void op_ED_0x5e(void)
 }
 
 /*LD A,R*/
-static void op_ED_0x5f(void)
+static void op_ED_0x5f(Z80EX_CONTEXT *cpu)
 {
 	LD_A_R();
 	T_WAIT_UNTIL(5);
@@ -567,7 +567,7 @@ static void op_ED_0x5f(void)
 }
 
 /*IN H,(C)*/
-static void op_ED_0x60(void)
+static void op_ED_0x60(Z80EX_CONTEXT *cpu)
 {
 	IN(H,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -575,7 +575,7 @@ static void op_ED_0x60(void)
 }
 
 /*OUT (C),H*/
-static void op_ED_0x61(void)
+static void op_ED_0x61(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,H, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -583,7 +583,7 @@ static void op_ED_0x61(void)
 }
 
 /*SBC HL,HL*/
-static void op_ED_0x62(void)
+static void op_ED_0x62(Z80EX_CONTEXT *cpu)
 {
 	SBC16(HL,HL);
 	T_WAIT_UNTIL(11);
@@ -591,7 +591,7 @@ static void op_ED_0x62(void)
 }
 
 /*LD (@),HL*/
-static void op_ED_0x63(void)
+static void op_ED_0x63(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -603,7 +603,7 @@ static void op_ED_0x63(void)
 }
 
 /*NEG*/
-static void op_ED_0x64(void)
+static void op_ED_0x64(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -611,7 +611,7 @@ static void op_ED_0x64(void)
 }
 
 /*RETN*/
-static void op_ED_0x65(void)
+static void op_ED_0x65(Z80EX_CONTEXT *cpu)
 {
 	RETN(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -619,7 +619,7 @@ static void op_ED_0x65(void)
 }
 
 /*IM 0*/
-static void op_ED_0x66(void)
+static void op_ED_0x66(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM0);
 	T_WAIT_UNTIL(4);
@@ -627,7 +627,7 @@ static void op_ED_0x66(void)
 }
 
 /*RRD*/
-static void op_ED_0x67(void)
+static void op_ED_0x67(Z80EX_CONTEXT *cpu)
 {
 	RRD(/*rd*/4, /*wr*/11);
 	T_WAIT_UNTIL(14);
@@ -635,7 +635,7 @@ static void op_ED_0x67(void)
 }
 
 /*IN L,(C)*/
-static void op_ED_0x68(void)
+static void op_ED_0x68(Z80EX_CONTEXT *cpu)
 {
 	IN(L,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -643,7 +643,7 @@ static void op_ED_0x68(void)
 }
 
 /*OUT (C),L*/
-static void op_ED_0x69(void)
+static void op_ED_0x69(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,L, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -651,7 +651,7 @@ static void op_ED_0x69(void)
 }
 
 /*ADC HL,HL*/
-static void op_ED_0x6a(void)
+static void op_ED_0x6a(Z80EX_CONTEXT *cpu)
 {
 	ADC16(HL,HL);
 	T_WAIT_UNTIL(11);
@@ -659,7 +659,7 @@ static void op_ED_0x6a(void)
 }
 
 /*LD HL,(@)*/
-static void op_ED_0x6b(void)
+static void op_ED_0x6b(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -671,7 +671,7 @@ static void op_ED_0x6b(void)
 }
 
 /*NEG*/
-static void op_ED_0x6c(void)
+static void op_ED_0x6c(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -679,7 +679,7 @@ static void op_ED_0x6c(void)
 }
 
 /*RETI*/
-static void op_ED_0x6d(void)
+static void op_ED_0x6d(Z80EX_CONTEXT *cpu)
 {
 	RETI(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -687,7 +687,7 @@ static void op_ED_0x6d(void)
 }
 
 /*IM 0*/
-static void op_ED_0x6e(void)
+static void op_ED_0x6e(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM0);
 	T_WAIT_UNTIL(4);
@@ -695,7 +695,7 @@ static void op_ED_0x6e(void)
 }
 
 /*RLD*/
-static void op_ED_0x6f(void)
+static void op_ED_0x6f(Z80EX_CONTEXT *cpu)
 {
 	RLD(/*rd*/4, /*wr*/11);
 	T_WAIT_UNTIL(14);
@@ -703,7 +703,7 @@ static void op_ED_0x6f(void)
 }
 
 /*IN_F (C)*/
-static void op_ED_0x70(void)
+static void op_ED_0x70(Z80EX_CONTEXT *cpu)
 {
 	IN_F(BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -711,15 +711,15 @@ static void op_ED_0x70(void)
 }
 
 /*OUT (C),0*/
-static void op_ED_0x71(void)
+static void op_ED_0x71(Z80EX_CONTEXT *cpu)
 {
-	OUT(BC,z80ex.nmos ? 0: 0xFF, /*wr*/5); /* LGB: CMOS CPU uses 0xFF here! I guess ... */
+	OUT(BC,cpu->nmos ? 0: 0xFF, /*wr*/5); /* LGB: CMOS CPU uses 0xFF here! I guess ... */
 	T_WAIT_UNTIL(8);
 	return;
 }
 
 /*SBC HL,SP*/
-static void op_ED_0x72(void)
+static void op_ED_0x72(Z80EX_CONTEXT *cpu)
 {
 	SBC16(HL,SP);
 	T_WAIT_UNTIL(11);
@@ -727,7 +727,7 @@ static void op_ED_0x72(void)
 }
 
 /*LD (@),SP*/
-static void op_ED_0x73(void)
+static void op_ED_0x73(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -739,7 +739,7 @@ static void op_ED_0x73(void)
 }
 
 /*NEG*/
-static void op_ED_0x74(void)
+static void op_ED_0x74(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -747,7 +747,7 @@ static void op_ED_0x74(void)
 }
 
 /*RETN*/
-static void op_ED_0x75(void)
+static void op_ED_0x75(Z80EX_CONTEXT *cpu)
 {
 	RETN(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -755,7 +755,7 @@ static void op_ED_0x75(void)
 }
 
 /*IM 1*/
-static void op_ED_0x76(void)
+static void op_ED_0x76(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM1);
 	T_WAIT_UNTIL(4);
@@ -763,7 +763,7 @@ static void op_ED_0x76(void)
 }
 
 /*IN A,(C)*/
-static void op_ED_0x78(void)
+static void op_ED_0x78(Z80EX_CONTEXT *cpu)
 {
 	IN(A,BC, /*rd*/5);
 	T_WAIT_UNTIL(8);
@@ -771,7 +771,7 @@ static void op_ED_0x78(void)
 }
 
 /*OUT (C),A*/
-static void op_ED_0x79(void)
+static void op_ED_0x79(Z80EX_CONTEXT *cpu)
 {
 	OUT(BC,A, /*wr*/5);
 	T_WAIT_UNTIL(8);
@@ -779,7 +779,7 @@ static void op_ED_0x79(void)
 }
 
 /*ADC HL,SP*/
-static void op_ED_0x7a(void)
+static void op_ED_0x7a(Z80EX_CONTEXT *cpu)
 {
 	ADC16(HL,SP);
 	T_WAIT_UNTIL(11);
@@ -787,7 +787,7 @@ static void op_ED_0x7a(void)
 }
 
 /*LD SP,(@)*/
-static void op_ED_0x7b(void)
+static void op_ED_0x7b(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -799,7 +799,7 @@ static void op_ED_0x7b(void)
 }
 
 /*NEG*/
-static void op_ED_0x7c(void)
+static void op_ED_0x7c(Z80EX_CONTEXT *cpu)
 {
 	NEG();
 	T_WAIT_UNTIL(4);
@@ -807,7 +807,7 @@ static void op_ED_0x7c(void)
 }
 
 /*RETI*/
-static void op_ED_0x7d(void)
+static void op_ED_0x7d(Z80EX_CONTEXT *cpu)
 {
 	RETI(/*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -815,7 +815,7 @@ static void op_ED_0x7d(void)
 }
 
 /*IM 2*/
-static void op_ED_0x7e(void)
+static void op_ED_0x7e(Z80EX_CONTEXT *cpu)
 {
 	IM_(IM2);
 	T_WAIT_UNTIL(4);
@@ -823,7 +823,7 @@ static void op_ED_0x7e(void)
 }
 
 /*LDI*/
-static void op_ED_0xa0(void)
+static void op_ED_0xa0(Z80EX_CONTEXT *cpu)
 {
 	LDI(/*rd*/4, /*wr*/7);
 	T_WAIT_UNTIL(12);
@@ -831,7 +831,7 @@ static void op_ED_0xa0(void)
 }
 
 /*CPI*/
-static void op_ED_0xa1(void)
+static void op_ED_0xa1(Z80EX_CONTEXT *cpu)
 {
 	CPI(/*rd*/4);
 	T_WAIT_UNTIL(12);
@@ -839,7 +839,7 @@ static void op_ED_0xa1(void)
 }
 
 /*INI*/
-static void op_ED_0xa2(void)
+static void op_ED_0xa2(Z80EX_CONTEXT *cpu)
 {
 	INI(/*rd*/6, /*wr*/9);
 	T_WAIT_UNTIL(12);
@@ -847,7 +847,7 @@ static void op_ED_0xa2(void)
 }
 
 /*OUTI*/
-static void op_ED_0xa3(void)
+static void op_ED_0xa3(Z80EX_CONTEXT *cpu)
 {
 	OUTI(/*rd*/5, /*wr*/9);
 	T_WAIT_UNTIL(12);
@@ -855,7 +855,7 @@ static void op_ED_0xa3(void)
 }
 
 /*LDD*/
-static void op_ED_0xa8(void)
+static void op_ED_0xa8(Z80EX_CONTEXT *cpu)
 {
 	LDD(/*rd*/4, /*wr*/7);
 	T_WAIT_UNTIL(12);
@@ -863,7 +863,7 @@ static void op_ED_0xa8(void)
 }
 
 /*CPD*/
-static void op_ED_0xa9(void)
+static void op_ED_0xa9(Z80EX_CONTEXT *cpu)
 {
 	CPD(/*rd*/4);
 	T_WAIT_UNTIL(12);
@@ -871,7 +871,7 @@ static void op_ED_0xa9(void)
 }
 
 /*IND*/
-static void op_ED_0xaa(void)
+static void op_ED_0xaa(Z80EX_CONTEXT *cpu)
 {
 	IND(/*rd*/6, /*wr*/9);
 	T_WAIT_UNTIL(12);
@@ -879,7 +879,7 @@ static void op_ED_0xaa(void)
 }
 
 /*OUTD*/
-static void op_ED_0xab(void)
+static void op_ED_0xab(Z80EX_CONTEXT *cpu)
 {
 	OUTD(/*rd*/5, /*wr*/9);
 	T_WAIT_UNTIL(12);
@@ -887,56 +887,56 @@ static void op_ED_0xab(void)
 }
 
 /*LDIR*/
-static void op_ED_0xb0(void)
+static void op_ED_0xb0(Z80EX_CONTEXT *cpu)
 {
 	LDIR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/4, /*wr*/7);
 	return;
 }
 
 /*CPIR*/
-static void op_ED_0xb1(void)
+static void op_ED_0xb1(Z80EX_CONTEXT *cpu)
 {
 	CPIR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/4);
 	return;
 }
 
 /*INIR*/
-static void op_ED_0xb2(void)
+static void op_ED_0xb2(Z80EX_CONTEXT *cpu)
 {
 	INIR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/6, /*wr*/9);
 	return;
 }
 
 /*OTIR*/
-static void op_ED_0xb3(void)
+static void op_ED_0xb3(Z80EX_CONTEXT *cpu)
 {
 	OTIR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/5, /*wr*/9);
 	return;
 }
 
 /*LDDR*/
-static void op_ED_0xb8(void)
+static void op_ED_0xb8(Z80EX_CONTEXT *cpu)
 {
 	LDDR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/4, /*wr*/7);
 	return;
 }
 
 /*CPDR*/
-static void op_ED_0xb9(void)
+static void op_ED_0xb9(Z80EX_CONTEXT *cpu)
 {
 	CPDR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/4);
 	return;
 }
 
 /*INDR*/
-static void op_ED_0xba(void)
+static void op_ED_0xba(Z80EX_CONTEXT *cpu)
 {
 	INDR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/6, /*wr*/9);
 	return;
 }
 
 /*OTDR*/
-static void op_ED_0xbb(void)
+static void op_ED_0xbb(Z80EX_CONTEXT *cpu)
 {
 	OTDR(/*t:*/ /*t1*/12,/*t2*/17, /*rd*/5, /*wr*/9);
 	return;
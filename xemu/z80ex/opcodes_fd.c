@@ -1,7 +1,7 @@
 /* autogenerated from ./opcodes_ddfd.dat, do not edit */
 
 /*ADD IY,BC*/
-static void op_FD_0x09(void)
+static void op_FD_0x09(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IY,BC);
 	T_WAIT_UNTIL(11);
@@ -9,7 +9,7 @@ static void op_FD_0x09(void)
 }
 
 /*ADD IY,DE*/
-static void op_FD_0x19(void)
+static void op_FD_0x19(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IY,DE);
 	T_WAIT_UNTIL(11);
@@ -17,7 +17,7 @@ static void op_FD_0x19(void)
 }
 
 /*LD IY,@*/
-static void op_FD_0x21(void)
+static void op_FD_0x21(Z80EX_CONTEXT *cpu)
 {
 	temp_word.b.l=READ_OP();
 	temp_word.b.h=READ_OP();
@@ -27,7 +27,7 @@ static void op_FD_0x21(void)
 }
 
 /*LD (@),IY*/
-static void op_FD_0x22(void)
+static void op_FD_0x22(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -39,7 +39,7 @@ static void op_FD_0x22(void)
 }
 
 /*INC IY*/
-static void op_FD_0x23(void)
+static void op_FD_0x23(Z80EX_CONTEXT *cpu)
 {
 	INC16(IY);
 	T_WAIT_UNTIL(6);
@@ -47,7 +47,7 @@ static void op_FD_0x23(void)
 }
 
 /*INC IYH*/
-static void op_FD_0x24(void)
+static void op_FD_0x24(Z80EX_CONTEXT *cpu)
 {
 	INC(IYH);
 	T_WAIT_UNTIL(4);
@@ -55,7 +55,7 @@ static void op_FD_0x24(void)
 }
 
 /*DEC IYH*/
-static void op_FD_0x25(void)
+static void op_FD_0x25(Z80EX_CONTEXT *cpu)
 {
 	DEC(IYH);
 	T_WAIT_UNTIL(4);
@@ -63,7 +63,7 @@ static void op_FD_0x25(void)
 }
 
 /*LD IYH,#*/
-static void op_FD_0x26(void)
+static void op_FD_0x26(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(IYH,temp_byte);
@@ -72,7 +72,7 @@ static void op_FD_0x26(void)
 }
 
 /*ADD IY,IY*/
-static void op_FD_0x29(void)
+static void op_FD_0x29(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IY,IY);
 	T_WAIT_UNTIL(11);
@@ -80,7 +80,7 @@ static void op_FD_0x29(void)
 }
 
 /*LD IY,(@)*/
-static void op_FD_0x2a(void)
+static void op_FD_0x2a(Z80EX_CONTEXT *cpu)
 {
 	temp_addr.b.l=READ_OP();
 	temp_addr.b.h=READ_OP();
@@ -92,7 +92,7 @@ static void op_FD_0x2a(void)
 }
 
 /*DEC IY*/
-static void op_FD_0x2b(void)
+static void op_FD_0x2b(Z80EX_CONTEXT *cpu)
 {
 	DEC16(IY);
 	T_WAIT_UNTIL(6);
@@ -100,7 +100,7 @@ static void op_FD_0x2b(void)
 }
 
 /*INC IYL*/
-static void op_FD_0x2c(void)
+static void op_FD_0x2c(Z80EX_CONTEXT *cpu)
 {
 	INC(IYL);
 	T_WAIT_UNTIL(4);
@@ -108,7 +108,7 @@ static void op_FD_0x2c(void)
 }
 
 /*DEC IYL*/
-static void op_FD_0x2d(void)
+static void op_FD_0x2d(Z80EX_CONTEXT *cpu)
 {
 	DEC(IYL);
 	T_WAIT_UNTIL(4);
@@ -116,7 +116,7 @@ static void op_FD_0x2d(void)
 }
 
 /*LD IYL,#*/
-static void op_FD_0x2e(void)
+static void op_FD_0x2e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	LD(IYL,temp_byte);
@@ -125,7 +125,7 @@ static void op_FD_0x2e(void)
 }
 
 /*INC (IY+$)*/
-static void op_FD_0x34(void)
+static void op_FD_0x34(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -138,7 +138,7 @@ static void op_FD_0x34(void)
 }
 
 /*DEC (IY+$)*/
-static void op_FD_0x35(void)
+static void op_FD_0x35(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -151,7 +151,7 @@ static void op_FD_0x35(void)
 }
 
 /*LD (IY+$),#*/
-static void op_FD_0x36(void)
+static void op_FD_0x36(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -164,7 +164,7 @@ static void op_FD_0x36(void)
 }
 
 /*ADD IY,SP*/
-static void op_FD_0x39(void)
+static void op_FD_0x39(Z80EX_CONTEXT *cpu)
 {
 	ADD16(IY,SP);
 	T_WAIT_UNTIL(11);
@@ -172,7 +172,7 @@ static void op_FD_0x39(void)
 }
 
 /*LD B,IYH*/
-static void op_FD_0x44(void)
+static void op_FD_0x44(Z80EX_CONTEXT *cpu)
 {
 	LD(B,IYH);
 	T_WAIT_UNTIL(4);
@@ -180,7 +180,7 @@ static void op_FD_0x44(void)
 }
 
 /*LD B,IYL*/
-static void op_FD_0x45(void)
+static void op_FD_0x45(Z80EX_CONTEXT *cpu)
 {
 	LD(B,IYL);
 	T_WAIT_UNTIL(4);
@@ -188,7 +188,7 @@ static void op_FD_0x45(void)
 }
 
 /*LD B,(IY+$)*/
-static void op_FD_0x46(void)
+static void op_FD_0x46(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -200,7 +200,7 @@ static void op_FD_0x46(void)
 }
 
 /*LD C,IYH*/
-static void op_FD_0x4c(void)
+static void op_FD_0x4c(Z80EX_CONTEXT *cpu)
 {
 	LD(C,IYH);
 	T_WAIT_UNTIL(4);
@@ -208,7 +208,7 @@ static void op_FD_0x4c(void)
 }
 
 /*LD C,IYL*/
-static void op_FD_0x4d(void)
+static void op_FD_0x4d(Z80EX_CONTEXT *cpu)
 {
 	LD(C,IYL);
 	T_WAIT_UNTIL(4);
@@ -216,7 +216,7 @@ static void op_FD_0x4d(void)
 }
 
 /*LD C,(IY+$)*/
-static void op_FD_0x4e(void)
+static void op_FD_0x4e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -228,7 +228,7 @@ static void op_FD_0x4e(void)
 }
 
 /*LD D,IYH*/
-static void op_FD_0x54(void)
+static void op_FD_0x54(Z80EX_CONTEXT *cpu)
 {
 	LD(D,IYH);
 	T_WAIT_UNTIL(4);
@@ -236,7 +236,7 @@ static void op_FD_0x54(void)
 }
 
 /*LD D,IYL*/
-static void op_FD_0x55(void)
+static void op_FD_0x55(Z80EX_CONTEXT *cpu)
 {
 	LD(D,IYL);
 	T_WAIT_UNTIL(4);
@@ -244,7 +244,7 @@ static void op_FD_0x55(void)
 }
 
 /*LD D,(IY+$)*/
-static void op_FD_0x56(void)
+static void op_FD_0x56(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -256,7 +256,7 @@ static void op_FD_0x56(void)
 }
 
 /*LD E,IYH*/
-static void op_FD_0x5c(void)
+static void op_FD_0x5c(Z80EX_CONTEXT *cpu)
 {
 	LD(E,IYH);
 	T_WAIT_UNTIL(4);
@@ -264,7 +264,7 @@ static void op_FD_0x5c(void)
 }
 
 /*LD E,IYL*/
-static void op_FD_0x5d(void)
+static void op_FD_0x5d(Z80EX_CONTEXT *cpu)
 {
 	LD(E,IYL);
 	T_WAIT_UNTIL(4);
@@ -272,7 +272,7 @@ static void op_FD_0x5d(void)
 }
 
 /*LD E,(IY+$)*/
-static void op_FD_0x5e(void)
+static void op_FD_0x5e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -284,7 +284,7 @@ static void op_FD_0x5e(void)
 }
 
 /*LD IYH,B*/
-static void op_FD_0x60(void)
+static void op_FD_0x60(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,B);
 	T_WAIT_UNTIL(4);
@@ -292,7 +292,7 @@ static void op_FD_0x60(void)
 }
 
 /*LD IYH,C*/
-static void op_FD_0x61(void)
+static void op_FD_0x61(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,C);
 	T_WAIT_UNTIL(4);
@@ -300,7 +300,7 @@ static void op_FD_0x61(void)
 }
 
 /*LD IYH,D*/
-static void op_FD_0x62(void)
+static void op_FD_0x62(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,D);
 	T_WAIT_UNTIL(4);
@@ -308,7 +308,7 @@ static void op_FD_0x62(void)
 }
 
 /*LD IYH,E*/
-static void op_FD_0x63(void)
+static void op_FD_0x63(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,E);
 	T_WAIT_UNTIL(4);
@@ -316,7 +316,7 @@ static void op_FD_0x63(void)
 }
 
 /*LD IYH,IYH*/
-static void op_FD_0x64(void)
+static void op_FD_0x64(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,IYH);
 	T_WAIT_UNTIL(4);
@@ -324,7 +324,7 @@ static void op_FD_0x64(void)
 }
 
 /*LD IYH,IYL*/
-static void op_FD_0x65(void)
+static void op_FD_0x65(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,IYL);
 	T_WAIT_UNTIL(4);
@@ -332,7 +332,7 @@ static void op_FD_0x65(void)
 }
 
 /*LD H,(IY+$)*/
-static void op_FD_0x66(void)
+static void op_FD_0x66(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -344,7 +344,7 @@ static void op_FD_0x66(void)
 }
 
 /*LD IYH,A*/
-static void op_FD_0x67(void)
+static void op_FD_0x67(Z80EX_CONTEXT *cpu)
 {
 	LD(IYH,A);
 	T_WAIT_UNTIL(4);
@@ -352,7 +352,7 @@ static void op_FD_0x67(void)
 }
 
 /*LD IYL,B*/
-static void op_FD_0x68(void)
+static void op_FD_0x68(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,B);
 	T_WAIT_UNTIL(4);
@@ -360,7 +360,7 @@ static void op_FD_0x68(void)
 }
 
 /*LD IYL,C*/
-static void op_FD_0x69(void)
+static void op_FD_0x69(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,C);
 	T_WAIT_UNTIL(4);
@@ -368,7 +368,7 @@ static void op_FD_0x69(void)
 }
 
 /*LD IYL,D*/
-static void op_FD_0x6a(void)
+static void op_FD_0x6a(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,D);
 	T_WAIT_UNTIL(4);
@@ -376,7 +376,7 @@ static void op_FD_0x6a(void)
 }
 
 /*LD IYL,E*/
-static void op_FD_0x6b(void)
+static void op_FD_0x6b(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,E);
 	T_WAIT_UNTIL(4);
@@ -384,7 +384,7 @@ static void op_FD_0x6b(void)
 }
 
 /*LD IYL,IYH*/
-static void op_FD_0x6c(void)
+static void op_FD_0x6c(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,IYH);
 	T_WAIT_UNTIL(4);
@@ -392,7 +392,7 @@ static void op_FD_0x6c(void)
 }
 
 /*LD IYL,IYL*/
-static void op_FD_0x6d(void)
+static void op_FD_0x6d(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,IYL);
 	T_WAIT_UNTIL(4);
@@ -400,7 +400,7 @@ static void op_FD_0x6d(void)
 }
 
 /*LD L,(IY+$)*/
-static void op_FD_0x6e(void)
+static void op_FD_0x6e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -412,7 +412,7 @@ static void op_FD_0x6e(void)
 }
 
 /*LD IYL,A*/
-static void op_FD_0x6f(void)
+static void op_FD_0x6f(Z80EX_CONTEXT *cpu)
 {
 	LD(IYL,A);
 	T_WAIT_UNTIL(4);
@@ -420,7 +420,7 @@ static void op_FD_0x6f(void)
 }
 
 /*LD (IY+$),B*/
-static void op_FD_0x70(void)
+static void op_FD_0x70(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -432,7 +432,7 @@ static void op_FD_0x70(void)
 }
 
 /*LD (IY+$),C*/
-static void op_FD_0x71(void)
+static void op_FD_0x71(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -444,7 +444,7 @@ static void op_FD_0x71(void)
 }
 
 /*LD (IY+$),D*/
-static void op_FD_0x72(void)
+static void op_FD_0x72(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -456,7 +456,7 @@ static void op_FD_0x72(void)
 }
 
 /*LD (IY+$),E*/
-static void op_FD_0x73(void)
+static void op_FD_0x73(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -468,7 +468,7 @@ static void op_FD_0x73(void)
 }
 
 /*LD (IY+$),H*/
-static void op_FD_0x74(void)
+static void op_FD_0x74(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -480,7 +480,7 @@ static void op_FD_0x74(void)
 }
 
 /*LD (IY+$),L*/
-static void op_FD_0x75(void)
+static void op_FD_0x75(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -492,7 +492,7 @@ static void op_FD_0x75(void)
 }
 
 /*LD (IY+$),A*/
-static void op_FD_0x77(void)
+static void op_FD_0x77(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -504,7 +504,7 @@ static void op_FD_0x77(void)
 }
 
 /*LD A,IYH*/
-static void op_FD_0x7c(void)
+static void op_FD_0x7c(Z80EX_CONTEXT *cpu)
 {
 	LD(A,IYH);
 	T_WAIT_UNTIL(4);
@@ -512,7 +512,7 @@ static void op_FD_0x7c(void)
 }
 
 /*LD A,IYL*/
-static void op_FD_0x7d(void)
+static void op_FD_0x7d(Z80EX_CONTEXT *cpu)
 {
 	LD(A,IYL);
 	T_WAIT_UNTIL(4);
@@ -520,7 +520,7 @@ static void op_FD_0x7d(void)
 }
 
 /*LD A,(IY+$)*/
-static void op_FD_0x7e(void)
+static void op_FD_0x7e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -532,7 +532,7 @@ static void op_FD_0x7e(void)
 }
 
 /*ADD A,IYH*/
-static void op_FD_0x84(void)
+static void op_FD_0x84(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,IYH);
 	T_WAIT_UNTIL(4);
@@ -540,7 +540,7 @@ static void op_FD_0x84(void)
 }
 
 /*ADD A,IYL*/
-static void op_FD_0x85(void)
+static void op_FD_0x85(Z80EX_CONTEXT *cpu)
 {
 	ADD(A,IYL);
 	T_WAIT_UNTIL(4);
@@ -548,7 +548,7 @@ static void op_FD_0x85(void)
 }
 
 /*ADD A,(IY+$)*/
-static void op_FD_0x86(void)
+static void op_FD_0x86(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -560,7 +560,7 @@ static void op_FD_0x86(void)
 }
 
 /*ADC A,IYH*/
-static void op_FD_0x8c(void)
+static void op_FD_0x8c(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,IYH);
 	T_WAIT_UNTIL(4);
@@ -568,7 +568,7 @@ static void op_FD_0x8c(void)
 }
 
 /*ADC A,IYL*/
-static void op_FD_0x8d(void)
+static void op_FD_0x8d(Z80EX_CONTEXT *cpu)
 {
 	ADC(A,IYL);
 	T_WAIT_UNTIL(4);
@@ -576,7 +576,7 @@ static void op_FD_0x8d(void)
 }
 
 /*ADC A,(IY+$)*/
-static void op_FD_0x8e(void)
+static void op_FD_0x8e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -588,7 +588,7 @@ static void op_FD_0x8e(void)
 }
 
 /*SUB IYH*/
-static void op_FD_0x94(void)
+static void op_FD_0x94(Z80EX_CONTEXT *cpu)
 {
 	SUB(IYH);
 	T_WAIT_UNTIL(4);
@@ -596,7 +596,7 @@ static void op_FD_0x94(void)
 }
 
 /*SUB IYL*/
-static void op_FD_0x95(void)
+static void op_FD_0x95(Z80EX_CONTEXT *cpu)
 {
 	SUB(IYL);
 	T_WAIT_UNTIL(4);
@@ -604,7 +604,7 @@ static void op_FD_0x95(void)
 }
 
 /*SUB (IY+$)*/
-static void op_FD_0x96(void)
+static void op_FD_0x96(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -616,7 +616,7 @@ static void op_FD_0x96(void)
 }
 
 /*SBC A,IYH*/
-static void op_FD_0x9c(void)
+static void op_FD_0x9c(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,IYH);
 	T_WAIT_UNTIL(4);
@@ -624,7 +624,7 @@ static void op_FD_0x9c(void)
 }
 
 /*SBC A,IYL*/
-static void op_FD_0x9d(void)
+static void op_FD_0x9d(Z80EX_CONTEXT *cpu)
 {
 	SBC(A,IYL);
 	T_WAIT_UNTIL(4);
@@ -632,7 +632,7 @@ static void op_FD_0x9d(void)
 }
 
 /*SBC A,(IY+$)*/
-static void op_FD_0x9e(void)
+static void op_FD_0x9e(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -644,7 +644,7 @@ static void op_FD_0x9e(void)
 }
 
 /*AND IYH*/
-static void op_FD_0xa4(void)
+static void op_FD_0xa4(Z80EX_CONTEXT *cpu)
 {
 	AND(IYH);
 	T_WAIT_UNTIL(4);
@@ -652,7 +652,7 @@ static void op_FD_0xa4(void)
 }
 
 /*AND IYL*/
-static void op_FD_0xa5(void)
+static void op_FD_0xa5(Z80EX_CONTEXT *cpu)
 {
 	AND(IYL);
 	T_WAIT_UNTIL(4);
@@ -660,7 +660,7 @@ static void op_FD_0xa5(void)
 }
 
 /*AND (IY+$)*/
-static void op_FD_0xa6(void)
+static void op_FD_0xa6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -672,7 +672,7 @@ static void op_FD_0xa6(void)
 }
 
 /*XOR IYH*/
-static void op_FD_0xac(void)
+static void op_FD_0xac(Z80EX_CONTEXT *cpu)
 {
 	XOR(IYH);
 	T_WAIT_UNTIL(4);
@@ -680,7 +680,7 @@ static void op_FD_0xac(void)
 }
 
 /*XOR IYL*/
-static void op_FD_0xad(void)
+static void op_FD_0xad(Z80EX_CONTEXT *cpu)
 {
 	XOR(IYL);
 	T_WAIT_UNTIL(4);
@@ -688,7 +688,7 @@ static void op_FD_0xad(void)
 }
 
 /*XOR (IY+$)*/
-static void op_FD_0xae(void)
+static void op_FD_0xae(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -700,7 +700,7 @@ static void op_FD_0xae(void)
 }
 
 /*OR IYH*/
-static void op_FD_0xb4(void)
+static void op_FD_0xb4(Z80EX_CONTEXT *cpu)
 {
 	OR(IYH);
 	T_WAIT_UNTIL(4);
@@ -708,7 +708,7 @@ static void op_FD_0xb4(void)
 }
 
 /*OR IYL*/
-static void op_FD_0xb5(void)
+static void op_FD_0xb5(Z80EX_CONTEXT *cpu)
 {
 	OR(IYL);
 	T_WAIT_UNTIL(4);
@@ -716,7 +716,7 @@ static void op_FD_0xb5(void)
 }
 
 /*OR (IY+$)*/
-static void op_FD_0xb6(void)
+static void op_FD_0xb6(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -728,7 +728,7 @@ static void op_FD_0xb6(void)
 }
 
 /*CP IYH*/
-static void op_FD_0xbc(void)
+static void op_FD_0xbc(Z80EX_CONTEXT *cpu)
 {
 	CP(IYH);
 	T_WAIT_UNTIL(4);
@@ -736,7 +736,7 @@ static void op_FD_0xbc(void)
 }
 
 /*CP IYL*/
-static void op_FD_0xbd(void)
+static void op_FD_0xbd(Z80EX_CONTEXT *cpu)
 {
 	CP(IYL);
 	T_WAIT_UNTIL(4);
@@ -744,7 +744,7 @@ static void op_FD_0xbd(void)
 }
 
 /*CP (IY+$)*/
-static void op_FD_0xbe(void)
+static void op_FD_0xbe(Z80EX_CONTEXT *cpu)
 {
 	temp_byte=READ_OP();
 	temp_byte_s=(temp_byte & 0x80)? -(((~temp_byte) & 0x7f)+1): temp_byte;
@@ -757,7 +757,7 @@ static void op_FD_0xbe(void)
 
 
 /*POP IY*/
-static void op_FD_0xe1(void)
+static void op_FD_0xe1(Z80EX_CONTEXT *cpu)
 {
 	POP(IY, /*rd*/4,7);
 	T_WAIT_UNTIL(10);
@@ -765,7 +765,7 @@ static void op_FD_0xe1(void)
 }
 
 /*EX (SP),IY*/
-static void op_FD_0xe3(void)
+static void op_FD_0xe3(Z80EX_CONTEXT *cpu)
 {
 	READ_MEM(temp_word.b.l,(SP),4);
 	READ_MEM(temp_word.b.h,(SP+1),7);
@@ -777,7 +777,7 @@ static void op_FD_0xe3(void)
 }
 
 /*PUSH IY*/
-static void op_FD_0xe5(void)
+static void op_FD_0xe5(Z80EX_CONTEXT *cpu)
 {
 	PUSH(IY, /*wr*/5,8);
 	T_WAIT_UNTIL(11);
@@ -785,7 +785,7 @@ static void op_FD_0xe5(void)
 }
 
 /*JP IY*/
-static void op_FD_0xe9(void)
+static void op_FD_0xe9(Z80EX_CONTEXT *cpu)
 {
 	JP_NO_MPTR(IY);
 	T_WAIT_UNTIL(4);
@@ -793,7 +793,7 @@ static void op_FD_0xe9(void)
 }
 
 /*LD SP,IY*/
-static void op_FD_0xf9(void)
+static void op_FD_0xf9(Z80EX_CONTEXT *cpu)
 {
 	LD16(SP,IY);
 	T_WAIT_UNTIL(6);
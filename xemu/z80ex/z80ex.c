@@ -19,19 +19,12 @@
 #include "xemu/z80ex/macros.h"
 
 #include "xemu/emutools_basicdefs.h"
+#include <SDL_atomic.h>
 
-#define temp_byte z80ex.tmpbyte
-#define temp_byte_s z80ex.tmpbyte_s
-#define temp_addr z80ex.tmpaddr
-#define temp_word z80ex.tmpword
-
-typedef void (*z80ex_opcode_fn) (void);
-
-#ifdef Z80EX_Z180_BY_DEFAULT
-#define Z180_LIKELY XEMU_LIKELY
-#else
-#define Z180_LIKELY XEMU_UNLIKELY
-#endif
+#define temp_byte cpu->tmpbyte
+#define temp_byte_s cpu->tmpbyte_s
+#define temp_addr cpu->tmpaddr
+#define temp_word cpu->tmpword
 
 #include "xemu/z80ex/ptables.c"
 #include "xemu/z80ex/opcodes_base.c"
@@ -43,128 +36,187 @@ typedef void (*z80ex_opcode_fn) (void);
 #include "xemu/z80ex/opcodes_fdcb.c"
 #include "xemu/z80ex/z180ex.c"
 
-/* do one opcode (instruction or prefix) */
-int z80ex_step(void)
-{
-	Z80EX_BYTE opcode, d;
-	z80ex_opcode_fn ofn = NULL;
-
-	z80ex.doing_opcode = 1;
-	z80ex.noint_once = 0;
-	z80ex.reset_PV_on_int = 0;
-	z80ex.tstate = 0;
-	z80ex.op_tstate = 0;
-
-	opcode = READ_OP_M1(); 		/* fetch opcode */
-	if (z80ex.int_vector_req)
-	{
-		TSTATES(2); 		/* interrupt eats two extra wait-states */
-	}
-	R++;				/* R increased by one on every first M1 cycle */
-
-	T_WAIT_UNTIL(4);		/* M1 cycle eats min 4 t-states */
-
-	if (!z80ex.prefix)
-		opcodes_base[opcode]();
-	else {
-		if ((z80ex.prefix | 0x20) == 0xFD && ((opcode | 0x20) == 0xFD || opcode == 0xED)) {
-			z80ex.prefix = opcode;
-			z80ex.noint_once = 1; /* interrupts are not accepted immediately after prefix */
-		} else {
-			switch (z80ex.prefix) {
-				case 0xDD:
-				case 0xFD:
-					if (opcode == 0xCB) {	/* FD/DD prefixed CB opcodes */
-						d = READ_OP(); /* displacement */
-						temp_byte_s = (d & 0x80)? -(((~d) & 0x7f)+1): d;
-						opcode = READ_OP();
+
+/* Flattened dispatch tables, one for each prefix state, built once from the opcode tables above.
+   All the fallback logic ("mirrored" DD/FD opcodes, invalid ED opcodes) is resolved at build time.
+   In the Z180 variant NULL entries mean opcodes causing an invalid instruction trap. */
+enum { DISPATCH_BASE, DISPATCH_CB, DISPATCH_ED, DISPATCH_DD, DISPATCH_FD, DISPATCH_DDCB, DISPATCH_FDCB, DISPATCH_TABLES };
+
+static z80ex_opcode_fn dispatch_z80[DISPATCH_TABLES][0x100];
 #ifdef Z80EX_Z180_SUPPORT
-						if (Z180_LIKELY(z80ex.z180)) {
-							if (XEMU_UNLIKELY((opcode & 7) != 6 || opcode == 0x36))
-								ofn = trapping(z80ex.prefix, 0xCB, opcode, ITC_B3);
-							else
-								ofn = (z80ex.prefix == 0xDD) ? opcodes_ddcb[opcode] : opcodes_fdcb[opcode];
-						} else
+static z80ex_opcode_fn dispatch_z180[DISPATCH_TABLES][0x100];
 #endif
-							ofn = (z80ex.prefix == 0xDD) ? opcodes_ddcb[opcode] : opcodes_fdcb[opcode];
-					} else { /* FD/DD prefixed base opcodes */
+static SDL_atomic_t dispatch_tables_ready;	/* zero-initialized as static */
+static SDL_SpinLock dispatch_tables_lock = 0;
+
+
+/* called by z80ex_ctx_init(), which may be called by more threads at the same time, each with its own context */
+static void build_dispatch_tables ( void )
+{
+	if (XEMU_LIKELY(SDL_AtomicGet(&dispatch_tables_ready)))
+		return;
+	SDL_AtomicLock(&dispatch_tables_lock);
+	if (SDL_AtomicGet(&dispatch_tables_ready)) {	/* another thread has just built them */
+		SDL_AtomicUnlock(&dispatch_tables_lock);
+		return;
+	}
+	for (int op = 0; op < 0x100; op++) {
+		dispatch_z80[DISPATCH_BASE][op] = opcodes_base[op];
+		dispatch_z80[DISPATCH_CB  ][op] = opcodes_cb[op];
+		dispatch_z80[DISPATCH_ED  ][op] = opcodes_ed[op] ? opcodes_ed[op] : opcodes_base[0x00];
+		dispatch_z80[DISPATCH_DD  ][op] = opcodes_dd[op] ? opcodes_dd[op] : opcodes_base[op];	/* 'mirrored' instructions */
+		dispatch_z80[DISPATCH_FD  ][op] = opcodes_fd[op] ? opcodes_fd[op] : opcodes_base[op];
+		dispatch_z80[DISPATCH_DDCB][op] = opcodes_ddcb[op];
+		dispatch_z80[DISPATCH_FDCB][op] = opcodes_fdcb[op];
 #ifdef Z80EX_Z180_SUPPORT
-						if (XEMU_UNLIKELY(z80ex.z180 && opcodes_ddfd_bad_for_z180[opcode])) {
-							ofn = trapping(z80ex.prefix, 0x00, opcode, ITC_B2);
-						} else {
+		const int ddcb_bad = ((op & 7) != 6 || op == 0x36);
+		dispatch_z180[DISPATCH_BASE][op] = opcodes_base[op];
+		dispatch_z180[DISPATCH_CB  ][op] = (op & 0xF8) == 0x30 ? NULL : opcodes_cb[op];
+		dispatch_z180[DISPATCH_ED  ][op] = opcodes_ed_z180[op];
+		dispatch_z180[DISPATCH_DD  ][op] = opcodes_ddfd_bad_for_z180[op] ? NULL : dispatch_z80[DISPATCH_DD][op];
+		dispatch_z180[DISPATCH_FD  ][op] = opcodes_ddfd_bad_for_z180[op] ? NULL : dispatch_z80[DISPATCH_FD][op];
+		dispatch_z180[DISPATCH_DDCB][op] = ddcb_bad ? NULL : opcodes_ddcb[op];
+		dispatch_z180[DISPATCH_FDCB][op] = ddcb_bad ? NULL : opcodes_fdcb[op];
 #endif
-							ofn = (z80ex.prefix == 0xDD) ? opcodes_dd[opcode] : opcodes_fd[opcode];
-							if (XEMU_UNLIKELY(ofn == NULL)) ofn = opcodes_base[opcode]; /* 'mirrored' instructions NOTE: this should NOT happen with Z180! */
+	}
+	SDL_AtomicSet(&dispatch_tables_ready, 1);	/* also a full memory barrier: the tables are complete before this */
+	SDL_AtomicUnlock(&dispatch_tables_lock);
+}
+
+
 #ifdef Z80EX_Z180_SUPPORT
-						}
+/* invalid opcode in Z180 mode, "table" is the dispatch table, where the opcode has a NULL entry */
+static z80ex_opcode_fn z180_invalid_opcode ( Z80EX_CONTEXT *cpu, int table, Z80EX_BYTE opcode )
+{
+	switch (table) {
+		case DISPATCH_CB:
+			return trapping(cpu, 0x00, 0xCB, opcode, ITC_B2);
+		case DISPATCH_ED:
+			return trapping(cpu, 0x00, 0xED, opcode, ITC_B2);
+		case DISPATCH_DD:
+		case DISPATCH_FD:
+			return trapping(cpu, cpu->prefix, 0x00, opcode, ITC_B2);
+		default:
+			return trapping(cpu, cpu->prefix, 0xCB, opcode, ITC_B3);
+	}
+}
 #endif
-					}
-					break;
 
-				case 0xED: /* ED opcodes */
+
+/* do one instruction: a prefixed instruction is done with a single call as well, only a redundant
+   DD/FD prefix (followed by another DD/FD/ED prefix) returns in the "middle", with z80ex_last_op_type() set */
+int z80ex_ctx_step ( Z80EX_CONTEXT *cpu )
+{
+	const z80ex_opcode_fn (*const tables)[0x100] = cpu->dispatch;
+	cpu->doing_opcode = 1;
+	cpu->tstate = 0;
+	for (;;) {
+		Z80EX_BYTE opcode;
+		int table;
+		cpu->noint_once = 0;
+		cpu->reset_PV_on_int = 0;
+		cpu->op_tstate = 0;
+		opcode = READ_OP_M1(); 		/* fetch opcode */
+		if (cpu->int_vector_req)
+		{
+			TSTATES(2); 		/* interrupt eats two extra wait-states */
+		}
+		R++;				/* R increased by one on every first M1 cycle */
+		T_WAIT_UNTIL(4);		/* M1 cycle eats min 4 t-states */
+		if (XEMU_LIKELY(!cpu->prefix)) {
+			tables[DISPATCH_BASE][opcode](cpu);
+			if (XEMU_LIKELY(!cpu->prefix))
+				break;
+			continue;	/* prefix opcode, continue with the prefixed opcode within this call */
+		}
+		switch (cpu->prefix) {
+			case 0xDD:
+			case 0xFD:
+				if ((opcode | 0x20) == 0xFD || opcode == 0xED) {
+					/* redundant prefix, return to the caller to avoid hanging on an endless chain of prefixes */
+					cpu->prefix = opcode;
+					cpu->noint_once = 1; /* interrupts are not accepted immediately after prefix */
+					cpu->doing_opcode = 0;
+					return cpu->tstate;
+				}
+				if (opcode == 0xCB) {	/* FD/DD prefixed CB opcodes */
+					const Z80EX_BYTE d = READ_OP(); /* displacement */
+					temp_byte_s = (d & 0x80)? -(((~d) & 0x7f)+1): d;
+					opcode = READ_OP();
+					table = (cpu->prefix == 0xDD) ? DISPATCH_DDCB : DISPATCH_FDCB;
+				} else
+					table = (cpu->prefix == 0xDD) ? DISPATCH_DD : DISPATCH_FD;
+				break;
+			case 0xED: /* ED opcodes */
 #ifdef Z80EX_ED_TRAPPING_SUPPORT
-					if (XEMU_UNLIKELY(opcode > 0xBB)) {
-						/* check if ED-trap emu func accepted the opcode as its own "faked" */
-						if (z80ex_ed_cb(opcode)) {
-							ofn = opcodes_base[0x00];
-							break;
-						}
+				if (XEMU_UNLIKELY(opcode > 0xBB)) {
+					/* check if ED-trap emu func accepted the opcode as its own "faked" */
+					if (CB_ED(opcode)) {
+						opcode = 0x00;
+						table = DISPATCH_BASE;
+						break;
 					}
+				}
 #endif
+				table = DISPATCH_ED;
+				break;
+			case 0xCB: /* CB opcodes */
+				table = DISPATCH_CB;
+				break;
+			default:
+				/* this must'nt happen! */
+				assert(0);
+				table = DISPATCH_BASE;
+				break;
+		}
+		z80ex_opcode_fn ofn = tables[table][opcode];
 #ifdef Z80EX_Z180_SUPPORT
-					if (Z180_LIKELY(z80ex.z180))
-						ofn = opcodes_ed_z180[opcode];
-					else
-#endif
-						ofn = opcodes_ed[opcode];
-					if (ofn == NULL) {
-#ifdef Z80EX_Z180_SUPPORT
-						if (XEMU_UNLIKELY(z80ex.z180))
-							ofn = trapping(0x00, 0xED, opcode, ITC_B2);
-						else
+		if (XEMU_UNLIKELY(!ofn))
+			ofn = z180_invalid_opcode(cpu, table, opcode);
 #endif
-							ofn = opcodes_base[0x00];
-					}
-					break;
+		ofn(cpu);
+		cpu->prefix = 0;
+		break;
+	}
+	cpu->doing_opcode = 0;
+	return cpu->tstate;
+}
 
-				case 0xCB: /* CB opcodes */
+
+/* do opcodes, until the given T-states budget is spent, or an event needs the attention of the caller */
+int z80ex_ctx_run ( Z80EX_CONTEXT *cpu, int budget )
+{
+	int t = 0;
+	cpu->run_break = 0;
+	do {
+		t += z80ex_ctx_step(cpu);
+		if (XEMU_UNLIKELY(cpu->run_break))
+			break;
+		/* the same conditions as z80ex_ctx_int() checks, to give the caller the chance to accept the interrupt */
+		if (XEMU_UNLIKELY(cpu->int_line && IFF1 && !cpu->noint_once && !cpu->prefix
 #ifdef Z80EX_Z180_SUPPORT
-					if (XEMU_UNLIKELY(z80ex.z180 && (opcode & 0xF8) == 0x30))
-						ofn = trapping(0x00, 0xCB, opcode, ITC_B2);
-					else
+			&& !cpu->internal_int_disable
 #endif
-						ofn = opcodes_cb[opcode];
-					break;
-
-				default:
-					/* this must'nt happen! */
-					assert(0);
-					break;
-			}
-
-			ofn();
-
-			z80ex.prefix = 0;
-		}
-	}
-
-	z80ex.doing_opcode = 0;
-	return z80ex.tstate;
+		))
+			break;
+	} while (t < budget);
+	return t;
 }
 
 
-void z80ex_reset ( void )
+void z80ex_ctx_reset ( Z80EX_CONTEXT *cpu )
 {
 	PC = 0x0000; IFF1 = IFF2 = 0; IM = IM0;
 	AF= SP = BC = DE = HL = IX = IY = AF_ = BC_ = DE_ = HL_ = 0xffff;
 	I = R = R7 = 0;
-	z80ex.noint_once = 0; z80ex.reset_PV_on_int = 0; z80ex.halted = 0;
-	z80ex.int_vector_req = 0;
-	z80ex.doing_opcode = 0;
-	z80ex.tstate = z80ex.op_tstate = 0;
-	z80ex.prefix = 0;
+	cpu->noint_once = 0; cpu->reset_PV_on_int = 0; cpu->halted = 0;
+	cpu->int_vector_req = 0;
+	cpu->doing_opcode = 0;
+	cpu->tstate = cpu->op_tstate = 0;
+	cpu->prefix = 0;
+	cpu->run_break = 0;
 #ifdef Z80EX_Z180_SUPPORT
-	z80ex.internal_int_disable = 0;
+	cpu->internal_int_disable = 0;
 #endif
 }
 
@@ -172,34 +224,48 @@ void z80ex_reset ( void )
 
 
 /**/
-void z80ex_init ( void )
+void z80ex_ctx_init ( Z80EX_CONTEXT *cpu )
 {
-	memset(&z80ex, 0x00, sizeof(Z80EX_CONTEXT));
+	memset(cpu, 0x00, sizeof(Z80EX_CONTEXT));
 
-	z80ex_reset();
+	z80ex_ctx_reset(cpu);
 
-	z80ex.nmos = 1;
+	cpu->nmos = 1;
 #ifdef Z80EX_HAVE_TSTATE_CB_VAR
-	z80ex.tstate_cb = 0;
+	cpu->tstate_cb = 0;
+#endif
+#ifdef Z80EX_Z180_SUPPORT
+	cpu->internal_int_disable = 0;
 #endif
+	build_dispatch_tables();
 #ifdef Z80EX_Z180_SUPPORT
-	z80ex.internal_int_disable = 0;
-	z80ex.z180 = 0;
+	z80ex_ctx_set_z180(cpu, 0);
+#else
+	cpu->dispatch = (const z80ex_opcode_fn (*)[0x100])dispatch_z80;
 #endif
 }
 
+
+#ifdef Z80EX_Z180_SUPPORT
+void z80ex_ctx_set_z180 ( Z80EX_CONTEXT *cpu, int z180 )
+{
+	cpu->z180 = z180;
+	cpu->dispatch = (const z80ex_opcode_fn (*)[0x100])(z180 ? dispatch_z180 : dispatch_z80);
+}
+#endif
+
 /*non-maskable interrupt*/
-int z80ex_nmi(void)
+int z80ex_ctx_nmi ( Z80EX_CONTEXT *cpu )
 {
-	if (z80ex.doing_opcode || z80ex.noint_once || z80ex.prefix) return 0;
+	if (cpu->doing_opcode || cpu->noint_once || cpu->prefix) return 0;
 
-	if (z80ex.halted) {
+	if (cpu->halted) {
 		/*so we met an interrupt... stop waiting*/
 		PC++;
-		z80ex.halted = 0;
+		cpu->halted = 0;
 	}
 
-	z80ex.doing_opcode = 1;
+	cpu->doing_opcode = 1;
 
 	R++; /* accepting interrupt increases R by one */
 	/*IFF2=IFF1;*/ /* contrary to zilog z80 docs, IFF2 is not modified on NMI. proved by Slava Tretiak aka restorer */
@@ -207,22 +273,22 @@ int z80ex_nmi(void)
 
 	TSTATES(5);
 
-	z80ex_mwrite_cb(--SP, z80ex.pc.b.h); /* PUSH PC -- high byte */
+	CB_MWRITE(--SP, cpu->pc.b.h); /* PUSH PC -- high byte */
 	TSTATES(3);
 
-	z80ex_mwrite_cb(--SP, z80ex.pc.b.l); /* PUSH PC -- low byte */
+	CB_MWRITE(--SP, cpu->pc.b.l); /* PUSH PC -- low byte */
 	TSTATES(3);
 
 	PC = 0x0066;
 	MEMPTR = PC; /* FIXME: is that really so? */
 
-	z80ex.doing_opcode = 0;
+	cpu->doing_opcode = 0;
 
 	return 11; /* NMI always takes 11 t-states */
 }
 
 /*maskable interrupt*/
-int z80ex_int(void)
+int z80ex_ctx_int ( Z80EX_CONTEXT *cpu )
 {
 	Z80EX_WORD inttemp;
 	Z80EX_BYTE iv;
@@ -232,19 +298,19 @@ int z80ex_int(void)
 	a maskable interrupt is accepted, whether or not the
 	last INT routine has finished */
 	if (
-		!IFF1 || z80ex.noint_once || z80ex.doing_opcode || z80ex.prefix
+		!IFF1 || cpu->noint_once || cpu->doing_opcode || cpu->prefix
 #ifdef Z80EX_Z180_SUPPORT
-		|| z80ex.internal_int_disable
+		|| cpu->internal_int_disable
 #endif
 	) return 0;
 
-	z80ex.tstate = 0;
-	z80ex.op_tstate = 0;
+	cpu->tstate = 0;
+	cpu->op_tstate = 0;
 
-	if (z80ex.halted) {
+	if (cpu->halted) {
 		/* so we met an interrupt... stop waiting */
 		PC++;
-		z80ex.halted = 0;
+		cpu->halted = 0;
 	}
 
 	/* When an INT is accepted, both IFF1 and IFF2 are cleared, preventing another interrupt from
@@ -254,22 +320,22 @@ int z80ex_int(void)
 	/* original (NMOS) zilog z80 bug: */
 	/* If a LD A,I or LD A,R (which copy IFF2 to the P/V flag) is interrupted, then the P/V flag is reset, even if interrupts were enabled beforehand. */
 	/* (this bug was fixed in CMOS version of z80) */
-	if (z80ex.reset_PV_on_int) {
+	if (cpu->reset_PV_on_int) {
 		F = (F & ~FLAG_P);
 	}
-	z80ex.reset_PV_on_int = 0;
+	cpu->reset_PV_on_int = 0;
 
-	z80ex.int_vector_req = 1;
-	z80ex.doing_opcode = 1;
+	cpu->int_vector_req = 1;
+	cpu->doing_opcode = 1;
 
 	switch (IM) {
 		case IM0:
 			/* note: there's no need to do R++ and WAITs here, it'll be handled by z80ex_step */
-			tt = z80ex_step();
-			while(z80ex.prefix) { /* this is not the end? */
-				tt+=z80ex_step();
+			tt = z80ex_ctx_step(cpu);
+			while(cpu->prefix) { /* this is not the end? */
+				tt+=z80ex_ctx_step(cpu);
 			}
-			z80ex.tstate = tt;
+			cpu->tstate = tt;
 			break;
 
 		case IM1:
@@ -277,7 +343,7 @@ int z80ex_int(void)
 			TSTATES(2); /* two extra wait-states */
 			/* An RST 38h is executed, no matter what value is put on the bus or what
 			value the I register has. 13 t-states (2 extra + 11 for RST). */
-			opcodes_base[0xff](); /* RST 38 */
+			opcodes_base[0xff](cpu); /* RST 38 */
 			break;
 
 		case IM2:
@@ -298,40 +364,36 @@ int z80ex_int(void)
 			break;
 	}
 
-	z80ex.doing_opcode = 0;
-	z80ex.int_vector_req = 0;
+	cpu->doing_opcode = 0;
+	cpu->int_vector_req = 0;
 
-	return z80ex.tstate;
+	return cpu->tstate;
 }
 
-void z80ex_w_states(unsigned w_states)
+void z80ex_ctx_w_states ( Z80EX_CONTEXT *cpu, unsigned w_states )
 {
 	TSTATES(w_states);
 }
 
-void z80ex_next_t_state(void)
+void z80ex_ctx_next_t_state ( Z80EX_CONTEXT *cpu )
 {
 #ifdef Z80EX_TSTATE_CALLBACK
-	if (IS_TSTATE_CB) z80ex_tstate_cb();
+	if (IS_TSTATE_CB) CB_TSTATE();
 #endif
-	z80ex.tstate++;
-	z80ex.op_tstate++;
+	cpu->tstate++;
+	cpu->op_tstate++;
 }
 
-/*int z80ex_get_noint_once(Z80EX_CONTEXT *cpu)
-{
-	return z80ex.noint_once;
-}*/
 
 /*returns 1 if maskable interrupts are possible in current z80 state*/
-int z80ex_int_possible(void)
+int z80ex_ctx_int_possible ( Z80EX_CONTEXT *cpu )
 {
-        return ((!IFF1 || z80ex.noint_once || z80ex.doing_opcode || z80ex.prefix) ? 0 : 1);
+        return ((!IFF1 || cpu->noint_once || cpu->doing_opcode || cpu->prefix) ? 0 : 1);
 }
 
 /*returns 1 if non-maskable interrupts are possible in current z80 state*/
-int z80ex_nmi_possible(void)
+int z80ex_ctx_nmi_possible ( Z80EX_CONTEXT *cpu )
 {
-        return ((z80ex.noint_once || z80ex.doing_opcode || z80ex.prefix) ? 0 : 1);
+        return ((cpu->noint_once || cpu->doing_opcode || cpu->prefix) ? 0 : 1);
 }
 
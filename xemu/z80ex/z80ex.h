@@ -20,7 +20,7 @@
 #	define IS_TSTATE_CB 1
 #	define Z80EX_TSTATE_CALLBACK
 #else
-#	define IS_TSTATE_CB z80ex.tstate_cb
+#	define IS_TSTATE_CB cpu->tstate_cb
 #	ifdef Z80EX_TSTATE_CALLBACK
 #		define Z80EX_HAVE_TSTATE_CB_VAR
 #	endif
@@ -140,6 +140,34 @@ typedef enum { IM0 = 0, IM1 = 1, IM2 = 2 } IM_MODE;
 #define Z80_FLAG_Z	0x40
 #define Z80_FLAG_S	0x80
 
+struct _z80_cpu_context;
+
+/* opcode implementation functions of the core */
+typedef void (*z80ex_opcode_fn) ( struct _z80_cpu_context *cpu );
+
+#ifdef Z80EX_CONTEXT_CALLBACKS
+/* Callback table used by a context (see "cb" in the context), if Z80EX_CONTEXT_CALLBACKS is defined.
+   The same table can be shared by many contexts, the context itself is passed to all callbacks.
+   Without Z80EX_CONTEXT_CALLBACKS, the statically linked callbacks (z80ex_mread_cb() and so on) are used. */
+typedef struct {
+	Z80EX_BYTE (*mread)   ( struct _z80_cpu_context *cpu, Z80EX_WORD addr, int m1_state );
+	void       (*mwrite)  ( struct _z80_cpu_context *cpu, Z80EX_WORD addr, Z80EX_BYTE value );
+	Z80EX_BYTE (*pread)   ( struct _z80_cpu_context *cpu, Z80EX_WORD port );
+	void       (*pwrite)  ( struct _z80_cpu_context *cpu, Z80EX_WORD port, Z80EX_BYTE value );
+	Z80EX_BYTE (*intread) ( struct _z80_cpu_context *cpu );
+	void       (*reti)    ( struct _z80_cpu_context *cpu );
+#ifdef Z80EX_TSTATE_CALLBACK
+	void       (*tstate)  ( struct _z80_cpu_context *cpu );
+#endif
+#ifdef Z80EX_ED_TRAPPING_SUPPORT
+	int        (*ed)      ( struct _z80_cpu_context *cpu, Z80EX_BYTE opcode );
+#endif
+#ifdef Z80EX_Z180_SUPPORT
+	void       (*z180)    ( struct _z80_cpu_context *cpu, Z80EX_WORD pc, Z80EX_BYTE prefix, Z80EX_BYTE series, Z80EX_BYTE opcode, Z80EX_BYTE itc76 );
+#endif
+} Z80EX_CALLBACKS;
+#endif
+
 struct _z80_cpu_context {
 	Z80EX_REGPAIR_T af,bc,de,hl;
 	Z80EX_REGPAIR_T af_,bc_,de_,hl_;
@@ -159,6 +187,8 @@ struct _z80_cpu_context {
 	int noint_once; /*disable interrupts before next opcode?*/
 	int reset_PV_on_int; /*reset P/V flag on interrupt? (for LD A,R / LD A,I)*/
 	int doing_opcode; /*is there an opcode currently executing?*/
+	int int_line; /*INT line state for z80ex_ctx_run(), set by the user: run returns when a maskable interrupt could be accepted*/
+	int run_break; /*if set (ie, by a callback) z80ex_ctx_run() returns after the current opcode*/
 	char int_vector_req; /*opcode must be fetched from IO device? (int vector read)*/
 	Z80EX_BYTE prefix;
 
@@ -175,18 +205,25 @@ struct _z80_cpu_context {
 	int nmos; /* NMOS Z80 mode if '1', CMOS if '0' */
 	/* Z180 related - LGB */
 #ifdef Z80EX_Z180_SUPPORT
-	int z180;
+	int z180;	/* do not modify directly, use z80ex_ctx_set_z180() */
 	int internal_int_disable;
+#endif
+	const z80ex_opcode_fn (*dispatch)[0x100];	/* dispatch tables for the selected CPU type (Z80 or Z180) */
+#ifdef Z80EX_CONTEXT_CALLBACKS
+	const Z80EX_CALLBACKS *cb;	/* must be set by the user after z80ex_ctx_init() */
+	void *user_data;		/* not used by z80ex, free for the user (ie, the callbacks) */
 #endif
 };
 
 typedef struct _z80_cpu_context Z80EX_CONTEXT;
 
+/* The "global" CPU instance, used by the z80ex_*() API without the "ctx" in its name.
+   That API is only a wrapper around z80ex_ctx_*() functions, which can work on any number of contexts. */
 extern Z80EX_CONTEXT z80ex;
 
 /* statically linked callbacks */
 
-#ifdef Z80EX_CALLBACK_PROTOTYPE
+#if defined(Z80EX_CALLBACK_PROTOTYPE) && !defined(Z80EX_CONTEXT_CALLBACKS)
 #ifdef Z80EX_TSTATE_CALLBACK
 Z80EX_CALLBACK_PROTOTYPE void z80ex_tstate_cb ( void );
 #endif
@@ -204,50 +241,91 @@ Z80EX_CALLBACK_PROTOTYPE void z80ex_z180_cb (Z80EX_WORD pc, Z80EX_BYTE prefix, Z
 #endif
 #endif
 
+/* ---- API working on a given context ---- */
+
+/*initialize CPU context*/
+extern void z80ex_ctx_init ( Z80EX_CONTEXT *cpu );
+/*reset CPU*/
+extern void z80ex_ctx_reset ( Z80EX_CONTEXT *cpu );
+#ifdef Z80EX_Z180_SUPPORT
+/*select Z180 (non-zero) or Z80 mode*/
+extern void z80ex_ctx_set_z180 ( Z80EX_CONTEXT *cpu, int z180 );
+#endif
+/*do next instruction (a prefixed one as a whole), return number of T-states. Only a redundant DD/FD prefix
+(followed by another DD/FD/ED prefix) returns before the instruction is done, see z80ex_last_op_type()*/
+extern int  z80ex_ctx_step ( Z80EX_CONTEXT *cpu );
+/*do opcodes until at least <budget> T-states are spent, or the run is interrupted by run_break or
+int_line (see the context structure), returns the number of T-states spent*/
+extern int  z80ex_ctx_run ( Z80EX_CONTEXT *cpu, int budget );
+/*maskable interrupt, returns number of T-states if interrupt was accepted, otherwise 0*/
+extern int  z80ex_ctx_int ( Z80EX_CONTEXT *cpu );
+/*non-maskable interrupt, returns number of T-states (11 if interrupt was accepted, or 0 if processor is doing an instruction right now)*/
+extern int  z80ex_ctx_nmi ( Z80EX_CONTEXT *cpu );
+/*generate <w_states> Wait-states, see z80ex_w_states()*/
+extern void z80ex_ctx_w_states ( Z80EX_CONTEXT *cpu, unsigned w_states );
+/*spend one T-state doing nothing, see z80ex_next_t_state()*/
+extern void z80ex_ctx_next_t_state ( Z80EX_CONTEXT *cpu );
+/*returns 1 if maskable interrupts are possible in current z80 state*/
+extern int  z80ex_ctx_int_possible ( Z80EX_CONTEXT *cpu );
+/*returns 1 if non-maskable interrupts are possible in current z80 state*/
+extern int  z80ex_ctx_nmi_possible ( Z80EX_CONTEXT *cpu );
+
+/* ---- API working on the global "z80ex" context ---- */
+
 /*create and initialize CPU*/
-extern void z80ex_init(void);
+static inline void z80ex_init ( void ) { z80ex_ctx_init(&z80ex); }
+
+/*do next instruction (a prefixed one as a whole), return number of T-states*/
+static inline int z80ex_step ( void ) { return z80ex_ctx_step(&z80ex); }
+
+/*do opcodes until <budget> T-states are spent or an event stops the run, return number of T-states*/
+static inline int z80ex_run ( int budget ) { return z80ex_ctx_run(&z80ex, budget); }
 
-/*do next opcode (instruction or prefix), return number of T-states*/
-extern int z80ex_step(void);
+/*to be used from callbacks: z80ex_run() should return after the current opcode, since an event needs attention*/
+static inline void z80ex_run_break ( void ) { z80ex.run_break = 1; }
 
 /*returns type of the last opcode, processed with z80ex_step.
-type will be 0 for complete instruction, or dd/fd/cb/ed for opcode prefix.*/
+type will be 0 for complete instruction, or dd/fd/ed if z80ex_step() returned after a redundant dd/fd prefix,
+and the instruction continues with this prefix on the next call. It's never cb.*/
 #define z80ex_last_op_type() z80ex.prefix
 
 /*maskable interrupt*/
 /*returns number of T-states if interrupt was accepted, otherwise 0*/
-extern int z80ex_int();
+static inline int z80ex_int ( void ) { return z80ex_ctx_int(&z80ex); }
 
 /*non-maskable interrupt*/
 /*returns number of T-states (11 if interrupt was accepted, or 0 if processor
 is doing an instruction right now)*/
-extern int z80ex_nmi();
+static inline int z80ex_nmi ( void ) { return z80ex_ctx_nmi(&z80ex); }
 
 /*reset CPU*/
-extern void z80ex_reset(void);
+static inline void z80ex_reset ( void ) { z80ex_ctx_reset(&z80ex); }
 
-extern void z80ex_init(void);
+#ifdef Z80EX_Z180_SUPPORT
+/*select Z180 (non-zero) or Z80 mode*/
+static inline void z80ex_set_z180 ( int z180 ) { z80ex_ctx_set_z180(&z80ex, z180); }
+#endif
 
 /*returns 1 if CPU doing HALT instruction now*/
 #define z80ex_doing_halt() z80ex.halted
 
-/*when called from callbacks, returns current T-state of the executing opcode (instruction or prefix),
-else returns T-states taken by last opcode executed*/
+/*when called from callbacks, returns current T-state of the executing instruction (counted with its prefixes),
+else returns T-states taken by last instruction executed*/
 #define z80ex_op_tstate() z80ex.tstate
 
 /*generate <w_states> Wait-states. (T-state callback will be called <w_states> times, when defined).
 should be used to simulate WAIT signal or disabled CLK*/
-extern void z80ex_w_states(unsigned w_states);
+static inline void z80ex_w_states ( unsigned w_states ) { z80ex_ctx_w_states(&z80ex, w_states); }
 
 /*spend one T-state doing nothing (often IO devices cannot handle data request on
 the first T-state at which RD/WR goes active).
 for I/O callbacks*/
-extern void z80ex_next_t_state();
+static inline void z80ex_next_t_state ( void ) { z80ex_ctx_next_t_state(&z80ex); }
 
 /*returns 1 if maskable interrupts are possible in current z80 state*/
-extern int z80ex_int_possible(void);
+static inline int z80ex_int_possible ( void ) { return z80ex_ctx_int_possible(&z80ex); }
 
 /*returns 1 if non-maskable interrupts are possible in current z80 state*/
-extern int z80ex_nmi_possible(void);
+static inline int z80ex_nmi_possible ( void ) { return z80ex_ctx_nmi_possible(&z80ex); }
 
 #endif